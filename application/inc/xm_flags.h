@@ -28,6 +28,21 @@
 #ifndef LVRM_RLST_FORCED_HARDWARE
 //#define LVRM_MODE_BMS
 #endif
+#ifdef LVRM_MODE_BMS
+#define LVRM_BMS_MONITORING_PERIOD_MIN_SECONDS  10
+#define LVRM_BMS_MONITORING_PERIOD_MAX_SECONDS  300
+#define LVRM_BMS_MONITORING_MARGIN_MV           500
+#define LVRM_BMS_SOC_PERIOD_SECONDS             30
+#define LVRM_BMS_SOC_REST_CURRENT_UA            20000
+#define LVRM_BMS_SOC_REST_DURATION_SECONDS      1800
+#ifdef XM_NVM_FACTORY_RESET
+#define LVRM_BMS_SOC_MODE                       0
+#define LVRM_BMS_SOC_LOW_THRESHOLD_PERCENT      30
+#define LVRM_BMS_SOC_HIGH_THRESHOLD_PERCENT     60
+#define LVRM_BATTERY_CHEMISTRY                  LVRM_BATTERY_CHEMISTRY_LEAD_ACID
+#define LVRM_BATTERY_CAPACITY_MAH               100000
+#endif
+#endif
 #endif
 
 #ifdef BPSM
@@ -45,14 +60,30 @@
 //#define DDRM_DDEN_FORCED_HARDWARE
 #endif
 
+#ifdef UHFM
+#define UHFM_STATISTICS_SAVE_PERIOD_SECONDS 3600
+#endif
+
 #ifdef GPSM
 #define GPSM_ACTIVE_ANTENNA
 //#define GPSM_BKEN_FORCED_HARDWARE
+#define GPSM_UBX_PROTOCOL
+#define GPSM_GPS_UART_DMA
 #ifdef XM_NVM_FACTORY_RESET
 #define GPSM_TIME_TIMEOUT_SECONDS           120
 #define GPSM_GEOLOC_TIMEOUT_SECONDS         180
 #define GPSM_TIMEPULSE_FREQUENCY_HZ         10000000
 #define GPSM_TIMEPULSE_DUTY_CYCLE           50
+#define GPSM_HOT_START_WINDOW_SECONDS       7200
+#define GPSM_WARM_START_WINDOW_SECONDS      604800
+#define GPSM_TRACKING_PERIOD_SECONDS        600
+#define GPSM_DISCIPLINE_WINDOW_SECONDS      64
+#define GPSM_PSM_UPDATE_PERIOD_SECONDS      10
+#define GPSM_PSM_SEARCH_PERIOD_SECONDS      60
+#define GPSM_FIX_GATE_ACCURACY_DM           100
+#define GPSM_FIX_GATE_PDOP                  50
+#define GPSM_FIX_GATE_SATELLITES            5
+#define GPSM_FIX_AVERAGING_DEPTH            1
 #endif
 #endif
 
@@ -60,15 +91,44 @@
 #define SM_AIN_ENABLE
 #define SM_DIO_ENABLE
 #define SM_DIGITAL_SENSORS_ENABLE
+#define SM_LOGGER_ENABLE
 #ifdef SM_AIN_ENABLE
+#define SM_AIN0_INPUT_TYPE                  ANALOG_INPUT_TYPE_VOLTAGE
 #define SM_AIN0_GAIN_TYPE                   ANALOG_GAIN_TYPE_ATTENUATION
 #define SM_AIN0_GAIN                        1
+#define SM_AIN0_FILTER_DECIMATION_RATIO     1
+#define SM_AIN0_FILTER_IIR_SHIFT            0
+#define SM_AIN1_INPUT_TYPE                  ANALOG_INPUT_TYPE_VOLTAGE
 #define SM_AIN1_GAIN_TYPE                   ANALOG_GAIN_TYPE_ATTENUATION
 #define SM_AIN1_GAIN                        1
+#define SM_AIN1_FILTER_DECIMATION_RATIO     1
+#define SM_AIN1_FILTER_IIR_SHIFT            0
+#define SM_AIN2_INPUT_TYPE                  ANALOG_INPUT_TYPE_VOLTAGE
 #define SM_AIN2_GAIN_TYPE                   ANALOG_GAIN_TYPE_ATTENUATION
 #define SM_AIN2_GAIN                        1
+#define SM_AIN2_FILTER_DECIMATION_RATIO     1
+#define SM_AIN2_FILTER_IIR_SHIFT            0
+#define SM_AIN3_INPUT_TYPE                  ANALOG_INPUT_TYPE_VOLTAGE
 #define SM_AIN3_GAIN_TYPE                   ANALOG_GAIN_TYPE_ATTENUATION
 #define SM_AIN3_GAIN                        1
+#define SM_AIN3_FILTER_DECIMATION_RATIO     1
+#define SM_AIN3_FILTER_IIR_SHIFT            0
+#define SM_AIN_FILTER_SAMPLE_PERIOD_SECONDS 1
+#endif
+#ifdef SM_DIO_ENABLE
+#define SM_DIO_COUNTER_SAVE_PERIOD_SECONDS  3600
+#endif
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+#define SM_SENSORS_PERIODIC_RATE            SHT3X_PERIODIC_RATE_0_5_MPS
+#define SM_SENSORS_ALERT_THIGH_DEGREES      60
+#define SM_SENSORS_ALERT_TLOW_DEGREES       (-20)
+#define SM_SENSORS_ALERT_HHIGH_PERCENT      90
+#define SM_SENSORS_ALERT_HLOW_PERCENT       10
+#define SM_SENSORS_ALERT_HYSTERESIS_DEGREES 2
+#define SM_SENSORS_ALERT_HYSTERESIS_PERCENT 5
+#endif
+#ifdef SM_LOGGER_ENABLE
+#define SM_LOGGER_NVM_SIZE_BYTES            512
 #endif
 #endif
 
@@ -87,5 +147,8 @@
 #if ((defined XM_IOUT_INDICATOR) || (defined GPSM))
 #define XM_RGB_LED
 #endif
+#if ((defined GPSM) || (defined SM))
+#define XM_TIMEBASE
+#endif
 
 #endif /* __XM_FLAGS_H__ */
@@ -16,6 +16,7 @@
 #include "pwr.h"
 #include "rcc.h"
 #include "rtc.h"
+#include "timebase.h"
 #include "types.h"
 // Utils.
 #include "error.h"
@@ -67,6 +68,9 @@ static void _XM_init_hw(void) {
     // Init RTC.
     rtc_status = RTC_init(NULL, NVIC_PRIORITY_RTC);
     RTC_stack_error(ERROR_BASE_RTC);
+#ifdef XM_TIMEBASE
+    TIMEBASE_init();
+#endif
     // Init delay timer.
     LPTIM_init(NVIC_PRIORITY_DELAY);
     // Init components.
@@ -92,11 +96,16 @@ int main(void) {
         IWDG_reload();
 #ifndef XM_DEBUG
         // Enter sleep or stop mode depending on node state.
-        if (NODE_get_state() == NODE_STATE_IDLE) {
+        switch (NODE_get_state()) {
+        case NODE_STATE_IDLE:
             PWR_enter_stop_mode();
-        }
-        else {
+            break;
+        case NODE_STATE_RUNNING:
             PWR_enter_sleep_mode();
+            break;
+        default:
+            // Pending steps are processed without waiting for the next wake-up.
+            break;
         }
         IWDG_reload();
 #endif
@@ -8,7 +8,7 @@
 #ifndef __LOAD_H__
 #define __LOAD_H__
 
-#include "lptim.h"
+#include "tim.h"
 #include "types.h"
 #include "xm_flags.h"
 
@@ -23,9 +23,9 @@ typedef enum {
     LOAD_SUCCESS = 0,
     LOAD_ERROR_STATE,
     // Low level drivers errors.
-    LOAD_ERROR_BASE_LPTIM = 0x0100,
+    LOAD_ERROR_BASE_TIM = 0x0100,
     // Last base value.
-    LOAD_ERROR_BASE_LAST = (LOAD_ERROR_BASE_LPTIM + LPTIM_ERROR_BASE_LAST)
+    LOAD_ERROR_BASE_LAST = (LOAD_ERROR_BASE_TIM + TIM_ERROR_BASE_LAST)
 } LOAD_status_t;
 
 #ifdef XM_LOAD_CONTROL
@@ -47,6 +47,8 @@ void LOAD_init(void);
  * \param[in]   state: New state to set.
  * \param[out]  none
  * \retval      Function execution status.
+ * \note        On LVRM HW2.0, the bistable relay sequence is only started and then driven by the LOAD_process() function.
+ * \note        A request received during a switching sequence is queued and executed at the end of the sequence.
  *******************************************************************/
 LOAD_status_t LOAD_set_output_state(uint8_t state);
 
@@ -59,6 +61,35 @@ LOAD_status_t LOAD_set_output_state(uint8_t state);
  *******************************************************************/
 uint8_t LOAD_get_output_state(void);
 
+#if (defined LVRM) && (defined HW2_0)
+/*!******************************************************************
+ * \fn LOAD_status_t LOAD_process(uint8_t* sequence_done)
+ * \brief Bistable relay switching sequence task.
+ * \param[in]   none
+ * \param[out]  sequence_done: Pointer to byte that will contain 1 if a switching sequence has just completed, 0 otherwise.
+ * \retval      Function execution status.
+ *******************************************************************/
+LOAD_status_t LOAD_process(uint8_t* sequence_done);
+
+/*!******************************************************************
+ * \fn uint8_t LOAD_is_switching(void)
+ * \brief Check if a relay switching sequence is in progress.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      1 if the relay is switching, 0 otherwise.
+ *******************************************************************/
+uint8_t LOAD_is_switching(void);
+
+/*!******************************************************************
+ * \fn uint8_t LOAD_is_request_pending(void)
+ * \brief Check if a relay request is queued.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      1 if a request is waiting for the end of the current sequence, 0 otherwise.
+ *******************************************************************/
+uint8_t LOAD_is_request_pending(void);
+#endif
+
 #ifdef BPSM
 /*!******************************************************************
  * \fn void LOAD_set_charge_state(uint8_t state)
@@ -8,8 +8,10 @@
 #ifndef __NEOM8X_DRIVER_FLAGS_H__
 #define __NEOM8X_DRIVER_FLAGS_H__
 
+#include "dma.h"
 #include "lptim.h"
 #include "usart.h"
+#include "xm_flags.h"
 
 /*** NEOM8x driver compilation flags ***/
 
@@ -18,7 +20,12 @@
 #endif
 
 #define NEOM8X_DRIVER_GPIO_ERROR_BASE_LAST              0
+#ifdef GPSM_GPS_UART_DMA
+// DMA errors are reported in the UART error base.
+#define NEOM8X_DRIVER_UART_ERROR_BASE_LAST              (USART_ERROR_BASE_LAST + DMA_ERROR_BASE_LAST)
+#else
 #define NEOM8X_DRIVER_UART_ERROR_BASE_LAST              USART_ERROR_BASE_LAST
+#endif
 #define NEOM8X_DRIVER_DELAY_ERROR_BASE_LAST             LPTIM_ERROR_BASE_LAST
 
 #define NEOM8X_DRIVER_GPS_DATA_TIME
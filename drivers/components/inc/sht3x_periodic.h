@@ -0,0 +1,140 @@
+/*
+ * sht3x_periodic.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SHT3X_PERIODIC_H__
+#define __SHT3X_PERIODIC_H__
+
+#include "sht3x.h"
+#include "types.h"
+
+/*** SHT3X PERIODIC structures ***/
+
+/*!******************************************************************
+ * \enum SHT3X_PERIODIC_status_t
+ * \brief SHT3X periodic mode driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    SHT3X_PERIODIC_SUCCESS = 0,
+    SHT3X_PERIODIC_ERROR_NULL_PARAMETER,
+    SHT3X_PERIODIC_ERROR_RATE,
+    SHT3X_PERIODIC_ERROR_CRC,
+    // Low level drivers errors.
+    SHT3X_PERIODIC_ERROR_BASE_SHT3X = 0x0100,
+    // Last base value.
+    SHT3X_PERIODIC_ERROR_BASE_LAST = (SHT3X_PERIODIC_ERROR_BASE_SHT3X + SHT3X_ERROR_BASE_LAST)
+} SHT3X_PERIODIC_status_t;
+
+#ifdef SM
+
+/*!******************************************************************
+ * \enum SHT3X_PERIODIC_rate_t
+ * \brief SHT3X low repeatability periodic measurement rates.
+ *******************************************************************/
+typedef enum {
+    SHT3X_PERIODIC_RATE_0_5_MPS = 0,
+    SHT3X_PERIODIC_RATE_1_MPS,
+    SHT3X_PERIODIC_RATE_2_MPS,
+    SHT3X_PERIODIC_RATE_4_MPS,
+    SHT3X_PERIODIC_RATE_10_MPS,
+    SHT3X_PERIODIC_RATE_LAST
+} SHT3X_PERIODIC_rate_t;
+
+/*!******************************************************************
+ * \struct SHT3X_PERIODIC_alert_limits_t
+ * \brief SHT3X alert thresholds.
+ *******************************************************************/
+typedef struct {
+    int32_t temperature_high_degrees;
+    int32_t temperature_low_degrees;
+    int32_t temperature_hysteresis_degrees;
+    int32_t humidity_high_percent;
+    int32_t humidity_low_percent;
+    int32_t humidity_hysteresis_percent;
+} SHT3X_PERIODIC_alert_limits_t;
+
+/*!******************************************************************
+ * \struct SHT3X_PERIODIC_alert_status_t
+ * \brief SHT3X alert tracking flags.
+ *******************************************************************/
+typedef struct {
+    uint8_t temperature_alert;
+    uint8_t humidity_alert;
+} SHT3X_PERIODIC_alert_status_t;
+
+/*** SHT3X PERIODIC functions ***/
+
+/*!******************************************************************
+ * \fn SHT3X_PERIODIC_status_t SHT3X_PERIODIC_set_alert_limits(uint8_t i2c_address, SHT3X_PERIODIC_alert_limits_t* limits)
+ * \brief Program the alert set and clear thresholds of the sensor.
+ * \param[in]   i2c_address: 7-bits sensor address.
+ * \param[in]   limits: Pointer to the thresholds, clear values are computed with the hysteresis.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_set_alert_limits(uint8_t i2c_address, SHT3X_PERIODIC_alert_limits_t* limits);
+
+/*!******************************************************************
+ * \fn SHT3X_PERIODIC_status_t SHT3X_PERIODIC_start(uint8_t i2c_address, SHT3X_PERIODIC_rate_t rate)
+ * \brief Start low repeatability periodic measurements.
+ * \param[in]   i2c_address: 7-bits sensor address.
+ * \param[in]   rate: Number of measurements per second.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_start(uint8_t i2c_address, SHT3X_PERIODIC_rate_t rate);
+
+/*!******************************************************************
+ * \fn SHT3X_PERIODIC_status_t SHT3X_PERIODIC_stop(uint8_t i2c_address)
+ * \brief Stop periodic measurements and go back to single shot mode.
+ * \param[in]   i2c_address: 7-bits sensor address.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_stop(uint8_t i2c_address);
+
+/*!******************************************************************
+ * \fn SHT3X_PERIODIC_status_t SHT3X_PERIODIC_read(uint8_t i2c_address, int32_t* temperature_degrees, int32_t* humidity_percent)
+ * \brief Fetch the last periodic measurement.
+ * \param[in]   i2c_address: 7-bits sensor address.
+ * \param[out]  temperature_degrees: Pointer to the temperature in degrees.
+ * \param[out]  humidity_percent: Pointer to the relative humidity in percent.
+ * \retval      Function execution status.
+ * \note        The sensor does not acknowledge the read request if no new measurement is available since the last fetch.
+ *******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_read(uint8_t i2c_address, int32_t* temperature_degrees, int32_t* humidity_percent);
+
+/*!******************************************************************
+ * \fn SHT3X_PERIODIC_status_t SHT3X_PERIODIC_probe(uint8_t i2c_address)
+ * \brief Check if a SHT3x sensor is present at the given address.
+ * \param[in]   i2c_address: 7-bits sensor address.
+ * \param[out]  none
+ * \retval      Function execution status, success if the sensor answered with a valid status register.
+ *******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_probe(uint8_t i2c_address);
+
+/*!******************************************************************
+ * \fn SHT3X_PERIODIC_status_t SHT3X_PERIODIC_get_alert_status(uint8_t i2c_address, SHT3X_PERIODIC_alert_status_t* alert_status)
+ * \brief Read the alert tracking flags from the status register.
+ * \param[in]   i2c_address: 7-bits sensor address.
+ * \param[out]  alert_status: Pointer to the current alert flags.
+ * \retval      Function execution status.
+ *******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_get_alert_status(uint8_t i2c_address, SHT3X_PERIODIC_alert_status_t* alert_status);
+
+/*******************************************************************/
+#define SHT3X_PERIODIC_exit_error(base) { ERROR_check_exit(sht3x_periodic_status, SHT3X_PERIODIC_SUCCESS, base) }
+
+/*******************************************************************/
+#define SHT3X_PERIODIC_stack_error(base) { ERROR_check_stack(sht3x_periodic_status, SHT3X_PERIODIC_SUCCESS, base) }
+
+/*******************************************************************/
+#define SHT3X_PERIODIC_stack_exit_error(base, code) { ERROR_check_stack_exit(sht3x_periodic_status, SHT3X_PERIODIC_SUCCESS, base, code) }
+
+#endif /* SM */
+
+#endif /* __SHT3X_PERIODIC_H__ */
@@ -0,0 +1,232 @@
+/*
+ * ubx.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UBX_H__
+#define __UBX_H__
+
+#include "neom8x.h"
+#include "types.h"
+#include "xm_flags.h"
+
+/*** UBX structures ***/
+
+/*!******************************************************************
+ * \enum UBX_status_t
+ * \brief UBX protocol driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UBX_SUCCESS = 0,
+    UBX_ERROR_NULL_PARAMETER,
+    UBX_ERROR_MESSAGE,
+    UBX_ERROR_STATE,
+    UBX_ERROR_FRAME,
+    UBX_ERROR_TIMEOUT,
+    // Low level drivers errors.
+    UBX_ERROR_BASE_NEOM8X = 0x0100,
+    // Last base value.
+    UBX_ERROR_BASE_LAST = (UBX_ERROR_BASE_NEOM8X + NEOM8X_ERROR_BASE_LAST)
+} UBX_status_t;
+
+#ifdef GPSM
+
+/*!******************************************************************
+ * \enum UBX_message_t
+ * \brief UBX output messages handled by the driver.
+ *******************************************************************/
+typedef enum {
+    UBX_MESSAGE_NAV_TIMEUTC = 0,
+    UBX_MESSAGE_NAV_PVT,
+    UBX_MESSAGE_NAV_AOPSTATUS,
+    UBX_MESSAGE_MGA_ACK,
+    UBX_MESSAGE_NAV_DOP,
+    UBX_MESSAGE_NAV_SAT,
+    UBX_MESSAGE_LAST
+} UBX_message_t;
+
+/*!******************************************************************
+ * \fn UBX_frame_cb_t
+ * \brief UBX frame reception callback.
+ *******************************************************************/
+typedef void (*UBX_frame_cb_t)(void);
+
+/*!******************************************************************
+ * \struct UBX_position_t
+ * \brief UBX NAV-PVT solution.
+ *******************************************************************/
+typedef struct {
+    NEOM8X_position_t position;
+    uint8_t fix_type;
+    uint8_t fix_ok;
+    uint8_t number_of_satellites;
+    uint32_t horizontal_accuracy_mm;
+    uint16_t pdop;
+} UBX_position_t;
+
+/*!******************************************************************
+ * \enum UBX_constellation_t
+ * \brief GNSS constellations reported in signal quality data.
+ *******************************************************************/
+typedef enum {
+    UBX_CONSTELLATION_GPS = 0,
+    UBX_CONSTELLATION_GLONASS,
+    UBX_CONSTELLATION_GALILEO,
+    UBX_CONSTELLATION_BEIDOU,
+    UBX_CONSTELLATION_LAST
+} UBX_constellation_t;
+
+/*!******************************************************************
+ * \struct UBX_quality_t
+ * \brief UBX NAV-DOP and NAV-SAT summary.
+ *******************************************************************/
+typedef struct {
+    uint8_t satellites_used;
+    uint8_t satellites_tracked;
+    uint16_t hdop;
+    uint16_t pdop;
+    uint8_t cno_max[UBX_CONSTELLATION_LAST];
+    uint8_t cno_mean[UBX_CONSTELLATION_LAST];
+} UBX_quality_t;
+
+/*!******************************************************************
+ * \enum UBX_power_mode_t
+ * \brief NEO-M8 power modes.
+ *******************************************************************/
+typedef enum {
+    UBX_POWER_MODE_CONTINUOUS = 0,
+    UBX_POWER_MODE_CYCLIC_TRACKING,
+    UBX_POWER_MODE_ON_OFF,
+    UBX_POWER_MODE_LAST
+} UBX_power_mode_t;
+
+/*!******************************************************************
+ * \struct UBX_power_mode_configuration_t
+ * \brief NEO-M8 power mode parameters.
+ *******************************************************************/
+typedef struct {
+    UBX_power_mode_t mode;
+    uint32_t update_period_ms;
+    uint32_t search_period_ms;
+} UBX_power_mode_configuration_t;
+
+/*** UBX functions ***/
+
+/*!******************************************************************
+ * \fn UBX_status_t UBX_start(UBX_message_t message, UBX_frame_cb_t frame_callback)
+ * \brief Configure the receiver to output a single UBX message per navigation solution and start reception.
+ * \param[in]   message: UBX message to enable.
+ * \param[in]   frame_callback: Function called when a valid frame has been received.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UBX_status_t UBX_start(UBX_message_t message, UBX_frame_cb_t frame_callback);
+
+/*!******************************************************************
+ * \fn UBX_status_t UBX_stop(void)
+ * \brief Stop reception and restore NMEA output.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UBX_status_t UBX_stop(void);
+
+/*!******************************************************************
+ * \fn uint8_t UBX_is_running(void)
+ * \brief Check if UBX reception is running.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      0 if the UART is owned by the NMEA driver, 1 otherwise.
+ *******************************************************************/
+uint8_t UBX_is_running(void);
+
+/*!******************************************************************
+ * \fn void UBX_rx_irq_callback(uint8_t data)
+ * \brief UBX byte reception handler.
+ * \param[in]   data: Received byte.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UBX_rx_irq_callback(uint8_t data);
+
+/*!******************************************************************
+ * \fn UBX_status_t UBX_get_time(NEOM8X_time_t* gps_time, uint8_t* time_valid)
+ * \brief Decode the last NAV-TIMEUTC frame.
+ * \param[in]   none
+ * \param[out]  gps_time: Pointer to the decoded UTC time.
+ * \param[out]  time_valid: Pointer to the UTC validity flag.
+ * \retval      Function execution status.
+ *******************************************************************/
+UBX_status_t UBX_get_time(NEOM8X_time_t* gps_time, uint8_t* time_valid);
+
+/*!******************************************************************
+ * \fn UBX_status_t UBX_get_position(UBX_position_t* ubx_position)
+ * \brief Decode the last NAV-PVT frame.
+ * \param[in]   none
+ * \param[out]  ubx_position: Pointer to the decoded solution.
+ * \retval      Function execution status.
+ *******************************************************************/
+UBX_status_t UBX_get_position(UBX_position_t* ubx_position);
+
+/*!******************************************************************
+ * \fn UBX_status_t UBX_set_power_mode(UBX_power_mode_configuration_t* configuration)
+ * \brief Configure receiver power mode with CFG-PM2 and CFG-RXM messages.
+ * \param[in]   configuration: Pointer to the power mode parameters.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UBX_status_t UBX_set_power_mode(UBX_power_mode_configuration_t* configuration);
+
+/*!******************************************************************
+ * \fn UBX_status_t UBX_set_aiding_configuration(uint8_t autonomous_aiding_enable)
+ * \brief Enable assistance data acknowledgment and configure AssistNow Autonomous with a CFG-NAVX5 message.
+ * \param[in]   autonomous_aiding_enable: 0 to disable AssistNow Autonomous, 1 to enable it.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UBX_status_t UBX_set_aiding_configuration(uint8_t autonomous_aiding_enable);
+
+/*!******************************************************************
+ * \fn UBX_status_t UBX_inject_assistance(uint8_t* data, uint32_t data_size_bytes, uint32_t* frame_size_bytes, uint8_t* acknowledged)
+ * \brief Send the first UBX-MGA frame of a buffer to the receiver and wait for its MGA-ACK.
+ * \param[in]   data: Assistance data buffer starting with a UBX frame.
+ * \param[in]   data_size_bytes: Number of bytes available in the buffer.
+ * \param[out]  frame_size_bytes: Size of the injected frame, 0 if the frame is not complete yet.
+ * \param[out]  acknowledged: 1 if the receiver accepted the message, 0 otherwise.
+ * \retval      Function execution status.
+ *******************************************************************/
+UBX_status_t UBX_inject_assistance(uint8_t* data, uint32_t data_size_bytes, uint32_t* frame_size_bytes, uint8_t* acknowledged);
+
+/*!******************************************************************
+ * \fn UBX_status_t UBX_get_autonomous_aiding_status(uint8_t* autonomous_aiding_running)
+ * \brief Poll the AssistNow Autonomous subsystem state with a NAV-AOPSTATUS message.
+ * \param[in]   none
+ * \param[out]  autonomous_aiding_running: 1 if orbit data is being computed, 0 otherwise.
+ * \retval      Function execution status.
+ *******************************************************************/
+UBX_status_t UBX_get_autonomous_aiding_status(uint8_t* autonomous_aiding_running);
+
+/*!******************************************************************
+ * \fn UBX_status_t UBX_get_quality(UBX_quality_t* ubx_quality)
+ * \brief Poll NAV-DOP and NAV-SAT messages to get the current signal quality.
+ * \param[in]   none
+ * \param[out]  ubx_quality: Pointer to the satellites, DOP (0.01 unit) and C/N0 (dBHz) data.
+ * \retval      Function execution status.
+ *******************************************************************/
+UBX_status_t UBX_get_quality(UBX_quality_t* ubx_quality);
+
+/*******************************************************************/
+#define UBX_exit_error(base) { ERROR_check_exit(ubx_status, UBX_SUCCESS, base) }
+
+/*******************************************************************/
+#define UBX_stack_error(base) { ERROR_check_stack(ubx_status, UBX_SUCCESS, base) }
+
+/*******************************************************************/
+#define UBX_stack_exit_error(base, code) { ERROR_check_stack_exit(ubx_status, UBX_SUCCESS, base, code) }
+
+#endif /* GPSM */
+
+#endif /* __UBX_H__ */
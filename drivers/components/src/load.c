@@ -10,7 +10,8 @@
 #include "error.h"
 #include "gpio.h"
 #include "gpio_mapping.h"
-#include "lptim.h"
+#include "nvic_priority.h"
+#include "tim.h"
 #include "types.h"
 #include "xm_flags.h"
 
@@ -22,9 +23,104 @@
 #define LOAD_VCOIL_DELAY_MS             100
 #define LOAD_RELAY_CONTROL_DURATION_MS  1000
 
+#define LOAD_STATE_NONE                 0xFF
+
+#if (defined LVRM) && (defined HW2_0)
+#define LOAD_TIM_INSTANCE               TIM_INSTANCE_TIM22
+#define LOAD_TIM_CHANNEL                TIM_CHANNEL_1
+#endif
+
+/*** LOAD local structures ***/
+
+#if (defined LVRM) && (defined HW2_0)
+/*******************************************************************/
+typedef enum {
+    LOAD_SEQUENCE_STEP_IDLE = 0,
+    LOAD_SEQUENCE_STEP_DC_DC,
+    LOAD_SEQUENCE_STEP_VCOIL,
+    LOAD_SEQUENCE_STEP_PULSE,
+    LOAD_SEQUENCE_STEP_LAST
+} LOAD_sequence_step_t;
+#endif
+
+#if (defined LVRM) && (defined HW2_0)
+/*******************************************************************/
+typedef struct {
+    LOAD_sequence_step_t step;
+    uint8_t target_state;
+    uint8_t pending_state;
+} LOAD_sequence_t;
+#endif
+
 /*** LOAD local global variables ***/
 
-static uint8_t load_state = 0xFF;
+static uint8_t load_state = LOAD_STATE_NONE;
+#if (defined LVRM) && (defined HW2_0)
+static LOAD_sequence_t load_sequence = { .step = LOAD_SEQUENCE_STEP_IDLE, .target_state = LOAD_STATE_NONE, .pending_state = LOAD_STATE_NONE };
+#endif
+
+/*** LOAD local functions ***/
+
+#if (defined LVRM) && (defined HW2_0)
+/*******************************************************************/
+static LOAD_status_t _LOAD_start_step(LOAD_sequence_step_t step, uint32_t duration_ms) {
+    // Local variables.
+    LOAD_status_t status = LOAD_SUCCESS;
+    TIM_status_t tim_status = TIM_SUCCESS;
+    // Start step timer.
+    tim_status = TIM_MCH_start_channel(LOAD_TIM_INSTANCE, LOAD_TIM_CHANNEL, duration_ms, TIM_WAITING_MODE_LOW_POWER_SLEEP);
+    TIM_exit_error(LOAD_ERROR_BASE_TIM);
+    // Update step.
+    load_sequence.step = step;
+errors:
+    return status;
+}
+#endif
+
+#if (defined LVRM) && (defined HW2_0)
+/*******************************************************************/
+static LOAD_status_t _LOAD_stop_sequence(void) {
+    // Local variables.
+    LOAD_status_t status = LOAD_SUCCESS;
+    TIM_status_t tim_status = TIM_SUCCESS;
+    // Turn all GPIOs off.
+    GPIO_write(&GPIO_OUT_CONTROL, 0);
+    GPIO_write(&GPIO_OUT_SELECT, 0);
+    GPIO_write(&GPIO_COIL_POWER_ENABLE, 0);
+    GPIO_write(&GPIO_DC_DC_POWER_ENABLE, 0);
+    // Reset sequence.
+    load_sequence.step = LOAD_SEQUENCE_STEP_IDLE;
+    load_sequence.target_state = LOAD_STATE_NONE;
+    // Release timer.
+    tim_status = TIM_MCH_stop_channel(LOAD_TIM_INSTANCE, LOAD_TIM_CHANNEL);
+    TIM_exit_error(LOAD_ERROR_BASE_TIM);
+    tim_status = TIM_MCH_de_init(LOAD_TIM_INSTANCE);
+    TIM_exit_error(LOAD_ERROR_BASE_TIM);
+errors:
+    return status;
+}
+#endif
+
+#if (defined LVRM) && (defined HW2_0)
+/*******************************************************************/
+static LOAD_status_t _LOAD_start_sequence(uint8_t state) {
+    // Local variables.
+    LOAD_status_t status = LOAD_SUCCESS;
+    TIM_status_t tim_status = TIM_SUCCESS;
+    // Init timer.
+    tim_status = TIM_MCH_init(LOAD_TIM_INSTANCE, NVIC_PRIORITY_LOAD);
+    TIM_exit_error(LOAD_ERROR_BASE_TIM);
+    load_sequence.target_state = state;
+    // Enable DC-DC.
+    GPIO_write(&GPIO_DC_DC_POWER_ENABLE, 1);
+    status = _LOAD_start_step(LOAD_SEQUENCE_STEP_DC_DC, LOAD_DC_DC_DELAY_MS);
+    if (status != LOAD_SUCCESS) goto errors;
+    return status;
+errors:
+    _LOAD_stop_sequence();
+    return status;
+}
+#endif
 
 /*** LOAD functions ***/
 
@@ -52,38 +148,26 @@ void LOAD_init(void) {
 LOAD_status_t LOAD_set_output_state(uint8_t state) {
     // Local variables.
     LOAD_status_t status = LOAD_SUCCESS;
+#if (defined LVRM) && (defined HW2_0)
+    // Check current sequence.
+    if (load_sequence.step != LOAD_SEQUENCE_STEP_IDLE) {
+        // Queue request, or cancel the queued one if the relay is already switching to the requested state.
+        load_sequence.pending_state = (state == load_sequence.target_state) ? LOAD_STATE_NONE : state;
+        goto errors;
+    }
     // Directly exit with success if state is already set.
     if (state == load_state) goto errors;
-#if (defined LVRM) && (defined HW2_0)
-    LPTIM_status_t lptim_status = LPTIM_SUCCESS;
-    // Enable DC-DC.
-    GPIO_write(&GPIO_DC_DC_POWER_ENABLE, 1);
-    lptim_status = LPTIM_delay_milliseconds(LOAD_DC_DC_DELAY_MS, LPTIM_DELAY_MODE_STOP);
-    LPTIM_exit_error(LOAD_ERROR_BASE_LPTIM);
-    // Enable COIL voltage.
-    GPIO_write(&GPIO_COIL_POWER_ENABLE, 1);
-    lptim_status = LPTIM_delay_milliseconds(LOAD_VCOIL_DELAY_MS, LPTIM_DELAY_MODE_STOP);
-    LPTIM_exit_error(LOAD_ERROR_BASE_LPTIM);
-    // Select coil.
-    GPIO_write(&GPIO_OUT_SELECT, state);
-    // Set relay state.
-    GPIO_write(&GPIO_OUT_CONTROL, 1);
-    lptim_status = LPTIM_delay_milliseconds(LOAD_RELAY_CONTROL_DURATION_MS, LPTIM_DELAY_MODE_STOP);
-    LPTIM_exit_error(LOAD_ERROR_BASE_LPTIM);
+    // Start switching sequence.
+    status = _LOAD_start_sequence(state);
 #else
+    // Directly exit with success if state is already set.
+    if (state == load_state) goto errors;
     // Set GPIO.
     GPIO_write(&GPIO_OUT_EN, state);
-#endif
     // Update state.
     load_state = state;
-errors:
-#if (defined LVRM) && (defined HW2_0)
-    // Turn all GPIOs off.
-    GPIO_write(&GPIO_OUT_CONTROL, 0);
-    GPIO_write(&GPIO_OUT_SELECT, 0);
-    GPIO_write(&GPIO_COIL_POWER_ENABLE, 0);
-    GPIO_write(&GPIO_DC_DC_POWER_ENABLE, 0);
 #endif
+errors:
     return status;
 }
 
@@ -93,6 +177,83 @@ uint8_t LOAD_get_output_state(void) {
     return load_state;
 }
 
+#if (defined LVRM) && (defined HW2_0)
+/*******************************************************************/
+LOAD_status_t LOAD_process(uint8_t* sequence_done) {
+    // Local variables.
+    LOAD_status_t status = LOAD_SUCCESS;
+    LOAD_status_t load_status = LOAD_SUCCESS;
+    TIM_status_t tim_status = TIM_SUCCESS;
+    uint8_t step_done = 0;
+    uint8_t pending_state = LOAD_STATE_NONE;
+    // Reset output.
+    (*sequence_done) = 0;
+    // Check current step.
+    if (load_sequence.step == LOAD_SEQUENCE_STEP_IDLE) goto errors;
+    tim_status = TIM_MCH_get_channel_status(LOAD_TIM_INSTANCE, LOAD_TIM_CHANNEL, &step_done);
+    TIM_exit_error(LOAD_ERROR_BASE_TIM);
+    if (step_done == 0) goto errors;
+    // Go to next step.
+    switch (load_sequence.step) {
+    case LOAD_SEQUENCE_STEP_DC_DC:
+        // Enable COIL voltage.
+        GPIO_write(&GPIO_COIL_POWER_ENABLE, 1);
+        status = _LOAD_start_step(LOAD_SEQUENCE_STEP_VCOIL, LOAD_VCOIL_DELAY_MS);
+        if (status != LOAD_SUCCESS) goto errors;
+        break;
+    case LOAD_SEQUENCE_STEP_VCOIL:
+        // Select coil.
+        GPIO_write(&GPIO_OUT_SELECT, load_sequence.target_state);
+        // Set relay state.
+        GPIO_write(&GPIO_OUT_CONTROL, 1);
+        status = _LOAD_start_step(LOAD_SEQUENCE_STEP_PULSE, LOAD_RELAY_CONTROL_DURATION_MS);
+        if (status != LOAD_SUCCESS) goto errors;
+        break;
+    case LOAD_SEQUENCE_STEP_PULSE:
+        // Update state.
+        load_state = load_sequence.target_state;
+        (*sequence_done) = 1;
+        status = _LOAD_stop_sequence();
+        if (status != LOAD_SUCCESS) goto errors;
+        // Execute queued request.
+        pending_state = load_sequence.pending_state;
+        load_sequence.pending_state = LOAD_STATE_NONE;
+        if ((pending_state != LOAD_STATE_NONE) && (pending_state != load_state)) {
+            status = _LOAD_start_sequence(pending_state);
+            if (status != LOAD_SUCCESS) goto errors;
+        }
+        break;
+    default:
+        status = LOAD_ERROR_STATE;
+        goto errors;
+    }
+    return status;
+errors:
+    // Abort sequence on error.
+    if (status != LOAD_SUCCESS) {
+        load_status = _LOAD_stop_sequence();
+        UNUSED(load_status);
+        load_sequence.pending_state = LOAD_STATE_NONE;
+        (*sequence_done) = 1;
+    }
+    return status;
+}
+#endif
+
+#if (defined LVRM) && (defined HW2_0)
+/*******************************************************************/
+uint8_t LOAD_is_switching(void) {
+    return ((load_sequence.step != LOAD_SEQUENCE_STEP_IDLE) ? 1 : 0);
+}
+#endif
+
+#if (defined LVRM) && (defined HW2_0)
+/*******************************************************************/
+uint8_t LOAD_is_request_pending(void) {
+    return ((load_sequence.pending_state != LOAD_STATE_NONE) ? 1 : 0);
+}
+#endif
+
 #ifdef BPSM
 /*******************************************************************/
 void LOAD_set_charge_state(uint8_t state) {
@@ -10,17 +10,101 @@
 #ifndef NEOM8X_DRIVER_DISABLE_FLAGS_FILE
 #include "neom8x_driver_flags.h"
 #endif
+#include "dma.h"
 #include "error.h"
 #include "gpio_mapping.h"
 #include "lptim.h"
 #include "nvic_priority.h"
+#include "stm32l0xx_drivers_flags.h"
+#include "ubx.h"
 #include "usart.h"
+#include "usart_registers.h"
 
 #ifndef NEOM8X_DRIVER_DISABLE
 
 /*** NEOM8X HW local macros ***/
 
-#define NEOM8X_HW_USART_INSTANCE    USART_INSTANCE_USART2
+#define NEOM8X_HW_USART_INSTANCE            USART_INSTANCE_USART2
+
+#ifdef GPSM_GPS_UART_DMA
+// USART2 RX is mapped on DMA1 channel 5 (request 4).
+#define NEOM8X_HW_DMA_BUFFER_SIZE_BYTES     64
+#define NEOM8X_HW_DMA_CHANNEL               DMA_CHANNEL_5
+#define NEOM8X_HW_DMA_REQUEST               4
+// DMA errors are reported after the USART ones in the UART error base.
+#define NEOM8X_HW_ERROR_BASE_DMA            (NEOM8X_ERROR_BASE_UART + USART_ERROR_BASE_LAST)
+
+#define NEOM8X_HW_USART_CR1_RXNEIE          (0b1 << 5)
+#define NEOM8X_HW_USART_CR3_DMAR            (0b1 << 6)
+
+#if ((STM32L0XX_DRIVERS_DMA_CHANNEL_MASK & 0x10) == 0)
+#error "GPS UART DMA channel is not enabled in the DMA driver"
+#endif
+#endif
+
+#ifdef GPSM
+/*** NEOM8X HW local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    USART_rx_irq_cb_t rx_irq_callback;
+#ifdef GPSM_GPS_UART_DMA
+    volatile uint8_t dma_buffer[NEOM8X_HW_DMA_BUFFER_SIZE_BYTES];
+    uint32_t dma_read_index;
+    volatile uint8_t dma_flush_lock;
+    uint8_t dma_running;
+#endif
+} NEOM8X_HW_context_t;
+
+/*** NEOM8X HW local global variables ***/
+
+static NEOM8X_HW_context_t neom8x_hw_ctx = { .rx_irq_callback = NULL };
+
+/*** NEOM8X HW local functions ***/
+
+/*******************************************************************/
+static void _NEOM8X_HW_rx_irq_callback(uint8_t data) {
+    // Route bytes to the UBX parser when it owns the UART.
+    if (UBX_is_running() != 0) {
+        UBX_rx_irq_callback(data);
+        return;
+    }
+    if (neom8x_hw_ctx.rx_irq_callback != NULL) {
+        neom8x_hw_ctx.rx_irq_callback(data);
+    }
+}
+#endif
+
+#ifdef GPSM_GPS_UART_DMA
+/*******************************************************************/
+static void _NEOM8X_HW_dma_flush(void) {
+    // Local variables.
+    uint16_t number_of_transfered_data = 0;
+    uint32_t write_index = 0;
+    // Flush can be requested by the DMA interrupt while the main context is already flushing.
+    if (neom8x_hw_ctx.dma_flush_lock != 0) return;
+    neom8x_hw_ctx.dma_flush_lock = 1;
+    if (DMA_get_number_of_transfered_data(NEOM8X_HW_DMA_CHANNEL, &number_of_transfered_data) != DMA_SUCCESS) goto errors;
+    write_index = (number_of_transfered_data % NEOM8X_HW_DMA_BUFFER_SIZE_BYTES);
+    // Hand over all received bytes at once.
+    while (neom8x_hw_ctx.dma_read_index != write_index) {
+        _NEOM8X_HW_rx_irq_callback(neom8x_hw_ctx.dma_buffer[neom8x_hw_ctx.dma_read_index]);
+        neom8x_hw_ctx.dma_read_index = (neom8x_hw_ctx.dma_read_index + 1) % NEOM8X_HW_DMA_BUFFER_SIZE_BYTES;
+    }
+errors:
+    neom8x_hw_ctx.dma_flush_lock = 0;
+}
+#endif
+
+#ifdef GPSM_GPS_UART_DMA
+/*******************************************************************/
+static void _NEOM8X_HW_idle_irq_callback(void) {
+    // Hand over the tail of the last frame as soon as the receiver stops transmitting.
+    if (neom8x_hw_ctx.dma_running != 0) {
+        _NEOM8X_HW_dma_flush();
+    }
+}
+#endif
 
 /*** NEOM8X HW functions ***/
 
@@ -30,14 +114,48 @@ NEOM8X_status_t NEOM8X_HW_init(NEOM8X_HW_configuration_t* configuration) {
     NEOM8X_status_t status = NEOM8X_SUCCESS;
     USART_status_t usart_status = USART_SUCCESS;
     USART_configuration_t usart_config;
+#ifdef GPSM_GPS_UART_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+    DMA_configuration_t dma_config;
+#endif
     // Init backup pin.
     GPIO_configure(&GPIO_GPS_VBCKP, GPIO_MODE_OUTPUT, GPIO_TYPE_PUSH_PULL, GPIO_SPEED_LOW, GPIO_PULL_NONE);
     // Init USART.
     usart_config.baud_rate = (configuration->uart_baud_rate);
     usart_config.nvic_priority = NVIC_PRIORITY_GPS_UART;
+#ifdef GPSM
+    neom8x_hw_ctx.rx_irq_callback = (USART_rx_irq_cb_t) (configuration->rx_irq_callback);
+    usart_config.rxne_callback = &_NEOM8X_HW_rx_irq_callback;
+#else
     usart_config.rxne_callback = (USART_rx_irq_cb_t) (configuration->rx_irq_callback);
+#endif
+#ifdef GPSM_GPS_UART_DMA
+    usart_config.idle_callback = &_NEOM8X_HW_idle_irq_callback;
+#else
+    usart_config.idle_callback = NULL;
+#endif
     usart_status = USART_init(NEOM8X_HW_USART_INSTANCE, &GPIO_GPS_USART, &usart_config);
     USART_exit_error(NEOM8X_ERROR_BASE_UART);
+#ifdef GPSM_GPS_UART_DMA
+    // Init DMA channel: byte transfers from the USART data register to the circular buffer.
+    dma_config.direction = DMA_DIRECTION_PERIPHERAL_TO_MEMORY;
+    dma_config.full_transfer_irq_callback = &_NEOM8X_HW_dma_flush;
+    dma_config.half_transfer_irq_callback = &_NEOM8X_HW_dma_flush;
+    dma_config.memory_address = (uint32_t) (neom8x_hw_ctx.dma_buffer);
+    dma_config.memory_data_size = DMA_TRANSFER_SIZE_8_BITS;
+    dma_config.memory_address_increment = 1;
+    dma_config.peripheral_address = (uint32_t) &(USART2->RDR);
+    dma_config.peripheral_data_size = DMA_TRANSFER_SIZE_8_BITS;
+    dma_config.peripheral_address_increment = 0;
+    dma_config.number_of_data = NEOM8X_HW_DMA_BUFFER_SIZE_BYTES;
+    dma_config.circular_mode = 1;
+    dma_config.priority = DMA_PRIORITY_HIGH;
+    dma_config.request_number = NEOM8X_HW_DMA_REQUEST;
+    dma_config.nvic_priority = NVIC_PRIORITY_GPS_UART;
+    dma_status = DMA_init(NEOM8X_HW_DMA_CHANNEL, &dma_config);
+    DMA_exit_error(NEOM8X_HW_ERROR_BASE_DMA);
+    neom8x_hw_ctx.dma_running = 0;
+#endif
 errors:
     return status;
 }
@@ -47,6 +165,15 @@ NEOM8X_status_t NEOM8X_HW_de_init(void) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
     USART_status_t usart_status = USART_SUCCESS;
+#ifdef GPSM_GPS_UART_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+#endif
+#ifdef GPSM_GPS_UART_DMA
+    // Release DMA channel.
+    dma_status = DMA_de_init(NEOM8X_HW_DMA_CHANNEL);
+    DMA_exit_error(NEOM8X_HW_ERROR_BASE_DMA);
+    neom8x_hw_ctx.dma_running = 0;
+#endif
     // Release USART.
     usart_status = USART_de_init(NEOM8X_HW_USART_INSTANCE, &GPIO_GPS_USART);
     USART_exit_error(NEOM8X_ERROR_BASE_UART);
@@ -71,9 +198,26 @@ NEOM8X_status_t NEOM8X_HW_start_rx(void) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
     USART_status_t usart_status = USART_SUCCESS;
+#ifdef GPSM_GPS_UART_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+#endif
     // Start USART.
     usart_status = USART_enable_rx(NEOM8X_HW_USART_INSTANCE);
     USART_exit_error(NEOM8X_ERROR_BASE_UART);
+#ifdef GPSM_GPS_UART_DMA
+    // Restart circular buffer.
+    dma_status = DMA_stop(NEOM8X_HW_DMA_CHANNEL);
+    DMA_exit_error(NEOM8X_HW_ERROR_BASE_DMA);
+    dma_status = DMA_set_memory_address(NEOM8X_HW_DMA_CHANNEL, (uint32_t) (neom8x_hw_ctx.dma_buffer), NEOM8X_HW_DMA_BUFFER_SIZE_BYTES);
+    DMA_exit_error(NEOM8X_HW_ERROR_BASE_DMA);
+    neom8x_hw_ctx.dma_read_index = 0;
+    dma_status = DMA_start(NEOM8X_HW_DMA_CHANNEL);
+    DMA_exit_error(NEOM8X_HW_ERROR_BASE_DMA);
+    // USART driver has no DMA mode: replace the RXNE interrupt by DMA requests.
+    USART2->CR1 &= ~NEOM8X_HW_USART_CR1_RXNEIE;
+    USART2->CR3 |= NEOM8X_HW_USART_CR3_DMAR;
+    neom8x_hw_ctx.dma_running = 1;
+#endif
 errors:
     return status;
 }
@@ -83,6 +227,17 @@ NEOM8X_status_t NEOM8X_HW_stop_rx(void) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
     USART_status_t usart_status = USART_SUCCESS;
+#ifdef GPSM_GPS_UART_DMA
+    DMA_status_t dma_status = DMA_SUCCESS;
+#endif
+#ifdef GPSM_GPS_UART_DMA
+    // Stop DMA requests and hand over remaining bytes.
+    USART2->CR3 &= ~NEOM8X_HW_USART_CR3_DMAR;
+    neom8x_hw_ctx.dma_running = 0;
+    _NEOM8X_HW_dma_flush();
+    dma_status = DMA_stop(NEOM8X_HW_DMA_CHANNEL);
+    DMA_exit_error(NEOM8X_HW_ERROR_BASE_DMA);
+#endif
     // Stop USART.
     usart_status = USART_disable_rx(NEOM8X_HW_USART_INSTANCE);
     USART_exit_error(NEOM8X_ERROR_BASE_UART);
@@ -98,6 +253,12 @@ NEOM8X_status_t NEOM8X_HW_delay_milliseconds(uint32_t delay_ms) {
     // Perform delay.
     lptim_status = LPTIM_delay_milliseconds(delay_ms, LPTIM_DELAY_MODE_SLEEP);
     LPTIM_exit_error(NEOM8X_ERROR_BASE_DELAY);
+#ifdef GPSM_GPS_UART_DMA
+    // Hand over bytes received since the last IDLE interrupt.
+    if (neom8x_hw_ctx.dma_running != 0) {
+        _NEOM8X_HW_dma_flush();
+    }
+#endif
 errors:
     return status;
 }
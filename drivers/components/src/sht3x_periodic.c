@@ -0,0 +1,267 @@
+/*
+ * sht3x_periodic.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "sht3x_periodic.h"
+
+#include "error.h"
+#include "sht3x.h"
+#include "sht3x_hw.h"
+#include "types.h"
+
+#ifdef SM
+
+/*** SHT3X PERIODIC local macros ***/
+
+#define SHT3X_PERIODIC_COMMAND_FETCH_DATA               0xE000
+#define SHT3X_PERIODIC_COMMAND_BREAK                    0x3093
+#define SHT3X_PERIODIC_COMMAND_READ_STATUS              0xF32D
+#define SHT3X_PERIODIC_COMMAND_CLEAR_STATUS             0x3041
+#define SHT3X_PERIODIC_COMMAND_ALERT_HIGH_SET           0x611D
+#define SHT3X_PERIODIC_COMMAND_ALERT_HIGH_CLEAR         0x6116
+#define SHT3X_PERIODIC_COMMAND_ALERT_LOW_CLEAR          0x610B
+#define SHT3X_PERIODIC_COMMAND_ALERT_LOW_SET            0x6100
+
+#define SHT3X_PERIODIC_COMMAND_DELAY_MS                 1
+
+#define SHT3X_PERIODIC_CRC_POLYNOMIAL                   0x31
+#define SHT3X_PERIODIC_CRC_INIT                         0xFF
+
+#define SHT3X_PERIODIC_RAW_MAX                          0xFFFF
+#define SHT3X_PERIODIC_TEMPERATURE_OFFSET_DEGREES       45
+#define SHT3X_PERIODIC_TEMPERATURE_RANGE_DEGREES        175
+#define SHT3X_PERIODIC_HUMIDITY_RANGE_PERCENT           100
+
+#define SHT3X_PERIODIC_ALERT_HUMIDITY_MASK              0xFE00
+#define SHT3X_PERIODIC_ALERT_TEMPERATURE_SHIFT          7
+
+#define SHT3X_PERIODIC_STATUS_HUMIDITY_ALERT            0x0800
+#define SHT3X_PERIODIC_STATUS_TEMPERATURE_ALERT         0x0400
+
+/*** SHT3X PERIODIC local global variables ***/
+
+// Low repeatability commands.
+static const uint16_t SHT3X_PERIODIC_COMMAND_START[SHT3X_PERIODIC_RATE_LAST] = { 0x202F, 0x212D, 0x222B, 0x2329, 0x272A };
+
+/*** SHT3X PERIODIC local functions ***/
+
+/*******************************************************************/
+static uint8_t _SHT3X_PERIODIC_compute_crc(uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    uint8_t crc = SHT3X_PERIODIC_CRC_INIT;
+    uint8_t idx = 0;
+    uint8_t bit_idx = 0;
+    // Bytes loop.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        crc ^= data[idx];
+        for (bit_idx = 0; bit_idx < 8; bit_idx++) {
+            crc = ((crc & 0x80) != 0) ? ((uint8_t) ((crc << 1) ^ SHT3X_PERIODIC_CRC_POLYNOMIAL)) : ((uint8_t) (crc << 1));
+        }
+    }
+    return crc;
+}
+
+/*******************************************************************/
+static SHT3X_PERIODIC_status_t _SHT3X_PERIODIC_write_command(uint8_t i2c_address, uint16_t command) {
+    // Local variables.
+    SHT3X_PERIODIC_status_t status = SHT3X_PERIODIC_SUCCESS;
+    SHT3X_status_t sht3x_status = SHT3X_SUCCESS;
+    uint8_t tx_data[2];
+    // Build frame.
+    tx_data[0] = (uint8_t) ((command >> 8) & 0xFF);
+    tx_data[1] = (uint8_t) ((command >> 0) & 0xFF);
+    // Send command.
+    sht3x_status = SHT3X_HW_i2c_write(i2c_address, tx_data, 2, 1);
+    SHT3X_exit_error(SHT3X_PERIODIC_ERROR_BASE_SHT3X);
+    // Minimum delay between two commands.
+    sht3x_status = SHT3X_HW_delay_milliseconds(SHT3X_PERIODIC_COMMAND_DELAY_MS);
+    SHT3X_exit_error(SHT3X_PERIODIC_ERROR_BASE_SHT3X);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static SHT3X_PERIODIC_status_t _SHT3X_PERIODIC_read_status(uint8_t i2c_address, uint16_t* status_register) {
+    // Local variables.
+    SHT3X_PERIODIC_status_t status = SHT3X_PERIODIC_SUCCESS;
+    SHT3X_status_t sht3x_status = SHT3X_SUCCESS;
+    uint8_t tx_data[2];
+    uint8_t rx_data[3];
+    // Read status register.
+    tx_data[0] = (uint8_t) ((SHT3X_PERIODIC_COMMAND_READ_STATUS >> 8) & 0xFF);
+    tx_data[1] = (uint8_t) ((SHT3X_PERIODIC_COMMAND_READ_STATUS >> 0) & 0xFF);
+    sht3x_status = SHT3X_HW_i2c_write(i2c_address, tx_data, 2, 0);
+    SHT3X_exit_error(SHT3X_PERIODIC_ERROR_BASE_SHT3X);
+    sht3x_status = SHT3X_HW_i2c_read(i2c_address, rx_data, 3);
+    SHT3X_exit_error(SHT3X_PERIODIC_ERROR_BASE_SHT3X);
+    // Check CRC.
+    if (_SHT3X_PERIODIC_compute_crc(rx_data, 2) != rx_data[2]) {
+        status = SHT3X_PERIODIC_ERROR_CRC;
+        goto errors;
+    }
+    (*status_register) = (uint16_t) ((rx_data[0] << 8) | rx_data[1]);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static SHT3X_PERIODIC_status_t _SHT3X_PERIODIC_write_alert_limit(uint8_t i2c_address, uint16_t command, int32_t temperature_degrees, int32_t humidity_percent) {
+    // Local variables.
+    SHT3X_PERIODIC_status_t status = SHT3X_PERIODIC_SUCCESS;
+    SHT3X_status_t sht3x_status = SHT3X_SUCCESS;
+    int32_t temperature_raw = 0;
+    int32_t humidity_raw = 0;
+    uint16_t limit = 0;
+    uint8_t tx_data[5];
+    // Convert to raw values.
+    temperature_raw = (((temperature_degrees + SHT3X_PERIODIC_TEMPERATURE_OFFSET_DEGREES) * SHT3X_PERIODIC_RAW_MAX) / SHT3X_PERIODIC_TEMPERATURE_RANGE_DEGREES);
+    humidity_raw = ((humidity_percent * SHT3X_PERIODIC_RAW_MAX) / SHT3X_PERIODIC_HUMIDITY_RANGE_PERCENT);
+    // Clamp values.
+    if (temperature_raw < 0) {
+        temperature_raw = 0;
+    }
+    if (temperature_raw > SHT3X_PERIODIC_RAW_MAX) {
+        temperature_raw = SHT3X_PERIODIC_RAW_MAX;
+    }
+    if (humidity_raw < 0) {
+        humidity_raw = 0;
+    }
+    if (humidity_raw > SHT3X_PERIODIC_RAW_MAX) {
+        humidity_raw = SHT3X_PERIODIC_RAW_MAX;
+    }
+    // Limit format is 7 MSBs of humidity and 9 MSBs of temperature.
+    limit = (uint16_t) ((((uint32_t) humidity_raw) & SHT3X_PERIODIC_ALERT_HUMIDITY_MASK) | (((uint32_t) temperature_raw) >> SHT3X_PERIODIC_ALERT_TEMPERATURE_SHIFT));
+    // Build frame.
+    tx_data[0] = (uint8_t) ((command >> 8) & 0xFF);
+    tx_data[1] = (uint8_t) ((command >> 0) & 0xFF);
+    tx_data[2] = (uint8_t) ((limit >> 8) & 0xFF);
+    tx_data[3] = (uint8_t) ((limit >> 0) & 0xFF);
+    tx_data[4] = _SHT3X_PERIODIC_compute_crc(&(tx_data[2]), 2);
+    // Send command.
+    sht3x_status = SHT3X_HW_i2c_write(i2c_address, tx_data, 5, 1);
+    SHT3X_exit_error(SHT3X_PERIODIC_ERROR_BASE_SHT3X);
+    sht3x_status = SHT3X_HW_delay_milliseconds(SHT3X_PERIODIC_COMMAND_DELAY_MS);
+    SHT3X_exit_error(SHT3X_PERIODIC_ERROR_BASE_SHT3X);
+errors:
+    return status;
+}
+
+/*** SHT3X PERIODIC functions ***/
+
+/*******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_set_alert_limits(uint8_t i2c_address, SHT3X_PERIODIC_alert_limits_t* limits) {
+    // Local variables.
+    SHT3X_PERIODIC_status_t status = SHT3X_PERIODIC_SUCCESS;
+    // Check parameters.
+    if (limits == NULL) {
+        status = SHT3X_PERIODIC_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // High alert.
+    status = _SHT3X_PERIODIC_write_alert_limit(i2c_address, SHT3X_PERIODIC_COMMAND_ALERT_HIGH_SET, (limits->temperature_high_degrees), (limits->humidity_high_percent));
+    if (status != SHT3X_PERIODIC_SUCCESS) goto errors;
+    status = _SHT3X_PERIODIC_write_alert_limit(i2c_address, SHT3X_PERIODIC_COMMAND_ALERT_HIGH_CLEAR, ((limits->temperature_high_degrees) - (limits->temperature_hysteresis_degrees)), ((limits->humidity_high_percent) - (limits->humidity_hysteresis_percent)));
+    if (status != SHT3X_PERIODIC_SUCCESS) goto errors;
+    // Low alert.
+    status = _SHT3X_PERIODIC_write_alert_limit(i2c_address, SHT3X_PERIODIC_COMMAND_ALERT_LOW_SET, (limits->temperature_low_degrees), (limits->humidity_low_percent));
+    if (status != SHT3X_PERIODIC_SUCCESS) goto errors;
+    status = _SHT3X_PERIODIC_write_alert_limit(i2c_address, SHT3X_PERIODIC_COMMAND_ALERT_LOW_CLEAR, ((limits->temperature_low_degrees) + (limits->temperature_hysteresis_degrees)), ((limits->humidity_low_percent) + (limits->humidity_hysteresis_percent)));
+    if (status != SHT3X_PERIODIC_SUCCESS) goto errors;
+    // Reset previous alerts.
+    status = _SHT3X_PERIODIC_write_command(i2c_address, SHT3X_PERIODIC_COMMAND_CLEAR_STATUS);
+    if (status != SHT3X_PERIODIC_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_start(uint8_t i2c_address, SHT3X_PERIODIC_rate_t rate) {
+    // Local variables.
+    SHT3X_PERIODIC_status_t status = SHT3X_PERIODIC_SUCCESS;
+    // Check parameters.
+    if (rate >= SHT3X_PERIODIC_RATE_LAST) {
+        status = SHT3X_PERIODIC_ERROR_RATE;
+        goto errors;
+    }
+    status = _SHT3X_PERIODIC_write_command(i2c_address, SHT3X_PERIODIC_COMMAND_START[rate]);
+    if (status != SHT3X_PERIODIC_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_stop(uint8_t i2c_address) {
+    return _SHT3X_PERIODIC_write_command(i2c_address, SHT3X_PERIODIC_COMMAND_BREAK);
+}
+
+/*******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_read(uint8_t i2c_address, int32_t* temperature_degrees, int32_t* humidity_percent) {
+    // Local variables.
+    SHT3X_PERIODIC_status_t status = SHT3X_PERIODIC_SUCCESS;
+    SHT3X_status_t sht3x_status = SHT3X_SUCCESS;
+    uint8_t tx_data[2];
+    uint8_t rx_data[6];
+    int32_t raw = 0;
+    // Check parameters.
+    if ((temperature_degrees == NULL) || (humidity_percent == NULL)) {
+        status = SHT3X_PERIODIC_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Fetch data.
+    tx_data[0] = (uint8_t) ((SHT3X_PERIODIC_COMMAND_FETCH_DATA >> 8) & 0xFF);
+    tx_data[1] = (uint8_t) ((SHT3X_PERIODIC_COMMAND_FETCH_DATA >> 0) & 0xFF);
+    sht3x_status = SHT3X_HW_i2c_write(i2c_address, tx_data, 2, 0);
+    SHT3X_exit_error(SHT3X_PERIODIC_ERROR_BASE_SHT3X);
+    sht3x_status = SHT3X_HW_i2c_read(i2c_address, rx_data, 6);
+    SHT3X_exit_error(SHT3X_PERIODIC_ERROR_BASE_SHT3X);
+    // Check CRC.
+    if ((_SHT3X_PERIODIC_compute_crc(&(rx_data[0]), 2) != rx_data[2]) || (_SHT3X_PERIODIC_compute_crc(&(rx_data[3]), 2) != rx_data[5])) {
+        status = SHT3X_PERIODIC_ERROR_CRC;
+        goto errors;
+    }
+    // Compute temperature.
+    raw = (int32_t) ((rx_data[0] << 8) | rx_data[1]);
+    (*temperature_degrees) = (((SHT3X_PERIODIC_TEMPERATURE_RANGE_DEGREES * raw) / SHT3X_PERIODIC_RAW_MAX) - SHT3X_PERIODIC_TEMPERATURE_OFFSET_DEGREES);
+    // Compute humidity.
+    raw = (int32_t) ((rx_data[3] << 8) | rx_data[4]);
+    (*humidity_percent) = ((SHT3X_PERIODIC_HUMIDITY_RANGE_PERCENT * raw) / SHT3X_PERIODIC_RAW_MAX);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_probe(uint8_t i2c_address) {
+    // Local variables.
+    SHT3X_PERIODIC_status_t status = SHT3X_PERIODIC_SUCCESS;
+    uint16_t status_register = 0;
+    // A valid status register read identifies the sensor.
+    status = _SHT3X_PERIODIC_read_status(i2c_address, &status_register);
+    if (status != SHT3X_PERIODIC_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+SHT3X_PERIODIC_status_t SHT3X_PERIODIC_get_alert_status(uint8_t i2c_address, SHT3X_PERIODIC_alert_status_t* alert_status) {
+    // Local variables.
+    SHT3X_PERIODIC_status_t status = SHT3X_PERIODIC_SUCCESS;
+    uint16_t status_register = 0;
+    // Check parameters.
+    if (alert_status == NULL) {
+        status = SHT3X_PERIODIC_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Read status register.
+    status = _SHT3X_PERIODIC_read_status(i2c_address, &status_register);
+    if (status != SHT3X_PERIODIC_SUCCESS) goto errors;
+    // Update flags.
+    alert_status->temperature_alert = ((status_register & SHT3X_PERIODIC_STATUS_TEMPERATURE_ALERT) != 0) ? 1 : 0;
+    alert_status->humidity_alert = ((status_register & SHT3X_PERIODIC_STATUS_HUMIDITY_ALERT) != 0) ? 1 : 0;
+errors:
+    return status;
+}
+
+#endif /* SM */
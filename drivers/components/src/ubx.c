@@ -0,0 +1,773 @@
+/*
+ * ubx.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "ubx.h"
+
+#include "error.h"
+#include "neom8x.h"
+#include "neom8x_hw.h"
+#include "types.h"
+
+#ifdef GPSM
+
+/*** UBX local macros ***/
+
+#define UBX_SYNC_CHAR_1                     0xB5
+#define UBX_SYNC_CHAR_2                     0x62
+
+#define UBX_HEADER_SIZE_BYTES               6
+#define UBX_CHECKSUM_SIZE_BYTES             2
+#define UBX_PAYLOAD_SIZE_MAX_BYTES          92
+#define UBX_TX_PAYLOAD_SIZE_MAX_BYTES       44
+
+#define UBX_CLASS_NAV                       0x01
+#define UBX_CLASS_CFG                       0x06
+#define UBX_CLASS_MGA                       0x13
+
+#define UBX_ID_NAV_PVT                      0x07
+#define UBX_ID_NAV_TIMEUTC                  0x21
+#define UBX_ID_CFG_PRT                      0x00
+#define UBX_ID_CFG_MSG                      0x01
+#define UBX_ID_CFG_RXM                      0x11
+#define UBX_ID_CFG_PM2                      0x3B
+#define UBX_ID_CFG_NAVX5                    0x23
+#define UBX_ID_NAV_AOPSTATUS                0x60
+#define UBX_ID_NAV_DOP                      0x04
+#define UBX_ID_NAV_SAT                      0x35
+#define UBX_ID_MGA_ACK                      0x60
+
+#define UBX_NAV_PVT_PAYLOAD_SIZE_BYTES      92
+#define UBX_NAV_TIMEUTC_PAYLOAD_SIZE_BYTES  20
+#define UBX_CFG_PRT_PAYLOAD_SIZE_BYTES      20
+#define UBX_CFG_MSG_PAYLOAD_SIZE_BYTES      3
+#define UBX_CFG_RXM_PAYLOAD_SIZE_BYTES      2
+#define UBX_CFG_PM2_PAYLOAD_SIZE_BYTES      44
+#define UBX_CFG_NAVX5_PAYLOAD_SIZE_BYTES    40
+#define UBX_NAV_AOPSTATUS_PAYLOAD_SIZE_BYTES    16
+#define UBX_MGA_ACK_PAYLOAD_SIZE_BYTES      8
+#define UBX_NAV_DOP_PAYLOAD_SIZE_BYTES      18
+// Variable length message, processed on the fly.
+#define UBX_NAV_SAT_PAYLOAD_SIZE_BYTES      0
+
+#define UBX_CFG_PRT_PORT_ID_UART1           1
+#define UBX_CFG_PRT_MODE_8N1                0x000008C0
+#define UBX_CFG_PRT_BAUD_RATE               9600
+#define UBX_CFG_PRT_PROTOCOL_UBX            0x0001
+#define UBX_CFG_PRT_PROTOCOL_NMEA           0x0002
+
+#define UBX_CFG_DELAY_MS                    100
+
+#define UBX_CFG_PM2_VERSION                 0x01
+#define UBX_CFG_PM2_FLAGS_UPDATE_RTC        0x00000800
+#define UBX_CFG_PM2_FLAGS_UPDATE_EPH        0x00001000
+#define UBX_CFG_PM2_FLAGS_MODE_ON_OFF       0x00000000
+#define UBX_CFG_PM2_FLAGS_MODE_CYCLIC       0x00020000
+#define UBX_CFG_RXM_RESERVED                0x08
+#define UBX_CFG_RXM_LP_MODE_CONTINUOUS      0x00
+#define UBX_CFG_RXM_LP_MODE_POWER_SAVE      0x01
+
+#define UBX_CFG_NAVX5_VERSION               0x0002
+#define UBX_CFG_NAVX5_MASK1_ACK_AID         0x0400
+#define UBX_CFG_NAVX5_MASK1_AOP             0x4000
+#define UBX_CFG_NAVX5_ACK_AIDING_ENABLE     0x01
+#define UBX_CFG_NAVX5_AOP_CFG_USE_AOP       0x01
+
+#define UBX_MGA_ACK_TYPE_ACCEPTED           0x01
+#define UBX_RESPONSE_TIMEOUT_MS             1000
+#define UBX_RESPONSE_POLLING_PERIOD_MS      10
+
+#define UBX_NAV_SAT_HEADER_SIZE_BYTES       8
+#define UBX_NAV_SAT_BLOCK_SIZE_BYTES        12
+#define UBX_NAV_SAT_BLOCK_OFFSET_GNSS_ID    0
+#define UBX_NAV_SAT_BLOCK_OFFSET_CNO        2
+#define UBX_NAV_SAT_BLOCK_OFFSET_FLAGS      8
+#define UBX_NAV_SAT_FLAGS_SV_USED           0x08
+
+#define UBX_GNSS_ID_GPS                     0
+#define UBX_GNSS_ID_GALILEO                 2
+#define UBX_GNSS_ID_BEIDOU                  3
+#define UBX_GNSS_ID_GLONASS                 6
+
+#define UBX_NAV_TIMEUTC_VALID_UTC           0x04
+#define UBX_NAV_PVT_FLAGS_GNSS_FIX_OK       0x01
+
+#define UBX_COORDINATE_SCALE                10000000
+
+/*** UBX local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    UBX_RX_STATE_SYNC_1 = 0,
+    UBX_RX_STATE_SYNC_2,
+    UBX_RX_STATE_CLASS,
+    UBX_RX_STATE_ID,
+    UBX_RX_STATE_LENGTH_LSB,
+    UBX_RX_STATE_LENGTH_MSB,
+    UBX_RX_STATE_PAYLOAD,
+    UBX_RX_STATE_CHECKSUM_A,
+    UBX_RX_STATE_CHECKSUM_B,
+    UBX_RX_STATE_LAST
+} UBX_rx_state_t;
+
+/*******************************************************************/
+typedef struct {
+    uint8_t message_class;
+    uint8_t message_id;
+    uint16_t payload_size_bytes;
+} UBX_message_descriptor_t;
+
+/*******************************************************************/
+typedef struct {
+    volatile uint8_t running;
+    UBX_message_t message;
+    UBX_frame_cb_t frame_callback;
+    // Reception.
+    UBX_rx_state_t rx_state;
+    uint8_t rx_class;
+    uint8_t rx_id;
+    uint16_t rx_length;
+    uint16_t rx_index;
+    uint8_t rx_checksum_a;
+    uint8_t rx_checksum_b;
+    uint8_t rx_payload[UBX_PAYLOAD_SIZE_MAX_BYTES];
+    // Satellites statistics computed during NAV-SAT reception.
+    uint8_t rx_sv_gnss_id;
+    uint8_t rx_sv_cno;
+    uint8_t rx_satellites_used;
+    uint8_t rx_satellites_tracked;
+    uint8_t rx_cno_max[UBX_CONSTELLATION_LAST];
+    uint16_t rx_cno_sum[UBX_CONSTELLATION_LAST];
+    uint8_t rx_cno_count[UBX_CONSTELLATION_LAST];
+    // Last valid frame.
+    volatile uint8_t frame_received;
+    uint8_t frame_payload[UBX_PAYLOAD_SIZE_MAX_BYTES];
+    UBX_quality_t frame_quality;
+} UBX_context_t;
+
+/*** UBX local global variables ***/
+
+static const UBX_message_descriptor_t UBX_MESSAGE[UBX_MESSAGE_LAST] = {
+    { UBX_CLASS_NAV, UBX_ID_NAV_TIMEUTC, UBX_NAV_TIMEUTC_PAYLOAD_SIZE_BYTES },
+    { UBX_CLASS_NAV, UBX_ID_NAV_PVT, UBX_NAV_PVT_PAYLOAD_SIZE_BYTES },
+    { UBX_CLASS_NAV, UBX_ID_NAV_AOPSTATUS, UBX_NAV_AOPSTATUS_PAYLOAD_SIZE_BYTES },
+    { UBX_CLASS_MGA, UBX_ID_MGA_ACK, UBX_MGA_ACK_PAYLOAD_SIZE_BYTES },
+    { UBX_CLASS_NAV, UBX_ID_NAV_DOP, UBX_NAV_DOP_PAYLOAD_SIZE_BYTES },
+    { UBX_CLASS_NAV, UBX_ID_NAV_SAT, UBX_NAV_SAT_PAYLOAD_SIZE_BYTES }
+};
+
+static UBX_context_t ubx_ctx;
+
+/*** UBX local functions ***/
+
+/*******************************************************************/
+#define _UBX_read_u16(payload, offset) ((uint16_t) (((uint16_t) (payload)[(offset)]) | (((uint16_t) (payload)[(offset) + 1]) << 8)))
+
+/*******************************************************************/
+#define _UBX_read_u32(payload, offset) ((uint32_t) (((uint32_t) (payload)[(offset)]) | (((uint32_t) (payload)[(offset) + 1]) << 8) | (((uint32_t) (payload)[(offset) + 2]) << 16) | (((uint32_t) (payload)[(offset) + 3]) << 24)))
+
+/*******************************************************************/
+#define _UBX_write_u16(payload, offset, value) { \
+    (payload)[(offset)] = (uint8_t) (((value) >> 0) & 0xFF); \
+    (payload)[(offset) + 1] = (uint8_t) (((value) >> 8) & 0xFF); \
+}
+
+/*******************************************************************/
+#define _UBX_write_u32(payload, offset, value) { \
+    (payload)[(offset)] = (uint8_t) (((value) >> 0) & 0xFF); \
+    (payload)[(offset) + 1] = (uint8_t) (((value) >> 8) & 0xFF); \
+    (payload)[(offset) + 2] = (uint8_t) (((value) >> 16) & 0xFF); \
+    (payload)[(offset) + 3] = (uint8_t) (((value) >> 24) & 0xFF); \
+}
+
+/*******************************************************************/
+static void _UBX_compute_checksum(uint8_t* frame, uint16_t payload_size_bytes, uint8_t* checksum_a, uint8_t* checksum_b) {
+    // Local variables.
+    uint16_t idx = 0;
+    // Checksum is computed from class to end of payload.
+    (*checksum_a) = 0;
+    (*checksum_b) = 0;
+    for (idx = 2; idx < (UBX_HEADER_SIZE_BYTES + payload_size_bytes); idx++) {
+        (*checksum_a) = (uint8_t) ((*checksum_a) + frame[idx]);
+        (*checksum_b) = (uint8_t) ((*checksum_b) + (*checksum_a));
+    }
+}
+
+/*******************************************************************/
+static UBX_status_t _UBX_send_frame(uint8_t message_class, uint8_t message_id, uint8_t* payload, uint16_t payload_size_bytes) {
+    // Local variables.
+    UBX_status_t status = UBX_SUCCESS;
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+    uint8_t frame[UBX_HEADER_SIZE_BYTES + UBX_TX_PAYLOAD_SIZE_MAX_BYTES + UBX_CHECKSUM_SIZE_BYTES];
+    uint8_t checksum_a = 0;
+    uint8_t checksum_b = 0;
+    uint16_t idx = 0;
+    // Check size.
+    if (payload_size_bytes > UBX_TX_PAYLOAD_SIZE_MAX_BYTES) {
+        status = UBX_ERROR_MESSAGE;
+        goto errors;
+    }
+    // Build header.
+    frame[0] = UBX_SYNC_CHAR_1;
+    frame[1] = UBX_SYNC_CHAR_2;
+    frame[2] = message_class;
+    frame[3] = message_id;
+    _UBX_write_u16(frame, 4, payload_size_bytes);
+    // Copy payload.
+    for (idx = 0; idx < payload_size_bytes; idx++) {
+        frame[UBX_HEADER_SIZE_BYTES + idx] = payload[idx];
+    }
+    // Compute checksum.
+    _UBX_compute_checksum(frame, payload_size_bytes, &checksum_a, &checksum_b);
+    frame[UBX_HEADER_SIZE_BYTES + payload_size_bytes] = checksum_a;
+    frame[UBX_HEADER_SIZE_BYTES + payload_size_bytes + 1] = checksum_b;
+    // Send frame.
+    neom8x_status = NEOM8X_HW_send_message(frame, (uint32_t) (UBX_HEADER_SIZE_BYTES + payload_size_bytes + UBX_CHECKSUM_SIZE_BYTES));
+    NEOM8X_exit_error(UBX_ERROR_BASE_NEOM8X);
+    // Let the receiver apply the configuration.
+    neom8x_status = NEOM8X_HW_delay_milliseconds(UBX_CFG_DELAY_MS);
+    NEOM8X_exit_error(UBX_ERROR_BASE_NEOM8X);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static UBX_status_t _UBX_set_output_protocol(uint16_t out_protocol_mask) {
+    // Local variables.
+    uint8_t payload[UBX_CFG_PRT_PAYLOAD_SIZE_BYTES] = { 0x00 };
+    // UART1 configuration, input always accepts both protocols.
+    payload[0] = UBX_CFG_PRT_PORT_ID_UART1;
+    _UBX_write_u32(payload, 4, UBX_CFG_PRT_MODE_8N1);
+    _UBX_write_u32(payload, 8, UBX_CFG_PRT_BAUD_RATE);
+    _UBX_write_u16(payload, 12, (UBX_CFG_PRT_PROTOCOL_UBX | UBX_CFG_PRT_PROTOCOL_NMEA));
+    _UBX_write_u16(payload, 14, out_protocol_mask);
+    return _UBX_send_frame(UBX_CLASS_CFG, UBX_ID_CFG_PRT, payload, UBX_CFG_PRT_PAYLOAD_SIZE_BYTES);
+}
+
+/*******************************************************************/
+static UBX_status_t _UBX_set_message_rate(UBX_message_t message, uint8_t rate) {
+    // Local variables.
+    uint8_t payload[UBX_CFG_MSG_PAYLOAD_SIZE_BYTES];
+    // Rate is given in number of navigation solutions on the current port.
+    payload[0] = UBX_MESSAGE[message].message_class;
+    payload[1] = UBX_MESSAGE[message].message_id;
+    payload[2] = rate;
+    return _UBX_send_frame(UBX_CLASS_CFG, UBX_ID_CFG_MSG, payload, UBX_CFG_MSG_PAYLOAD_SIZE_BYTES);
+}
+
+/*******************************************************************/
+static UBX_status_t _UBX_request(uint8_t* frame, uint32_t frame_size_bytes, UBX_message_t response) {
+    // Local variables.
+    UBX_status_t status = UBX_SUCCESS;
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+    uint32_t delay_ms = 0;
+    // Check state.
+    if (ubx_ctx.running != 0) {
+        status = UBX_ERROR_STATE;
+        goto errors;
+    }
+    // Take UART ownership without changing the output protocols, the response is not periodic.
+    ubx_ctx.message = response;
+    ubx_ctx.frame_callback = NULL;
+    ubx_ctx.rx_state = UBX_RX_STATE_SYNC_1;
+    ubx_ctx.frame_received = 0;
+    ubx_ctx.running = 1;
+    neom8x_status = NEOM8X_HW_start_rx();
+    NEOM8X_exit_error(UBX_ERROR_BASE_NEOM8X);
+    // Send request.
+    neom8x_status = NEOM8X_HW_send_message(frame, frame_size_bytes);
+    NEOM8X_exit_error(UBX_ERROR_BASE_NEOM8X);
+    // Wait for response.
+    while (ubx_ctx.frame_received == 0) {
+        if (delay_ms >= UBX_RESPONSE_TIMEOUT_MS) {
+            status = UBX_ERROR_TIMEOUT;
+            goto errors;
+        }
+        neom8x_status = NEOM8X_HW_delay_milliseconds(UBX_RESPONSE_POLLING_PERIOD_MS);
+        NEOM8X_exit_error(UBX_ERROR_BASE_NEOM8X);
+        delay_ms += UBX_RESPONSE_POLLING_PERIOD_MS;
+    }
+errors:
+    // Release UART.
+    if (ubx_ctx.running != 0) {
+        NEOM8X_HW_stop_rx();
+        ubx_ctx.running = 0;
+    }
+    return status;
+}
+
+/*******************************************************************/
+static UBX_status_t _UBX_poll(UBX_message_t message) {
+    // Local variables.
+    uint8_t frame[UBX_HEADER_SIZE_BYTES + UBX_CHECKSUM_SIZE_BYTES];
+    // Poll request is the message header with an empty payload.
+    frame[0] = UBX_SYNC_CHAR_1;
+    frame[1] = UBX_SYNC_CHAR_2;
+    frame[2] = UBX_MESSAGE[message].message_class;
+    frame[3] = UBX_MESSAGE[message].message_id;
+    _UBX_write_u16(frame, 4, 0);
+    _UBX_compute_checksum(frame, 0, &(frame[UBX_HEADER_SIZE_BYTES]), &(frame[UBX_HEADER_SIZE_BYTES + 1]));
+    return _UBX_request(frame, (UBX_HEADER_SIZE_BYTES + UBX_CHECKSUM_SIZE_BYTES), message);
+}
+
+/*******************************************************************/
+static UBX_constellation_t _UBX_get_constellation(uint8_t gnss_id) {
+    // Local variables.
+    UBX_constellation_t constellation = UBX_CONSTELLATION_LAST;
+    // Convert GNSS identifier.
+    switch (gnss_id) {
+    case UBX_GNSS_ID_GPS:
+        constellation = UBX_CONSTELLATION_GPS;
+        break;
+    case UBX_GNSS_ID_GLONASS:
+        constellation = UBX_CONSTELLATION_GLONASS;
+        break;
+    case UBX_GNSS_ID_GALILEO:
+        constellation = UBX_CONSTELLATION_GALILEO;
+        break;
+    case UBX_GNSS_ID_BEIDOU:
+        constellation = UBX_CONSTELLATION_BEIDOU;
+        break;
+    default:
+        break;
+    }
+    return constellation;
+}
+
+/*******************************************************************/
+static void _UBX_reset_satellites_statistics(void) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Reset accumulators.
+    ubx_ctx.rx_satellites_used = 0;
+    ubx_ctx.rx_satellites_tracked = 0;
+    for (idx = 0; idx < UBX_CONSTELLATION_LAST; idx++) {
+        ubx_ctx.rx_cno_max[idx] = 0;
+        ubx_ctx.rx_cno_sum[idx] = 0;
+        ubx_ctx.rx_cno_count[idx] = 0;
+    }
+}
+
+/*******************************************************************/
+static void _UBX_process_satellites_byte(uint8_t data) {
+    // Local variables.
+    UBX_constellation_t constellation = UBX_CONSTELLATION_LAST;
+    uint16_t block_offset = 0;
+    // Skip message header.
+    if (ubx_ctx.rx_index < UBX_NAV_SAT_HEADER_SIZE_BYTES) goto errors;
+    block_offset = (uint16_t) ((ubx_ctx.rx_index - UBX_NAV_SAT_HEADER_SIZE_BYTES) % UBX_NAV_SAT_BLOCK_SIZE_BYTES);
+    // Decode satellite block.
+    switch (block_offset) {
+    case UBX_NAV_SAT_BLOCK_OFFSET_GNSS_ID:
+        ubx_ctx.rx_sv_gnss_id = data;
+        break;
+    case UBX_NAV_SAT_BLOCK_OFFSET_CNO:
+        ubx_ctx.rx_sv_cno = data;
+        break;
+    case UBX_NAV_SAT_BLOCK_OFFSET_FLAGS:
+        // Satellites used in the navigation solution.
+        if ((data & UBX_NAV_SAT_FLAGS_SV_USED) != 0) {
+            ubx_ctx.rx_satellites_used++;
+        }
+        // Only satellites with a signal are taken into account.
+        if (ubx_ctx.rx_sv_cno == 0) break;
+        ubx_ctx.rx_satellites_tracked++;
+        constellation = _UBX_get_constellation(ubx_ctx.rx_sv_gnss_id);
+        if (constellation >= UBX_CONSTELLATION_LAST) break;
+        if (ubx_ctx.rx_sv_cno > ubx_ctx.rx_cno_max[constellation]) {
+            ubx_ctx.rx_cno_max[constellation] = ubx_ctx.rx_sv_cno;
+        }
+        ubx_ctx.rx_cno_sum[constellation] = (uint16_t) (ubx_ctx.rx_cno_sum[constellation] + ubx_ctx.rx_sv_cno);
+        ubx_ctx.rx_cno_count[constellation]++;
+        break;
+    default:
+        break;
+    }
+errors:
+    return;
+}
+
+/*******************************************************************/
+static void _UBX_convert_coordinate(int32_t coordinate, uint8_t* degrees, uint8_t* minutes, uint32_t* seconds, uint8_t* positive_flag) {
+    // Local variables.
+    uint32_t absolute = (coordinate < 0) ? ((uint32_t) (-coordinate)) : ((uint32_t) coordinate);
+    uint32_t remainder = 0;
+    // Coordinate is given in 1e-7 degrees.
+    (*positive_flag) = (coordinate < 0) ? 0 : 1;
+    (*degrees) = (uint8_t) (absolute / UBX_COORDINATE_SCALE);
+    remainder = ((absolute % UBX_COORDINATE_SCALE) * 60);
+    (*minutes) = (uint8_t) (remainder / UBX_COORDINATE_SCALE);
+    remainder = ((remainder % UBX_COORDINATE_SCALE) * 60);
+    // Seconds are expressed in thousandths like the NMEA path.
+    (*seconds) = (remainder / (UBX_COORDINATE_SCALE / 1000));
+}
+
+/*** UBX functions ***/
+
+/*******************************************************************/
+UBX_status_t UBX_start(UBX_message_t message, UBX_frame_cb_t frame_callback) {
+    // Local variables.
+    UBX_status_t status = UBX_SUCCESS;
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+    // Check parameters.
+    if (message >= UBX_MESSAGE_LAST) {
+        status = UBX_ERROR_MESSAGE;
+        goto errors;
+    }
+    if (frame_callback == NULL) {
+        status = UBX_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (ubx_ctx.running != 0) {
+        status = UBX_ERROR_STATE;
+        goto errors;
+    }
+    // Disable NMEA output and enable the required message only.
+    status = _UBX_set_output_protocol(UBX_CFG_PRT_PROTOCOL_UBX);
+    if (status != UBX_SUCCESS) goto errors;
+    status = _UBX_set_message_rate(message, 1);
+    if (status != UBX_SUCCESS) goto errors;
+    // Reset context.
+    ubx_ctx.message = message;
+    ubx_ctx.frame_callback = frame_callback;
+    ubx_ctx.rx_state = UBX_RX_STATE_SYNC_1;
+    ubx_ctx.frame_received = 0;
+    // Take UART ownership and start reception.
+    ubx_ctx.running = 1;
+    neom8x_status = NEOM8X_HW_start_rx();
+    NEOM8X_exit_error(UBX_ERROR_BASE_NEOM8X);
+    return status;
+errors:
+    UBX_stop();
+    return status;
+}
+
+/*******************************************************************/
+UBX_status_t UBX_stop(void) {
+    // Local variables.
+    UBX_status_t status = UBX_SUCCESS;
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+    // Stop reception.
+    neom8x_status = NEOM8X_HW_stop_rx();
+    ubx_ctx.running = 0;
+    NEOM8X_exit_error(UBX_ERROR_BASE_NEOM8X);
+    // Disable message and restore NMEA output for the NEOM8X driver.
+    if (ubx_ctx.message < UBX_MESSAGE_LAST) {
+        status = _UBX_set_message_rate(ubx_ctx.message, 0);
+        if (status != UBX_SUCCESS) goto errors;
+    }
+    status = _UBX_set_output_protocol(UBX_CFG_PRT_PROTOCOL_UBX | UBX_CFG_PRT_PROTOCOL_NMEA);
+    if (status != UBX_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+uint8_t UBX_is_running(void) {
+    return (ubx_ctx.running);
+}
+
+/*******************************************************************/
+void UBX_rx_irq_callback(uint8_t data) {
+    // Local variables.
+    uint16_t idx = 0;
+    // Update checksum over class, ID, length and payload fields.
+    if ((ubx_ctx.rx_state >= UBX_RX_STATE_CLASS) && (ubx_ctx.rx_state <= UBX_RX_STATE_PAYLOAD)) {
+        ubx_ctx.rx_checksum_a = (uint8_t) (ubx_ctx.rx_checksum_a + data);
+        ubx_ctx.rx_checksum_b = (uint8_t) (ubx_ctx.rx_checksum_b + ubx_ctx.rx_checksum_a);
+    }
+    // Frame state machine.
+    switch (ubx_ctx.rx_state) {
+    case UBX_RX_STATE_SYNC_1:
+        if (data == UBX_SYNC_CHAR_1) {
+            ubx_ctx.rx_state = UBX_RX_STATE_SYNC_2;
+        }
+        break;
+    case UBX_RX_STATE_SYNC_2:
+        ubx_ctx.rx_checksum_a = 0;
+        ubx_ctx.rx_checksum_b = 0;
+        ubx_ctx.rx_state = (data == UBX_SYNC_CHAR_2) ? UBX_RX_STATE_CLASS : UBX_RX_STATE_SYNC_1;
+        break;
+    case UBX_RX_STATE_CLASS:
+        ubx_ctx.rx_class = data;
+        ubx_ctx.rx_state = UBX_RX_STATE_ID;
+        break;
+    case UBX_RX_STATE_ID:
+        ubx_ctx.rx_id = data;
+        ubx_ctx.rx_state = UBX_RX_STATE_LENGTH_LSB;
+        break;
+    case UBX_RX_STATE_LENGTH_LSB:
+        ubx_ctx.rx_length = data;
+        ubx_ctx.rx_state = UBX_RX_STATE_LENGTH_MSB;
+        break;
+    case UBX_RX_STATE_LENGTH_MSB:
+        ubx_ctx.rx_length |= (uint16_t) (((uint16_t) data) << 8);
+        ubx_ctx.rx_index = 0;
+        // Satellites information is not stored but processed on the fly.
+        if ((ubx_ctx.rx_class == UBX_CLASS_NAV) && (ubx_ctx.rx_id == UBX_ID_NAV_SAT)) {
+            _UBX_reset_satellites_statistics();
+            ubx_ctx.rx_state = (ubx_ctx.rx_length == 0) ? UBX_RX_STATE_CHECKSUM_A : UBX_RX_STATE_PAYLOAD;
+        }
+        // Drop frames which do not fit the buffer.
+        else if (ubx_ctx.rx_length > UBX_PAYLOAD_SIZE_MAX_BYTES) {
+            ubx_ctx.rx_state = UBX_RX_STATE_SYNC_1;
+        }
+        else {
+            ubx_ctx.rx_state = (ubx_ctx.rx_length == 0) ? UBX_RX_STATE_CHECKSUM_A : UBX_RX_STATE_PAYLOAD;
+        }
+        break;
+    case UBX_RX_STATE_PAYLOAD:
+        if ((ubx_ctx.rx_class == UBX_CLASS_NAV) && (ubx_ctx.rx_id == UBX_ID_NAV_SAT)) {
+            _UBX_process_satellites_byte(data);
+            ubx_ctx.rx_index++;
+        }
+        else {
+            ubx_ctx.rx_payload[ubx_ctx.rx_index++] = data;
+        }
+        if (ubx_ctx.rx_index >= ubx_ctx.rx_length) {
+            ubx_ctx.rx_state = UBX_RX_STATE_CHECKSUM_A;
+        }
+        break;
+    case UBX_RX_STATE_CHECKSUM_A:
+        ubx_ctx.rx_state = (data == ubx_ctx.rx_checksum_a) ? UBX_RX_STATE_CHECKSUM_B : UBX_RX_STATE_SYNC_1;
+        break;
+    case UBX_RX_STATE_CHECKSUM_B:
+        // Keep only the expected message.
+        if ((data == ubx_ctx.rx_checksum_b) &&
+            (ubx_ctx.rx_class == UBX_MESSAGE[ubx_ctx.message].message_class) &&
+            (ubx_ctx.rx_id == UBX_MESSAGE[ubx_ctx.message].message_id) &&
+            ((ubx_ctx.rx_length == UBX_MESSAGE[ubx_ctx.message].payload_size_bytes) || (UBX_MESSAGE[ubx_ctx.message].payload_size_bytes == 0)) &&
+            (ubx_ctx.frame_received == 0)) {
+            if (ubx_ctx.message == UBX_MESSAGE_NAV_SAT) {
+                // Save satellites statistics.
+                ubx_ctx.frame_quality.satellites_used = ubx_ctx.rx_satellites_used;
+                ubx_ctx.frame_quality.satellites_tracked = ubx_ctx.rx_satellites_tracked;
+                for (idx = 0; idx < UBX_CONSTELLATION_LAST; idx++) {
+                    ubx_ctx.frame_quality.cno_max[idx] = ubx_ctx.rx_cno_max[idx];
+                    ubx_ctx.frame_quality.cno_mean[idx] = (ubx_ctx.rx_cno_count[idx] == 0) ? 0 : (uint8_t) (ubx_ctx.rx_cno_sum[idx] / ubx_ctx.rx_cno_count[idx]);
+                }
+            }
+            else {
+                // Copy payload.
+                for (idx = 0; idx < ubx_ctx.rx_length; idx++) {
+                    ubx_ctx.frame_payload[idx] = ubx_ctx.rx_payload[idx];
+                }
+            }
+            ubx_ctx.frame_received = 1;
+            if (ubx_ctx.frame_callback != NULL) {
+                ubx_ctx.frame_callback();
+            }
+        }
+        ubx_ctx.rx_state = UBX_RX_STATE_SYNC_1;
+        break;
+    default:
+        ubx_ctx.rx_state = UBX_RX_STATE_SYNC_1;
+        break;
+    }
+}
+
+/*******************************************************************/
+UBX_status_t UBX_get_time(NEOM8X_time_t* gps_time, uint8_t* time_valid) {
+    // Local variables.
+    UBX_status_t status = UBX_SUCCESS;
+    // Check parameters.
+    if ((gps_time == NULL) || (time_valid == NULL)) {
+        status = UBX_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*time_valid) = 0;
+    // Check frame.
+    if ((ubx_ctx.frame_received == 0) || (ubx_ctx.message != UBX_MESSAGE_NAV_TIMEUTC)) goto errors;
+    // Decode NAV-TIMEUTC payload.
+    gps_time->year = _UBX_read_u16(ubx_ctx.frame_payload, 12);
+    gps_time->month = ubx_ctx.frame_payload[14];
+    gps_time->date = ubx_ctx.frame_payload[15];
+    gps_time->hours = ubx_ctx.frame_payload[16];
+    gps_time->minutes = ubx_ctx.frame_payload[17];
+    gps_time->seconds = ubx_ctx.frame_payload[18];
+    (*time_valid) = ((ubx_ctx.frame_payload[19] & UBX_NAV_TIMEUTC_VALID_UTC) != 0) ? 1 : 0;
+    // Release buffer.
+    ubx_ctx.frame_received = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UBX_status_t UBX_get_position(UBX_position_t* ubx_position) {
+    // Local variables.
+    UBX_status_t status = UBX_SUCCESS;
+    int32_t altitude_mm = 0;
+    // Check parameters.
+    if (ubx_position == NULL) {
+        status = UBX_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    ubx_position->fix_ok = 0;
+    // Check frame.
+    if ((ubx_ctx.frame_received == 0) || (ubx_ctx.message != UBX_MESSAGE_NAV_PVT)) goto errors;
+    // Decode NAV-PVT payload.
+    ubx_position->fix_type = ubx_ctx.frame_payload[20];
+    ubx_position->fix_ok = ((ubx_ctx.frame_payload[21] & UBX_NAV_PVT_FLAGS_GNSS_FIX_OK) != 0) ? 1 : 0;
+    ubx_position->number_of_satellites = ubx_ctx.frame_payload[23];
+    _UBX_convert_coordinate((int32_t) _UBX_read_u32(ubx_ctx.frame_payload, 28), &(ubx_position->position.lat_degrees), &(ubx_position->position.lat_minutes), &(ubx_position->position.lat_seconds), &(ubx_position->position.lat_north_flag));
+    _UBX_convert_coordinate((int32_t) _UBX_read_u32(ubx_ctx.frame_payload, 24), &(ubx_position->position.long_degrees), &(ubx_position->position.long_minutes), &(ubx_position->position.long_seconds), &(ubx_position->position.long_east_flag));
+    // Altitude above mean sea level in mm.
+    altitude_mm = (int32_t) _UBX_read_u32(ubx_ctx.frame_payload, 36);
+    ubx_position->position.altitude = (altitude_mm < 0) ? 0 : (uint32_t) (altitude_mm / 1000);
+    ubx_position->horizontal_accuracy_mm = _UBX_read_u32(ubx_ctx.frame_payload, 40);
+    ubx_position->pdop = _UBX_read_u16(ubx_ctx.frame_payload, 76);
+    // Release buffer.
+    ubx_ctx.frame_received = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UBX_status_t UBX_set_power_mode(UBX_power_mode_configuration_t* configuration) {
+    // Local variables.
+    UBX_status_t status = UBX_SUCCESS;
+    uint8_t pm2_payload[UBX_CFG_PM2_PAYLOAD_SIZE_BYTES] = { 0x00 };
+    uint8_t rxm_payload[UBX_CFG_RXM_PAYLOAD_SIZE_BYTES];
+    uint32_t flags = (UBX_CFG_PM2_FLAGS_UPDATE_RTC | UBX_CFG_PM2_FLAGS_UPDATE_EPH);
+    // Check parameters.
+    if (configuration == NULL) {
+        status = UBX_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((configuration->mode) >= UBX_POWER_MODE_LAST) {
+        status = UBX_ERROR_MESSAGE;
+        goto errors;
+    }
+    // Power save parameters are only relevant out of continuous mode.
+    if ((configuration->mode) != UBX_POWER_MODE_CONTINUOUS) {
+        flags |= ((configuration->mode) == UBX_POWER_MODE_CYCLIC_TRACKING) ? UBX_CFG_PM2_FLAGS_MODE_CYCLIC : UBX_CFG_PM2_FLAGS_MODE_ON_OFF;
+        pm2_payload[0] = UBX_CFG_PM2_VERSION;
+        _UBX_write_u32(pm2_payload, 4, flags);
+        _UBX_write_u32(pm2_payload, 8, (configuration->update_period_ms));
+        _UBX_write_u32(pm2_payload, 12, (configuration->search_period_ms));
+        status = _UBX_send_frame(UBX_CLASS_CFG, UBX_ID_CFG_PM2, pm2_payload, UBX_CFG_PM2_PAYLOAD_SIZE_BYTES);
+        if (status != UBX_SUCCESS) goto errors;
+    }
+    // Select low power mode.
+    rxm_payload[0] = UBX_CFG_RXM_RESERVED;
+    rxm_payload[1] = ((configuration->mode) == UBX_POWER_MODE_CONTINUOUS) ? UBX_CFG_RXM_LP_MODE_CONTINUOUS : UBX_CFG_RXM_LP_MODE_POWER_SAVE;
+    status = _UBX_send_frame(UBX_CLASS_CFG, UBX_ID_CFG_RXM, rxm_payload, UBX_CFG_RXM_PAYLOAD_SIZE_BYTES);
+    if (status != UBX_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UBX_status_t UBX_set_aiding_configuration(uint8_t autonomous_aiding_enable) {
+    // Local variables.
+    uint8_t payload[UBX_CFG_NAVX5_PAYLOAD_SIZE_BYTES] = { 0x00 };
+    // Only acknowledgment and autonomous aiding fields are applied.
+    _UBX_write_u16(payload, 0, UBX_CFG_NAVX5_VERSION);
+    _UBX_write_u16(payload, 2, (UBX_CFG_NAVX5_MASK1_ACK_AID | UBX_CFG_NAVX5_MASK1_AOP));
+    payload[17] = UBX_CFG_NAVX5_ACK_AIDING_ENABLE;
+    payload[27] = (autonomous_aiding_enable == 0) ? 0x00 : UBX_CFG_NAVX5_AOP_CFG_USE_AOP;
+    return _UBX_send_frame(UBX_CLASS_CFG, UBX_ID_CFG_NAVX5, payload, UBX_CFG_NAVX5_PAYLOAD_SIZE_BYTES);
+}
+
+/*******************************************************************/
+UBX_status_t UBX_inject_assistance(uint8_t* data, uint32_t data_size_bytes, uint32_t* frame_size_bytes, uint8_t* acknowledged) {
+    // Local variables.
+    UBX_status_t status = UBX_SUCCESS;
+    uint16_t payload_size_bytes = 0;
+    uint8_t checksum_a = 0;
+    uint8_t checksum_b = 0;
+    // Check parameters.
+    if ((data == NULL) || (frame_size_bytes == NULL) || (acknowledged == NULL)) {
+        status = UBX_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*frame_size_bytes) = 0;
+    (*acknowledged) = 0;
+    // Wait for complete header.
+    if (data_size_bytes < UBX_HEADER_SIZE_BYTES) goto errors;
+    // Check framing.
+    if ((data[0] != UBX_SYNC_CHAR_1) || (data[1] != UBX_SYNC_CHAR_2) || (data[2] != UBX_CLASS_MGA)) {
+        status = UBX_ERROR_FRAME;
+        goto errors;
+    }
+    // Wait for complete frame.
+    payload_size_bytes = _UBX_read_u16(data, 4);
+    if (data_size_bytes < (uint32_t) (UBX_HEADER_SIZE_BYTES + payload_size_bytes + UBX_CHECKSUM_SIZE_BYTES)) goto errors;
+    // Check checksum.
+    _UBX_compute_checksum(data, payload_size_bytes, &checksum_a, &checksum_b);
+    if ((data[UBX_HEADER_SIZE_BYTES + payload_size_bytes] != checksum_a) || (data[UBX_HEADER_SIZE_BYTES + payload_size_bytes + 1] != checksum_b)) {
+        status = UBX_ERROR_FRAME;
+        goto errors;
+    }
+    (*frame_size_bytes) = (uint32_t) (UBX_HEADER_SIZE_BYTES + payload_size_bytes + UBX_CHECKSUM_SIZE_BYTES);
+    // Send message and wait for MGA-ACK (flow control).
+    status = _UBX_request(data, (*frame_size_bytes), UBX_MESSAGE_MGA_ACK);
+    if (status == UBX_ERROR_TIMEOUT) {
+        // Message is considered as not acknowledged.
+        status = UBX_SUCCESS;
+        goto errors;
+    }
+    if (status != UBX_SUCCESS) goto errors;
+    // Check acknowledgment type and message ID.
+    if ((ubx_ctx.frame_payload[0] == UBX_MGA_ACK_TYPE_ACCEPTED) && (ubx_ctx.frame_payload[3] == data[3])) {
+        (*acknowledged) = 1;
+    }
+    ubx_ctx.frame_received = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UBX_status_t UBX_get_autonomous_aiding_status(uint8_t* autonomous_aiding_running) {
+    // Local variables.
+    UBX_status_t status = UBX_SUCCESS;
+    // Check parameters.
+    if (autonomous_aiding_running == NULL) {
+        status = UBX_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*autonomous_aiding_running) = 0;
+    // Poll NAV-AOPSTATUS.
+    status = _UBX_poll(UBX_MESSAGE_NAV_AOPSTATUS);
+    if (status != UBX_SUCCESS) goto errors;
+    // Status field is non zero while orbits are being computed.
+    (*autonomous_aiding_running) = (ubx_ctx.frame_payload[5] == 0) ? 0 : 1;
+    ubx_ctx.frame_received = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UBX_status_t UBX_get_quality(UBX_quality_t* ubx_quality) {
+    // Local variables.
+    UBX_status_t status = UBX_SUCCESS;
+    uint8_t idx = 0;
+    // Check parameters.
+    if (ubx_quality == NULL) {
+        status = UBX_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Poll dilution of precision.
+    status = _UBX_poll(UBX_MESSAGE_NAV_DOP);
+    if (status != UBX_SUCCESS) goto errors;
+    ubx_quality->pdop = _UBX_read_u16(ubx_ctx.frame_payload, 6);
+    ubx_quality->hdop = _UBX_read_u16(ubx_ctx.frame_payload, 12);
+    ubx_ctx.frame_received = 0;
+    // Poll satellites information.
+    status = _UBX_poll(UBX_MESSAGE_NAV_SAT);
+    if (status != UBX_SUCCESS) goto errors;
+    ubx_quality->satellites_used = ubx_ctx.frame_quality.satellites_used;
+    ubx_quality->satellites_tracked = ubx_ctx.frame_quality.satellites_tracked;
+    for (idx = 0; idx < UBX_CONSTELLATION_LAST; idx++) {
+        ubx_quality->cno_max[idx] = ubx_ctx.frame_quality.cno_max[idx];
+        ubx_quality->cno_mean[idx] = ubx_ctx.frame_quality.cno_mean[idx];
+    }
+    ubx_ctx.frame_received = 0;
+errors:
+    return status;
+}
+
+#endif /* GPSM */
@@ -13,7 +13,8 @@
  * \brief I2C slaves address mapping.
  *******************************************************************/
 typedef enum {
-    I2C_ADDRESS_SHT30 = 0x44
+    I2C_ADDRESS_SHT30 = 0x44,
+    I2C_ADDRESS_SHT30_SECONDARY = 0x45
 } I2C_address_mapping_t;
 
 #endif /* __I2C_ADDRESS_H__ */
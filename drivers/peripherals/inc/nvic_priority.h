@@ -25,8 +25,15 @@ typedef enum {
 #ifdef XM_RGB_LED
     NVIC_PRIORITY_LED = 1,
 #endif
+#if ((defined LVRM) && (defined HW2_0))
+    NVIC_PRIORITY_LOAD = 1,
+#endif
 #ifdef GPSM
     NVIC_PRIORITY_GPS_UART = 0,
+    NVIC_PRIORITY_GPS_TIMEPULSE = 1,
+#endif
+#ifdef SM
+    NVIC_PRIORITY_DIGITAL_INPUTS = 1,
 #endif
 #ifdef UHFM
     NVIC_PRIORITY_SIGFOX_RADIO_IRQ_GPIO = 0,
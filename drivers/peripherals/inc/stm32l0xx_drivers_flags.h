@@ -12,15 +12,23 @@
 
 /*** STM32L0xx drivers compilation flags ***/
 
+#ifdef GPSM_GPS_UART_DMA
+#define STM32L0XX_DRIVERS_DMA_CHANNEL_MASK              0x10
+#else
 #define STM32L0XX_DRIVERS_DMA_CHANNEL_MASK              0x00
+#endif
 
 #ifdef UHFM
 #define STM32L0XX_DRIVERS_EXTI_GPIO_MASK                0x0800
+#elif (defined GPSM)
+#define STM32L0XX_DRIVERS_EXTI_GPIO_MASK                0x8000
+#elif (defined SM)
+#define STM32L0XX_DRIVERS_EXTI_GPIO_MASK                0x0603
 #else
 #define STM32L0XX_DRIVERS_EXTI_GPIO_MASK                0x0000
 #endif
 
-//#define STM32L0XX_DRIVERS_I2C_FAST_MODE
+#define STM32L0XX_DRIVERS_I2C_FAST_MODE
 
 #define STM32L0XX_DRIVERS_LPUART_MODE                   2
 //#define STM32L0XX_DRIVERS_LPUART_DISABLE_TX_0
@@ -36,9 +44,12 @@
 #if ((defined BPSM) || (defined SM))
 #define STM32L0XX_DRIVERS_TIM_MODE_MASK                 0x00
 #endif
-#if ((defined LVRM) || (defined DDRM) || (defined RRM))
+#if (((defined LVRM) && (defined HW1_0)) || (defined DDRM) || (defined RRM))
 #define STM32L0XX_DRIVERS_TIM_MODE_MASK                 0x09
 #endif
+#if ((defined LVRM) && (defined HW2_0))
+#define STM32L0XX_DRIVERS_TIM_MODE_MASK                 0x0B
+#endif
 #ifdef GPSM
 #define STM32L0XX_DRIVERS_TIM_MODE_MASK                 0x0D
 #endif
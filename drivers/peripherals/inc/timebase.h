@@ -0,0 +1,173 @@
+/*
+ * timebase.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TIMEBASE_H__
+#define __TIMEBASE_H__
+
+#include "types.h"
+#include "xm_flags.h"
+
+/*** TIMEBASE macros ***/
+
+#define TIMEBASE_CYCLE_COUNTER_MASK     0x00FFFFFF
+#define TIMEBASE_RTC_SECONDS_PER_DAY    86400
+#define TIMEBASE_HSI_TRIM_MAX           0x1F
+
+/*** TIMEBASE structures ***/
+
+/*!******************************************************************
+ * \enum TIMEBASE_status_t
+ * \brief TIMEBASE driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    TIMEBASE_SUCCESS = 0,
+    TIMEBASE_ERROR_NULL_PARAMETER,
+    TIMEBASE_ERROR_RTC_READ,
+    TIMEBASE_ERROR_RTC_CALIBRATION_PENDING,
+    TIMEBASE_ERROR_RTC_SYNCHRONIZATION,
+    // Last base value.
+    TIMEBASE_ERROR_BASE_LAST = 0x0100
+} TIMEBASE_status_t;
+
+#ifdef XM_TIMEBASE
+
+/*!******************************************************************
+ * \struct TIMEBASE_rtc_time_t
+ * \brief RTC calendar time of the day.
+ *******************************************************************/
+typedef struct {
+    uint32_t seconds;
+    uint32_t ticks;
+} TIMEBASE_rtc_time_t;
+
+/*** TIMEBASE functions ***/
+
+/*!******************************************************************
+ * \fn void TIMEBASE_init(void)
+ * \brief Init timebase driver.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ * \note        RTC_init() must have been called before.
+ *******************************************************************/
+void TIMEBASE_init(void);
+
+/*!******************************************************************
+ * \fn void TIMEBASE_enable_rtc_direct_read(void)
+ * \brief Read the RTC calendar counters without shadow registers.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ * \note        Requests are counted: the previous RTC read mode is restored by the last TIMEBASE_disable_rtc_direct_read() call.
+ *******************************************************************/
+void TIMEBASE_enable_rtc_direct_read(void);
+
+/*!******************************************************************
+ * \fn void TIMEBASE_disable_rtc_direct_read(void)
+ * \brief Release a direct read request.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TIMEBASE_disable_rtc_direct_read(void);
+
+/*!******************************************************************
+ * \fn void TIMEBASE_start_cycle_counter(void)
+ * \brief Start the free running 24-bits HSI cycles down counter.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TIMEBASE_start_cycle_counter(void);
+
+/*!******************************************************************
+ * \fn void TIMEBASE_stop_cycle_counter(void)
+ * \brief Stop the HSI cycles counter.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TIMEBASE_stop_cycle_counter(void);
+
+/*!******************************************************************
+ * \fn uint32_t TIMEBASE_get_cycle_counter(void)
+ * \brief Read the HSI cycles counter.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current counter value.
+ *******************************************************************/
+uint32_t TIMEBASE_get_cycle_counter(void);
+
+/*!******************************************************************
+ * \fn uint32_t TIMEBASE_get_rtc_ticks_per_second(void)
+ * \brief Get the RTC sub-seconds resolution.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of RTC ticks per second.
+ *******************************************************************/
+uint32_t TIMEBASE_get_rtc_ticks_per_second(void);
+
+/*!******************************************************************
+ * \fn TIMEBASE_status_t TIMEBASE_get_rtc_time(TIMEBASE_rtc_time_t* rtc_time)
+ * \brief Read the RTC calendar time of the day.
+ * \param[in]   none
+ * \param[out]  rtc_time: Pointer to the time in seconds and in RTC ticks since midnight.
+ * \retval      Function execution status.
+ * \note        This function does not write any RTC register and can be called from interrupts only when direct read is enabled.
+ * \note        Otherwise, it waits for the shadow registers synchronization and must be called in process context.
+ *******************************************************************/
+TIMEBASE_status_t TIMEBASE_get_rtc_time(TIMEBASE_rtc_time_t* rtc_time);
+
+/*!******************************************************************
+ * \fn int32_t TIMEBASE_get_rtc_calibration(void)
+ * \brief Read the current RTC smooth calibration.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Calibration in steps of 0.954ppm (positive values speed up the calendar).
+ *******************************************************************/
+int32_t TIMEBASE_get_rtc_calibration(void);
+
+/*!******************************************************************
+ * \fn TIMEBASE_status_t TIMEBASE_set_rtc_calibration(int32_t calibration_step, uint32_t* rtc_calr)
+ * \brief Set the RTC smooth calibration.
+ * \param[in]   calibration_step: Calibration in steps of 0.954ppm, clamped to the hardware range.
+ * \param[out]  rtc_calr: Pointer to the programmed calibration register value.
+ * \retval      Function execution status.
+ *******************************************************************/
+TIMEBASE_status_t TIMEBASE_set_rtc_calibration(int32_t calibration_step, uint32_t* rtc_calr);
+
+/*!******************************************************************
+ * \fn uint8_t TIMEBASE_get_hsi_trim(void)
+ * \brief Read the HSI oscillator trimming value.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current trimming value.
+ *******************************************************************/
+uint8_t TIMEBASE_get_hsi_trim(void);
+
+/*!******************************************************************
+ * \fn void TIMEBASE_set_hsi_trim(uint8_t hsi_trim)
+ * \brief Set the HSI oscillator trimming value.
+ * \param[in]   hsi_trim: Trimming value to set (higher value increases frequency).
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TIMEBASE_set_hsi_trim(uint8_t hsi_trim);
+
+/*******************************************************************/
+#define TIMEBASE_exit_error(base) { ERROR_check_exit(timebase_status, TIMEBASE_SUCCESS, base) }
+
+/*******************************************************************/
+#define TIMEBASE_stack_error(base) { ERROR_check_stack(timebase_status, TIMEBASE_SUCCESS, base) }
+
+/*******************************************************************/
+#define TIMEBASE_stack_exit_error(base, code) { ERROR_check_stack_exit(timebase_status, TIMEBASE_SUCCESS, base, code) }
+
+#endif /* XM_TIMEBASE */
+
+#endif /* __TIMEBASE_H__ */
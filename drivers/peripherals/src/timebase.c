@@ -0,0 +1,261 @@
+/*
+ * timebase.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "timebase.h"
+
+#include "rcc_registers.h"
+#include "rtc_registers.h"
+#include "types.h"
+#include "xm_flags.h"
+
+#ifdef XM_TIMEBASE
+
+/*** TIMEBASE local macros ***/
+
+// stm32l0xx-drivers has no API for the SysTick counter, the RTC sub-seconds and smooth calibration or the HSI trimming:
+// this driver is the only place accessing these registers. Backup domain write access (PWR_CR.DBP) is granted by the RCC driver when starting the LSE.
+// Cortex-M0+ SysTick is used as a free running 24-bits HSI cycles counter.
+#define TIMEBASE_SYSTICK_CSR                    (*((volatile uint32_t*) 0xE000E010))
+#define TIMEBASE_SYSTICK_RVR                    (*((volatile uint32_t*) 0xE000E014))
+#define TIMEBASE_SYSTICK_CVR                    (*((volatile uint32_t*) 0xE000E018))
+#define TIMEBASE_SYSTICK_CSR_ENABLE             0x00000005
+
+#define TIMEBASE_RTC_CR_BYPSHAD                 0x00000020
+#define TIMEBASE_RTC_ISR_RSF                    0x00000020
+// Clear RSF and keep INIT cleared, writing 1 to the other flags has no effect.
+#define TIMEBASE_RTC_ISR_RSF_CLEAR_MASK         0xFFFFFF5F
+#define TIMEBASE_RTC_RSF_TIMEOUT                1000000
+#define TIMEBASE_RTC_PRER_PREDIV_S_MASK         0x00007FFF
+#define TIMEBASE_RTC_READ_RETRIES               4
+#define TIMEBASE_RTC_CALIBRATION_STEP_MAX       512
+#define TIMEBASE_RTC_CALIBRATION_STEP_MIN       (-511)
+#define TIMEBASE_RTC_CALR_CALP                  0x00008000
+#define TIMEBASE_RTC_CALR_CALM_MASK             0x000001FF
+#define TIMEBASE_RTC_ISR_RECALPF                0x00010000
+#define TIMEBASE_RTC_RECALPF_TIMEOUT            1000000
+
+#define TIMEBASE_RCC_ICSCR_HSI_TRIM_SHIFT       8
+
+/*** TIMEBASE local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t rtc_direct_read_count;
+    uint32_t rtc_bypshad;
+} TIMEBASE_context_t;
+
+/*** TIMEBASE local global variables ***/
+
+static TIMEBASE_context_t timebase_ctx;
+
+/*** TIMEBASE local functions ***/
+
+/*******************************************************************/
+static uint32_t _TIMEBASE_bcd_to_binary(uint32_t bcd) {
+    return ((((bcd >> 4) & 0x0F) * 10) + (bcd & 0x0F));
+}
+
+/*******************************************************************/
+static void _TIMEBASE_unlock_rtc(void) {
+    // Disable write protection.
+    RTC->WPR = 0xCA;
+    RTC->WPR = 0x53;
+}
+
+/*******************************************************************/
+static void _TIMEBASE_lock_rtc(void) {
+    // Enable write protection.
+    RTC->WPR = 0xFF;
+}
+
+/*******************************************************************/
+static TIMEBASE_status_t _TIMEBASE_synchronize_rtc_shadow(void) {
+    // Local variables.
+    TIMEBASE_status_t status = TIMEBASE_SUCCESS;
+    uint32_t loop_count = 0;
+    // Shadow registers are not updated in stop mode: wait for the next copy.
+    _TIMEBASE_unlock_rtc();
+    RTC->ISR = TIMEBASE_RTC_ISR_RSF_CLEAR_MASK;
+    _TIMEBASE_lock_rtc();
+    while (((RTC->ISR) & TIMEBASE_RTC_ISR_RSF) == 0) {
+        loop_count++;
+        if (loop_count > TIMEBASE_RTC_RSF_TIMEOUT) {
+            status = TIMEBASE_ERROR_RTC_SYNCHRONIZATION;
+            goto errors;
+        }
+    }
+errors:
+    return status;
+}
+
+/*** TIMEBASE functions ***/
+
+/*******************************************************************/
+void TIMEBASE_init(void) {
+    // RTC read mode is left to the RTC driver outside direct read windows.
+    timebase_ctx.rtc_direct_read_count = 0;
+    timebase_ctx.rtc_bypshad = 0;
+}
+
+/*******************************************************************/
+void TIMEBASE_enable_rtc_direct_read(void) {
+    // Bypass shadow registers on first request only.
+    if (timebase_ctx.rtc_direct_read_count == 0) {
+        timebase_ctx.rtc_bypshad = ((RTC->CR) & TIMEBASE_RTC_CR_BYPSHAD);
+        _TIMEBASE_unlock_rtc();
+        RTC->CR |= TIMEBASE_RTC_CR_BYPSHAD;
+        _TIMEBASE_lock_rtc();
+    }
+    timebase_ctx.rtc_direct_read_count++;
+}
+
+/*******************************************************************/
+void TIMEBASE_disable_rtc_direct_read(void) {
+    // Check state.
+    if (timebase_ctx.rtc_direct_read_count == 0) return;
+    timebase_ctx.rtc_direct_read_count--;
+    // Restore previous RTC read mode once all requesters are released.
+    if ((timebase_ctx.rtc_direct_read_count == 0) && (timebase_ctx.rtc_bypshad == 0)) {
+        _TIMEBASE_unlock_rtc();
+        RTC->CR &= ~TIMEBASE_RTC_CR_BYPSHAD;
+        _TIMEBASE_lock_rtc();
+    }
+}
+
+/*******************************************************************/
+void TIMEBASE_start_cycle_counter(void) {
+    TIMEBASE_SYSTICK_RVR = TIMEBASE_CYCLE_COUNTER_MASK;
+    TIMEBASE_SYSTICK_CVR = 0;
+    TIMEBASE_SYSTICK_CSR = TIMEBASE_SYSTICK_CSR_ENABLE;
+}
+
+/*******************************************************************/
+void TIMEBASE_stop_cycle_counter(void) {
+    TIMEBASE_SYSTICK_CSR = 0;
+}
+
+/*******************************************************************/
+uint32_t TIMEBASE_get_cycle_counter(void) {
+    return (TIMEBASE_SYSTICK_CVR);
+}
+
+/*******************************************************************/
+uint32_t TIMEBASE_get_rtc_ticks_per_second(void) {
+    return (((RTC->PRER) & TIMEBASE_RTC_PRER_PREDIV_S_MASK) + 1);
+}
+
+/*******************************************************************/
+TIMEBASE_status_t TIMEBASE_get_rtc_time(TIMEBASE_rtc_time_t* rtc_time) {
+    // Local variables.
+    TIMEBASE_status_t status = TIMEBASE_ERROR_RTC_READ;
+    uint32_t rtc_prediv_s = ((RTC->PRER) & TIMEBASE_RTC_PRER_PREDIV_S_MASK);
+    uint32_t rtc_ssr = 0;
+    uint32_t rtc_tr = 0;
+    uint32_t rtc_dr = 0;
+    uint32_t check_ssr = 0;
+    uint32_t check_tr = 0;
+    uint32_t check_dr = 0;
+    uint32_t idx = 0;
+    // Check parameter.
+    if (rtc_time == NULL) {
+        status = TIMEBASE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Shadow registers are up to date without any wait in direct read mode.
+    if (timebase_ctx.rtc_direct_read_count == 0) {
+        status = _TIMEBASE_synchronize_rtc_shadow();
+        if (status != TIMEBASE_SUCCESS) goto errors;
+        status = TIMEBASE_ERROR_RTC_READ;
+    }
+    // Counters are read twice to detect a sub-second edge occurring in between.
+    // In shadow mode, reading SSR freezes TR and DR until DR is read.
+    for (idx = 0; idx < TIMEBASE_RTC_READ_RETRIES; idx++) {
+        rtc_ssr = (RTC->SSR);
+        rtc_tr = (RTC->TR);
+        rtc_dr = (RTC->DR);
+        check_ssr = (RTC->SSR);
+        check_tr = (RTC->TR);
+        check_dr = (RTC->DR);
+        if ((rtc_ssr == check_ssr) && (rtc_tr == check_tr) && (rtc_dr == check_dr)) {
+            status = TIMEBASE_SUCCESS;
+            break;
+        }
+    }
+    if (status != TIMEBASE_SUCCESS) goto errors;
+    // Convert to seconds and sub-seconds of the day.
+    rtc_time->seconds = (_TIMEBASE_bcd_to_binary((rtc_tr >> 16) & 0x3F) * 3600);
+    rtc_time->seconds += (_TIMEBASE_bcd_to_binary((rtc_tr >> 8) & 0x7F) * 60);
+    rtc_time->seconds += _TIMEBASE_bcd_to_binary(rtc_tr & 0x7F);
+    rtc_time->ticks = (((rtc_time->seconds) * (rtc_prediv_s + 1)) + (rtc_prediv_s - rtc_ssr));
+errors:
+    return status;
+}
+
+/*******************************************************************/
+int32_t TIMEBASE_get_rtc_calibration(void) {
+    // Local variables.
+    uint32_t calr = (RTC->CALR);
+    // Positive steps use CALP (+512 pulses) compensated by CALM.
+    return ((((calr & TIMEBASE_RTC_CALR_CALP) != 0) ? TIMEBASE_RTC_CALIBRATION_STEP_MAX : 0) - (int32_t) (calr & TIMEBASE_RTC_CALR_CALM_MASK));
+}
+
+/*******************************************************************/
+TIMEBASE_status_t TIMEBASE_set_rtc_calibration(int32_t calibration_step, uint32_t* rtc_calr) {
+    // Local variables.
+    TIMEBASE_status_t status = TIMEBASE_SUCCESS;
+    uint32_t calr = 0;
+    uint32_t loop_count = 0;
+    // Check parameter.
+    if (rtc_calr == NULL) {
+        status = TIMEBASE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Clamp to smooth calibration range.
+    if (calibration_step > TIMEBASE_RTC_CALIBRATION_STEP_MAX) {
+        calibration_step = TIMEBASE_RTC_CALIBRATION_STEP_MAX;
+    }
+    if (calibration_step < TIMEBASE_RTC_CALIBRATION_STEP_MIN) {
+        calibration_step = TIMEBASE_RTC_CALIBRATION_STEP_MIN;
+    }
+    // Positive steps use CALP (+512 pulses) compensated by CALM.
+    if (calibration_step > 0) {
+        calr = (TIMEBASE_RTC_CALR_CALP | ((uint32_t) (TIMEBASE_RTC_CALIBRATION_STEP_MAX - calibration_step) & TIMEBASE_RTC_CALR_CALM_MASK));
+    }
+    else {
+        calr = ((uint32_t) (-calibration_step) & TIMEBASE_RTC_CALR_CALM_MASK);
+    }
+    // Wait for previous calibration to be taken into account.
+    while (((RTC->ISR) & TIMEBASE_RTC_ISR_RECALPF) != 0) {
+        loop_count++;
+        if (loop_count > TIMEBASE_RTC_RECALPF_TIMEOUT) {
+            status = TIMEBASE_ERROR_RTC_CALIBRATION_PENDING;
+            goto errors;
+        }
+    }
+    _TIMEBASE_unlock_rtc();
+    RTC->CALR = calr;
+    _TIMEBASE_lock_rtc();
+    (*rtc_calr) = calr;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+uint8_t TIMEBASE_get_hsi_trim(void) {
+    return ((uint8_t) (((RCC->ICSCR) >> TIMEBASE_RCC_ICSCR_HSI_TRIM_SHIFT) & TIMEBASE_HSI_TRIM_MAX));
+}
+
+/*******************************************************************/
+void TIMEBASE_set_hsi_trim(uint8_t hsi_trim) {
+    // Clamp value.
+    if (hsi_trim > TIMEBASE_HSI_TRIM_MAX) {
+        hsi_trim = TIMEBASE_HSI_TRIM_MAX;
+    }
+    RCC->ICSCR = (((RCC->ICSCR) & ~(((uint32_t) TIMEBASE_HSI_TRIM_MAX) << TIMEBASE_RCC_ICSCR_HSI_TRIM_SHIFT)) | (((uint32_t) hsi_trim) << TIMEBASE_RCC_ICSCR_HSI_TRIM_SHIFT));
+}
+
+#endif /* XM_TIMEBASE */
@@ -11,6 +11,12 @@
 #include "adc.h"
 #include "types.h"
 
+/*** ANALOG macros ***/
+
+#if ((defined SM) && (defined SM_AIN_ENABLE))
+#define ANALOG_FILTER_IIR_SHIFT_MAX     8
+#endif
+
 /*** ANALOG structures ***/
 
 /*!******************************************************************
@@ -24,6 +30,10 @@ typedef enum {
     ANALOG_ERROR_CHANNEL,
     ANALOG_ERROR_CALIBRATION_MISSING,
     ANALOG_ERROR_GAIN_TYPE,
+    ANALOG_ERROR_INPUT_TYPE,
+    ANALOG_ERROR_GAIN,
+    ANALOG_ERROR_CHANNEL_CONFIGURATION_MISSING,
+    ANALOG_ERROR_FILTER_IIR_SHIFT,
     // Low level drivers errors.
     ANALOG_ERROR_BASE_ADC = 0x0100,
     // Last base value.
@@ -75,6 +85,19 @@ typedef enum {
 } ANALOG_gain_type_t;
 #endif
 
+#if ((defined SM) && (defined SM_AIN_ENABLE))
+/*!******************************************************************
+ * \enum ANALOG_input_type_t
+ * \brief ANALOG input types list.
+ *******************************************************************/
+typedef enum {
+    ANALOG_INPUT_TYPE_VOLTAGE = 0,
+    ANALOG_INPUT_TYPE_CURRENT_4_20MA,
+    ANALOG_INPUT_TYPE_RATIOMETRIC,
+    ANALOG_INPUT_TYPE_LAST
+} ANALOG_input_type_t;
+#endif
+
 /*** ANALOG functions ***/
 
 /*!******************************************************************
@@ -104,6 +127,53 @@ ANALOG_status_t ANALOG_de_init(void);
  *******************************************************************/
 ANALOG_status_t ANALOG_convert_channel(ANALOG_channel_t channel, int32_t* analog_data);
 
+#if ((defined SM) && (defined SM_AIN_ENABLE))
+/*!******************************************************************
+ * \fn ANALOG_status_t ANALOG_set_channel_configuration(ANALOG_channel_t channel, ANALOG_input_type_t input_type, ANALOG_gain_type_t gain_type, int32_t gain)
+ * \brief Configure the front-end of an analog input.
+ * \param[in]   channel: Analog input to configure.
+ * \param[in]   input_type: Type of the signal applied on the input.
+ * \param[in]   gain_type: Type of the front-end gain.
+ * \param[in]   gain: Front-end gain, or shunt resistor in ohms for the current loop type.
+ * \param[out]  none
+ * \retval      Function execution status.
+ * \note        The channel is then converted in mV, uA or per-mille of the supply depending on the input type.
+ *******************************************************************/
+ANALOG_status_t ANALOG_set_channel_configuration(ANALOG_channel_t channel, ANALOG_input_type_t input_type, ANALOG_gain_type_t gain_type, int32_t gain);
+#endif
+
+#if ((defined SM) && (defined SM_AIN_ENABLE))
+/*!******************************************************************
+ * \fn ANALOG_status_t ANALOG_set_channel_filter(ANALOG_channel_t channel, uint8_t decimation_ratio, uint8_t iir_shift)
+ * \brief Configure the digital filter of an analog input.
+ * \param[in]   channel: Analog input to configure.
+ * \param[in]   decimation_ratio: Number of samples averaged for each decimator output, 0 or 1 to bypass the decimator.
+ * \param[in]   iir_shift: First order IIR filter coefficient as 2^(-iir_shift), 0 to bypass the IIR filter.
+ * \param[out]  none
+ * \retval      Function execution status.
+ * \note        The filter state is reset. Once a first output is available, the channel conversion returns the filtered value.
+ *******************************************************************/
+ANALOG_status_t ANALOG_set_channel_filter(ANALOG_channel_t channel, uint8_t decimation_ratio, uint8_t iir_shift);
+
+/*!******************************************************************
+ * \fn ANALOG_status_t ANALOG_filter_channel(ANALOG_channel_t channel, uint8_t* output_ready)
+ * \brief Acquire a background sample of an analog input and feed its digital filter.
+ * \param[in]   channel: Analog input to sample.
+ * \param[out]  output_ready: Pointer to byte that will contain 1 if the sample completed a decimation period, 0 otherwise.
+ * \retval      Function execution status.
+ *******************************************************************/
+ANALOG_status_t ANALOG_filter_channel(ANALOG_channel_t channel, uint8_t* output_ready);
+
+/*!******************************************************************
+ * \fn uint8_t ANALOG_is_channel_filtered(ANALOG_channel_t channel)
+ * \brief Check if the digital filter of an analog input is enabled.
+ * \param[in]   channel: Analog input to check.
+ * \param[out]  none
+ * \retval      1 if the filter is enabled, 0 otherwise.
+ *******************************************************************/
+uint8_t ANALOG_is_channel_filtered(ANALOG_channel_t channel);
+#endif
+
 /*******************************************************************/
 #define ANALOG_exit_error(base) { ERROR_check_exit(analog_status, ANALOG_SUCCESS, base) }
 
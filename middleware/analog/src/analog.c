@@ -76,35 +76,67 @@
 
 #define ANALOG_ERROR_VALUE                  0xFFFF
 
+#ifdef SM
+#define ANALOG_AIN_NUMBER                   4
+#define ANALOG_CURRENT_UA_PER_MA            1000
+#define ANALOG_RATIOMETRIC_FULL_SCALE       1000
+#define ANALOG_FILTER_FRACTIONAL_BITS       8
+#endif
+
 /*** ANALOG local structures ***/
 
-#ifdef SM
+#if ((defined SM) && (defined SM_AIN_ENABLE))
 /*******************************************************************/
 typedef struct {
-    ADC_channel_t adc_channel;
-    ANALOG_gain_type_t gain_type;
-    int32_t gain;
-} ANALOG_channel_configuration_t;
+    ANALOG_input_type_t input_type;
+    int32_t scale_numerator;
+    int32_t scale_denominator;
+} ANALOG_channel_scale_t;
+#endif
+
+#if ((defined SM) && (defined SM_AIN_ENABLE))
+/*******************************************************************/
+typedef struct {
+    uint8_t decimation_ratio;
+    uint8_t iir_shift;
+    uint8_t sample_count;
+    uint8_t output_valid;
+    uint32_t accumulator;
+    int32_t output;
+} ANALOG_channel_filter_t;
 #endif
 
 /*******************************************************************/
 typedef struct {
     int32_t vmcu_mv;
+#if ((defined SM) && (defined SM_AIN_ENABLE))
+    ANALOG_channel_scale_t ain_scale[ANALOG_AIN_NUMBER];
+    ANALOG_channel_filter_t ain_filter[ANALOG_AIN_NUMBER];
+#endif
 } ANALOG_context_t;
 
 /*** ANALOG local global variables ***/
 
 #if ((defined SM) && (defined SM_AIN_ENABLE))
-static const ANALOG_channel_configuration_t ANALOG_CHANNEL_CONFIGURATION[ANALOG_CHANNEL_LAST] = {
-    { ANALOG_ADC_CHANNEL_AIN0, SM_AIN0_GAIN_TYPE, SM_AIN0_GAIN },
-    { ANALOG_ADC_CHANNEL_AIN1, SM_AIN1_GAIN_TYPE, SM_AIN1_GAIN },
-    { ANALOG_ADC_CHANNEL_AIN2, SM_AIN2_GAIN_TYPE, SM_AIN2_GAIN },
-    { ANALOG_ADC_CHANNEL_AIN3, SM_AIN3_GAIN_TYPE, SM_AIN3_GAIN },
+static const ADC_channel_t ANALOG_AIN_ADC_CHANNEL[ANALOG_AIN_NUMBER] = {
+    ANALOG_ADC_CHANNEL_AIN0,
+    ANALOG_ADC_CHANNEL_AIN1,
+    ANALOG_ADC_CHANNEL_AIN2,
+    ANALOG_ADC_CHANNEL_AIN3
 };
 #endif
 
 static ANALOG_context_t analog_ctx = { .vmcu_mv = ANALOG_VMCU_MV_DEFAULT };
 
+/*** ANALOG local functions ***/
+
+#if ((defined SM) && (defined SM_AIN_ENABLE))
+/*******************************************************************/
+static uint8_t _ANALOG_is_filter_enabled(ANALOG_channel_filter_t* ain_filter) {
+    return (((ain_filter->decimation_ratio > 1) || (ain_filter->iir_shift > 0)) ? 1 : 0);
+}
+#endif
+
 /*** ANALOG functions ***/
 
 /*******************************************************************/
@@ -145,7 +177,9 @@ ANALOG_status_t ANALOG_convert_channel(ANALOG_channel_t channel, int32_t* analog
     int32_t iout_ua = 0;
 #endif
 #if ((defined SM) && (defined SM_AIN_ENABLE))
-    uint8_t ainx_index = 0;
+    ANALOG_channel_scale_t* ain_scale = NULL;
+    ANALOG_channel_filter_t* ain_filter = NULL;
+    int64_t ain_data = 0;
 #endif
     // Check parameter.
     if (analog_data == NULL) {
@@ -247,23 +281,29 @@ ANALOG_status_t ANALOG_convert_channel(ANALOG_channel_t channel, int32_t* analog
     case ANALOG_CHANNEL_AIN1_MV:
     case ANALOG_CHANNEL_AIN2_MV:
     case ANALOG_CHANNEL_AIN3_MV:
-        // Convert index.
-        ainx_index = (channel - ANALOG_CHANNEL_AIN0_MV);
-        // Convert channel.
-        adc_status = ADC_convert_channel(ANALOG_CHANNEL_CONFIGURATION[ainx_index].adc_channel, &adc_data_12bits);
-        ADC_exit_error(ANALOG_ERROR_BASE_ADC);
-        // Apply gain.
-        switch (ANALOG_CHANNEL_CONFIGURATION[ainx_index].gain_type) {
-        case ANALOG_GAIN_TYPE_ATTENUATION:
-            (*analog_data) = (adc_data_12bits * analog_ctx.vmcu_mv * ANALOG_CHANNEL_CONFIGURATION[ainx_index].gain) / (ADC_FULL_SCALE);
-            break;
-        case ANALOG_GAIN_TYPE_AMPLIFICATION:
-            (*analog_data) = (adc_data_12bits * analog_ctx.vmcu_mv) / (ADC_FULL_SCALE * ANALOG_CHANNEL_CONFIGURATION[ainx_index].gain);
-            break;
-        default:
-            status = ANALOG_ERROR_GAIN_TYPE;
+        // Check configuration.
+        ain_scale = &(analog_ctx.ain_scale[channel - ANALOG_CHANNEL_AIN0_MV]);
+        if (ain_scale->scale_denominator == 0) {
+            status = ANALOG_ERROR_CHANNEL_CONFIGURATION_MISSING;
             goto errors;
         }
+        ain_filter = &(analog_ctx.ain_filter[channel - ANALOG_CHANNEL_AIN0_MV]);
+        if ((_ANALOG_is_filter_enabled(ain_filter) != 0) && (ain_filter->output_valid != 0)) {
+            // Use filtered value.
+            ain_data = (int64_t) ain_filter->output;
+        }
+        else {
+            // Convert channel.
+            adc_status = ADC_convert_channel(ANALOG_AIN_ADC_CHANNEL[channel - ANALOG_CHANNEL_AIN0_MV], &adc_data_12bits);
+            ADC_exit_error(ANALOG_ERROR_BASE_ADC);
+            ain_data = ((int64_t) adc_data_12bits) << ANALOG_FILTER_FRACTIONAL_BITS;
+        }
+        // Apply precomputed scale.
+        ain_data *= (int64_t) ain_scale->scale_numerator;
+        if (ain_scale->input_type != ANALOG_INPUT_TYPE_RATIOMETRIC) {
+            ain_data *= (int64_t) analog_ctx.vmcu_mv;
+        }
+        (*analog_data) = (int32_t) (ain_data / (((int64_t) ain_scale->scale_denominator) << ANALOG_FILTER_FRACTIONAL_BITS));
         break;
 #endif
 #ifdef UHFM
@@ -282,3 +322,145 @@ ANALOG_status_t ANALOG_convert_channel(ANALOG_channel_t channel, int32_t* analog
 errors:
     return status;
 }
+
+#if ((defined SM) && (defined SM_AIN_ENABLE))
+/*******************************************************************/
+ANALOG_status_t ANALOG_set_channel_configuration(ANALOG_channel_t channel, ANALOG_input_type_t input_type, ANALOG_gain_type_t gain_type, int32_t gain) {
+    // Local variables.
+    ANALOG_status_t status = ANALOG_SUCCESS;
+    ANALOG_channel_scale_t* ain_scale = NULL;
+    int32_t divider_numerator = 1;
+    int32_t divider_denominator = 1;
+    // Check parameters.
+    if ((channel < ANALOG_CHANNEL_AIN0_MV) || (channel > ANALOG_CHANNEL_AIN3_MV)) {
+        status = ANALOG_ERROR_CHANNEL;
+        goto errors;
+    }
+    if (input_type >= ANALOG_INPUT_TYPE_LAST) {
+        status = ANALOG_ERROR_INPUT_TYPE;
+        goto errors;
+    }
+    if (gain_type >= ANALOG_GAIN_TYPE_LAST) {
+        status = ANALOG_ERROR_GAIN_TYPE;
+        goto errors;
+    }
+    if (gain <= 0) {
+        status = ANALOG_ERROR_GAIN;
+        goto errors;
+    }
+    ain_scale = &(analog_ctx.ain_scale[channel - ANALOG_CHANNEL_AIN0_MV]);
+    // Front-end ratio.
+    if (gain_type == ANALOG_GAIN_TYPE_ATTENUATION) {
+        divider_numerator = gain;
+    }
+    else {
+        divider_denominator = gain;
+    }
+    // Precompute scale factor of the ADC full scale.
+    switch (input_type) {
+    case ANALOG_INPUT_TYPE_VOLTAGE:
+        // Result in mV, applied to the MCU voltage.
+        ain_scale->scale_numerator = divider_numerator;
+        ain_scale->scale_denominator = (ADC_FULL_SCALE * divider_denominator);
+        break;
+    case ANALOG_INPUT_TYPE_CURRENT_4_20MA:
+        // Result in uA, gain is the shunt resistor in ohms.
+        ain_scale->scale_numerator = ANALOG_CURRENT_UA_PER_MA;
+        ain_scale->scale_denominator = (ADC_FULL_SCALE * gain);
+        break;
+    case ANALOG_INPUT_TYPE_RATIOMETRIC:
+        // Result in per-mille of the supply, independent of the MCU voltage.
+        ain_scale->scale_numerator = (ANALOG_RATIOMETRIC_FULL_SCALE * divider_numerator);
+        ain_scale->scale_denominator = (ADC_FULL_SCALE * divider_denominator);
+        break;
+    default:
+        status = ANALOG_ERROR_INPUT_TYPE;
+        goto errors;
+    }
+    ain_scale->input_type = input_type;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined SM) && (defined SM_AIN_ENABLE))
+/*******************************************************************/
+ANALOG_status_t ANALOG_set_channel_filter(ANALOG_channel_t channel, uint8_t decimation_ratio, uint8_t iir_shift) {
+    // Local variables.
+    ANALOG_status_t status = ANALOG_SUCCESS;
+    ANALOG_channel_filter_t* ain_filter = NULL;
+    // Check parameters.
+    if ((channel < ANALOG_CHANNEL_AIN0_MV) || (channel > ANALOG_CHANNEL_AIN3_MV)) {
+        status = ANALOG_ERROR_CHANNEL;
+        goto errors;
+    }
+    if (iir_shift > ANALOG_FILTER_IIR_SHIFT_MAX) {
+        status = ANALOG_ERROR_FILTER_IIR_SHIFT;
+        goto errors;
+    }
+    ain_filter = &(analog_ctx.ain_filter[channel - ANALOG_CHANNEL_AIN0_MV]);
+    // Update configuration and reset state.
+    ain_filter->decimation_ratio = (decimation_ratio == 0) ? 1 : decimation_ratio;
+    ain_filter->iir_shift = iir_shift;
+    ain_filter->sample_count = 0;
+    ain_filter->accumulator = 0;
+    ain_filter->output = 0;
+    ain_filter->output_valid = 0;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined SM) && (defined SM_AIN_ENABLE))
+/*******************************************************************/
+ANALOG_status_t ANALOG_filter_channel(ANALOG_channel_t channel, uint8_t* output_ready) {
+    // Local variables.
+    ANALOG_status_t status = ANALOG_SUCCESS;
+    ADC_status_t adc_status = ADC_SUCCESS;
+    ANALOG_channel_filter_t* ain_filter = NULL;
+    int32_t adc_data_12bits = 0;
+    int32_t decimator_output = 0;
+    // Check parameters.
+    if (output_ready == NULL) {
+        status = ANALOG_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((channel < ANALOG_CHANNEL_AIN0_MV) || (channel > ANALOG_CHANNEL_AIN3_MV)) {
+        status = ANALOG_ERROR_CHANNEL;
+        goto errors;
+    }
+    (*output_ready) = 0;
+    ain_filter = &(analog_ctx.ain_filter[channel - ANALOG_CHANNEL_AIN0_MV]);
+    // Convert channel.
+    adc_status = ADC_convert_channel(ANALOG_AIN_ADC_CHANNEL[channel - ANALOG_CHANNEL_AIN0_MV], &adc_data_12bits);
+    ADC_exit_error(ANALOG_ERROR_BASE_ADC);
+    // Integrate.
+    ain_filter->accumulator += (uint32_t) adc_data_12bits;
+    ain_filter->sample_count++;
+    if (ain_filter->sample_count < ain_filter->decimation_ratio) goto errors;
+    // Dump decimator output with fractional bits.
+    decimator_output = (int32_t) ((ain_filter->accumulator << ANALOG_FILTER_FRACTIONAL_BITS) / ain_filter->sample_count);
+    ain_filter->accumulator = 0;
+    ain_filter->sample_count = 0;
+    // First order IIR filter, initialized with the first decimator output.
+    if ((ain_filter->output_valid == 0) || (ain_filter->iir_shift == 0)) {
+        ain_filter->output = decimator_output;
+    }
+    else {
+        ain_filter->output += ((decimator_output - ain_filter->output) >> ain_filter->iir_shift);
+    }
+    ain_filter->output_valid = 1;
+    (*output_ready) = 1;
+errors:
+    return status;
+}
+#endif
+
+#if ((defined SM) && (defined SM_AIN_ENABLE))
+/*******************************************************************/
+uint8_t ANALOG_is_channel_filtered(ANALOG_channel_t channel) {
+    // Check parameter.
+    if ((channel < ANALOG_CHANNEL_AIN0_MV) || (channel > ANALOG_CHANNEL_AIN3_MV)) return 0;
+    return _ANALOG_is_filter_enabled(&(analog_ctx.ain_filter[channel - ANALOG_CHANNEL_AIN0_MV]));
+}
+#endif
@@ -21,6 +21,8 @@ typedef enum {
     DIGITAL_SUCCESS = 0,
     DIGITAL_ERROR_NULL_PARAMETER,
     DIGITAL_ERROR_CHANNEL,
+    DIGITAL_ERROR_COUNTER_EDGE,
+    DIGITAL_ERROR_MEASUREMENT_STATE,
     // Last base value.
     DIGITAL_ERROR_BASE_LAST = 0x0100
 } DIGITAL_status_t;
@@ -39,6 +41,27 @@ typedef enum {
     DIGITAL_CHANNEL_LAST
 } DIGITAL_channel_t;
 
+/*!******************************************************************
+ * \enum DIGITAL_counter_edge_t
+ * \brief DIGITAL channels edge counting modes.
+ *******************************************************************/
+typedef enum {
+    DIGITAL_COUNTER_EDGE_NONE = 0,
+    DIGITAL_COUNTER_EDGE_RISING,
+    DIGITAL_COUNTER_EDGE_FALLING,
+    DIGITAL_COUNTER_EDGE_BOTH,
+    DIGITAL_COUNTER_EDGE_LAST
+} DIGITAL_counter_edge_t;
+
+/*!******************************************************************
+ * \struct DIGITAL_signal_t
+ * \brief DIGITAL channel signal measurement result.
+ *******************************************************************/
+typedef struct {
+    uint32_t frequency_mhz;
+    uint16_t duty_cycle_permille;
+} DIGITAL_signal_t;
+
 /*** DIGITAL functions ***/
 
 /*!******************************************************************
@@ -68,6 +91,66 @@ DIGITAL_status_t DIGITAL_de_init(void);
  *******************************************************************/
 DIGITAL_status_t DIGITAL_read_channel(DIGITAL_channel_t channel, uint8_t* state);
 
+/*!******************************************************************
+ * \fn DIGITAL_status_t DIGITAL_start_counter(DIGITAL_channel_t channel, DIGITAL_counter_edge_t edge, uint32_t debounce_ms)
+ * \brief Start counting the edges of a digital channel with external interrupt (also running in stop mode).
+ * \param[in]   channel: Channel to monitor.
+ * \param[in]   edge: Edges to count.
+ * \param[in]   debounce_ms: Minimum delay between two counted edges, 0 to disable debouncing.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DIGITAL_status_t DIGITAL_start_counter(DIGITAL_channel_t channel, DIGITAL_counter_edge_t edge, uint32_t debounce_ms);
+
+/*!******************************************************************
+ * \fn DIGITAL_status_t DIGITAL_stop_counter(DIGITAL_channel_t channel)
+ * \brief Stop counting the edges of a digital channel.
+ * \param[in]   channel: Channel to release.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DIGITAL_status_t DIGITAL_stop_counter(DIGITAL_channel_t channel);
+
+/*!******************************************************************
+ * \fn DIGITAL_status_t DIGITAL_set_counter(DIGITAL_channel_t channel, uint32_t count)
+ * \brief Set the edge counter value of a digital channel.
+ * \param[in]   channel: Channel to set.
+ * \param[in]   count: New counter value.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DIGITAL_status_t DIGITAL_set_counter(DIGITAL_channel_t channel, uint32_t count);
+
+/*!******************************************************************
+ * \fn DIGITAL_status_t DIGITAL_read_counter(DIGITAL_channel_t channel, uint8_t clear, uint32_t* count)
+ * \brief Read the edge counter of a digital channel.
+ * \param[in]   channel: Channel to read.
+ * \param[in]   clear: Remove the returned value from the counter if non zero.
+ * \param[out]  count: Pointer to the number of edges counted.
+ * \retval      Function execution status.
+ *******************************************************************/
+DIGITAL_status_t DIGITAL_read_counter(DIGITAL_channel_t channel, uint8_t clear, uint32_t* count);
+
+/*!******************************************************************
+ * \fn DIGITAL_status_t DIGITAL_start_measurement(DIGITAL_channel_t channel)
+ * \brief Start measuring the frequency and duty cycle of a digital channel.
+ * \param[in]   channel: Channel to measure.
+ * \param[out]  none
+ * \retval      Function execution status.
+ * \note        Edges are timestamped with the HSI clock so the MCU must not enter stop mode until the measurement is stopped.
+ * \note        The signal period must be lower than 1 second (use edge counters for slower signals).
+ *******************************************************************/
+DIGITAL_status_t DIGITAL_start_measurement(DIGITAL_channel_t channel);
+
+/*!******************************************************************
+ * \fn DIGITAL_status_t DIGITAL_stop_measurement(DIGITAL_channel_t channel, DIGITAL_signal_t* signal)
+ * \brief Stop measuring a digital channel and compute the average signal parameters over the window.
+ * \param[in]   channel: Channel to stop.
+ * \param[out]  signal: Pointer to the measured frequency (mHz) and duty cycle (per mille).
+ * \retval      Function execution status.
+ *******************************************************************/
+DIGITAL_status_t DIGITAL_stop_measurement(DIGITAL_channel_t channel, DIGITAL_signal_t* signal);
+
 /*******************************************************************/
 #define DIGITAL_exit_error(base) { ERROR_check_exit(digital_status, DIGITAL_SUCCESS, base) }
 
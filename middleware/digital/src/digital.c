@@ -8,16 +8,173 @@
 #include "digital.h"
 
 #include "error.h"
+#include "exti.h"
 #include "gpio.h"
 #include "gpio_mapping.h"
+#include "nvic_priority.h"
+#include "timebase.h"
 #include "types.h"
 #include "xm_flags.h"
 
 #ifdef SM
 
+/*** DIGITAL local macros ***/
+
+#define DIGITAL_HSI_FREQUENCY_HZ        16000000
+#define DIGITAL_DUTY_CYCLE_MAX          1000
+
+/*** DIGITAL local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    volatile uint32_t count;
+    volatile uint32_t last_edge_ticks;
+    volatile uint8_t last_edge_valid;
+    uint32_t debounce_ticks;
+    DIGITAL_counter_edge_t edge;
+    uint8_t running;
+} DIGITAL_counter_t;
+
+/*******************************************************************/
+typedef struct {
+    volatile uint32_t last_rising_systick;
+    volatile uint32_t high_cycles_current;
+    volatile uint32_t period_cycles;
+    volatile uint32_t high_cycles;
+    volatile uint32_t number_of_periods;
+    volatile uint8_t rising_valid;
+    volatile uint8_t falling_valid;
+    uint8_t running;
+} DIGITAL_measurement_t;
+
+/*** DIGITAL local functions declaration ***/
+
+static void _DIGITAL_dio0_irq_callback(void);
+static void _DIGITAL_dio1_irq_callback(void);
+static void _DIGITAL_dio2_irq_callback(void);
+static void _DIGITAL_dio3_irq_callback(void);
+
 /*** DIGITAL local global variables ***/
 
 static const GPIO_pin_t* DIGITAL_CHANNEL_GPIO[DIGITAL_CHANNEL_LAST] = { &GPIO_DIO0, &GPIO_DIO1, &GPIO_DIO2, &GPIO_DIO3 };
+static const EXTI_gpio_irq_cb_t DIGITAL_CHANNEL_IRQ_CALLBACK[DIGITAL_CHANNEL_LAST] = { &_DIGITAL_dio0_irq_callback, &_DIGITAL_dio1_irq_callback, &_DIGITAL_dio2_irq_callback, &_DIGITAL_dio3_irq_callback };
+static const EXTI_trigger_t DIGITAL_COUNTER_EDGE_TRIGGER[DIGITAL_COUNTER_EDGE_LAST] = { EXTI_TRIGGER_RISING_EDGE, EXTI_TRIGGER_RISING_EDGE, EXTI_TRIGGER_FALLING_EDGE, EXTI_TRIGGER_ANY_EDGE };
+
+static DIGITAL_counter_t digital_counter[DIGITAL_CHANNEL_LAST];
+static DIGITAL_measurement_t digital_measurement[DIGITAL_CHANNEL_LAST];
+
+/*** DIGITAL local functions ***/
+
+/*******************************************************************/
+static uint8_t _DIGITAL_is_exti_running(DIGITAL_channel_t channel) {
+    return (((digital_counter[channel].running) != 0) || ((digital_measurement[channel].running) != 0));
+}
+
+/*******************************************************************/
+static void _DIGITAL_configure_exti(DIGITAL_channel_t channel) {
+    // Local variables.
+    EXTI_trigger_t trigger = EXTI_TRIGGER_ANY_EDGE;
+    // Disable interrupt during configuration.
+    EXTI_disable_gpio_interrupt(DIGITAL_CHANNEL_GPIO[channel]);
+    // Release input when no function uses it anymore.
+    if (_DIGITAL_is_exti_running(channel) == 0) {
+        EXTI_release_gpio(DIGITAL_CHANNEL_GPIO[channel], GPIO_MODE_INPUT);
+        return;
+    }
+    // Both edges are required to measure the duty cycle.
+    if (digital_measurement[channel].running == 0) {
+        trigger = DIGITAL_COUNTER_EDGE_TRIGGER[digital_counter[channel].edge];
+    }
+    EXTI_configure_gpio(DIGITAL_CHANNEL_GPIO[channel], GPIO_PULL_NONE, trigger, DIGITAL_CHANNEL_IRQ_CALLBACK[channel], NVIC_PRIORITY_DIGITAL_INPUTS);
+    EXTI_clear_gpio_flag(DIGITAL_CHANNEL_GPIO[channel]);
+    EXTI_enable_gpio_interrupt(DIGITAL_CHANNEL_GPIO[channel]);
+}
+
+/*******************************************************************/
+static void _DIGITAL_measure_edge(DIGITAL_channel_t channel, uint32_t systick, uint8_t state) {
+    // Local variables.
+    DIGITAL_measurement_t* measurement = &(digital_measurement[channel]);
+    if (state != 0) {
+        // Accumulate the previous period only if its falling edge has been seen (SysTick is a down counter).
+        if (((measurement->rising_valid) != 0) && ((measurement->falling_valid) != 0)) {
+            measurement->period_cycles += (((measurement->last_rising_systick) - systick) & TIMEBASE_CYCLE_COUNTER_MASK);
+            measurement->high_cycles += (measurement->high_cycles_current);
+            (measurement->number_of_periods)++;
+        }
+        measurement->last_rising_systick = systick;
+        measurement->rising_valid = 1;
+        measurement->falling_valid = 0;
+    }
+    else {
+        if (((measurement->rising_valid) != 0) && ((measurement->falling_valid) == 0)) {
+            measurement->high_cycles_current = (((measurement->last_rising_systick) - systick) & TIMEBASE_CYCLE_COUNTER_MASK);
+            measurement->falling_valid = 1;
+        }
+    }
+}
+
+/*******************************************************************/
+static void _DIGITAL_count_edge(DIGITAL_channel_t channel) {
+    // Local variables.
+    DIGITAL_counter_t* counter = &(digital_counter[channel]);
+    TIMEBASE_rtc_time_t rtc_time;
+    uint32_t day_ticks = 0;
+    // Count edge directly when debouncing is disabled or if the calendar can not be read.
+    if (((counter->debounce_ticks) == 0) || (TIMEBASE_get_rtc_time(&rtc_time) != TIMEBASE_SUCCESS)) {
+        (counter->count)++;
+        return;
+    }
+    day_ticks = (TIMEBASE_RTC_SECONDS_PER_DAY * TIMEBASE_get_rtc_ticks_per_second());
+    // Ignore edges occurring within the debounce window of the last counted one.
+    if ((counter->last_edge_valid) != 0) {
+        if (((rtc_time.ticks + day_ticks - (counter->last_edge_ticks)) % day_ticks) < (counter->debounce_ticks)) return;
+    }
+    (counter->count)++;
+    counter->last_edge_ticks = rtc_time.ticks;
+    counter->last_edge_valid = 1;
+}
+
+/*******************************************************************/
+static void _DIGITAL_edge_callback(DIGITAL_channel_t channel) {
+    // Local variables.
+    DIGITAL_counter_edge_t edge = digital_counter[channel].edge;
+    uint32_t systick = 0;
+    uint8_t state = 0;
+    // Counting only.
+    if (digital_measurement[channel].running == 0) {
+        _DIGITAL_count_edge(channel);
+        return;
+    }
+    // Capture HSI cycles counter as soon as possible.
+    systick = TIMEBASE_get_cycle_counter();
+    state = GPIO_read(DIGITAL_CHANNEL_GPIO[channel]);
+    _DIGITAL_measure_edge(channel, systick, state);
+    // Interrupt is triggered on both edges during measurement: filter the counted polarity with the input level.
+    if (digital_counter[channel].running == 0) return;
+    if ((edge == DIGITAL_COUNTER_EDGE_BOTH) || ((edge == DIGITAL_COUNTER_EDGE_RISING) && (state != 0)) || ((edge == DIGITAL_COUNTER_EDGE_FALLING) && (state == 0))) {
+        _DIGITAL_count_edge(channel);
+    }
+}
+
+/*******************************************************************/
+static void _DIGITAL_dio0_irq_callback(void) {
+    _DIGITAL_edge_callback(DIGITAL_CHANNEL_DIO0);
+}
+
+/*******************************************************************/
+static void _DIGITAL_dio1_irq_callback(void) {
+    _DIGITAL_edge_callback(DIGITAL_CHANNEL_DIO1);
+}
+
+/*******************************************************************/
+static void _DIGITAL_dio2_irq_callback(void) {
+    _DIGITAL_edge_callback(DIGITAL_CHANNEL_DIO2);
+}
+
+/*******************************************************************/
+static void _DIGITAL_dio3_irq_callback(void) {
+    _DIGITAL_edge_callback(DIGITAL_CHANNEL_DIO3);
+}
 
 /*** DIGITAL functions ***/
 
@@ -64,4 +221,197 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+DIGITAL_status_t DIGITAL_start_counter(DIGITAL_channel_t channel, DIGITAL_counter_edge_t edge, uint32_t debounce_ms) {
+    // Local variables.
+    DIGITAL_status_t status = DIGITAL_SUCCESS;
+    // Check parameters.
+    if (channel >= DIGITAL_CHANNEL_LAST) {
+        status = DIGITAL_ERROR_CHANNEL;
+        goto errors;
+    }
+    if ((edge == DIGITAL_COUNTER_EDGE_NONE) || (edge >= DIGITAL_COUNTER_EDGE_LAST)) {
+        status = DIGITAL_ERROR_COUNTER_EDGE;
+        goto errors;
+    }
+    // Disable interrupt during configuration.
+    if (_DIGITAL_is_exti_running(channel) != 0) {
+        EXTI_disable_gpio_interrupt(DIGITAL_CHANNEL_GPIO[channel]);
+    }
+    // Release previous direct RTC read request.
+    if ((digital_counter[channel].running != 0) && (digital_counter[channel].debounce_ticks != 0)) {
+        TIMEBASE_disable_rtc_direct_read();
+    }
+    // Convert debounce delay to RTC sub-seconds.
+    digital_counter[channel].debounce_ticks = (((debounce_ms * TIMEBASE_get_rtc_ticks_per_second()) + 999) / 1000);
+    // Debouncing reads the RTC in interrupt context, possibly right after a stop mode wake-up.
+    if (digital_counter[channel].debounce_ticks != 0) {
+        TIMEBASE_enable_rtc_direct_read();
+    }
+    digital_counter[channel].last_edge_valid = 0;
+    digital_counter[channel].edge = edge;
+    // Update state.
+    digital_counter[channel].running = 1;
+    // Configure external interrupt.
+    _DIGITAL_configure_exti(channel);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DIGITAL_status_t DIGITAL_stop_counter(DIGITAL_channel_t channel) {
+    // Local variables.
+    DIGITAL_status_t status = DIGITAL_SUCCESS;
+    // Check parameters.
+    if (channel >= DIGITAL_CHANNEL_LAST) {
+        status = DIGITAL_ERROR_CHANNEL;
+        goto errors;
+    }
+    // Check state.
+    if (digital_counter[channel].running == 0) goto errors;
+    // Update state.
+    digital_counter[channel].running = 0;
+    if (digital_counter[channel].debounce_ticks != 0) {
+        TIMEBASE_disable_rtc_direct_read();
+    }
+    // Release input or restore measurement trigger.
+    _DIGITAL_configure_exti(channel);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DIGITAL_status_t DIGITAL_set_counter(DIGITAL_channel_t channel, uint32_t count) {
+    // Local variables.
+    DIGITAL_status_t status = DIGITAL_SUCCESS;
+    // Check parameters.
+    if (channel >= DIGITAL_CHANNEL_LAST) {
+        status = DIGITAL_ERROR_CHANNEL;
+        goto errors;
+    }
+    // Update counter.
+    if (_DIGITAL_is_exti_running(channel) != 0) {
+        EXTI_disable_gpio_interrupt(DIGITAL_CHANNEL_GPIO[channel]);
+    }
+    digital_counter[channel].count = count;
+    if (_DIGITAL_is_exti_running(channel) != 0) {
+        EXTI_enable_gpio_interrupt(DIGITAL_CHANNEL_GPIO[channel]);
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DIGITAL_status_t DIGITAL_read_counter(DIGITAL_channel_t channel, uint8_t clear, uint32_t* count) {
+    // Local variables.
+    DIGITAL_status_t status = DIGITAL_SUCCESS;
+    // Check parameters.
+    if (channel >= DIGITAL_CHANNEL_LAST) {
+        status = DIGITAL_ERROR_CHANNEL;
+        goto errors;
+    }
+    if (count == NULL) {
+        status = DIGITAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Read counter.
+    (*count) = digital_counter[channel].count;
+    // Remove the returned value only, so that edges occurring meanwhile are kept.
+    if (clear != 0) {
+        if (_DIGITAL_is_exti_running(channel) != 0) {
+            EXTI_disable_gpio_interrupt(DIGITAL_CHANNEL_GPIO[channel]);
+        }
+        digital_counter[channel].count -= (*count);
+        if (_DIGITAL_is_exti_running(channel) != 0) {
+            EXTI_enable_gpio_interrupt(DIGITAL_CHANNEL_GPIO[channel]);
+        }
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DIGITAL_status_t DIGITAL_start_measurement(DIGITAL_channel_t channel) {
+    // Local variables.
+    DIGITAL_status_t status = DIGITAL_SUCCESS;
+    uint8_t idx = 0;
+    uint8_t systick_running = 0;
+    // Check parameters.
+    if (channel >= DIGITAL_CHANNEL_LAST) {
+        status = DIGITAL_ERROR_CHANNEL;
+        goto errors;
+    }
+    // Check if the HSI cycles counter is already used by another channel.
+    for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+        if (digital_measurement[idx].running != 0) {
+            systick_running = 1;
+        }
+    }
+    if (systick_running == 0) {
+        TIMEBASE_start_cycle_counter();
+    }
+    // Reset accumulators.
+    if (_DIGITAL_is_exti_running(channel) != 0) {
+        EXTI_disable_gpio_interrupt(DIGITAL_CHANNEL_GPIO[channel]);
+    }
+    digital_measurement[channel].period_cycles = 0;
+    digital_measurement[channel].high_cycles = 0;
+    digital_measurement[channel].number_of_periods = 0;
+    digital_measurement[channel].rising_valid = 0;
+    digital_measurement[channel].falling_valid = 0;
+    // Update state.
+    digital_measurement[channel].running = 1;
+    // Switch external interrupt to both edges.
+    _DIGITAL_configure_exti(channel);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DIGITAL_status_t DIGITAL_stop_measurement(DIGITAL_channel_t channel, DIGITAL_signal_t* signal) {
+    // Local variables.
+    DIGITAL_status_t status = DIGITAL_SUCCESS;
+    uint8_t idx = 0;
+    uint8_t systick_running = 0;
+    // Check parameters.
+    if (channel >= DIGITAL_CHANNEL_LAST) {
+        status = DIGITAL_ERROR_CHANNEL;
+        goto errors;
+    }
+    if (signal == NULL) {
+        status = DIGITAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Check state.
+    if (digital_measurement[channel].running == 0) {
+        status = DIGITAL_ERROR_MEASUREMENT_STATE;
+        goto errors;
+    }
+    // Update state.
+    digital_measurement[channel].running = 0;
+    // Release input or restore counter trigger.
+    _DIGITAL_configure_exti(channel);
+    // Stop HSI cycles counter if not used anymore.
+    for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+        if (digital_measurement[idx].running != 0) {
+            systick_running = 1;
+        }
+    }
+    if (systick_running == 0) {
+        TIMEBASE_stop_cycle_counter();
+    }
+    // Compute results.
+    if ((digital_measurement[channel].number_of_periods == 0) || (digital_measurement[channel].period_cycles == 0)) {
+        // Static level.
+        signal->frequency_mhz = 0;
+        signal->duty_cycle_permille = (GPIO_read(DIGITAL_CHANNEL_GPIO[channel]) != 0) ? DIGITAL_DUTY_CYCLE_MAX : 0;
+    }
+    else {
+        signal->frequency_mhz = (uint32_t) ((((uint64_t) digital_measurement[channel].number_of_periods) * ((uint64_t) DIGITAL_HSI_FREQUENCY_HZ) * 1000) / ((uint64_t) digital_measurement[channel].period_cycles));
+        signal->duty_cycle_permille = (uint16_t) ((((uint64_t) digital_measurement[channel].high_cycles) * DIGITAL_DUTY_CYCLE_MAX) / ((uint64_t) digital_measurement[channel].period_cycles));
+    }
+errors:
+    return status;
+}
+
 #endif /* SM */
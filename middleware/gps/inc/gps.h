@@ -10,7 +10,9 @@
 
 #include "led.h"
 #include "neom8x.h"
+#include "timebase.h"
 #include "types.h"
+#include "ubx.h"
 
 /*** GPS structures ***/
 
@@ -22,15 +24,47 @@ typedef enum {
     // Driver errors.
     GPS_SUCCESS = 0,
     GPS_ERROR_NULL_PARAMETER,
+    GPS_ERROR_ACQUISITION_TYPE,
+    GPS_ERROR_ACQUISITION_STATE,
+    GPS_ERROR_CLOCK_DISCIPLINE_STATE,
+    GPS_ERROR_CLOCK_DISCIPLINE_PULSES,
+    GPS_ERROR_CLOCK_DISCIPLINE_FREQUENCY,
+    GPS_ERROR_CALENDAR,
+    GPS_ERROR_GEOFENCE_VERTEX_COUNT,
+    GPS_ERROR_FIX_AVERAGING_DEPTH,
+    GPS_ERROR_CLOCK_DISCIPLINE_PHASE,
     // Low level drivers errors.
     GPS_ERROR_BASE_NEOM8N = 0x0100,
     GPS_ERROR_BASE_LED = (GPS_ERROR_BASE_NEOM8N + NEOM8X_ERROR_BASE_LAST),
+    GPS_ERROR_BASE_UBX = (GPS_ERROR_BASE_LED + LED_ERROR_BASE_LAST),
+    GPS_ERROR_BASE_TIMEBASE = (GPS_ERROR_BASE_UBX + UBX_ERROR_BASE_LAST),
     // Last base value.
-    GPS_ERROR_BASE_LAST = (GPS_ERROR_BASE_LED + LED_ERROR_BASE_LAST)
+    GPS_ERROR_BASE_LAST = (GPS_ERROR_BASE_TIMEBASE + TIMEBASE_ERROR_BASE_LAST)
 } GPS_status_t;
 
 #ifdef GPSM
 
+/*!******************************************************************
+ * \enum GPS_acquisition_type_t
+ * \brief GPS acquisition types.
+ *******************************************************************/
+typedef enum {
+    GPS_ACQUISITION_TYPE_TIME = 0,
+    GPS_ACQUISITION_TYPE_POSITION,
+    GPS_ACQUISITION_TYPE_LAST
+} GPS_acquisition_type_t;
+
+/*!******************************************************************
+ * \enum GPS_acquisition_state_t
+ * \brief GPS acquisition states.
+ *******************************************************************/
+typedef enum {
+    GPS_ACQUISITION_STATE_IDLE = 0,
+    GPS_ACQUISITION_STATE_RUNNING,
+    GPS_ACQUISITION_STATE_DONE,
+    GPS_ACQUISITION_STATE_LAST
+} GPS_acquisition_state_t;
+
 /*!******************************************************************
  * \enum GPS_acquisition_status_t
  * \brief GPS acquisition status.
@@ -59,6 +93,59 @@ typedef NEOM8X_position_t GPS_position_t;
  *******************************************************************/
 typedef NEOM8X_timepulse_configuration_t GPS_timepulse_configuration_t;
 
+/*!******************************************************************
+ * \typedef GPS_power_mode_configuration_t
+ * \brief GPS power mode parameters.
+ *******************************************************************/
+typedef UBX_power_mode_configuration_t GPS_power_mode_configuration_t;
+
+/*!******************************************************************
+ * \typedef GPS_quality_t
+ * \brief GPS signal quality data.
+ *******************************************************************/
+typedef UBX_quality_t GPS_quality_t;
+
+/*!******************************************************************
+ * \struct GPS_coordinates_t
+ * \brief GPS signed coordinates in 1e-7 degree unit.
+ *******************************************************************/
+typedef struct {
+    int32_t latitude;
+    int32_t longitude;
+} GPS_coordinates_t;
+
+/*!******************************************************************
+ * \struct GPS_fix_quality_gate_t
+ * \brief GPS position acquisition completion criteria.
+ *******************************************************************/
+typedef struct {
+    uint32_t horizontal_accuracy_max_mm;
+    uint16_t pdop_max;
+    uint8_t satellites_min;
+    uint8_t averaging_depth;
+} GPS_fix_quality_gate_t;
+
+/*!******************************************************************
+ * \struct GPS_fix_report_t
+ * \brief GPS position acquisition quality report.
+ *******************************************************************/
+typedef struct {
+    uint32_t horizontal_accuracy_mm;
+    uint8_t number_of_fixes;
+    uint8_t gate_reached;
+} GPS_fix_report_t;
+
+/*!******************************************************************
+ * \struct GPS_clock_discipline_t
+ * \brief GPS clock discipline result.
+ *******************************************************************/
+typedef struct {
+    int32_t lse_error_ppb;
+    int32_t hsi_error_ppm;
+    uint32_t rtc_calibration;
+    uint8_t hsi_trim;
+} GPS_clock_discipline_t;
+
 /*** GPS functions ***/
 
 /*!******************************************************************
@@ -80,26 +167,81 @@ GPS_status_t GPS_init(void);
 GPS_status_t GPS_de_init(void);
 
 /*!******************************************************************
- * \fn GPS_status_t GPS_get_time(GPS_time_t* gps_time, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status)
- * \brief Perform GPS position acquisition.
+ * \fn GPS_status_t GPS_start_acquisition(GPS_acquisition_type_t acquisition_type, uint32_t timeout_seconds)
+ * \brief Start GPS acquisition without waiting for its completion.
+ * \param[in]   acquisition_type: Type of data to acquire.
  * \param[in]   timeout_seconds: Fix timeout in seconds.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_start_acquisition(GPS_acquisition_type_t acquisition_type, uint32_t timeout_seconds);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_stop_acquisition(void)
+ * \brief Stop GPS acquisition and release the result.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_stop_acquisition(void);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_process(void)
+ * \brief Process GPS acquisition, to be called as long as the acquisition is running.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_process(void);
+
+/*!******************************************************************
+ * \fn GPS_acquisition_state_t GPS_get_acquisition_state(void)
+ * \brief Get GPS acquisition state.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current acquisition state.
+ *******************************************************************/
+GPS_acquisition_state_t GPS_get_acquisition_state(void);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_get_time(GPS_time_t* gps_time, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status)
+ * \brief Read the result of a completed GPS time acquisition.
+ * \param[in]   none
  * \param[out]  gps_time: Pointer to the GPS time if found.
  * \param[out]  acquisition_duration_seconds; Pointer to integer that will contain the GPS acquisition duration in seconds.
- * \param[out]  acquisition_success: Pointer to the acquisition success flag.
+ * \param[out]  acquisition_status: Pointer to the acquisition status.
  * \retval      Function execution status.
  *******************************************************************/
-GPS_status_t GPS_get_time(GPS_time_t* gps_time, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status);
+GPS_status_t GPS_get_time(GPS_time_t* gps_time, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status);
 
 /*!******************************************************************
- * \fn GPS_status_t GPS_get_position(GPS_position_t* gps_position, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status)
- * \brief Perform GPS position acquisition.
- * \param[in]   timeout_seconds: Fix timeout in seconds.
+ * \fn GPS_status_t GPS_get_position(GPS_position_t* gps_position, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status)
+ * \brief Read the result of a completed GPS position acquisition.
+ * \param[in]   none
  * \param[out]  gps_position: Pointer to the GPS position if found.
  * \param[out]  acquisition_duration_seconds; Pointer to integer that will contain the GPS acquisition duration in seconds.
- * \param[out]  acquisition_success: Pointer to the acquisition success flag.
+ * \param[out]  acquisition_status: Pointer to the acquisition status.
  * \retval      Function execution status.
  *******************************************************************/
-GPS_status_t GPS_get_position(GPS_position_t* gps_position, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status);
+GPS_status_t GPS_get_position(GPS_position_t* gps_position, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_set_fix_quality_gate(GPS_fix_quality_gate_t* fix_quality_gate)
+ * \brief Configure the completion criteria of the next position acquisitions.
+ * \param[in]   fix_quality_gate: Pointer to the criteria (a null threshold disables the criterion, the altitude stability filter is used when all are disabled).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_set_fix_quality_gate(GPS_fix_quality_gate_t* fix_quality_gate);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_get_fix_report(GPS_fix_report_t* fix_report)
+ * \brief Read the quality of the last position acquisition result.
+ * \param[in]   none
+ * \param[out]  fix_report: Pointer to the estimated accuracy and number of averaged fixes.
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_get_fix_report(GPS_fix_report_t* fix_report);
 
 /*!******************************************************************
  * \fn GPS_status_t GPS_set_backup_voltage(uint8_t state)
@@ -128,6 +270,147 @@ uint8_t GPS_get_backup_voltage(void);
  *******************************************************************/
 GPS_status_t GPS_set_timepulse(GPS_timepulse_configuration_t* configuration);
 
+/*!******************************************************************
+ * \fn GPS_status_t GPS_set_power_mode(GPS_power_mode_configuration_t* configuration)
+ * \brief Configure GPS receiver power mode.
+ * \param[in]   configuration: Pointer to the power mode parameters.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_set_power_mode(GPS_power_mode_configuration_t* configuration);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_set_aiding_configuration(uint8_t autonomous_aiding_enable)
+ * \brief Enable assistance data flow control and configure GPS autonomous aiding.
+ * \param[in]   autonomous_aiding_enable: 0 to disable AssistNow Autonomous, 1 to enable it.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_set_aiding_configuration(uint8_t autonomous_aiding_enable);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_inject_assistance(uint8_t* data, uint32_t data_size_bytes, uint32_t* frame_size_bytes, uint8_t* acknowledged)
+ * \brief Inject the first AssistNow message of a buffer into the GPS receiver.
+ * \param[in]   data: Assistance data buffer starting with a UBX-MGA frame.
+ * \param[in]   data_size_bytes: Number of bytes available in the buffer.
+ * \param[out]  frame_size_bytes: Size of the injected frame, 0 if the frame is not complete yet.
+ * \param[out]  acknowledged: 1 if the receiver accepted the message, 0 otherwise.
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_inject_assistance(uint8_t* data, uint32_t data_size_bytes, uint32_t* frame_size_bytes, uint8_t* acknowledged);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_get_autonomous_aiding_status(uint8_t* autonomous_aiding_running)
+ * \brief Read GPS autonomous aiding state.
+ * \param[in]   none
+ * \param[out]  autonomous_aiding_running: 1 if orbit data is being computed, 0 otherwise.
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_get_autonomous_aiding_status(uint8_t* autonomous_aiding_running);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_get_quality(GPS_quality_t* gps_quality)
+ * \brief Read GPS satellites, dilution of precision and C/N0 data.
+ * \param[in]   none
+ * \param[out]  gps_quality: Pointer to the signal quality data.
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_get_quality(GPS_quality_t* gps_quality);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_start_clock_discipline(void)
+ * \brief Start capturing 1PPS timepulse edges to measure the MCU clocks.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_start_clock_discipline(void);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_stop_clock_discipline(void)
+ * \brief Stop capturing timepulse edges.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_stop_clock_discipline(void);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_process_clock_discipline(void)
+ * \brief Measure the RTC phase of the last captured timepulse edge.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ * \note        This function has to be called within half a second after each edge, edges measured too late are skipped.
+ *******************************************************************/
+GPS_status_t GPS_process_clock_discipline(void);
+
+/*!******************************************************************
+ * \fn uint32_t GPS_get_clock_discipline_pulse_count(void)
+ * \brief Get the number of timepulse edges measured since discipline start.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of edges between the first and the last measured ones.
+ *******************************************************************/
+uint32_t GPS_get_clock_discipline_pulse_count(void);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_apply_clock_discipline(GPS_clock_discipline_t* clock_discipline)
+ * \brief Compute LSE and HSI errors from the captured edges and correct the RTC smooth calibration and HSI trimming.
+ * \param[in]   none
+ * \param[out]  clock_discipline: Pointer to the measured errors and applied corrections.
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_apply_clock_discipline(GPS_clock_discipline_t* clock_discipline);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_set_calendar(GPS_time_t* gps_time)
+ * \brief Synchronize calendar on GPS time.
+ * \param[in]   gps_time: Pointer to the GPS time.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_set_calendar(GPS_time_t* gps_time);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_get_calendar(uint32_t* unix_time_seconds)
+ * \brief Read the GPS synchronized calendar.
+ * \param[in]   none
+ * \param[out]  unix_time_seconds: Pointer to the current UNIX time.
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_get_calendar(uint32_t* unix_time_seconds);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_convert_position(GPS_position_t* gps_position, GPS_coordinates_t* coordinates)
+ * \brief Convert a GPS position to signed fixed point coordinates.
+ * \param[in]   gps_position: Pointer to the GPS position.
+ * \param[out]  coordinates: Pointer to the coordinates in 1e-7 degree unit.
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_convert_position(GPS_position_t* gps_position, GPS_coordinates_t* coordinates);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_get_distance(GPS_coordinates_t* point_1, GPS_coordinates_t* point_2, uint32_t* distance_m)
+ * \brief Compute the distance between two points with an equirectangular approximation.
+ * \param[in]   point_1: Pointer to the first point.
+ * \param[in]   point_2: Pointer to the second point.
+ * \param[out]  distance_m: Pointer to the distance in meters.
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_get_distance(GPS_coordinates_t* point_1, GPS_coordinates_t* point_2, uint32_t* distance_m);
+
+/*!******************************************************************
+ * \fn GPS_status_t GPS_is_inside_polygon(GPS_coordinates_t* point, GPS_coordinates_t* vertices, uint8_t number_of_vertices, uint8_t* inside)
+ * \brief Check if a point is inside a polygon.
+ * \param[in]   point: Pointer to the point to check.
+ * \param[in]   vertices: Polygon vertices.
+ * \param[in]   number_of_vertices: Number of vertices (3 at least).
+ * \param[out]  inside: Pointer to the result, 1 if the point is inside the polygon, 0 otherwise.
+ * \retval      Function execution status.
+ *******************************************************************/
+GPS_status_t GPS_is_inside_polygon(GPS_coordinates_t* point, GPS_coordinates_t* vertices, uint8_t number_of_vertices, uint8_t* inside);
+
 /*******************************************************************/
 #define GPS_exit_error(base) { ERROR_check_exit(gps_status, GPS_SUCCESS, base) }
 
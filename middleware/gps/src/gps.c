@@ -8,25 +8,113 @@
 #include "gps.h"
 
 #include "error.h"
-#include "iwdg.h"
+#include "exti.h"
+#include "gpio.h"
+#include "gpio_mapping.h"
 #include "neom8x.h"
-#include "pwr.h"
+#include "nvic_priority.h"
 #include "rtc.h"
+#include "timebase.h"
 #include "types.h"
+#include "ubx.h"
 
 #ifdef GPSM
 
+/*** GPS local macros ***/
+
+#define GPS_HSI_FREQUENCY_HZ                    16000000
+#define GPS_HSI_ERROR_PPM_MAX                   50000
+#define GPS_HSI_TRIM_STEP_PPM                   4000
+
+#define GPS_RTC_SECONDS_PER_DAY                 TIMEBASE_RTC_SECONDS_PER_DAY
+#define GPS_RTC_EDGE_TIMEOUT                    100000
+#define GPS_RTC_CALIBRATION_PPB_PER_STEP        954
+// Residual errors close to half a step are kept to avoid toggling the calibration with the measurement noise.
+#define GPS_RTC_CALIBRATION_HYSTERESIS_PPB      (GPS_RTC_CALIBRATION_PPB_PER_STEP / 4)
+
+#define GPS_UNIX_EPOCH_YEAR                     1970
+#define GPS_UNIX_DAYS_0000_TO_1970              719468
+
+#define GPS_UBX_FIX_TYPE_3D                     3
+
+#define GPS_COORDINATE_SCALE                    10000000
+#define GPS_COORDINATE_FULL_TURN                (360 * ((int64_t) GPS_COORDINATE_SCALE))
+#define GPS_COORDINATE_HALF_TURN                (180 * ((int64_t) GPS_COORDINATE_SCALE))
+// Length of a 1e-7 degree arc on the Earth surface, in micrometers.
+#define GPS_COORDINATE_UNIT_UM                  11132
+#define GPS_COS_TABLE_STEP_DEGREES              5
+#define GPS_COS_TABLE_SIZE                      ((90 / GPS_COS_TABLE_STEP_DEGREES) + 1)
+#define GPS_GEOFENCE_NUMBER_OF_VERTICES_MIN     3
+
+#define GPS_FIX_AVERAGING_DEPTH_MAX             8
+// Fixes are weighted by the inverse of their horizontal variance expressed in dm^2.
+#define GPS_FIX_WEIGHT_SCALE                    (((uint64_t) 1) << 20)
+#define GPS_FIX_ACCURACY_UNIT_MM                100
+#define GPS_FIX_ACCURACY_MAX                    0xFFFF
+
 /*** GPS local structures ***/
 
 /*******************************************************************/
 typedef struct {
+    GPS_acquisition_state_t state;
+    GPS_acquisition_type_t type;
     volatile uint8_t process_flag;
     NEOM8X_acquisition_status_t acquisition_status;
+    NEOM8X_acquisition_status_t expected_acquisition_status;
+    uint32_t start_time_seconds;
+    uint32_t timeout_seconds;
+    uint32_t duration_seconds;
+    GPS_fix_quality_gate_t fix_gate;
+    GPS_fix_report_t fix_report;
+#ifdef GPSM_UBX_PROTOCOL
+    GPS_time_t ubx_time;
+    UBX_position_t ubx_position;
+    uint32_t ubx_previous_altitude;
+    uint8_t ubx_fix_count;
+    GPS_coordinates_t fix_reference;
+    uint64_t fix_weight_sum;
+    int64_t fix_latitude_sum;
+    int64_t fix_longitude_sum;
+    uint64_t fix_altitude_sum;
+#endif
 } GPS_context_t;
 
+/*******************************************************************/
+typedef struct {
+    uint32_t pulse_count;
+    uint32_t hsi_cycles;
+    uint32_t systick;
+    uint32_t edge_systick;
+    uint32_t edge_rtc_ticks;
+} GPS_timepulse_capture_t;
+
+/*******************************************************************/
+typedef struct {
+    volatile uint8_t running;
+    volatile uint32_t pulse_count;
+    volatile uint32_t hsi_cycles;
+    volatile uint32_t pulse_systick;
+    volatile uint32_t pulse_rtc_ticks;
+    uint32_t measured_pulse_count;
+    GPS_timepulse_capture_t first;
+    GPS_timepulse_capture_t last;
+    uint32_t calendar_unix_time_seconds;
+    uint32_t calendar_rtc_seconds;
+    uint32_t calendar_uptime_seconds;
+    volatile uint8_t calendar_valid;
+    volatile uint8_t calendar_pulse_sync;
+} GPS_clock_discipline_context_t;
+
 /*** GPS local global variables ***/
 
+// Cosinus of 0 to 90 degrees with a 5 degrees step, in Q15 format.
+static const uint16_t GPS_COS_Q15[GPS_COS_TABLE_SIZE] = {
+    32768, 32643, 32270, 31651, 30792, 29698, 28378, 26842, 25102, 23170,
+    21063, 18795, 16384, 13848, 11207, 8481, 5690, 2856, 0
+};
+
 static GPS_context_t gps_ctx;
+static GPS_clock_discipline_context_t gps_clock_discipline_ctx;
 
 /*** GPS local functions ***/
 
@@ -36,55 +124,331 @@ static void _GPS_process_callback(void) {
     gps_ctx.process_flag = 1;
 }
 
+#ifndef GPSM_UBX_PROTOCOL
 /*******************************************************************/
 static void _GPS_completion_callback(NEOM8X_acquisition_status_t acquisition_status) {
     // Update global variable.
     gps_ctx.acquisition_status = acquisition_status;
 }
+#endif
 
 /*******************************************************************/
-static GPS_status_t _GPS_perform_acquisition(NEOM8X_gps_data_t gps_data, NEOM8X_acquisition_status_t expected_acquisition_status, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds) {
+static GPS_status_t _GPS_check_result(GPS_acquisition_type_t acquisition_type, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status) {
     // Local variables.
     GPS_status_t status = GPS_SUCCESS;
-    LED_status_t led_status = LED_SUCCESS;
-    NEOM8X_status_t neom8x_status;
-    NEOM8X_acquisition_t gps_acquisition;
-    uint32_t start_time = RTC_get_uptime_seconds();
-    // Reset data.
-    gps_ctx.acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL;
-    (*acquisition_duration_seconds) = 0;
-    // Configure GPS acquisition.
-    gps_acquisition.gps_data = gps_data;
-    gps_acquisition.completion_callback = &_GPS_completion_callback;
-    gps_acquisition.process_callback = &_GPS_process_callback;
-    // Start acquisition.
-    neom8x_status = NEOM8X_start_acquisition(&gps_acquisition);
-    NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
-    // Processing loop.
-    while (RTC_get_uptime_seconds() < (start_time + timeout_seconds)) {
-        // Enter sleep mode.
-        IWDG_reload();
-        PWR_enter_sleep_mode();
-        // Update acquisition duration.
-        (*acquisition_duration_seconds) = (RTC_get_uptime_seconds() - start_time);
-        // Check flag.
-        if (gps_ctx.process_flag != 0) {
-            // Process driver.
-            neom8x_status = NEOM8X_process();
-            NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
-            // Blink LED.
-            led_status = LED_start_single_blink(500, LED_COLOR_YELLOW);
-            LED_exit_error(GPS_ERROR_BASE_LED);
+    // Check parameters.
+    if ((acquisition_duration_seconds == NULL) || (acquisition_status == NULL)) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Check state.
+    if ((gps_ctx.state != GPS_ACQUISITION_STATE_DONE) || (gps_ctx.type != acquisition_type)) {
+        status = GPS_ERROR_ACQUISITION_STATE;
+        goto errors;
+    }
+    // Update output data.
+    (*acquisition_duration_seconds) = gps_ctx.duration_seconds;
+    (*acquisition_status) = (gps_ctx.acquisition_status != NEOM8X_ACQUISITION_STATUS_FAIL) ? GPS_ACQUISITION_SUCCESS : GPS_ACQUISITION_ERROR_TIMEOUT;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static uint32_t _GPS_get_rtc_elapsed_seconds(uint32_t rtc_seconds, uint32_t reference_rtc_seconds, uint32_t reference_uptime_seconds) {
+    // Local variables.
+    uint32_t elapsed_seconds = ((rtc_seconds + GPS_RTC_SECONDS_PER_DAY - reference_rtc_seconds) % GPS_RTC_SECONDS_PER_DAY);
+    uint32_t elapsed_uptime_seconds = (RTC_get_uptime_seconds() - reference_uptime_seconds);
+    uint32_t number_of_days = 0;
+    // Use coarse uptime to count days and RTC calendar for the remaining seconds.
+    if (elapsed_uptime_seconds > elapsed_seconds) {
+        number_of_days = ((elapsed_uptime_seconds - elapsed_seconds + (GPS_RTC_SECONDS_PER_DAY / 2)) / GPS_RTC_SECONDS_PER_DAY);
+    }
+    return ((number_of_days * GPS_RTC_SECONDS_PER_DAY) + elapsed_seconds);
+}
+
+/*******************************************************************/
+static void _GPS_timepulse_irq_callback(void) {
+    // Local variables.
+    uint32_t systick = TIMEBASE_get_cycle_counter();
+    TIMEBASE_rtc_time_t rtc_time;
+    // Accumulate HSI cycles between consecutive pulses (cycle counter is a down counter).
+    if (gps_clock_discipline_ctx.pulse_count != 0) {
+        gps_clock_discipline_ctx.hsi_cycles += ((gps_clock_discipline_ctx.pulse_systick - systick) & TIMEBASE_CYCLE_COUNTER_MASK);
+    }
+    gps_clock_discipline_ctx.pulse_systick = systick;
+    gps_clock_discipline_ctx.pulse_count++;
+    // LSE phase is measured in process context, only the coarse RTC time is captured here.
+    if (TIMEBASE_get_rtc_time(&rtc_time) != TIMEBASE_SUCCESS) return;
+    gps_clock_discipline_ctx.pulse_rtc_ticks = rtc_time.ticks;
+    // Align calendar on the first second edge following the GPS time message.
+    if (gps_clock_discipline_ctx.calendar_pulse_sync != 0) {
+        gps_clock_discipline_ctx.calendar_unix_time_seconds++;
+        gps_clock_discipline_ctx.calendar_rtc_seconds = rtc_time.seconds;
+        gps_clock_discipline_ctx.calendar_uptime_seconds = RTC_get_uptime_seconds();
+        gps_clock_discipline_ctx.calendar_pulse_sync = 0;
+    }
+}
+
+/*******************************************************************/
+static GPS_status_t _GPS_capture_timepulse(GPS_timepulse_capture_t* capture) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    TIMEBASE_status_t timebase_status = TIMEBASE_SUCCESS;
+    TIMEBASE_rtc_time_t rtc_time;
+    uint32_t rtc_ticks_per_day = (GPS_RTC_SECONDS_PER_DAY * TIMEBASE_get_rtc_ticks_per_second());
+    uint32_t pulse_rtc_ticks = 0;
+    uint32_t reference_rtc_ticks = 0;
+    uint32_t loop_count = 0;
+    // Copy the last edge captured by the interrupt.
+    do {
+        capture->pulse_count = gps_clock_discipline_ctx.pulse_count;
+        capture->hsi_cycles = gps_clock_discipline_ctx.hsi_cycles;
+        capture->systick = gps_clock_discipline_ctx.pulse_systick;
+        pulse_rtc_ticks = gps_clock_discipline_ctx.pulse_rtc_ticks;
+    }
+    while (capture->pulse_count != gps_clock_discipline_ctx.pulse_count);
+    // Wait for the next RTC sub-second edge to measure LSE phase with HSI resolution.
+    timebase_status = TIMEBASE_get_rtc_time(&rtc_time);
+    TIMEBASE_exit_error(GPS_ERROR_BASE_TIMEBASE);
+    reference_rtc_ticks = rtc_time.ticks;
+    do {
+        timebase_status = TIMEBASE_get_rtc_time(&rtc_time);
+        capture->edge_systick = TIMEBASE_get_cycle_counter();
+        TIMEBASE_exit_error(GPS_ERROR_BASE_TIMEBASE);
+        loop_count++;
+        if (loop_count > GPS_RTC_EDGE_TIMEOUT) {
+            status = GPS_ERROR_CLOCK_DISCIPLINE_PHASE;
+            goto errors;
+        }
+    }
+    while (rtc_time.ticks == reference_rtc_ticks);
+    capture->edge_rtc_ticks = rtc_time.ticks;
+    // Cycle counter wraps after about one second: the edge must be measured within half a second.
+    if (((capture->edge_rtc_ticks + rtc_ticks_per_day - pulse_rtc_ticks) % rtc_ticks_per_day) > (TIMEBASE_get_rtc_ticks_per_second() >> 1)) {
+        status = GPS_ERROR_CLOCK_DISCIPLINE_PHASE;
+        goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static uint32_t _GPS_time_to_unix(GPS_time_t* gps_time) {
+    // Local variables.
+    int32_t year = (int32_t) (gps_time->year);
+    uint32_t month = (gps_time->month);
+    uint32_t era = 0;
+    uint32_t year_of_era = 0;
+    uint32_t day_of_year = 0;
+    uint32_t day_of_era = 0;
+    uint32_t days = 0;
+    // Days from civil algorithm (March based years).
+    if (month <= 2) {
+        year--;
+    }
+    era = (uint32_t) (year / 400);
+    year_of_era = (uint32_t) (year - (int32_t) (era * 400));
+    day_of_year = (((153 * ((month > 2) ? (month - 3) : (month + 9))) + 2) / 5) + (gps_time->date) - 1;
+    day_of_era = (year_of_era * 365) + (year_of_era / 4) - (year_of_era / 100) + day_of_year;
+    days = (era * 146097) + day_of_era - GPS_UNIX_DAYS_0000_TO_1970;
+    return ((days * GPS_RTC_SECONDS_PER_DAY) + ((gps_time->hours) * 3600) + ((gps_time->minutes) * 60) + (gps_time->seconds));
+}
+
+/*******************************************************************/
+static uint32_t _GPS_get_cos_q15(int64_t latitude) {
+    // Local variables.
+    uint64_t absolute = (uint64_t) ((latitude < 0) ? (-latitude) : latitude);
+    uint64_t step = (uint64_t) (GPS_COS_TABLE_STEP_DEGREES * ((int64_t) GPS_COORDINATE_SCALE));
+    uint32_t idx = 0;
+    uint64_t remainder = 0;
+    // Clamp to pole.
+    if (absolute >= (uint64_t) (90 * ((int64_t) GPS_COORDINATE_SCALE))) {
+        return 0;
+    }
+    // Linear interpolation between table points.
+    idx = (uint32_t) (absolute / step);
+    remainder = (absolute % step);
+    return (uint32_t) (GPS_COS_Q15[idx] - (((GPS_COS_Q15[idx] - GPS_COS_Q15[idx + 1]) * remainder) / step));
+}
+
+/*******************************************************************/
+static uint32_t _GPS_sqrt(uint64_t value) {
+    // Local variables.
+    uint64_t result = 0;
+    uint64_t bit = ((uint64_t) 1) << 62;
+    // Bitwise integer square root.
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= (result + bit)) {
+            value -= (result + bit);
+            result = (result >> 1) + bit;
+        }
+        else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t) result;
+}
+
+/*******************************************************************/
+static int64_t _GPS_get_longitude_delta(int32_t from, int32_t to) {
+    // Local variables.
+    int64_t delta = ((int64_t) to) - ((int64_t) from);
+    // Take the shortest way around the anti-meridian.
+    if (delta > GPS_COORDINATE_HALF_TURN) {
+        delta -= GPS_COORDINATE_FULL_TURN;
+    }
+    if (delta < (-GPS_COORDINATE_HALF_TURN)) {
+        delta += GPS_COORDINATE_FULL_TURN;
+    }
+    return delta;
+}
+
+#ifdef GPSM_UBX_PROTOCOL
+/*******************************************************************/
+static void _GPS_convert_coordinate(int32_t coordinate, uint8_t* degrees, uint8_t* minutes, uint32_t* seconds, uint8_t* positive_flag) {
+    // Local variables.
+    uint32_t absolute = (coordinate < 0) ? ((uint32_t) (-coordinate)) : ((uint32_t) coordinate);
+    uint32_t remainder = 0;
+    // Inverse of the GPS_convert_position() function.
+    (*positive_flag) = (coordinate < 0) ? 0 : 1;
+    (*degrees) = (uint8_t) (absolute / GPS_COORDINATE_SCALE);
+    remainder = ((absolute % GPS_COORDINATE_SCALE) * 60);
+    (*minutes) = (uint8_t) (remainder / GPS_COORDINATE_SCALE);
+    remainder = ((remainder % GPS_COORDINATE_SCALE) * 60);
+    (*seconds) = (remainder / (GPS_COORDINATE_SCALE / 1000));
+}
+
+/*******************************************************************/
+static uint8_t _GPS_check_fix_quality(void) {
+    // Local variables.
+    uint8_t fix_accepted = 1;
+    uint32_t altitude_delta = 0;
+    // Check if the quality gate is configured.
+    if ((gps_ctx.fix_gate.horizontal_accuracy_max_mm == 0) && (gps_ctx.fix_gate.pdop_max == 0) && (gps_ctx.fix_gate.satellites_min == 0)) {
+        // Apply the same altitude stability filter as the NMEA path.
+        altitude_delta = (gps_ctx.ubx_position.position.altitude > gps_ctx.ubx_previous_altitude) ? (gps_ctx.ubx_position.position.altitude - gps_ctx.ubx_previous_altitude) : (gps_ctx.ubx_previous_altitude - gps_ctx.ubx_position.position.altitude);
+        fix_accepted = ((gps_ctx.ubx_fix_count > 0) && (altitude_delta <= NEOM8X_DRIVER_ALTITUDE_STABILITY_THRESHOLD)) ? 1 : 0;
+        gps_ctx.ubx_previous_altitude = gps_ctx.ubx_position.position.altitude;
+        gps_ctx.ubx_fix_count++;
+    }
+    else {
+        // Check all enabled criteria.
+        if ((gps_ctx.fix_gate.horizontal_accuracy_max_mm != 0) && (gps_ctx.ubx_position.horizontal_accuracy_mm > gps_ctx.fix_gate.horizontal_accuracy_max_mm)) {
+            fix_accepted = 0;
+        }
+        if ((gps_ctx.fix_gate.pdop_max != 0) && (gps_ctx.ubx_position.pdop > gps_ctx.fix_gate.pdop_max)) {
+            fix_accepted = 0;
+        }
+        if ((gps_ctx.fix_gate.satellites_min != 0) && (gps_ctx.ubx_position.number_of_satellites < gps_ctx.fix_gate.satellites_min)) {
+            fix_accepted = 0;
+        }
+    }
+    return fix_accepted;
+}
+
+/*******************************************************************/
+static void _GPS_add_fix(void) {
+    // Local variables.
+    GPS_coordinates_t coordinates;
+    uint32_t accuracy_dm = (gps_ctx.ubx_position.horizontal_accuracy_mm / GPS_FIX_ACCURACY_UNIT_MM);
+    uint64_t weight = 0;
+    // Compute weight.
+    if (accuracy_dm == 0) {
+        accuracy_dm = 1;
+    }
+    if (accuracy_dm > GPS_FIX_ACCURACY_MAX) {
+        accuracy_dm = GPS_FIX_ACCURACY_MAX;
+    }
+    weight = GPS_FIX_WEIGHT_SCALE / (((uint64_t) accuracy_dm) * ((uint64_t) accuracy_dm));
+    if (weight == 0) {
+        weight = 1;
+    }
+    GPS_convert_position(&(gps_ctx.ubx_position.position), &coordinates);
+    // Accumulate offsets from the first fix to handle the anti-meridian.
+    if (gps_ctx.fix_report.number_of_fixes == 0) {
+        gps_ctx.fix_reference = coordinates;
+        gps_ctx.fix_weight_sum = 0;
+        gps_ctx.fix_latitude_sum = 0;
+        gps_ctx.fix_longitude_sum = 0;
+        gps_ctx.fix_altitude_sum = 0;
+    }
+    gps_ctx.fix_weight_sum += weight;
+    gps_ctx.fix_latitude_sum += ((int64_t) weight) * (((int64_t) coordinates.latitude) - ((int64_t) gps_ctx.fix_reference.latitude));
+    gps_ctx.fix_longitude_sum += ((int64_t) weight) * _GPS_get_longitude_delta(gps_ctx.fix_reference.longitude, coordinates.longitude);
+    gps_ctx.fix_altitude_sum += weight * ((uint64_t) gps_ctx.ubx_position.position.altitude);
+    gps_ctx.fix_report.number_of_fixes++;
+    gps_ctx.fix_report.horizontal_accuracy_mm = gps_ctx.ubx_position.horizontal_accuracy_mm;
+}
+
+/*******************************************************************/
+static void _GPS_compute_average_fix(void) {
+    // Local variables.
+    GPS_position_t* position = &(gps_ctx.ubx_position.position);
+    int64_t latitude = 0;
+    int64_t longitude = 0;
+    // Last fix is directly used without averaging.
+    if (gps_ctx.fix_report.number_of_fixes <= 1) goto errors;
+    // Weighted mean of the accepted fixes.
+    latitude = ((int64_t) gps_ctx.fix_reference.latitude) + (gps_ctx.fix_latitude_sum / ((int64_t) gps_ctx.fix_weight_sum));
+    longitude = ((int64_t) gps_ctx.fix_reference.longitude) + (gps_ctx.fix_longitude_sum / ((int64_t) gps_ctx.fix_weight_sum));
+    if (longitude > GPS_COORDINATE_HALF_TURN) {
+        longitude -= GPS_COORDINATE_FULL_TURN;
+    }
+    if (longitude < (-GPS_COORDINATE_HALF_TURN)) {
+        longitude += GPS_COORDINATE_FULL_TURN;
+    }
+    _GPS_convert_coordinate((int32_t) latitude, &(position->lat_degrees), &(position->lat_minutes), &(position->lat_seconds), &(position->lat_north_flag));
+    _GPS_convert_coordinate((int32_t) longitude, &(position->long_degrees), &(position->long_minutes), &(position->long_seconds), &(position->long_east_flag));
+    position->altitude = (uint32_t) (gps_ctx.fix_altitude_sum / gps_ctx.fix_weight_sum);
+    // Accuracy of the inverse variance weighted mean.
+    gps_ctx.fix_report.horizontal_accuracy_mm = _GPS_sqrt((GPS_FIX_WEIGHT_SCALE * GPS_FIX_ACCURACY_UNIT_MM * GPS_FIX_ACCURACY_UNIT_MM) / gps_ctx.fix_weight_sum);
+errors:
+    return;
+}
+
+/*******************************************************************/
+static GPS_status_t _GPS_ubx_process(void) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    UBX_status_t ubx_status = UBX_SUCCESS;
+    uint8_t time_valid = 0;
+    uint8_t averaging_depth = 0;
+    // Decode last frame.
+    if (gps_ctx.type == GPS_ACQUISITION_TYPE_TIME) {
+        ubx_status = UBX_get_time(&(gps_ctx.ubx_time), &time_valid);
+        UBX_exit_error(GPS_ERROR_BASE_UBX);
+        if (time_valid != 0) {
+            gps_ctx.acquisition_status = NEOM8X_ACQUISITION_STATUS_FOUND;
+        }
+    }
+    else {
+        ubx_status = UBX_get_position(&(gps_ctx.ubx_position));
+        UBX_exit_error(GPS_ERROR_BASE_UBX);
+        // Wait for a valid 3D fix.
+        if ((gps_ctx.ubx_position.fix_ok == 0) || (gps_ctx.ubx_position.fix_type < GPS_UBX_FIX_TYPE_3D)) goto errors;
+        gps_ctx.acquisition_status = NEOM8X_ACQUISITION_STATUS_FOUND;
+        // Report the raw fix accuracy until the gate is reached.
+        if (gps_ctx.fix_report.number_of_fixes == 0) {
+            gps_ctx.fix_report.horizontal_accuracy_mm = gps_ctx.ubx_position.horizontal_accuracy_mm;
+        }
+        if (_GPS_check_fix_quality() == 0) goto errors;
+        _GPS_add_fix();
+        // Complete acquisition once enough fixes passed the gate.
+        averaging_depth = (gps_ctx.fix_gate.averaging_depth == 0) ? 1 : gps_ctx.fix_gate.averaging_depth;
+        if (gps_ctx.fix_report.number_of_fixes >= averaging_depth) {
+            _GPS_compute_average_fix();
+            gps_ctx.fix_report.gate_reached = 1;
+            gps_ctx.acquisition_status = NEOM8X_ACQUISITION_STATUS_STABLE;
         }
-        // Check acquisition status.
-        if (gps_ctx.acquisition_status == expected_acquisition_status) break;
     }
-    neom8x_status = NEOM8X_stop_acquisition();
-    NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
 errors:
-    NEOM8X_stop_acquisition();
     return status;
 }
+#endif
 
 /*** GPS functions ***/
 
@@ -93,6 +457,9 @@ GPS_status_t GPS_init(void) {
     // Local variables.
     GPS_status_t status = GPS_SUCCESS;
     NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+    // Init context.
+    gps_ctx.state = GPS_ACQUISITION_STATE_IDLE;
+    gps_ctx.process_flag = 0;
     // Init GPS module.
     neom8x_status = NEOM8X_init();
     NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
@@ -105,6 +472,15 @@ GPS_status_t GPS_de_init(void) {
     // Local variables.
     GPS_status_t status = GPS_SUCCESS;
     NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+    // Stop running acquisition.
+    if (gps_ctx.state == GPS_ACQUISITION_STATE_RUNNING) {
+#ifdef GPSM_UBX_PROTOCOL
+        UBX_stop();
+#else
+        NEOM8X_stop_acquisition();
+#endif
+    }
+    gps_ctx.state = GPS_ACQUISITION_STATE_IDLE;
     // Init GPS module.
     neom8x_status = NEOM8X_de_init();
     NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
@@ -113,57 +489,260 @@ errors:
 }
 
 /*******************************************************************/
-GPS_status_t GPS_get_time(GPS_time_t* gps_time, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status) {
+GPS_status_t GPS_start_acquisition(GPS_acquisition_type_t acquisition_type, uint32_t timeout_seconds) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+#ifdef GPSM_UBX_PROTOCOL
+    UBX_status_t ubx_status = UBX_SUCCESS;
+    UBX_message_t ubx_message = UBX_MESSAGE_LAST;
+#else
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+    NEOM8X_acquisition_t gps_acquisition;
+#endif
+    // Check state.
+    if (gps_ctx.state == GPS_ACQUISITION_STATE_RUNNING) {
+        status = GPS_ERROR_ACQUISITION_STATE;
+        goto errors;
+    }
+    // Check type.
+    switch (acquisition_type) {
+    case GPS_ACQUISITION_TYPE_TIME:
+#ifdef GPSM_UBX_PROTOCOL
+        ubx_message = UBX_MESSAGE_NAV_TIMEUTC;
+#else
+        gps_acquisition.gps_data = NEOM8X_GPS_DATA_TIME;
+#endif
+        gps_ctx.expected_acquisition_status = NEOM8X_ACQUISITION_STATUS_FOUND;
+        break;
+    case GPS_ACQUISITION_TYPE_POSITION:
+#ifdef GPSM_UBX_PROTOCOL
+        ubx_message = UBX_MESSAGE_NAV_PVT;
+#else
+        gps_acquisition.gps_data = NEOM8X_GPS_DATA_POSITION;
+#endif
+        gps_ctx.expected_acquisition_status = NEOM8X_ACQUISITION_STATUS_STABLE;
+        break;
+    default:
+        status = GPS_ERROR_ACQUISITION_TYPE;
+        goto errors;
+    }
+    // Reset context.
+    gps_ctx.type = acquisition_type;
+    gps_ctx.process_flag = 0;
+    gps_ctx.acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL;
+    gps_ctx.start_time_seconds = RTC_get_uptime_seconds();
+    gps_ctx.timeout_seconds = timeout_seconds;
+    gps_ctx.duration_seconds = 0;
+    gps_ctx.fix_report.horizontal_accuracy_mm = 0;
+    gps_ctx.fix_report.number_of_fixes = 0;
+    gps_ctx.fix_report.gate_reached = 0;
+#ifdef GPSM_UBX_PROTOCOL
+    gps_ctx.ubx_previous_altitude = 0;
+    gps_ctx.ubx_fix_count = 0;
+    // Start binary output of the required message only.
+    ubx_status = UBX_start(ubx_message, &_GPS_process_callback);
+    UBX_exit_error(GPS_ERROR_BASE_UBX);
+#else
+    // Configure GPS acquisition.
+    gps_acquisition.completion_callback = &_GPS_completion_callback;
+    gps_acquisition.process_callback = &_GPS_process_callback;
+    // Start acquisition.
+    neom8x_status = NEOM8X_start_acquisition(&gps_acquisition);
+    NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
+#endif
+    // Update state.
+    gps_ctx.state = GPS_ACQUISITION_STATE_RUNNING;
+    return status;
+errors:
+#ifdef GPSM_UBX_PROTOCOL
+    UBX_stop();
+#else
+    NEOM8X_stop_acquisition();
+#endif
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_stop_acquisition(void) {
     // Local variables.
     GPS_status_t status = GPS_SUCCESS;
+#ifdef GPSM_UBX_PROTOCOL
+    UBX_status_t ubx_status = UBX_SUCCESS;
+#else
     NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+#endif
+    // Check state.
+    if (gps_ctx.state == GPS_ACQUISITION_STATE_RUNNING) {
+        // Stop driver.
+#ifdef GPSM_UBX_PROTOCOL
+        ubx_status = UBX_stop();
+        UBX_exit_error(GPS_ERROR_BASE_UBX);
+#else
+        neom8x_status = NEOM8X_stop_acquisition();
+        NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
+#endif
+    }
+errors:
+    // Release result in all cases.
+    gps_ctx.state = GPS_ACQUISITION_STATE_IDLE;
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_process(void) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    LED_status_t led_status = LED_SUCCESS;
+#ifdef GPSM_UBX_PROTOCOL
+    UBX_status_t ubx_status = UBX_SUCCESS;
+#else
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+#endif
+    // Check state.
+    if (gps_ctx.state != GPS_ACQUISITION_STATE_RUNNING) goto errors;
+    // Update acquisition duration.
+    gps_ctx.duration_seconds = (RTC_get_uptime_seconds() - gps_ctx.start_time_seconds);
+    // Check flag.
+    if (gps_ctx.process_flag != 0) {
+        // Clear flag.
+        gps_ctx.process_flag = 0;
+        // Process driver.
+#ifdef GPSM_UBX_PROTOCOL
+        status = _GPS_ubx_process();
+        if (status != GPS_SUCCESS) goto errors;
+#else
+        neom8x_status = NEOM8X_process();
+        NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
+#endif
+        // Blink LED.
+        led_status = LED_start_single_blink(500, LED_COLOR_YELLOW);
+        LED_exit_error(GPS_ERROR_BASE_LED);
+    }
+    // Check acquisition status and timeout.
+    if ((gps_ctx.acquisition_status == gps_ctx.expected_acquisition_status) || (gps_ctx.duration_seconds >= gps_ctx.timeout_seconds)) {
+        // Stop driver.
+#ifdef GPSM_UBX_PROTOCOL
+        ubx_status = UBX_stop();
+        UBX_exit_error(GPS_ERROR_BASE_UBX);
+#else
+        neom8x_status = NEOM8X_stop_acquisition();
+        NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
+#endif
+        // Update state.
+        gps_ctx.state = GPS_ACQUISITION_STATE_DONE;
+    }
+    return status;
+errors:
+    // Abort acquisition on driver error.
+    if (gps_ctx.state == GPS_ACQUISITION_STATE_RUNNING) {
+#ifdef GPSM_UBX_PROTOCOL
+        UBX_stop();
+#else
+        NEOM8X_stop_acquisition();
+#endif
+        gps_ctx.acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL;
+        gps_ctx.state = GPS_ACQUISITION_STATE_DONE;
+    }
+    return status;
+}
+
+/*******************************************************************/
+GPS_acquisition_state_t GPS_get_acquisition_state(void) {
+    return (gps_ctx.state);
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_time(GPS_time_t* gps_time, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+#ifndef GPSM_UBX_PROTOCOL
+    NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+#endif
     // Check parameters.
-    if ((acquisition_status == NULL) || (acquisition_status == NULL)) {
+    if (gps_time == NULL) {
         status = GPS_ERROR_NULL_PARAMETER;
         goto errors;
     }
-    // Reset output data.
-    (*acquisition_duration_seconds) = 0;
-    (*acquisition_status) = GPS_ACQUISITION_ERROR_TIMEOUT;
-    // Perform time acquisition.
-    status = _GPS_perform_acquisition(NEOM8X_GPS_DATA_TIME, NEOM8X_ACQUISITION_STATUS_FOUND, timeout_seconds, acquisition_duration_seconds);
+    // Read acquisition result.
+    status = _GPS_check_result(GPS_ACQUISITION_TYPE_TIME, acquisition_duration_seconds, acquisition_status);
     if (status != GPS_SUCCESS) goto errors;
     // Check status.
-    if (gps_ctx.acquisition_status != NEOM8X_ACQUISITION_STATUS_FAIL) {
+    if ((*acquisition_status) == GPS_ACQUISITION_SUCCESS) {
         // Read data.
+#ifdef GPSM_UBX_PROTOCOL
+        (*gps_time) = gps_ctx.ubx_time;
+#else
         neom8x_status = NEOM8X_get_time(gps_time);
         NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
-        // Update status.
-        (*acquisition_status) = GPS_ACQUISITION_SUCCESS;
+#endif
     }
 errors:
     return status;
 }
 
 /*******************************************************************/
-GPS_status_t GPS_get_position(GPS_position_t* gps_position, uint32_t timeout_seconds, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status) {
+GPS_status_t GPS_get_position(GPS_position_t* gps_position, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status) {
     // Local variables.
     GPS_status_t status = GPS_SUCCESS;
+#ifndef GPSM_UBX_PROTOCOL
     NEOM8X_status_t neom8x_status = NEOM8X_SUCCESS;
+#endif
     // Check parameters.
-    if ((acquisition_duration_seconds == NULL) || (acquisition_status == NULL)) {
+    if (gps_position == NULL) {
         status = GPS_ERROR_NULL_PARAMETER;
         goto errors;
     }
-    // Reset output data.
-    (*acquisition_duration_seconds) = 0;
-    (*acquisition_status) = GPS_ACQUISITION_ERROR_TIMEOUT;
-    // Perform position acquisition.
-    status = _GPS_perform_acquisition(NEOM8X_GPS_DATA_POSITION, NEOM8X_ACQUISITION_STATUS_STABLE, timeout_seconds, acquisition_duration_seconds);
+    // Read acquisition result.
+    status = _GPS_check_result(GPS_ACQUISITION_TYPE_POSITION, acquisition_duration_seconds, acquisition_status);
     if (status != GPS_SUCCESS) goto errors;
     // Check status.
-    if (gps_ctx.acquisition_status != NEOM8X_ACQUISITION_STATUS_FAIL) {
+    if ((*acquisition_status) == GPS_ACQUISITION_SUCCESS) {
         // Read data.
+#ifdef GPSM_UBX_PROTOCOL
+        (*gps_position) = gps_ctx.ubx_position.position;
+#else
         neom8x_status = NEOM8X_get_position(gps_position);
         NEOM8X_exit_error(GPS_ERROR_BASE_NEOM8N);
-        // Update status.
-        (*acquisition_status) = GPS_ACQUISITION_SUCCESS;
+#endif
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_set_fix_quality_gate(GPS_fix_quality_gate_t* fix_quality_gate) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    // Check parameters.
+    if (fix_quality_gate == NULL) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
     }
+    if ((fix_quality_gate->averaging_depth) > GPS_FIX_AVERAGING_DEPTH_MAX) {
+        status = GPS_ERROR_FIX_AVERAGING_DEPTH;
+        goto errors;
+    }
+    // Update criteria.
+    gps_ctx.fix_gate = (*fix_quality_gate);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_fix_report(GPS_fix_report_t* fix_report) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    // Check parameters.
+    if (fix_report == NULL) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Check state.
+    if ((gps_ctx.state != GPS_ACQUISITION_STATE_DONE) || (gps_ctx.type != GPS_ACQUISITION_TYPE_POSITION)) {
+        status = GPS_ERROR_ACQUISITION_STATE;
+        goto errors;
+    }
+    (*fix_report) = gps_ctx.fix_report;
 errors:
     return status;
 }
@@ -201,4 +780,383 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+GPS_status_t GPS_set_power_mode(GPS_power_mode_configuration_t* configuration) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    UBX_status_t ubx_status = UBX_SUCCESS;
+    // Check parameters.
+    if (configuration == NULL) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    ubx_status = UBX_set_power_mode(configuration);
+    UBX_exit_error(GPS_ERROR_BASE_UBX);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_set_aiding_configuration(uint8_t autonomous_aiding_enable) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    UBX_status_t ubx_status = UBX_SUCCESS;
+    // Configure receiver.
+    ubx_status = UBX_set_aiding_configuration(autonomous_aiding_enable);
+    UBX_exit_error(GPS_ERROR_BASE_UBX);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_inject_assistance(uint8_t* data, uint32_t data_size_bytes, uint32_t* frame_size_bytes, uint8_t* acknowledged) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    UBX_status_t ubx_status = UBX_SUCCESS;
+    // Check parameters.
+    if ((data == NULL) || (frame_size_bytes == NULL) || (acknowledged == NULL)) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Inject message.
+    ubx_status = UBX_inject_assistance(data, data_size_bytes, frame_size_bytes, acknowledged);
+    UBX_exit_error(GPS_ERROR_BASE_UBX);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_autonomous_aiding_status(uint8_t* autonomous_aiding_running) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    UBX_status_t ubx_status = UBX_SUCCESS;
+    // Check parameters.
+    if (autonomous_aiding_running == NULL) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Poll receiver.
+    ubx_status = UBX_get_autonomous_aiding_status(autonomous_aiding_running);
+    UBX_exit_error(GPS_ERROR_BASE_UBX);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_quality(GPS_quality_t* gps_quality) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    UBX_status_t ubx_status = UBX_SUCCESS;
+    // Check parameters.
+    if (gps_quality == NULL) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Poll receiver.
+    ubx_status = UBX_get_quality(gps_quality);
+    UBX_exit_error(GPS_ERROR_BASE_UBX);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_start_clock_discipline(void) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    // Check state.
+    if (gps_clock_discipline_ctx.running != 0) {
+        status = GPS_ERROR_CLOCK_DISCIPLINE_STATE;
+        goto errors;
+    }
+    // Reset context.
+    gps_clock_discipline_ctx.pulse_count = 0;
+    gps_clock_discipline_ctx.hsi_cycles = 0;
+    gps_clock_discipline_ctx.measured_pulse_count = 0;
+    gps_clock_discipline_ctx.first.pulse_count = 0;
+    gps_clock_discipline_ctx.last.pulse_count = 0;
+    // Start free running HSI cycles counter and read RTC from the timepulse interrupt.
+    TIMEBASE_start_cycle_counter();
+    TIMEBASE_enable_rtc_direct_read();
+    // Capture timepulse rising edges.
+    EXTI_configure_gpio(&GPIO_GPS_TIMEPULSE, GPIO_PULL_NONE, EXTI_TRIGGER_RISING_EDGE, &_GPS_timepulse_irq_callback, NVIC_PRIORITY_GPS_TIMEPULSE);
+    EXTI_clear_gpio_flag(&GPIO_GPS_TIMEPULSE);
+    EXTI_enable_gpio_interrupt(&GPIO_GPS_TIMEPULSE);
+    // Update state.
+    gps_clock_discipline_ctx.running = 1;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_stop_clock_discipline(void) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    // Check state.
+    if (gps_clock_discipline_ctx.running == 0) goto errors;
+    // Release timepulse input.
+    EXTI_disable_gpio_interrupt(&GPIO_GPS_TIMEPULSE);
+    EXTI_release_gpio(&GPIO_GPS_TIMEPULSE, GPIO_MODE_INPUT);
+    // Stop counter and restore RTC read mode.
+    TIMEBASE_stop_cycle_counter();
+    TIMEBASE_disable_rtc_direct_read();
+    // Update state.
+    gps_clock_discipline_ctx.running = 0;
+    gps_clock_discipline_ctx.calendar_pulse_sync = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_process_clock_discipline(void) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    GPS_timepulse_capture_t capture;
+    // Check state.
+    if (gps_clock_discipline_ctx.running == 0) goto errors;
+    // Measure each new edge only once.
+    if (gps_clock_discipline_ctx.pulse_count == gps_clock_discipline_ctx.measured_pulse_count) goto errors;
+    status = _GPS_capture_timepulse(&capture);
+    gps_clock_discipline_ctx.measured_pulse_count = capture.pulse_count;
+    // Edge is skipped when the process was too late to measure its phase.
+    if (status == GPS_ERROR_CLOCK_DISCIPLINE_PHASE) {
+        status = GPS_SUCCESS;
+        goto errors;
+    }
+    if (status != GPS_SUCCESS) goto errors;
+    // Update captures.
+    if (gps_clock_discipline_ctx.first.pulse_count == 0) {
+        gps_clock_discipline_ctx.first = capture;
+    }
+    gps_clock_discipline_ctx.last = capture;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+uint32_t GPS_get_clock_discipline_pulse_count(void) {
+    // Local variables.
+    uint32_t pulse_count = 0;
+    // Count edges between first and last measured ones.
+    if (gps_clock_discipline_ctx.first.pulse_count != 0) {
+        pulse_count = (gps_clock_discipline_ctx.last.pulse_count - gps_clock_discipline_ctx.first.pulse_count + 1);
+    }
+    return pulse_count;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_apply_clock_discipline(GPS_clock_discipline_t* clock_discipline) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    TIMEBASE_status_t timebase_status = TIMEBASE_SUCCESS;
+    uint32_t number_of_periods = 0;
+    uint32_t rtc_ticks_per_second = TIMEBASE_get_rtc_ticks_per_second();
+    uint32_t rtc_ticks_per_day = (GPS_RTC_SECONDS_PER_DAY * rtc_ticks_per_second);
+    uint64_t hsi_cycles = 0;
+    int64_t hsi_error_ppm = 0;
+    int64_t phase_cycles = 0;
+    int64_t elapsed_cycles = 0;
+    int64_t rtc_ticks = 0;
+    int64_t reference = 0;
+    int64_t lse_error_ppb = 0;
+    int32_t calibration_step = 0;
+    int32_t hsi_trim = 0;
+    int32_t hsi_trim_delta = 0;
+    uint32_t calr = 0;
+    // Check parameters.
+    if (clock_discipline == NULL) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Check captures.
+    if (GPS_get_clock_discipline_pulse_count() < 2) {
+        status = GPS_ERROR_CLOCK_DISCIPLINE_PULSES;
+        goto errors;
+    }
+    number_of_periods = (gps_clock_discipline_ctx.last.pulse_count - gps_clock_discipline_ctx.first.pulse_count);
+    hsi_cycles = (uint64_t) (gps_clock_discipline_ctx.last.hsi_cycles - gps_clock_discipline_ctx.first.hsi_cycles);
+    // HSI error against the GPS second.
+    hsi_error_ppm = ((((int64_t) hsi_cycles - ((int64_t) GPS_HSI_FREQUENCY_HZ * (int64_t) number_of_periods)) * 1000000) / ((int64_t) GPS_HSI_FREQUENCY_HZ * (int64_t) number_of_periods));
+    if ((hsi_error_ppm > GPS_HSI_ERROR_PPM_MAX) || (hsi_error_ppm < (-GPS_HSI_ERROR_PPM_MAX))) {
+        status = GPS_ERROR_CLOCK_DISCIPLINE_FREQUENCY;
+        goto errors;
+    }
+    // Elapsed time between first and last RTC edges, in HSI cycles.
+    phase_cycles = (int64_t) ((gps_clock_discipline_ctx.last.systick - gps_clock_discipline_ctx.last.edge_systick) & TIMEBASE_CYCLE_COUNTER_MASK);
+    phase_cycles -= (int64_t) ((gps_clock_discipline_ctx.first.systick - gps_clock_discipline_ctx.first.edge_systick) & TIMEBASE_CYCLE_COUNTER_MASK);
+    elapsed_cycles = ((int64_t) hsi_cycles + phase_cycles);
+    // RTC ticks counted meanwhile.
+    rtc_ticks = (int64_t) ((gps_clock_discipline_ctx.last.edge_rtc_ticks + rtc_ticks_per_day - gps_clock_discipline_ctx.first.edge_rtc_ticks) % rtc_ticks_per_day);
+    // LSE error: (rtc_ticks / rtc_ticks_per_second) / (elapsed_cycles / hsi_frequency) - 1.
+    reference = ((int64_t) rtc_ticks_per_second * (int64_t) number_of_periods * elapsed_cycles);
+    lse_error_ppb = ((((rtc_ticks * (int64_t) hsi_cycles) - reference) * 1000000) / (reference / 1000));
+    // Update RTC smooth calibration from the current one.
+    calibration_step = TIMEBASE_get_rtc_calibration();
+    if ((lse_error_ppb > ((GPS_RTC_CALIBRATION_PPB_PER_STEP / 2) + GPS_RTC_CALIBRATION_HYSTERESIS_PPB)) || (lse_error_ppb < (-(GPS_RTC_CALIBRATION_PPB_PER_STEP / 2) - GPS_RTC_CALIBRATION_HYSTERESIS_PPB))) {
+        calibration_step -= (int32_t) ((lse_error_ppb + ((lse_error_ppb >= 0) ? (GPS_RTC_CALIBRATION_PPB_PER_STEP / 2) : (-GPS_RTC_CALIBRATION_PPB_PER_STEP / 2))) / GPS_RTC_CALIBRATION_PPB_PER_STEP);
+    }
+    timebase_status = TIMEBASE_set_rtc_calibration(calibration_step, &calr);
+    TIMEBASE_exit_error(GPS_ERROR_BASE_TIMEBASE);
+    // Update HSI trimming (higher trim value increases frequency).
+    hsi_trim = (int32_t) TIMEBASE_get_hsi_trim();
+    hsi_trim_delta = (int32_t) ((hsi_error_ppm + ((hsi_error_ppm >= 0) ? (GPS_HSI_TRIM_STEP_PPM / 2) : (-GPS_HSI_TRIM_STEP_PPM / 2))) / GPS_HSI_TRIM_STEP_PPM);
+    hsi_trim -= hsi_trim_delta;
+    if (hsi_trim < 0) {
+        hsi_trim = 0;
+    }
+    if (hsi_trim > TIMEBASE_HSI_TRIM_MAX) {
+        hsi_trim = TIMEBASE_HSI_TRIM_MAX;
+    }
+    TIMEBASE_set_hsi_trim((uint8_t) hsi_trim);
+    // Update output data.
+    clock_discipline->lse_error_ppb = (int32_t) lse_error_ppb;
+    clock_discipline->hsi_error_ppm = (int32_t) hsi_error_ppm;
+    clock_discipline->rtc_calibration = calr;
+    clock_discipline->hsi_trim = (uint8_t) hsi_trim;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_set_calendar(GPS_time_t* gps_time) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    TIMEBASE_status_t timebase_status = TIMEBASE_SUCCESS;
+    TIMEBASE_rtc_time_t rtc_time;
+    // Check parameters.
+    if (gps_time == NULL) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((gps_time->year) < GPS_UNIX_EPOCH_YEAR) {
+        status = GPS_ERROR_CALENDAR;
+        goto errors;
+    }
+    // Read RTC.
+    timebase_status = TIMEBASE_get_rtc_time(&rtc_time);
+    TIMEBASE_exit_error(GPS_ERROR_BASE_TIMEBASE);
+    // Set reference.
+    gps_clock_discipline_ctx.calendar_unix_time_seconds = _GPS_time_to_unix(gps_time);
+    gps_clock_discipline_ctx.calendar_rtc_seconds = rtc_time.seconds;
+    gps_clock_discipline_ctx.calendar_uptime_seconds = RTC_get_uptime_seconds();
+    gps_clock_discipline_ctx.calendar_valid = 1;
+    // Refine alignment on next timepulse edge when captures are running.
+    gps_clock_discipline_ctx.calendar_pulse_sync = gps_clock_discipline_ctx.running;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_calendar(uint32_t* unix_time_seconds) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    TIMEBASE_status_t timebase_status = TIMEBASE_SUCCESS;
+    TIMEBASE_rtc_time_t rtc_time;
+    // Check parameters.
+    if (unix_time_seconds == NULL) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (gps_clock_discipline_ctx.calendar_valid == 0) {
+        status = GPS_ERROR_CALENDAR;
+        goto errors;
+    }
+    // Read RTC.
+    timebase_status = TIMEBASE_get_rtc_time(&rtc_time);
+    TIMEBASE_exit_error(GPS_ERROR_BASE_TIMEBASE);
+    (*unix_time_seconds) = gps_clock_discipline_ctx.calendar_unix_time_seconds + _GPS_get_rtc_elapsed_seconds(rtc_time.seconds, gps_clock_discipline_ctx.calendar_rtc_seconds, gps_clock_discipline_ctx.calendar_uptime_seconds);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_convert_position(GPS_position_t* gps_position, GPS_coordinates_t* coordinates) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    int32_t value = 0;
+    // Check parameters.
+    if ((gps_position == NULL) || (coordinates == NULL)) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Seconds are expressed in thousandths.
+    value = (int32_t) ((((uint32_t) gps_position->lat_degrees) * GPS_COORDINATE_SCALE) + ((((uint32_t) gps_position->lat_minutes) * (GPS_COORDINATE_SCALE / 10)) / 6) + (((gps_position->lat_seconds) * 25) / 9));
+    coordinates->latitude = (gps_position->lat_north_flag == 0) ? (-value) : value;
+    value = (int32_t) ((((uint32_t) gps_position->long_degrees) * GPS_COORDINATE_SCALE) + ((((uint32_t) gps_position->long_minutes) * (GPS_COORDINATE_SCALE / 10)) / 6) + (((gps_position->long_seconds) * 25) / 9));
+    coordinates->longitude = (gps_position->long_east_flag == 0) ? (-value) : value;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_distance(GPS_coordinates_t* point_1, GPS_coordinates_t* point_2, uint32_t* distance_m) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    int64_t delta_latitude = 0;
+    int64_t delta_longitude = 0;
+    uint64_t distance_units = 0;
+    // Check parameters.
+    if ((point_1 == NULL) || (point_2 == NULL) || (distance_m == NULL)) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Equirectangular projection around the mean latitude.
+    delta_latitude = ((int64_t) (point_2->latitude)) - ((int64_t) (point_1->latitude));
+    delta_longitude = _GPS_get_longitude_delta((point_1->longitude), (point_2->longitude));
+    delta_longitude = (delta_longitude * ((int64_t) _GPS_get_cos_q15((((int64_t) (point_1->latitude)) + ((int64_t) (point_2->latitude))) / 2))) >> 15;
+    // Distance in coordinate unit, then in meters.
+    distance_units = (uint64_t) _GPS_sqrt((uint64_t) ((delta_latitude * delta_latitude) + (delta_longitude * delta_longitude)));
+    (*distance_m) = (uint32_t) ((distance_units * GPS_COORDINATE_UNIT_UM) / 1000000);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_is_inside_polygon(GPS_coordinates_t* point, GPS_coordinates_t* vertices, uint8_t number_of_vertices, uint8_t* inside) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    int64_t xi = 0;
+    int64_t yi = 0;
+    int64_t xj = 0;
+    int64_t yj = 0;
+    int64_t py = 0;
+    uint8_t idx = 0;
+    uint8_t jdx = 0;
+    // Check parameters.
+    if ((point == NULL) || (vertices == NULL) || (inside == NULL)) {
+        status = GPS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (number_of_vertices < GPS_GEOFENCE_NUMBER_OF_VERTICES_MIN) {
+        status = GPS_ERROR_GEOFENCE_VERTEX_COUNT;
+        goto errors;
+    }
+    (*inside) = 0;
+    // Ray casting toward east, with vertices expressed relatively to the point.
+    py = 0;
+    jdx = (uint8_t) (number_of_vertices - 1);
+    for (idx = 0; idx < number_of_vertices; idx++) {
+        xi = _GPS_get_longitude_delta((point->longitude), (vertices[idx].longitude));
+        yi = ((int64_t) (vertices[idx].latitude)) - ((int64_t) (point->latitude));
+        xj = _GPS_get_longitude_delta((point->longitude), (vertices[jdx].longitude));
+        yj = ((int64_t) (vertices[jdx].latitude)) - ((int64_t) (point->latitude));
+        // Check if edge crosses the ray.
+        if ((yi > py) != (yj > py)) {
+            // Intersection abscissa is positive when ((xi * (yj - yi)) - (yi * (xj - xi))) has the sign of (yj - yi).
+            if (yj > yi) {
+                if (((xi * (yj - yi)) - (yi * (xj - xi))) > 0) {
+                    (*inside) ^= 1;
+                }
+            }
+            else {
+                if (((xi * (yj - yi)) - (yi * (xj - xi))) < 0) {
+                    (*inside) ^= 1;
+                }
+            }
+        }
+        jdx = idx;
+    }
+errors:
+    return status;
+}
+
 #endif /* GPSM */
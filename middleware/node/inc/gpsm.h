@@ -8,6 +8,7 @@
 #ifndef __GPSM_H__
 #define __GPSM_H__
 
+#include "gpsm_ext_registers.h"
 #include "gpsm_registers.h"
 #include "node.h"
 #include "una.h"
@@ -16,9 +17,11 @@
 
 /*** GPSM macros ***/
 
-#define NODE_BOARD_ID               UNA_BOARD_ID_GPSM
-#define NODE_REGISTER_ADDRESS_LAST  GPSM_REGISTER_ADDRESS_LAST
-#define NODE_REGISTER_ACCESS        GPSM_REGISTER_ACCESS
+#define NODE_BOARD_ID                   UNA_BOARD_ID_GPSM
+#define NODE_REGISTER_ADDRESS_LAST      GPSM_EXT_REGISTER_ADDRESS_LAST
+#define NODE_REGISTER_ACCESS            GPSM_REGISTER_ACCESS
+#define NODE_EXT_REGISTER_ADDRESS_BASE  GPSM_REGISTER_ADDRESS_LAST
+#define NODE_EXT_REGISTER_ACCESS        GPSM_EXT_REGISTER_ACCESS
 
 /*** GPSM functions ***/
 
@@ -59,6 +62,52 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask);
  *******************************************************************/
 NODE_status_t GPSM_mtrg_callback(void);
 
+/*!******************************************************************
+ * \fn NODE_status_t GPSM_process(void)
+ * \brief GPSM acquisition process.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t GPSM_process(void);
+
+/*!******************************************************************
+ * \fn uint8_t GPSM_is_acquisition_running(void)
+ * \brief Check if a GPS acquisition is running.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      0 if no acquisition is running, 1 otherwise.
+ *******************************************************************/
+uint8_t GPSM_is_acquisition_running(void);
+
+/*!******************************************************************
+ * \fn uint8_t GPSM_is_clock_discipline_running(void)
+ * \brief Check if the clock discipline loop is running.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      0 if the loop is idle, 1 otherwise.
+ *******************************************************************/
+uint8_t GPSM_is_clock_discipline_running(void);
+
+/*!******************************************************************
+ * \fn uint8_t GPSM_is_report_pending(void)
+ * \brief Check if the receiver state of the last acquisition still has to be read.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      0 if no receiver poll is pending, 1 otherwise.
+ *******************************************************************/
+uint8_t GPSM_is_report_pending(void);
+
+/*!******************************************************************
+ * \fn uint8_t GPSM_is_assistance_pending(void)
+ * \brief Check if aiding configuration or assistance data still has to be sent to the receiver.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      0 if no receiver exchange is pending, 1 otherwise.
+ * \note        A requested acquisition is started only once all pending messages have been sent.
+ *******************************************************************/
+uint8_t GPSM_is_assistance_pending(void);
+
 #endif /* GPSM */
 
 #endif /* __GPSM_H__ */
@@ -0,0 +1,345 @@
+/*
+ * gpsm_ext_registers.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __GPSM_EXT_REGISTERS_H__
+#define __GPSM_EXT_REGISTERS_H__
+
+#include "gpsm_registers.h"
+#include "types.h"
+#include "una.h"
+
+/*** GPSM EXT REGISTERS macros ***/
+
+#define GPSM_EXT_NUMBER_OF_REGISTERS                            (GPSM_EXT_REGISTER_ADDRESS_LAST - GPSM_REGISTER_ADDRESS_LAST)
+
+#define GPSM_TRACKING_DEPTH                                     8
+#define GPSM_TRACKING_NUMBER_OF_REGISTERS_PER_ENTRY             4
+
+#define GPSM_MGA_WINDOW_NUMBER_OF_REGISTERS                     8
+
+#define GPSM_GEOFENCE_NUMBER                                    4
+#define GPSM_GEOFENCE_NUMBER_OF_REGISTERS_PER_FENCE             3
+#define GPSM_GEOFENCE_NUMBER_OF_VERTICES                        8
+
+#define GPSM_REGISTER_ACQUISITION_STATUS_MASK_TIP               0x00000001
+#define GPSM_REGISTER_ACQUISITION_STATUS_MASK_TFX               0x00000002
+#define GPSM_REGISTER_ACQUISITION_STATUS_MASK_TTO               0x00000004
+#define GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP               0x00000010
+#define GPSM_REGISTER_ACQUISITION_STATUS_MASK_GFX               0x00000020
+#define GPSM_REGISTER_ACQUISITION_STATUS_MASK_GTO               0x00000040
+#define GPSM_REGISTER_ACQUISITION_STATUS_MASK_ELAPSED_TIME      0xFFFF0000
+
+#define GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_HSEN         0x00000001
+#define GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_HOT_WINDOW   0x0000FF00
+#define GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_WARM_WINDOW  0x00FF0000
+
+#define GPSM_REGISTER_HOT_START_STATUS_MASK_START_TYPE          0x00000003
+#define GPSM_REGISTER_HOT_START_STATUS_MASK_LFV                 0x00000004
+#define GPSM_REGISTER_HOT_START_STATUS_MASK_TTFF                0xFFFF0000
+
+#define GPSM_REGISTER_ACQUISITION_ENERGY_MASK_ENERGY            0xFFFFFFFF
+
+#define GPSM_REGISTER_TRACKING_CONFIGURATION_MASK_TKEN          0x00000001
+#define GPSM_REGISTER_TRACKING_CONFIGURATION_MASK_PERIOD        0x0000FF00
+
+#define GPSM_REGISTER_TRACKING_CONTROL_MASK_TCLR                0x00000001
+
+#define GPSM_REGISTER_TRACKING_STATUS_MASK_INDEX                0x000000FF
+#define GPSM_REGISTER_TRACKING_STATUS_MASK_COUNT                0x0000FF00
+
+#define GPSM_REGISTER_TRACKING_ENTRY_0_MASK_TIMESTAMP           0xFFFFFFFF
+// Tracking entries 1 to 3 use the GEOLOC_DATA_0 to GEOLOC_DATA_2 registers layout.
+
+#define GPSM_REGISTER_DISCIPLINE_CONFIGURATION_MASK_WINDOW      0x000000FF
+
+#define GPSM_REGISTER_DISCIPLINE_CONTROL_MASK_CDTRG             0x00000001
+
+#define GPSM_REGISTER_DISCIPLINE_STATUS_MASK_CDIP               0x00000001
+#define GPSM_REGISTER_DISCIPLINE_STATUS_MASK_CDS                0x00000002
+#define GPSM_REGISTER_DISCIPLINE_STATUS_MASK_CDE                0x00000004
+#define GPSM_REGISTER_DISCIPLINE_STATUS_MASK_CAV                0x00000008
+#define GPSM_REGISTER_DISCIPLINE_STATUS_MASK_PULSE_COUNT        0x0000FF00
+#define GPSM_REGISTER_DISCIPLINE_STATUS_MASK_HSI_TRIM           0x001F0000
+
+#define GPSM_REGISTER_DISCIPLINE_DATA_0_MASK_LSE_ERROR          0xFFFFFFFF
+
+#define GPSM_REGISTER_DISCIPLINE_DATA_1_MASK_HSI_ERROR          0x0000FFFF
+#define GPSM_REGISTER_DISCIPLINE_DATA_1_MASK_RTC_CALIBRATION    0xFFFF0000
+
+#define GPSM_REGISTER_CALENDAR_MASK_UNIX_TIME                   0xFFFFFFFF
+
+#define GPSM_REGISTER_PSM_CONFIGURATION_MASK_PSEN               0x00000001
+#define GPSM_REGISTER_PSM_CONFIGURATION_MASK_PSMD               0x00000002
+#define GPSM_REGISTER_PSM_CONFIGURATION_MASK_UPDATE_PERIOD      0x0000FF00
+#define GPSM_REGISTER_PSM_CONFIGURATION_MASK_SEARCH_PERIOD      0x00FF0000
+
+#define GPSM_REGISTER_PSM_STATUS_MASK_POWER_STATE               0x00000003
+
+#define GPSM_REGISTER_MGA_CONFIGURATION_MASK_AOPEN              0x00000001
+
+#define GPSM_REGISTER_MGA_CONTROL_MASK_MGAPP                    0x00000001
+#define GPSM_REGISTER_MGA_CONTROL_MASK_MGCLR                    0x00000002
+#define GPSM_REGISTER_MGA_CONTROL_MASK_LENGTH                   0x00003F00
+
+#define GPSM_REGISTER_MGA_STATUS_MASK_MGE                       0x00000001
+#define GPSM_REGISTER_MGA_STATUS_MASK_MGO                       0x00000002
+#define GPSM_REGISTER_MGA_STATUS_MASK_AOPST                     0x00000004
+#define GPSM_REGISTER_MGA_STATUS_MASK_LEVEL                     0xFFFF0000
+
+#define GPSM_REGISTER_MGA_COUNTERS_MASK_ACK_COUNT               0x0000FFFF
+#define GPSM_REGISTER_MGA_COUNTERS_MASK_NACK_COUNT              0xFFFF0000
+// MGA data window registers contain 4 bytes each, least significant byte first.
+
+#define GPSM_REGISTER_QUALITY_DATA_0_MASK_SV_USED               0x000000FF
+#define GPSM_REGISTER_QUALITY_DATA_0_MASK_SV_TRACKED            0x0000FF00
+#define GPSM_REGISTER_QUALITY_DATA_0_MASK_QDV                   0x00010000
+
+#define GPSM_REGISTER_QUALITY_DATA_1_MASK_HDOP                  0x0000FFFF
+#define GPSM_REGISTER_QUALITY_DATA_1_MASK_PDOP                  0xFFFF0000
+
+#define GPSM_REGISTER_QUALITY_DATA_2_MASK_GPS_CN0_MAX           0x000000FF
+#define GPSM_REGISTER_QUALITY_DATA_2_MASK_GPS_CN0_MEAN          0x0000FF00
+#define GPSM_REGISTER_QUALITY_DATA_2_MASK_GLONASS_CN0_MAX       0x00FF0000
+#define GPSM_REGISTER_QUALITY_DATA_2_MASK_GLONASS_CN0_MEAN      0xFF000000
+
+#define GPSM_REGISTER_QUALITY_DATA_3_MASK_GALILEO_CN0_MAX       0x000000FF
+#define GPSM_REGISTER_QUALITY_DATA_3_MASK_GALILEO_CN0_MEAN      0x0000FF00
+#define GPSM_REGISTER_QUALITY_DATA_3_MASK_BEIDOU_CN0_MAX        0x00FF0000
+#define GPSM_REGISTER_QUALITY_DATA_3_MASK_BEIDOU_CN0_MEAN       0xFF000000
+
+#define GPSM_REGISTER_GEOFENCE_CONFIGURATION_MASK_GFEN          0x00000001
+#define GPSM_REGISTER_GEOFENCE_CONFIGURATION_MASK_GFTP          0x00000002
+#define GPSM_REGISTER_GEOFENCE_CONFIGURATION_MASK_VERTEX_INDEX  0x00000700
+#define GPSM_REGISTER_GEOFENCE_CONFIGURATION_MASK_VERTEX_COUNT  0x0000F000
+#define GPSM_REGISTER_GEOFENCE_CONFIGURATION_MASK_RADIUS        0xFFFF0000
+// Coordinates are signed values in 1e-7 degree unit.
+#define GPSM_REGISTER_GEOFENCE_LATITUDE_MASK_LATITUDE           0xFFFFFFFF
+#define GPSM_REGISTER_GEOFENCE_LONGITUDE_MASK_LONGITUDE         0xFFFFFFFF
+
+#define GPSM_REGISTER_GEOFENCE_CONTROL_MASK_GFCLR               0x00000001
+
+#define GPSM_REGISTER_GEOFENCE_STATUS_MASK_INSIDE               0x0000000F
+#define GPSM_REGISTER_GEOFENCE_STATUS_MASK_ENTER                0x000000F0
+#define GPSM_REGISTER_GEOFENCE_STATUS_MASK_EXIT                 0x00000F00
+#define GPSM_REGISTER_GEOFENCE_STATUS_MASK_GFV                  0x00001000
+
+// Accuracy in decimeters and PDOP in 0.1 unit, a null value disables the criterion.
+#define GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_ACCURACY_MAX  0x0000FFFF
+#define GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_PDOP_MAX      0x00FF0000
+#define GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_SV_MIN        0x0F000000
+#define GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_AVERAGING     0xF0000000
+
+#define GPSM_REGISTER_FIX_GATE_STATUS_MASK_ACCURACY             0x0000FFFF
+#define GPSM_REGISTER_FIX_GATE_STATUS_MASK_FIX_COUNT            0x000F0000
+#define GPSM_REGISTER_FIX_GATE_STATUS_MASK_FGR                  0x00100000
+
+/*** GPSM EXT REGISTERS structures ***/
+
+/*!******************************************************************
+ * \enum GPSM_ext_register_address_t
+ * \brief GPSM extended registers map, located after the UNA registers map.
+ *******************************************************************/
+typedef enum {
+    GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS = GPSM_REGISTER_ADDRESS_LAST,
+    GPSM_REGISTER_ADDRESS_HOT_START_CONFIGURATION,
+    GPSM_REGISTER_ADDRESS_HOT_START_STATUS,
+    GPSM_REGISTER_ADDRESS_ACQUISITION_ENERGY,
+    GPSM_REGISTER_ADDRESS_TRACKING_CONFIGURATION,
+    GPSM_REGISTER_ADDRESS_TRACKING_CONTROL,
+    GPSM_REGISTER_ADDRESS_TRACKING_STATUS,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_0,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_1,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_2,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_3,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_4,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_5,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_6,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_7,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_8,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_9,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_10,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_11,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_12,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_13,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_14,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_15,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_16,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_17,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_18,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_19,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_20,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_21,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_22,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_23,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_24,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_25,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_26,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_27,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_28,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_29,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_30,
+    GPSM_REGISTER_ADDRESS_TRACKING_DATA_31,
+    GPSM_REGISTER_ADDRESS_DISCIPLINE_CONFIGURATION,
+    GPSM_REGISTER_ADDRESS_DISCIPLINE_CONTROL,
+    GPSM_REGISTER_ADDRESS_DISCIPLINE_STATUS,
+    GPSM_REGISTER_ADDRESS_DISCIPLINE_DATA_0,
+    GPSM_REGISTER_ADDRESS_DISCIPLINE_DATA_1,
+    GPSM_REGISTER_ADDRESS_CALENDAR,
+    GPSM_REGISTER_ADDRESS_PSM_CONFIGURATION,
+    GPSM_REGISTER_ADDRESS_PSM_STATUS,
+    GPSM_REGISTER_ADDRESS_MGA_CONFIGURATION,
+    GPSM_REGISTER_ADDRESS_MGA_CONTROL,
+    GPSM_REGISTER_ADDRESS_MGA_STATUS,
+    GPSM_REGISTER_ADDRESS_MGA_COUNTERS,
+    GPSM_REGISTER_ADDRESS_MGA_DATA_0,
+    GPSM_REGISTER_ADDRESS_MGA_DATA_1,
+    GPSM_REGISTER_ADDRESS_MGA_DATA_2,
+    GPSM_REGISTER_ADDRESS_MGA_DATA_3,
+    GPSM_REGISTER_ADDRESS_MGA_DATA_4,
+    GPSM_REGISTER_ADDRESS_MGA_DATA_5,
+    GPSM_REGISTER_ADDRESS_MGA_DATA_6,
+    GPSM_REGISTER_ADDRESS_MGA_DATA_7,
+    GPSM_REGISTER_ADDRESS_QUALITY_DATA_0,
+    GPSM_REGISTER_ADDRESS_QUALITY_DATA_1,
+    GPSM_REGISTER_ADDRESS_QUALITY_DATA_2,
+    GPSM_REGISTER_ADDRESS_QUALITY_DATA_3,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_0_CONFIGURATION,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_0_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_0_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_1_CONFIGURATION,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_1_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_1_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_2_CONFIGURATION,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_2_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_2_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_3_CONFIGURATION,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_3_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_3_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_0_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_0_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_1_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_1_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_2_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_2_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_3_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_3_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_4_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_4_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_5_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_5_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_6_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_6_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_7_LATITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_7_LONGITUDE,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_CONTROL,
+    GPSM_REGISTER_ADDRESS_GEOFENCE_STATUS,
+    GPSM_REGISTER_ADDRESS_FIX_GATE_CONFIGURATION,
+    GPSM_REGISTER_ADDRESS_FIX_GATE_STATUS,
+    GPSM_EXT_REGISTER_ADDRESS_LAST
+} GPSM_ext_register_address_t;
+
+/*** GPSM EXT REGISTERS global variables ***/
+
+static const UNA_register_access_t GPSM_EXT_REGISTER_ACCESS[GPSM_EXT_NUMBER_OF_REGISTERS] = {
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY
+};
+
+#endif /* __GPSM_EXT_REGISTERS_H__ */
@@ -8,6 +8,7 @@
 #ifndef __LVRM_H__
 #define __LVRM_H__
 
+#include "lvrm_ext_registers.h"
 #include "lvrm_registers.h"
 #include "node.h"
 #include "una.h"
@@ -16,9 +17,15 @@
 
 /*** LVRM macros ***/
 
-#define NODE_BOARD_ID               UNA_BOARD_ID_LVRM
-#define NODE_REGISTER_ADDRESS_LAST  LVRM_REGISTER_ADDRESS_LAST
-#define NODE_REGISTER_ACCESS        LVRM_REGISTER_ACCESS
+#define NODE_BOARD_ID                   UNA_BOARD_ID_LVRM
+#define NODE_REGISTER_ACCESS            LVRM_REGISTER_ACCESS
+#if ((defined LVRM_MODE_BMS) || (defined HW2_0))
+#define NODE_REGISTER_ADDRESS_LAST      LVRM_EXT_REGISTER_ADDRESS_LAST
+#define NODE_EXT_REGISTER_ADDRESS_BASE  LVRM_REGISTER_ADDRESS_LAST
+#define NODE_EXT_REGISTER_ACCESS        LVRM_EXT_REGISTER_ACCESS
+#else
+#define NODE_REGISTER_ADDRESS_LAST      LVRM_REGISTER_ADDRESS_LAST
+#endif
 
 /*** LVRM functions ***/
 
@@ -70,6 +77,28 @@ NODE_status_t LVRM_mtrg_callback(void);
 NODE_status_t LVRM_bms_process(void);
 #endif
 
+#ifdef HW2_0
+/*!******************************************************************
+ * \fn NODE_status_t LVRM_relay_process(void)
+ * \brief Process bistable relay switching sequence.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t LVRM_relay_process(void);
+#endif
+
+#ifdef HW2_0
+/*!******************************************************************
+ * \fn uint8_t LVRM_is_relay_switching(void)
+ * \brief Check if a bistable relay switching sequence is in progress.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      0 if the relay is idle, 1 otherwise.
+ *******************************************************************/
+uint8_t LVRM_is_relay_switching(void);
+#endif
+
 #endif /* LVRM */
 
 #endif /* __LVRM_H__ */
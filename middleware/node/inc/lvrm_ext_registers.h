@@ -0,0 +1,106 @@
+/*
+ * lvrm_ext_registers.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LVRM_EXT_REGISTERS_H__
+#define __LVRM_EXT_REGISTERS_H__
+
+#include "lvrm_registers.h"
+#include "types.h"
+#include "una.h"
+#include "xm_flags.h"
+
+#if ((defined LVRM_MODE_BMS) || (defined HW2_0))
+
+/*** LVRM EXT REGISTERS macros ***/
+
+#define LVRM_EXT_NUMBER_OF_REGISTERS                                (LVRM_EXT_REGISTER_ADDRESS_LAST - LVRM_REGISTER_ADDRESS_LAST)
+
+#ifdef LVRM_MODE_BMS
+// Open circuit voltage points from 0% to 100% state of charge by steps of 10%.
+#define LVRM_BATTERY_OCV_NUMBER_OF_POINTS                           11
+#define LVRM_BATTERY_OCV_NUMBER_OF_REGISTERS                        6
+
+// Chemistry: 0 = custom OCV table, 1 = lead-acid, 2 = LiFePO4, 3 = Li-ion. Writing a preset loads its OCV table.
+#define LVRM_REGISTER_BATTERY_CONFIGURATION_MASK_CHEM               0x0000000F
+// Nominal capacity in units of 100mAh.
+#define LVRM_REGISTER_BATTERY_CONFIGURATION_MASK_CAPACITY           0xFFFF0000
+
+// Relay driven by the state of charge instead of the voltage thresholds.
+#define LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOCM                   0x00000001
+#define LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOC_LOW_THRESHOLD      0x0000FF00
+#define LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOC_HIGH_THRESHOLD     0x00FF0000
+
+#define LVRM_REGISTER_BATTERY_OCV_MASK_OCV_LOW                      0x0000FFFF
+#define LVRM_REGISTER_BATTERY_OCV_MASK_OCV_HIGH                     0xFFFF0000
+
+#define LVRM_REGISTER_BATTERY_STATUS_1_MASK_SOC                     0x000000FF
+#define LVRM_REGISTER_BATTERY_STATUS_1_MASK_SOCV                    0x00000100
+#define LVRM_REGISTER_BATTERY_STATUS_1_MASK_REST                    0x00000200
+// Time to empty in minutes, 0xFFFF when the battery is not discharging.
+#define LVRM_REGISTER_BATTERY_STATUS_1_MASK_TTE                     0xFFFF0000
+
+// Remaining charge in units of 100mAh.
+#define LVRM_REGISTER_BATTERY_STATUS_2_MASK_CHARGE                  0x0000FFFF
+#define LVRM_REGISTER_BATTERY_STATUS_2_MASK_IAVG                    0xFFFF0000
+#endif
+
+#ifdef HW2_0
+// Bistable relay switching sequence in progress and queued relay request.
+#define LVRM_REGISTER_RELAY_STATUS_MASK_SWIP                        0x00000001
+#define LVRM_REGISTER_RELAY_STATUS_MASK_PEND                        0x00000002
+#endif
+
+/*** LVRM EXT REGISTERS structures ***/
+
+/*!******************************************************************
+ * \enum LVRM_ext_register_address_t
+ * \brief LVRM extended registers map, located after the UNA registers map.
+ *******************************************************************/
+typedef enum {
+#ifdef LVRM_MODE_BMS
+    LVRM_REGISTER_ADDRESS_BATTERY_CONFIGURATION = LVRM_REGISTER_ADDRESS_LAST,
+    LVRM_REGISTER_ADDRESS_BMS_CONFIGURATION,
+    LVRM_REGISTER_ADDRESS_BATTERY_OCV_0,
+    LVRM_REGISTER_ADDRESS_BATTERY_OCV_1,
+    LVRM_REGISTER_ADDRESS_BATTERY_OCV_2,
+    LVRM_REGISTER_ADDRESS_BATTERY_OCV_3,
+    LVRM_REGISTER_ADDRESS_BATTERY_OCV_4,
+    LVRM_REGISTER_ADDRESS_BATTERY_OCV_5,
+    LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1,
+    LVRM_REGISTER_ADDRESS_BATTERY_STATUS_2,
+#ifdef HW2_0
+    LVRM_REGISTER_ADDRESS_RELAY_STATUS,
+#endif
+#else
+    LVRM_REGISTER_ADDRESS_RELAY_STATUS = LVRM_REGISTER_ADDRESS_LAST,
+#endif
+    LVRM_EXT_REGISTER_ADDRESS_LAST
+} LVRM_ext_register_address_t;
+
+/*** LVRM EXT REGISTERS global variables ***/
+
+static const UNA_register_access_t LVRM_EXT_REGISTER_ACCESS[LVRM_EXT_NUMBER_OF_REGISTERS] = {
+#ifdef LVRM_MODE_BMS
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+#endif
+#ifdef HW2_0
+    UNA_REGISTER_ACCESS_READ_ONLY
+#endif
+};
+
+#endif /* LVRM_MODE_BMS or HW2_0 */
+
+#endif /* __LVRM_EXT_REGISTERS_H__ */
@@ -18,6 +18,7 @@
 #include "power.h"
 #include "s2lp.h"
 #include "sht3x.h"
+#include "sht3x_periodic.h"
 #include "types.h"
 #include "una.h"
 
@@ -41,6 +42,7 @@ typedef enum {
     NODE_ERROR_SIGFOX_MCU_API,
     NODE_ERROR_SIGFOX_RF_API,
     NODE_ERROR_SIGFOX_EP_API,
+    NODE_ERROR_GPS_STATE,
     // Low level drivers errors.
     NODE_ERROR_BASE_NVM = 0x0100,
     NODE_ERROR_BASE_LPTIM = (NODE_ERROR_BASE_NVM + NVM_ERROR_BASE_LAST),
@@ -51,7 +53,8 @@ typedef enum {
     NODE_ERROR_BASE_POWER = (NODE_ERROR_BASE_GPS + GPS_ERROR_BASE_LAST),
     NODE_ERROR_BASE_S2LP = (NODE_ERROR_BASE_POWER + POWER_ERROR_BASE_LAST),
     NODE_ERROR_BASE_SHT3X = (NODE_ERROR_BASE_S2LP + S2LP_ERROR_BASE_LAST),
-    NODE_ERROR_BASE_ANALOG = (NODE_ERROR_BASE_SHT3X + SHT3X_ERROR_BASE_LAST),
+    NODE_ERROR_BASE_SHT3X_PERIODIC = (NODE_ERROR_BASE_SHT3X + SHT3X_ERROR_BASE_LAST),
+    NODE_ERROR_BASE_ANALOG = (NODE_ERROR_BASE_SHT3X_PERIODIC + SHT3X_PERIODIC_ERROR_BASE_LAST),
     NODE_ERROR_BASE_SIGFOX_EP_ADDON_RFP_API = (NODE_ERROR_BASE_ANALOG + ANALOG_ERROR_BASE_LAST),
     // Last base value.
     NODE_ERROR_BASE_LAST = (NODE_ERROR_BASE_SIGFOX_EP_ADDON_RFP_API + 0x0100)
@@ -64,6 +67,7 @@ typedef enum {
 typedef enum {
     NODE_STATE_IDLE = 0,
     NODE_STATE_RUNNING,
+    NODE_STATE_BUSY,
     NODE_STATE_LAST
 } NODE_state_t;
 
@@ -8,17 +8,20 @@
 #ifndef __SM_H__
 #define __SM_H__
 
-#include "sm_registers.h"
 #include "node.h"
+#include "sm_ext_registers.h"
+#include "sm_registers.h"
 #include "una.h"
 
 #ifdef SM
 
 /*** SM macros ***/
 
-#define NODE_BOARD_ID               UNA_BOARD_ID_SM
-#define NODE_REGISTER_ADDRESS_LAST  SM_REGISTER_ADDRESS_LAST
-#define NODE_REGISTER_ACCESS        SM_REGISTER_ACCESS
+#define NODE_BOARD_ID                   UNA_BOARD_ID_SM
+#define NODE_REGISTER_ADDRESS_LAST      SM_EXT_REGISTER_ADDRESS_LAST
+#define NODE_REGISTER_ACCESS            SM_REGISTER_ACCESS
+#define NODE_EXT_REGISTER_ADDRESS_BASE  SM_REGISTER_ADDRESS_LAST
+#define NODE_EXT_REGISTER_ACCESS        SM_EXT_REGISTER_ACCESS
 
 /*** SM functions ***/
 
@@ -59,6 +62,24 @@ NODE_status_t SM_check_register(uint8_t reg_addr, uint32_t reg_mask);
  *******************************************************************/
 NODE_status_t SM_mtrg_callback(void);
 
+/*!******************************************************************
+ * \fn NODE_status_t SM_process(void)
+ * \brief SM background process.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t SM_process(void);
+
+/*!******************************************************************
+ * \fn uint8_t SM_is_dio_measurement_running(void)
+ * \brief Check if a DIO frequency measurement window is running.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      0 if no measurement is running, 1 otherwise.
+ *******************************************************************/
+uint8_t SM_is_dio_measurement_running(void);
+
 #endif /* SM */
 
 #endif /* __SM_H__ */
@@ -0,0 +1,204 @@
+/*
+ * sm_ext_registers.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SM_EXT_REGISTERS_H__
+#define __SM_EXT_REGISTERS_H__
+
+#include "sm_registers.h"
+#include "types.h"
+#include "una.h"
+
+/*** SM EXT REGISTERS macros ***/
+
+#define SM_EXT_NUMBER_OF_REGISTERS                              (SM_EXT_REGISTER_ADDRESS_LAST - SM_REGISTER_ADDRESS_LAST)
+
+// Edge: 0 = disabled, 1 = rising, 2 = falling, 3 = both.
+#define SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO0_EDGE    0x00000003
+#define SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO0_RCEN    0x00000004
+#define SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO1_EDGE    0x00000030
+#define SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO1_RCEN    0x00000040
+#define SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO2_EDGE    0x00000300
+#define SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO2_RCEN    0x00000400
+#define SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO3_EDGE    0x00003000
+#define SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO3_RCEN    0x00004000
+
+// Debounce delays in ms.
+#define SM_REGISTER_DIO_COUNTER_DEBOUNCE_MASK_DIO0              0x000000FF
+#define SM_REGISTER_DIO_COUNTER_DEBOUNCE_MASK_DIO1              0x0000FF00
+#define SM_REGISTER_DIO_COUNTER_DEBOUNCE_MASK_DIO2              0x00FF0000
+#define SM_REGISTER_DIO_COUNTER_DEBOUNCE_MASK_DIO3              0xFF000000
+
+#define SM_REGISTER_DIO_COUNTER_CONTROL_MASK_CLR0               0x00000001
+#define SM_REGISTER_DIO_COUNTER_CONTROL_MASK_CLR1               0x00000002
+#define SM_REGISTER_DIO_COUNTER_CONTROL_MASK_CLR2               0x00000004
+#define SM_REGISTER_DIO_COUNTER_CONTROL_MASK_CLR3               0x00000008
+
+#define SM_REGISTER_DIO_COUNTER_MASK_COUNT                      0xFFFFFFFF
+
+// Window and period in seconds.
+#define SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN0     0x00000001
+#define SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN1     0x00000002
+#define SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN2     0x00000004
+#define SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN3     0x00000008
+#define SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_WINDOW   0x0000FF00
+#define SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_PERIOD   0xFFFF0000
+
+// Frequency in mHz.
+#define SM_REGISTER_DIO_FREQUENCY_MASK_FREQUENCY                0xFFFFFFFF
+
+// Duty cycle in 0.1% unit.
+#define SM_REGISTER_DIO_DUTY_CYCLE_1_MASK_DIO0                  0x0000FFFF
+#define SM_REGISTER_DIO_DUTY_CYCLE_1_MASK_DIO1                  0xFFFF0000
+#define SM_REGISTER_DIO_DUTY_CYCLE_2_MASK_DIO2                  0x0000FFFF
+#define SM_REGISTER_DIO_DUTY_CYCLE_2_MASK_DIO3                  0xFFFF0000
+
+// Rate: 0 = 0.5 mps, 1 = 1 mps, 2 = 2 mps, 3 = 4 mps, 4 = 10 mps.
+#define SM_REGISTER_SENSORS_CONFIGURATION_MASK_PMEN             0x00000001
+#define SM_REGISTER_SENSORS_CONFIGURATION_MASK_RATE             0x000000F0
+
+// Signed temperatures in degrees and humidities in percent.
+#define SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_THIGH      0x000000FF
+#define SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_TLOW       0x0000FF00
+#define SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_HHIGH      0x00FF0000
+#define SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_HLOW       0xFF000000
+
+#define SM_REGISTER_SENSORS_STATUS_MASK_PMST                    0x00000001
+#define SM_REGISTER_SENSORS_STATUS_MASK_TA                      0x00000002
+#define SM_REGISTER_SENSORS_STATUS_MASK_HA                      0x00000004
+#define SM_REGISTER_SENSORS_STATUS_MASK_TAF                     0x00000008
+#define SM_REGISTER_SENSORS_STATUS_MASK_HAF                     0x00000010
+
+// One bit per entry of the sensors table, main sensor feeding the ANALOG_DATA_3 register.
+#define SM_REGISTER_SENSORS_DETECTION_MASK_DETECTED             0x000000FF
+#define SM_REGISTER_SENSORS_DETECTION_MASK_MAIN                 0x0000FF00
+
+#define SM_REGISTER_SENSORS_DATA_MASK_TAMB                      0x0000FFFF
+#define SM_REGISTER_SENSORS_DATA_MASK_HAMB                      0x00FF0000
+
+// Type: 0 = voltage (mV), 1 = 4-20mA current loop (uA), 2 = ratiometric (per-mille of supply).
+// Gain type: 0 = attenuation, 1 = amplification. Gain is the shunt resistor in ohms for the current loop type.
+#define SM_REGISTER_AIN_CONFIGURATION_MASK_TYPE                 0x00000003
+#define SM_REGISTER_AIN_CONFIGURATION_MASK_GT                   0x00000004
+// IIR filter coefficient as 2^(-IIR), 0 to bypass the IIR filter.
+#define SM_REGISTER_AIN_CONFIGURATION_MASK_IIR                  0x000000F0
+// Number of background samples (one per SM_AIN_FILTER_SAMPLE_PERIOD_SECONDS) averaged by the decimator, 0 or 1 to bypass the decimator.
+#define SM_REGISTER_AIN_CONFIGURATION_MASK_DEC                  0x0000FF00
+#define SM_REGISTER_AIN_CONFIGURATION_MASK_GAIN                 0xFFFF0000
+
+// Sampling period in seconds.
+#define SM_REGISTER_LOGGER_CONFIGURATION_MASK_LEN               0x00000001
+#define SM_REGISTER_LOGGER_CONFIGURATION_MASK_PERIOD            0xFFFFFF00
+
+#define SM_REGISTER_LOGGER_CONTROL_MASK_CLR                     0x00000001
+
+#define SM_REGISTER_LOGGER_STATUS_MASK_COUNT                    0x0000FFFF
+#define SM_REGISTER_LOGGER_STATUS_MASK_CAPACITY                 0xFFFF0000
+
+// Logger time in seconds, continued from the last record after a reset.
+#define SM_REGISTER_LOGGER_TIME_MASK_TIME                       0xFFFFFFFF
+
+// Index of the record exposed in the window, 0 being the oldest one. Incremented after reading the last word.
+#define SM_REGISTER_LOGGER_READ_POINTER_MASK_INDEX              0x0000FFFF
+
+// Sequence 0 means empty record.
+#define SM_REGISTER_LOGGER_RECORD_0_MASK_SEQ                    0x0000FFFF
+#define SM_REGISTER_LOGGER_RECORD_0_MASK_CHK                    0x00FF0000
+#define SM_REGISTER_LOGGER_RECORD_0_MASK_DIO0                   0x03000000
+#define SM_REGISTER_LOGGER_RECORD_0_MASK_DIO1                   0x0C000000
+#define SM_REGISTER_LOGGER_RECORD_0_MASK_DIO2                   0x30000000
+#define SM_REGISTER_LOGGER_RECORD_0_MASK_DIO3                   0xC0000000
+
+// Restart flag is set on the first record after a reset.
+#define SM_REGISTER_LOGGER_RECORD_1_MASK_TIME                   0x7FFFFFFF
+#define SM_REGISTER_LOGGER_RECORD_1_MASK_RST                    0x80000000
+
+// Records words 2 to 4 are copies of the ANALOG_DATA_1 to ANALOG_DATA_3 registers.
+
+/*** SM EXT REGISTERS structures ***/
+
+/*!******************************************************************
+ * \enum SM_ext_register_address_t
+ * \brief SM extended registers map, located after the UNA registers map.
+ *******************************************************************/
+typedef enum {
+    SM_REGISTER_ADDRESS_DIO_COUNTER_CONFIGURATION = SM_REGISTER_ADDRESS_LAST,
+    SM_REGISTER_ADDRESS_DIO_COUNTER_DEBOUNCE,
+    SM_REGISTER_ADDRESS_DIO_COUNTER_CONTROL,
+    SM_REGISTER_ADDRESS_DIO_COUNTER_0,
+    SM_REGISTER_ADDRESS_DIO_COUNTER_1,
+    SM_REGISTER_ADDRESS_DIO_COUNTER_2,
+    SM_REGISTER_ADDRESS_DIO_COUNTER_3,
+    SM_REGISTER_ADDRESS_DIO_MEASUREMENT_CONFIGURATION,
+    SM_REGISTER_ADDRESS_DIO_FREQUENCY_0,
+    SM_REGISTER_ADDRESS_DIO_FREQUENCY_1,
+    SM_REGISTER_ADDRESS_DIO_FREQUENCY_2,
+    SM_REGISTER_ADDRESS_DIO_FREQUENCY_3,
+    SM_REGISTER_ADDRESS_DIO_DUTY_CYCLE_1,
+    SM_REGISTER_ADDRESS_DIO_DUTY_CYCLE_2,
+    SM_REGISTER_ADDRESS_SENSORS_CONFIGURATION,
+    SM_REGISTER_ADDRESS_SENSORS_ALERT_CONFIGURATION,
+    SM_REGISTER_ADDRESS_SENSORS_STATUS,
+    SM_REGISTER_ADDRESS_SENSORS_DETECTION,
+    SM_REGISTER_ADDRESS_SENSORS_DATA_0,
+    SM_REGISTER_ADDRESS_SENSORS_DATA_1,
+    SM_REGISTER_ADDRESS_AIN_CONFIGURATION_0,
+    SM_REGISTER_ADDRESS_AIN_CONFIGURATION_1,
+    SM_REGISTER_ADDRESS_AIN_CONFIGURATION_2,
+    SM_REGISTER_ADDRESS_AIN_CONFIGURATION_3,
+    SM_REGISTER_ADDRESS_LOGGER_CONFIGURATION,
+    SM_REGISTER_ADDRESS_LOGGER_CONTROL,
+    SM_REGISTER_ADDRESS_LOGGER_STATUS,
+    SM_REGISTER_ADDRESS_LOGGER_TIME,
+    SM_REGISTER_ADDRESS_LOGGER_READ_POINTER,
+    SM_REGISTER_ADDRESS_LOGGER_RECORD_0,
+    SM_REGISTER_ADDRESS_LOGGER_RECORD_1,
+    SM_REGISTER_ADDRESS_LOGGER_RECORD_2,
+    SM_REGISTER_ADDRESS_LOGGER_RECORD_3,
+    SM_REGISTER_ADDRESS_LOGGER_RECORD_4,
+    SM_EXT_REGISTER_ADDRESS_LAST
+} SM_ext_register_address_t;
+
+/*** SM EXT REGISTERS global variables ***/
+
+static const UNA_register_access_t SM_EXT_REGISTER_ACCESS[SM_EXT_NUMBER_OF_REGISTERS] = {
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY
+};
+
+#endif /* __SM_EXT_REGISTERS_H__ */
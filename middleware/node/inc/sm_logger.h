@@ -0,0 +1,80 @@
+/*
+ * sm_logger.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SM_LOGGER_H__
+#define __SM_LOGGER_H__
+
+#include "node.h"
+#include "types.h"
+#include "xm_flags.h"
+
+#if ((defined SM) && (defined SM_LOGGER_ENABLE))
+
+/*** SM LOGGER macros ***/
+
+#define SM_LOGGER_RECORD_SIZE_WORDS     5
+
+/*** SM LOGGER functions ***/
+
+/*!******************************************************************
+ * \fn NODE_status_t SM_LOGGER_init(void)
+ * \brief Recover the records store state from NVM.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ * \note        A record interrupted by a power failure is detected with its checksum and discarded.
+ *******************************************************************/
+NODE_status_t SM_LOGGER_init(void);
+
+/*!******************************************************************
+ * \fn NODE_status_t SM_LOGGER_append(uint32_t* record)
+ * \brief Append a record in the store, overwriting the oldest one when full.
+ * \param[in]   record: Record words, the sequence and checksum fields of the first word are computed by the logger.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t SM_LOGGER_append(uint32_t* record);
+
+/*!******************************************************************
+ * \fn NODE_status_t SM_LOGGER_read(uint16_t record_index, uint32_t* record)
+ * \brief Read a record from the store.
+ * \param[in]   record_index: Index of the record to read, 0 being the oldest one.
+ * \param[out]  record: Pointer to the record words, all zero if the index is out of range.
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t SM_LOGGER_read(uint16_t record_index, uint32_t* record);
+
+/*!******************************************************************
+ * \fn NODE_status_t SM_LOGGER_clear(void)
+ * \brief Erase all records.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t SM_LOGGER_clear(void);
+
+/*!******************************************************************
+ * \fn uint16_t SM_LOGGER_get_count(void)
+ * \brief Get the number of records in the store.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of records.
+ *******************************************************************/
+uint16_t SM_LOGGER_get_count(void);
+
+/*!******************************************************************
+ * \fn uint16_t SM_LOGGER_get_capacity(void)
+ * \brief Get the maximum number of records of the store.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Store capacity in records.
+ *******************************************************************/
+uint16_t SM_LOGGER_get_capacity(void);
+
+#endif /* SM and SM_LOGGER_ENABLE */
+
+#endif /* __SM_LOGGER_H__ */
@@ -10,6 +10,7 @@
 
 #include "adc.h"
 #include "node.h"
+#include "uhfm_ext_registers.h"
 #include "uhfm_registers.h"
 #include "una.h"
 
@@ -17,9 +18,11 @@
 
 /*** UHFM macros ***/
 
-#define NODE_BOARD_ID               UNA_BOARD_ID_UHFM
-#define NODE_REGISTER_ADDRESS_LAST  UHFM_REGISTER_ADDRESS_LAST
-#define NODE_REGISTER_ACCESS        UHFM_REGISTER_ACCESS
+#define NODE_BOARD_ID                   UNA_BOARD_ID_UHFM
+#define NODE_REGISTER_ADDRESS_LAST      UHFM_EXT_REGISTER_ADDRESS_LAST
+#define NODE_REGISTER_ACCESS            UHFM_REGISTER_ACCESS
+#define NODE_EXT_REGISTER_ADDRESS_BASE  UHFM_REGISTER_ADDRESS_LAST
+#define NODE_EXT_REGISTER_ACCESS        UHFM_EXT_REGISTER_ACCESS
 
 /*** UHFM functions ***/
 
@@ -60,6 +63,15 @@ NODE_status_t UHFM_check_register(uint8_t reg_addr, uint32_t reg_mask);
  *******************************************************************/
 NODE_status_t UHFM_mtrg_callback(void);
 
+/*!******************************************************************
+ * \fn NODE_status_t UHFM_process(void)
+ * \brief UHFM packet error rate campaign and statistics storage process.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NODE_status_t UHFM_process(void);
+
 #endif /* UHFM */
 
 #endif /* __UHFM_H__ */
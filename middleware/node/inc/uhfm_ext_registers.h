@@ -0,0 +1,144 @@
+/*
+ * uhfm_ext_registers.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UHFM_EXT_REGISTERS_H__
+#define __UHFM_EXT_REGISTERS_H__
+
+#include "types.h"
+#include "uhfm_registers.h"
+#include "una.h"
+
+/*** UHFM EXT REGISTERS macros ***/
+
+#define UHFM_EXT_NUMBER_OF_REGISTERS                                (UHFM_EXT_REGISTER_ADDRESS_LAST - UHFM_REGISTER_ADDRESS_LAST)
+
+#define UHFM_HISTORY_DEPTH                                          8
+#define UHFM_HISTORY_NUMBER_OF_REGISTERS_PER_ENTRY                  2
+
+#define UHFM_REGISTER_PER_CONFIGURATION_MASK_NUMBER_OF_ITERATIONS   0x0000FFFF
+#define UHFM_REGISTER_PER_CONFIGURATION_MASK_MODE                   0x00010000
+#define UHFM_REGISTER_PER_CONFIGURATION_MASK_PERIOD                 0xFF000000
+
+#define UHFM_REGISTER_PER_CONTROL_MASK_PTRG                         0x00000001
+#define UHFM_REGISTER_PER_CONTROL_MASK_PSTP                         0x00000002
+
+#define UHFM_REGISTER_PER_STATUS_MASK_PRST                          0x00000001
+#define UHFM_REGISTER_PER_STATUS_MASK_PDNE                          0x00000002
+#define UHFM_REGISTER_PER_STATUS_MASK_PERR                          0x00000004
+#define UHFM_REGISTER_PER_STATUS_MASK_ITERATION                     0xFFFF0000
+
+#define UHFM_REGISTER_PER_DATA_0_MASK_UL_FRAME_COUNT                0x0000FFFF
+#define UHFM_REGISTER_PER_DATA_0_MASK_DL_FRAME_COUNT                0xFFFF0000
+
+#define UHFM_REGISTER_PER_DATA_1_MASK_DL_ERROR_COUNT                0x0000FFFF
+#define UHFM_REGISTER_PER_DATA_1_MASK_DL_RSSI_MIN                   0x00FF0000
+#define UHFM_REGISTER_PER_DATA_1_MASK_DL_RSSI_MAX                   0xFF000000
+
+#define UHFM_REGISTER_PER_DATA_2_MASK_DL_RSSI_MEAN                  0x000000FF
+#define UHFM_REGISTER_PER_DATA_2_MASK_DL_RSSI_LAST                  0x0000FF00
+#define UHFM_REGISTER_PER_DATA_2_MASK_DL_CRC_ERROR_COUNT            0xFFFF0000
+
+#define UHFM_REGISTER_HISTORY_CONTROL_MASK_HCLR                     0x00000001
+
+#define UHFM_REGISTER_HISTORY_STATUS_MASK_INDEX                     0x000000FF
+#define UHFM_REGISTER_HISTORY_STATUS_MASK_COUNT                     0x0000FF00
+
+#define UHFM_REGISTER_STATISTICS_0_MASK_UL_MESSAGE_COUNT            0x0000FFFF
+#define UHFM_REGISTER_STATISTICS_0_MASK_UL_SUCCESS_COUNT            0xFFFF0000
+
+#define UHFM_REGISTER_STATISTICS_1_MASK_DL_REQUEST_COUNT            0x0000FFFF
+#define UHFM_REGISTER_STATISTICS_1_MASK_DL_SUCCESS_COUNT            0xFFFF0000
+
+#define UHFM_REGISTER_STATISTICS_2_MASK_DL_RSSI_SUM                 0xFFFFFFFF
+
+#define UHFM_REGISTER_STATISTICS_3_MASK_DL_RSSI_MIN                 0x000000FF
+#define UHFM_REGISTER_STATISTICS_3_MASK_DL_RSSI_MAX                 0x0000FF00
+
+#define UHFM_REGISTER_STATISTICS_4_MASK_UL_SUCCESS_RATE             0x000000FF
+#define UHFM_REGISTER_STATISTICS_4_MASK_DL_SUCCESS_RATE             0x0000FF00
+#define UHFM_REGISTER_STATISTICS_4_MASK_DL_RSSI_MEAN                0x00FF0000
+
+#define UHFM_REGISTER_HISTORY_ENTRY_0_MASK_TIMESTAMP                0xFFFFFFFF
+
+#define UHFM_REGISTER_HISTORY_ENTRY_1_MASK_MESSAGE_COUNTER          0x0000FFFF
+#define UHFM_REGISTER_HISTORY_ENTRY_1_MASK_MESSAGE_STATUS           0x00FF0000
+#define UHFM_REGISTER_HISTORY_ENTRY_1_MASK_DL_RSSI                  0xFF000000
+
+/*** UHFM EXT REGISTERS structures ***/
+
+/*!******************************************************************
+ * \enum UHFM_ext_register_address_t
+ * \brief UHFM extended registers map, located after the UNA registers map.
+ *******************************************************************/
+typedef enum {
+    UHFM_REGISTER_ADDRESS_PER_CONFIGURATION = UHFM_REGISTER_ADDRESS_LAST,
+    UHFM_REGISTER_ADDRESS_PER_CONTROL,
+    UHFM_REGISTER_ADDRESS_PER_STATUS,
+    UHFM_REGISTER_ADDRESS_PER_DATA_0,
+    UHFM_REGISTER_ADDRESS_PER_DATA_1,
+    UHFM_REGISTER_ADDRESS_PER_DATA_2,
+    UHFM_REGISTER_ADDRESS_HISTORY_CONTROL,
+    UHFM_REGISTER_ADDRESS_HISTORY_STATUS,
+    UHFM_REGISTER_ADDRESS_STATISTICS_0,
+    UHFM_REGISTER_ADDRESS_STATISTICS_1,
+    UHFM_REGISTER_ADDRESS_STATISTICS_2,
+    UHFM_REGISTER_ADDRESS_STATISTICS_3,
+    UHFM_REGISTER_ADDRESS_STATISTICS_4,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_0,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_1,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_2,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_3,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_4,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_5,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_6,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_7,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_8,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_9,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_10,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_11,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_12,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_13,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_14,
+    UHFM_REGISTER_ADDRESS_HISTORY_DATA_15,
+    UHFM_EXT_REGISTER_ADDRESS_LAST
+} UHFM_ext_register_address_t;
+
+/*** UHFM EXT REGISTERS global variables ***/
+
+static const UNA_register_access_t UHFM_EXT_REGISTER_ACCESS[UHFM_EXT_NUMBER_OF_REGISTERS] = {
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY
+};
+
+#endif /* __UHFM_EXT_REGISTERS_H__ */
@@ -14,13 +14,58 @@
 #include "node.h"
 #include "power.h"
 #include "rtc.h"
+#include "stm32l0xx_drivers_flags.h"
 #include "swreg.h"
 #include "una.h"
 
 #ifdef GPSM
 
+/*** GPSM local macros ***/
+
+#define GPSM_ACQUISITION_POWER_MW           75
+#ifdef GPSM_ACTIVE_ANTENNA
+#define GPSM_ACTIVE_ANTENNA_POWER_MW        30
+#else
+#define GPSM_ACTIVE_ANTENNA_POWER_MW        0
+#endif
+
+#define GPSM_DISCIPLINE_TIMEPULSE_FREQUENCY_HZ  1
+#define GPSM_DISCIPLINE_TIMEPULSE_DUTY_CYCLE    10
+#define GPSM_DISCIPLINE_TIMEOUT_MARGIN_SECONDS  (2 * STM32L0XX_DRIVERS_RTC_WAKEUP_PERIOD_SECONDS)
+#define GPSM_DISCIPLINE_HSI_ERROR_MAX           32767
+
+#define GPSM_MGA_BUFFER_SIZE_BYTES          512
+#define GPSM_MGA_COUNTER_MAX                0xFFFF
+
+#define GPSM_FIX_GATE_ACCURACY_MAX_DM       0xFFFF
+
 /*** GPSM local structures ***/
 
+/*******************************************************************/
+typedef enum {
+    GPSM_START_TYPE_COLD = 0,
+    GPSM_START_TYPE_WARM,
+    GPSM_START_TYPE_HOT,
+    GPSM_START_TYPE_LAST
+} GPSM_start_type_t;
+
+/*******************************************************************/
+typedef enum {
+    GPSM_POWER_STATE_OFF = 0,
+    GPSM_POWER_STATE_CONTINUOUS,
+    GPSM_POWER_STATE_CYCLIC_TRACKING,
+    GPSM_POWER_STATE_ON_OFF,
+    GPSM_POWER_STATE_LAST
+} GPSM_power_state_t;
+
+/*******************************************************************/
+typedef enum {
+    GPSM_REPORT_STEP_NONE = 0,
+    GPSM_REPORT_STEP_QUALITY,
+    GPSM_REPORT_STEP_AOP_STATUS,
+    GPSM_REPORT_STEP_LAST
+} GPSM_report_step_t;
+
 /*******************************************************************/
 typedef union {
     struct {
@@ -28,14 +73,49 @@ typedef union {
         unsigned tpen :1;
         unsigned pwmd :1;
         unsigned pwen :1;
+        unsigned tip :1;
+        unsigned gip :1;
+        unsigned lfv :1;
+        unsigned cdip :1;
+        unsigned cdcp :1;
+        unsigned cds :1;
+        unsigned cde :1;
+        unsigned mge :1;
+        unsigned mgo :1;
+        unsigned aopst :1;
+        unsigned gfv :1;
     };
-    uint8_t all;
+    uint16_t all;
 } GPSM_flags_t;
 
 /*******************************************************************/
 typedef struct {
     GPSM_flags_t flags;
     UNA_bit_representation_t bkenst;
+    uint32_t acquisition_start_time_seconds;
+    uint32_t acquisition_duration_seconds;
+    uint32_t acquisition_timeout_seconds;
+    uint8_t acquisition_start_pending;
+    uint32_t last_fix_time_seconds;
+    GPSM_start_type_t start_type;
+    GPSM_report_step_t report_step;
+    uint32_t acquisition_energy_mj;
+    uint32_t tracking_next_time_seconds;
+    uint8_t tracking_index;
+    uint8_t tracking_count;
+    uint32_t discipline_deadline_seconds;
+    GPS_clock_discipline_t clock_discipline;
+    GPSM_power_state_t power_state;
+    uint8_t mga_buffer[GPSM_MGA_BUFFER_SIZE_BYTES];
+    uint16_t mga_level;
+    uint16_t mga_ack_count;
+    uint16_t mga_nack_count;
+    uint8_t mga_configuration_pending;
+    uint8_t mga_injection_pending;
+    uint8_t geofence_inside;
+    uint8_t geofence_enter;
+    uint8_t geofence_exit;
+    GPS_fix_report_t fix_report;
 } GPSM_context_t;
 
 /*** GPSM local global variables ***/
@@ -76,6 +156,176 @@ static void _GPSM_load_dynamic_configuration(void) {
         // Write register.
         NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, reg_value, UNA_REGISTER_MASK_ALL);
     }
+    // Load hot start and tracking configurations from NVM.
+    NODE_read_nvm(GPSM_REGISTER_ADDRESS_HOT_START_CONFIGURATION, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_HOT_START_CONFIGURATION, reg_value, UNA_REGISTER_MASK_ALL);
+    NODE_read_nvm(GPSM_REGISTER_ADDRESS_TRACKING_CONFIGURATION, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_TRACKING_CONFIGURATION, reg_value, UNA_REGISTER_MASK_ALL);
+    NODE_read_nvm(GPSM_REGISTER_ADDRESS_DISCIPLINE_CONFIGURATION, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_DISCIPLINE_CONFIGURATION, reg_value, UNA_REGISTER_MASK_ALL);
+    NODE_read_nvm(GPSM_REGISTER_ADDRESS_PSM_CONFIGURATION, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_PSM_CONFIGURATION, reg_value, UNA_REGISTER_MASK_ALL);
+    NODE_read_nvm(GPSM_REGISTER_ADDRESS_MGA_CONFIGURATION, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_MGA_CONFIGURATION, reg_value, UNA_REGISTER_MASK_ALL);
+    NODE_read_nvm(GPSM_REGISTER_ADDRESS_FIX_GATE_CONFIGURATION, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_FIX_GATE_CONFIGURATION, reg_value, UNA_REGISTER_MASK_ALL);
+    // Load geofences from NVM.
+    for (reg_addr = GPSM_REGISTER_ADDRESS_GEOFENCE_0_CONFIGURATION; reg_addr < GPSM_REGISTER_ADDRESS_GEOFENCE_CONTROL; reg_addr++) {
+        NODE_read_nvm(reg_addr, &reg_value);
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, reg_value, UNA_REGISTER_MASK_ALL);
+    }
+}
+
+/*******************************************************************/
+static void _GPSM_clear_tracking(void) {
+    // Local variables.
+    uint8_t reg_addr = 0;
+    // Reset ring buffer.
+    gpsm_ctx.tracking_index = 0;
+    gpsm_ctx.tracking_count = 0;
+    for (reg_addr = GPSM_REGISTER_ADDRESS_TRACKING_DATA_0; reg_addr < (GPSM_REGISTER_ADDRESS_TRACKING_DATA_0 + (GPSM_TRACKING_DEPTH * GPSM_TRACKING_NUMBER_OF_REGISTERS_PER_ENTRY)); reg_addr++) {
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, 0, UNA_REGISTER_MASK_ALL);
+    }
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_TRACKING_STATUS);
+}
+
+/*******************************************************************/
+static void _GPSM_add_tracking_entry(uint32_t reg_geoloc_data_0, uint32_t reg_geoloc_data_1, uint32_t reg_geoloc_data_2) {
+    // Local variables.
+    uint8_t reg_addr = (GPSM_REGISTER_ADDRESS_TRACKING_DATA_0 + (gpsm_ctx.tracking_index * GPSM_TRACKING_NUMBER_OF_REGISTERS_PER_ENTRY));
+    // Write tracking entry.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (reg_addr + 0), RTC_get_uptime_seconds(), GPSM_REGISTER_TRACKING_ENTRY_0_MASK_TIMESTAMP);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (reg_addr + 1), reg_geoloc_data_0, UNA_REGISTER_MASK_ALL);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (reg_addr + 2), reg_geoloc_data_1, UNA_REGISTER_MASK_ALL);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (reg_addr + 3), reg_geoloc_data_2, UNA_REGISTER_MASK_ALL);
+    // Update ring buffer indexes.
+    gpsm_ctx.tracking_index = (uint8_t) ((gpsm_ctx.tracking_index + 1) % GPSM_TRACKING_DEPTH);
+    if (gpsm_ctx.tracking_count < GPSM_TRACKING_DEPTH) {
+        gpsm_ctx.tracking_count++;
+    }
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_TRACKING_STATUS);
+}
+
+/*******************************************************************/
+static void _GPSM_clear_assistance(void) {
+    // Local variables.
+    uint8_t reg_addr = 0;
+    // Reset buffer and counters.
+    gpsm_ctx.mga_level = 0;
+    gpsm_ctx.mga_ack_count = 0;
+    gpsm_ctx.mga_nack_count = 0;
+    gpsm_ctx.mga_injection_pending = 0;
+    gpsm_ctx.flags.mge = 0;
+    gpsm_ctx.flags.mgo = 0;
+    for (reg_addr = GPSM_REGISTER_ADDRESS_MGA_DATA_0; reg_addr < (GPSM_REGISTER_ADDRESS_MGA_DATA_0 + GPSM_MGA_WINDOW_NUMBER_OF_REGISTERS); reg_addr++) {
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, 0, UNA_REGISTER_MASK_ALL);
+    }
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_MGA_STATUS);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_MGA_COUNTERS);
+}
+
+/*******************************************************************/
+static void _GPSM_append_assistance(uint8_t length) {
+    // Local variables.
+    uint32_t reg_mga_data = 0;
+    uint8_t idx = 0;
+    // Check length and remaining space.
+    if (length > (GPSM_MGA_WINDOW_NUMBER_OF_REGISTERS * 4)) {
+        length = (GPSM_MGA_WINDOW_NUMBER_OF_REGISTERS * 4);
+    }
+    if ((gpsm_ctx.mga_level + length) > GPSM_MGA_BUFFER_SIZE_BYTES) {
+        gpsm_ctx.flags.mgo = 1;
+        goto errors;
+    }
+    // Copy window bytes.
+    for (idx = 0; idx < length; idx++) {
+        if ((idx % 4) == 0) {
+            NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, (GPSM_REGISTER_ADDRESS_MGA_DATA_0 + (idx / 4)), &reg_mga_data);
+        }
+        gpsm_ctx.mga_buffer[gpsm_ctx.mga_level++] = (uint8_t) ((reg_mga_data >> (8 * (idx % 4))) & 0xFF);
+    }
+    // Injected by the next process calls.
+    gpsm_ctx.mga_injection_pending = 1;
+errors:
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_MGA_STATUS);
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_is_inside_geofence(uint8_t geofence_index, GPS_coordinates_t* coordinates, uint8_t* inside) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_coordinates_t vertices[GPSM_GEOFENCE_NUMBER_OF_VERTICES];
+    uint8_t reg_addr = (GPSM_REGISTER_ADDRESS_GEOFENCE_0_CONFIGURATION + (geofence_index * GPSM_GEOFENCE_NUMBER_OF_REGISTERS_PER_FENCE));
+    uint32_t reg_geofence_configuration = 0;
+    uint32_t reg_value = 0;
+    uint32_t distance_m = 0;
+    uint8_t vertex_index = 0;
+    uint8_t vertex_count = 0;
+    uint8_t idx = 0;
+    // Disabled geofences are never entered.
+    (*inside) = 0;
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, &reg_geofence_configuration);
+    if (SWREG_read_field(reg_geofence_configuration, GPSM_REGISTER_GEOFENCE_CONFIGURATION_MASK_GFEN) == 0) goto errors;
+    // Check geofence type.
+    if (SWREG_read_field(reg_geofence_configuration, GPSM_REGISTER_GEOFENCE_CONFIGURATION_MASK_GFTP) == 0) {
+        // Circle defined by its center and radius.
+        NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, (reg_addr + 1), &reg_value);
+        vertices[0].latitude = (int32_t) SWREG_read_field(reg_value, GPSM_REGISTER_GEOFENCE_LATITUDE_MASK_LATITUDE);
+        NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, (reg_addr + 2), &reg_value);
+        vertices[0].longitude = (int32_t) SWREG_read_field(reg_value, GPSM_REGISTER_GEOFENCE_LONGITUDE_MASK_LONGITUDE);
+        gps_status = GPS_get_distance(&(vertices[0]), coordinates, &distance_m);
+        GPS_exit_error(NODE_ERROR_BASE_GPS);
+        (*inside) = (distance_m <= SWREG_read_field(reg_geofence_configuration, GPSM_REGISTER_GEOFENCE_CONFIGURATION_MASK_RADIUS)) ? 1 : 0;
+    }
+    else {
+        // Polygon defined by a range of the shared vertices table.
+        vertex_index = (uint8_t) SWREG_read_field(reg_geofence_configuration, GPSM_REGISTER_GEOFENCE_CONFIGURATION_MASK_VERTEX_INDEX);
+        vertex_count = (uint8_t) SWREG_read_field(reg_geofence_configuration, GPSM_REGISTER_GEOFENCE_CONFIGURATION_MASK_VERTEX_COUNT);
+        // Invalid polygons are considered as outside.
+        if ((vertex_count < 3) || ((vertex_index + vertex_count) > GPSM_GEOFENCE_NUMBER_OF_VERTICES)) goto errors;
+        for (idx = 0; idx < vertex_count; idx++) {
+            reg_addr = (GPSM_REGISTER_ADDRESS_GEOFENCE_VERTEX_0_LATITUDE + ((vertex_index + idx) << 1));
+            NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, &reg_value);
+            vertices[idx].latitude = (int32_t) SWREG_read_field(reg_value, GPSM_REGISTER_GEOFENCE_LATITUDE_MASK_LATITUDE);
+            NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, (reg_addr + 1), &reg_value);
+            vertices[idx].longitude = (int32_t) SWREG_read_field(reg_value, GPSM_REGISTER_GEOFENCE_LONGITUDE_MASK_LONGITUDE);
+        }
+        gps_status = GPS_is_inside_polygon(coordinates, vertices, vertex_count, inside);
+        GPS_exit_error(NODE_ERROR_BASE_GPS);
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_geofence_process(GPS_position_t* gps_position) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_coordinates_t coordinates;
+    uint8_t geofence_inside = 0;
+    uint8_t inside = 0;
+    uint8_t idx = 0;
+    // Convert position to fixed point coordinates.
+    gps_status = GPS_convert_position(gps_position, &coordinates);
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+    // Evaluate all geofences.
+    for (idx = 0; idx < GPSM_GEOFENCE_NUMBER; idx++) {
+        status = _GPSM_is_inside_geofence(idx, &coordinates, &inside);
+        if (status != NODE_SUCCESS) goto errors;
+        geofence_inside |= (uint8_t) (inside << idx);
+    }
+    // Transitions are only reported from a known state.
+    if (gpsm_ctx.flags.gfv != 0) {
+        gpsm_ctx.geofence_enter |= (uint8_t) (geofence_inside & (~gpsm_ctx.geofence_inside));
+        gpsm_ctx.geofence_exit |= (uint8_t) ((~geofence_inside) & gpsm_ctx.geofence_inside);
+    }
+    gpsm_ctx.geofence_inside = geofence_inside;
+    gpsm_ctx.flags.gfv = 1;
+errors:
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_GEOFENCE_STATUS);
+    return status;
 }
 
 /*******************************************************************/
@@ -100,9 +350,153 @@ static void _GPSM_power_control(uint8_t state) {
     if ((state == 0) && (gpsm_ctx.flags.gps_power != 0)) {
         // Turn GPS off.
         POWER_disable(POWER_REQUESTER_ID_GPSM, POWER_DOMAIN_GPS);
+#ifndef GPSM_BKEN_FORCED_HARDWARE
+        // Aiding data is lost without backup voltage.
+        if (GPS_get_backup_voltage() == 0) {
+            gpsm_ctx.flags.lfv = 0;
+        }
+#endif
+    }
+    // Receiver always starts in continuous mode and without aiding configuration.
+    if ((state != 0) && (gpsm_ctx.flags.gps_power == 0)) {
+        gpsm_ctx.power_state = GPSM_POWER_STATE_CONTINUOUS;
+        gpsm_ctx.mga_configuration_pending = 1;
+    }
+    if (state == 0) {
+        gpsm_ctx.power_state = GPSM_POWER_STATE_OFF;
+        gpsm_ctx.flags.aopst = 0;
     }
     // Update local flag.
     gpsm_ctx.flags.gps_power = (state == 0) ? 0 : 1;
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_PSM_STATUS);
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_apply_fix_gate(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_fix_quality_gate_t fix_quality_gate;
+    uint32_t reg_fix_gate_configuration = 0;
+    // Read configuration.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_FIX_GATE_CONFIGURATION, &reg_fix_gate_configuration);
+    // Convert to driver units.
+    fix_quality_gate.horizontal_accuracy_max_mm = (SWREG_read_field(reg_fix_gate_configuration, GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_ACCURACY_MAX) * 100);
+    fix_quality_gate.pdop_max = (uint16_t) (SWREG_read_field(reg_fix_gate_configuration, GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_PDOP_MAX) * 10);
+    fix_quality_gate.satellites_min = (uint8_t) SWREG_read_field(reg_fix_gate_configuration, GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_SV_MIN);
+    fix_quality_gate.averaging_depth = (uint8_t) SWREG_read_field(reg_fix_gate_configuration, GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_AVERAGING);
+    gps_status = GPS_set_fix_quality_gate(&fix_quality_gate);
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_apply_power_save(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_power_mode_configuration_t power_mode_config;
+    GPSM_power_state_t power_state = GPSM_POWER_STATE_CONTINUOUS;
+    uint32_t reg_psm_configuration = 0;
+    // Power save is only relevant when the GPS is kept on by the PWEN bit.
+    if (gpsm_ctx.flags.gps_power == 0) goto errors;
+    // Read configuration.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_PSM_CONFIGURATION, &reg_psm_configuration);
+    if ((gpsm_ctx.flags.pwmd != 0) && (gpsm_ctx.flags.pwen != 0) && (SWREG_read_field(reg_psm_configuration, GPSM_REGISTER_PSM_CONFIGURATION_MASK_PSEN) != 0)) {
+        power_state = (SWREG_read_field(reg_psm_configuration, GPSM_REGISTER_PSM_CONFIGURATION_MASK_PSMD) == 0) ? GPSM_POWER_STATE_CYCLIC_TRACKING : GPSM_POWER_STATE_ON_OFF;
+    }
+    // Check if receiver has to be reconfigured.
+    if (power_state == gpsm_ctx.power_state) goto errors;
+    // Set parameters.
+    switch (power_state) {
+    case GPSM_POWER_STATE_CYCLIC_TRACKING:
+        power_mode_config.mode = UBX_POWER_MODE_CYCLIC_TRACKING;
+        break;
+    case GPSM_POWER_STATE_ON_OFF:
+        power_mode_config.mode = UBX_POWER_MODE_ON_OFF;
+        break;
+    default:
+        power_mode_config.mode = UBX_POWER_MODE_CONTINUOUS;
+        break;
+    }
+    power_mode_config.update_period_ms = (uint32_t) (UNA_get_seconds(SWREG_read_field(reg_psm_configuration, GPSM_REGISTER_PSM_CONFIGURATION_MASK_UPDATE_PERIOD)) * 1000);
+    power_mode_config.search_period_ms = (uint32_t) (UNA_get_seconds(SWREG_read_field(reg_psm_configuration, GPSM_REGISTER_PSM_CONFIGURATION_MASK_SEARCH_PERIOD)) * 1000);
+    // Configure receiver.
+    gps_status = GPS_set_power_mode(&power_mode_config);
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+    // Update local state.
+    gpsm_ctx.power_state = power_state;
+errors:
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_PSM_STATUS);
+    return status;
+}
+
+/*******************************************************************/
+static uint8_t _GPSM_is_injection_pending(void) {
+    // Local variables.
+    uint8_t pending = 0;
+    // Receiver must be powered and the UART free.
+    if ((gpsm_ctx.flags.gps_power != 0) && (GPSM_is_report_pending() == 0) && ((GPSM_is_acquisition_running() == 0) || (gpsm_ctx.acquisition_start_pending != 0))) {
+        pending = ((gpsm_ctx.mga_configuration_pending != 0) || (gpsm_ctx.mga_injection_pending != 0)) ? 1 : 0;
+    }
+    return pending;
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_assistance_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    uint32_t reg_mga_configuration = 0;
+    uint32_t frame_size_bytes = 0;
+    uint8_t acknowledged = 0;
+    uint16_t idx = 0;
+    // Perform a single receiver exchange per call, configuration is lost at each power cycle.
+    if (gpsm_ctx.mga_configuration_pending != 0) {
+        gpsm_ctx.mga_configuration_pending = 0;
+        NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_MGA_CONFIGURATION, &reg_mga_configuration);
+        gps_status = GPS_set_aiding_configuration((uint8_t) SWREG_read_field(reg_mga_configuration, GPSM_REGISTER_MGA_CONFIGURATION_MASK_AOPEN));
+        GPS_exit_error(NODE_ERROR_BASE_GPS);
+        goto errors;
+    }
+    // Inject next complete message, which is acknowledged before sending the next one.
+    gpsm_ctx.mga_injection_pending = 0;
+    gps_status = GPS_inject_assistance(gpsm_ctx.mga_buffer, gpsm_ctx.mga_level, &frame_size_bytes, &acknowledged);
+    if (gps_status == (GPS_ERROR_BASE_UBX + UBX_ERROR_FRAME)) {
+        // Buffer is not aligned on a UBX-MGA frame anymore.
+        gpsm_ctx.flags.mge = 1;
+        gpsm_ctx.mga_level = 0;
+        goto errors;
+    }
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+    // Wait for the end of the message.
+    if (frame_size_bytes == 0) {
+        // Message can not fit the buffer.
+        if (gpsm_ctx.mga_level >= GPSM_MGA_BUFFER_SIZE_BYTES) {
+            gpsm_ctx.flags.mge = 1;
+            gpsm_ctx.mga_level = 0;
+        }
+        goto errors;
+    }
+    // Update counters.
+    if (acknowledged != 0) {
+        gpsm_ctx.mga_ack_count = (gpsm_ctx.mga_ack_count < GPSM_MGA_COUNTER_MAX) ? (uint16_t) (gpsm_ctx.mga_ack_count + 1) : GPSM_MGA_COUNTER_MAX;
+    }
+    else {
+        gpsm_ctx.mga_nack_count = (gpsm_ctx.mga_nack_count < GPSM_MGA_COUNTER_MAX) ? (uint16_t) (gpsm_ctx.mga_nack_count + 1) : GPSM_MGA_COUNTER_MAX;
+    }
+    // Remove message from buffer.
+    for (idx = 0; idx < (gpsm_ctx.mga_level - frame_size_bytes); idx++) {
+        gpsm_ctx.mga_buffer[idx] = gpsm_ctx.mga_buffer[idx + frame_size_bytes];
+    }
+    gpsm_ctx.mga_level = (uint16_t) (gpsm_ctx.mga_level - frame_size_bytes);
+    // Continue with the next message at next call.
+    gpsm_ctx.mga_injection_pending = (gpsm_ctx.mga_level > 0) ? 1 : 0;
+errors:
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_MGA_STATUS);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_MGA_COUNTERS);
+    return status;
 }
 
 /*******************************************************************/
@@ -115,7 +509,7 @@ static NODE_status_t _GPSM_power_request(uint8_t state) {
     // Check power mode.
     if ((reg_control_1 & GPSM_REGISTER_CONTROL_1_MASK_PWMD) == 0) {
         // Power managed by the node.
-        if ((state == 0) && ((reg_control_1 & (GPSM_REGISTER_CONTROL_1_MASK_TTRG | GPSM_REGISTER_CONTROL_1_MASK_GTRG | GPSM_REGISTER_CONTROL_1_MASK_TPEN)) == 0)) {
+        if ((state == 0) && ((reg_control_1 & (GPSM_REGISTER_CONTROL_1_MASK_TTRG | GPSM_REGISTER_CONTROL_1_MASK_GTRG | GPSM_REGISTER_CONTROL_1_MASK_TPEN)) == 0) && (GPSM_is_acquisition_running() == 0) && (GPSM_is_report_pending() == 0) && (gpsm_ctx.flags.cdip == 0)) {
             _GPSM_power_control(0);
         }
         if (state != 0) {
@@ -134,38 +528,409 @@ errors:
     return status;
 }
 
+#ifndef GPSM_BKEN_FORCED_HARDWARE
+/*******************************************************************/
+static NODE_status_t _GPSM_set_backup_voltage(uint8_t state) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    // Set backup voltage.
+    gps_status = GPS_set_backup_voltage(state);
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+    // Aiding data is lost if the GPS is not powered anymore.
+    if ((state == 0) && (gpsm_ctx.flags.gps_power == 0)) {
+        gpsm_ctx.flags.lfv = 0;
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifndef GPSM_BKEN_FORCED_HARDWARE
+/*******************************************************************/
+static NODE_status_t _GPSM_hot_start_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t reg_hot_start_configuration = 0;
+    uint32_t warm_window_seconds = 0;
+    // Check manager state.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_HOT_START_CONFIGURATION, &reg_hot_start_configuration);
+    if (SWREG_read_field(reg_hot_start_configuration, GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_HSEN) == 0) goto errors;
+    // Backup voltage is only useful while the GPS is off.
+    if ((gpsm_ctx.flags.gps_power != 0) || (GPS_get_backup_voltage() == 0)) goto errors;
+    // Release backup voltage once the aiding data is outdated.
+    warm_window_seconds = (uint32_t) UNA_get_seconds(SWREG_read_field(reg_hot_start_configuration, GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_WARM_WINDOW));
+    if ((gpsm_ctx.flags.lfv == 0) || (RTC_get_uptime_seconds() >= (gpsm_ctx.last_fix_time_seconds + warm_window_seconds))) {
+        status = _GPSM_set_backup_voltage(0);
+        if (status != NODE_SUCCESS) goto errors;
+        GPSM_update_register(GPSM_REGISTER_ADDRESS_STATUS_1);
+    }
+errors:
+    return status;
+}
+#endif
+
+/*******************************************************************/
+static GPSM_start_type_t _GPSM_get_start_type(void) {
+    // Local variables.
+    GPSM_start_type_t start_type = GPSM_START_TYPE_COLD;
+    uint32_t reg_hot_start_configuration = 0;
+    uint32_t last_fix_age_seconds = 0;
+    // Check last fix.
+    if (gpsm_ctx.flags.lfv == 0) goto errors;
+    // Compare last fix age to the aiding data validity windows.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_HOT_START_CONFIGURATION, &reg_hot_start_configuration);
+    last_fix_age_seconds = (RTC_get_uptime_seconds() - gpsm_ctx.last_fix_time_seconds);
+    if (last_fix_age_seconds < ((uint32_t) UNA_get_seconds(SWREG_read_field(reg_hot_start_configuration, GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_HOT_WINDOW)))) {
+        start_type = GPSM_START_TYPE_HOT;
+    }
+    else if (last_fix_age_seconds < ((uint32_t) UNA_get_seconds(SWREG_read_field(reg_hot_start_configuration, GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_WARM_WINDOW)))) {
+        start_type = GPSM_START_TYPE_WARM;
+    }
+errors:
+    return start_type;
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_start_gps_acquisition(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_acquisition_type_t acquisition_type = (gpsm_ctx.flags.tip != 0) ? GPS_ACQUISITION_TYPE_TIME : GPS_ACQUISITION_TYPE_POSITION;
+    // Start acquisition, which is then performed by the GPSM process.
+    gpsm_ctx.acquisition_start_pending = 0;
+    gps_status = GPS_start_acquisition(acquisition_type, gpsm_ctx.acquisition_timeout_seconds);
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_start_acquisition(GPS_acquisition_type_t acquisition_type) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t timeout_seconds = 0;
+    uint32_t reg_timeout = 0;
+    uint32_t reg_status_1 = 0;
+    uint32_t reg_status_1_mask = 0;
+    uint32_t reg_acquisition_status = 0;
+    uint32_t reg_acquisition_status_mask = 0;
+#ifndef GPSM_BKEN_FORCED_HARDWARE
+    uint32_t reg_hot_start_configuration = 0;
+#endif
+    // Check state.
+    if (GPSM_is_acquisition_running() != 0) {
+        status = NODE_ERROR_GPS_STATE;
+        goto errors;
+    }
+    // Quality data of the previous acquisition is not relevant anymore.
+    gpsm_ctx.report_step = GPSM_REPORT_STEP_NONE;
+    // Read timeout.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_CONFIGURATION_1, &reg_timeout);
+    // Reset status flags.
+    if (acquisition_type == GPS_ACQUISITION_TYPE_TIME) {
+        timeout_seconds = SWREG_read_field(reg_timeout, GPSM_REGISTER_CONFIGURATION_1_MASK_TIME_TIMEOUT);
+        SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b0, GPSM_REGISTER_STATUS_1_MASK_TFS);
+        SWREG_write_field(&reg_acquisition_status, &reg_acquisition_status_mask, 0b0, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TFX);
+        SWREG_write_field(&reg_acquisition_status, &reg_acquisition_status_mask, 0b0, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TTO);
+    }
+    else {
+        timeout_seconds = SWREG_read_field(reg_timeout, GPSM_REGISTER_CONFIGURATION_1_MASK_GEOLOC_TIMEOUT);
+        SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b0, GPSM_REGISTER_STATUS_1_MASK_GFS);
+        SWREG_write_field(&reg_acquisition_status, &reg_acquisition_status_mask, 0b0, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GFX);
+        SWREG_write_field(&reg_acquisition_status, &reg_acquisition_status_mask, 0b0, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GTO);
+    }
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, reg_status_1, reg_status_1_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, reg_acquisition_status, reg_acquisition_status_mask);
+    // Estimate start type before turning GPS on.
+    gpsm_ctx.start_type = _GPSM_get_start_type();
+    // Turn GPS on.
+    status = _GPSM_power_request(1);
+    if (status != NODE_SUCCESS) goto errors;
+#ifndef GPSM_BKEN_FORCED_HARDWARE
+    // Keep aiding data of the new fix after GPS power off.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_HOT_START_CONFIGURATION, &reg_hot_start_configuration);
+    if (SWREG_read_field(reg_hot_start_configuration, GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_HSEN) != 0) {
+        status = _GPSM_set_backup_voltage(1);
+        if (status != NODE_SUCCESS) goto errors;
+    }
+#endif
+    // Receiver acquisition is started by the GPSM process once pending assistance data has been injected.
+    gpsm_ctx.acquisition_timeout_seconds = timeout_seconds;
+    gpsm_ctx.acquisition_start_pending = 1;
+    // Update local flags.
+    gpsm_ctx.acquisition_start_time_seconds = RTC_get_uptime_seconds();
+    gpsm_ctx.acquisition_duration_seconds = 0;
+    if (acquisition_type == GPS_ACQUISITION_TYPE_TIME) {
+        gpsm_ctx.flags.tip = 1;
+    }
+    else {
+        gpsm_ctx.flags.gip = 1;
+    }
+errors:
+    // Update status.
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_STATUS_1);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS);
+    // Turn GPS off is possible.
+    _GPSM_power_request(0);
+    return status;
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_set_discipline_timepulse(uint8_t state) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    GPS_timepulse_configuration_t timepulse_config;
+    // Discipline loop requires a 1PPS signal.
+    timepulse_config.active = state;
+    timepulse_config.frequency_hz = GPSM_DISCIPLINE_TIMEPULSE_FREQUENCY_HZ;
+    timepulse_config.duty_cycle_percent = GPSM_DISCIPLINE_TIMEPULSE_DUTY_CYCLE;
+    gps_status = GPS_set_timepulse(&timepulse_config);
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_start_clock_discipline(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    // Check state.
+    if ((GPSM_is_acquisition_running() != 0) || (gpsm_ctx.flags.cdip != 0) || (gpsm_ctx.flags.tpen != 0)) {
+        status = NODE_ERROR_GPS_STATE;
+        goto errors;
+    }
+    // Reset status flags.
+    gpsm_ctx.flags.cds = 0;
+    gpsm_ctx.flags.cde = 0;
+    // Time fix is required first to synchronize the calendar.
+    status = _GPSM_start_acquisition(GPS_ACQUISITION_TYPE_TIME);
+    if (status != NODE_SUCCESS) goto errors;
+    // Update local flag.
+    gpsm_ctx.flags.cdip = 1;
+errors:
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_DISCIPLINE_STATUS);
+    return status;
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_start_clock_discipline_captures(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    uint32_t reg_discipline_configuration = 0;
+    // Enable 1PPS signal.
+    status = _GPSM_set_discipline_timepulse(1);
+    if (status != NODE_SUCCESS) goto errors;
+    // Start edges capture.
+    gps_status = GPS_start_clock_discipline();
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+    // Compute deadline.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_DISCIPLINE_CONFIGURATION, &reg_discipline_configuration);
+    gpsm_ctx.discipline_deadline_seconds = RTC_get_uptime_seconds() + SWREG_read_field(reg_discipline_configuration, GPSM_REGISTER_DISCIPLINE_CONFIGURATION_MASK_WINDOW) + GPSM_DISCIPLINE_TIMEOUT_MARGIN_SECONDS;
+    // Update local flag.
+    gpsm_ctx.flags.cdcp = 1;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static void _GPSM_stop_clock_discipline(uint8_t success) {
+    // Release timepulse captures.
+    if (gpsm_ctx.flags.cdcp != 0) {
+        GPS_stop_clock_discipline();
+        _GPSM_set_discipline_timepulse(0);
+    }
+    // Update local flags.
+    gpsm_ctx.flags.cdip = 0;
+    gpsm_ctx.flags.cdcp = 0;
+    gpsm_ctx.flags.cds = (success == 0) ? 0 : 1;
+    gpsm_ctx.flags.cde = (success == 0) ? 1 : 0;
+    // Update status.
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_DISCIPLINE_STATUS);
+    // Turn GPS off is possible.
+    _GPSM_power_request(0);
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_clock_discipline_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+    uint32_t reg_discipline_configuration = 0;
+    uint32_t window = 0;
+    int32_t hsi_error_ppm = 0;
+    uint32_t reg_discipline_data_1 = 0;
+    uint32_t reg_discipline_data_1_mask = 0;
+    // Check captures.
+    if (gpsm_ctx.flags.cdcp == 0) goto errors;
+    // Measure new timepulse edges.
+    gps_status = GPS_process_clock_discipline();
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+    // Read window.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_DISCIPLINE_CONFIGURATION, &reg_discipline_configuration);
+    window = SWREG_read_field(reg_discipline_configuration, GPSM_REGISTER_DISCIPLINE_CONFIGURATION_MASK_WINDOW);
+    if (window == 0) {
+        window = 1;
+    }
+    // Window is made of (window + 1) edges.
+    if (GPS_get_clock_discipline_pulse_count() > window) {
+        // Correct clocks.
+        gps_status = GPS_apply_clock_discipline(&(gpsm_ctx.clock_discipline));
+        GPS_exit_error(NODE_ERROR_BASE_GPS);
+        // Write data registers.
+        hsi_error_ppm = gpsm_ctx.clock_discipline.hsi_error_ppm;
+        if (hsi_error_ppm > GPSM_DISCIPLINE_HSI_ERROR_MAX) {
+            hsi_error_ppm = GPSM_DISCIPLINE_HSI_ERROR_MAX;
+        }
+        if (hsi_error_ppm < (-GPSM_DISCIPLINE_HSI_ERROR_MAX)) {
+            hsi_error_ppm = (-GPSM_DISCIPLINE_HSI_ERROR_MAX);
+        }
+        SWREG_write_field(&reg_discipline_data_1, &reg_discipline_data_1_mask, (((uint32_t) hsi_error_ppm) & GPSM_REGISTER_DISCIPLINE_DATA_1_MASK_HSI_ERROR), GPSM_REGISTER_DISCIPLINE_DATA_1_MASK_HSI_ERROR);
+        SWREG_write_field(&reg_discipline_data_1, &reg_discipline_data_1_mask, gpsm_ctx.clock_discipline.rtc_calibration, GPSM_REGISTER_DISCIPLINE_DATA_1_MASK_RTC_CALIBRATION);
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_DISCIPLINE_DATA_0, (uint32_t) gpsm_ctx.clock_discipline.lse_error_ppb, GPSM_REGISTER_DISCIPLINE_DATA_0_MASK_LSE_ERROR);
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_DISCIPLINE_DATA_1, reg_discipline_data_1, reg_discipline_data_1_mask);
+        // Release loop.
+        _GPSM_stop_clock_discipline(1);
+    }
+    else if (RTC_get_uptime_seconds() >= gpsm_ctx.discipline_deadline_seconds) {
+        // Timepulse is missing.
+        _GPSM_stop_clock_discipline(0);
+    }
+    return status;
+errors:
+    if (gpsm_ctx.flags.cdcp != 0) {
+        _GPSM_stop_clock_discipline(0);
+    }
+    return status;
+}
+
+/*******************************************************************/
+static void _GPSM_read_quality_data(void) {
+    // Local variables.
+    GPS_quality_t gps_quality;
+    uint32_t reg_quality_data_0 = 0;
+    uint32_t reg_quality_data_0_mask = 0;
+    uint32_t reg_quality_data_1 = 0;
+    uint32_t reg_quality_data_1_mask = 0;
+    uint32_t reg_quality_data_2 = 0;
+    uint32_t reg_quality_data_2_mask = 0;
+    uint32_t reg_quality_data_3 = 0;
+    uint32_t reg_quality_data_3_mask = 0;
+    // Reset validity flag.
+    SWREG_write_field(&reg_quality_data_0, &reg_quality_data_0_mask, 0b0, GPSM_REGISTER_QUALITY_DATA_0_MASK_QDV);
+    // Read receiver state at the end of the acquisition, whatever the result.
+    if (gpsm_ctx.flags.gps_power == 0) goto errors;
+    if (GPS_get_quality(&gps_quality) != GPS_SUCCESS) goto errors;
+    // Fill registers with quality data.
+    SWREG_write_field(&reg_quality_data_0, &reg_quality_data_0_mask, (uint32_t) gps_quality.satellites_used, GPSM_REGISTER_QUALITY_DATA_0_MASK_SV_USED);
+    SWREG_write_field(&reg_quality_data_0, &reg_quality_data_0_mask, (uint32_t) gps_quality.satellites_tracked, GPSM_REGISTER_QUALITY_DATA_0_MASK_SV_TRACKED);
+    SWREG_write_field(&reg_quality_data_0, &reg_quality_data_0_mask, 0b1, GPSM_REGISTER_QUALITY_DATA_0_MASK_QDV);
+    SWREG_write_field(&reg_quality_data_1, &reg_quality_data_1_mask, (uint32_t) gps_quality.hdop, GPSM_REGISTER_QUALITY_DATA_1_MASK_HDOP);
+    SWREG_write_field(&reg_quality_data_1, &reg_quality_data_1_mask, (uint32_t) gps_quality.pdop, GPSM_REGISTER_QUALITY_DATA_1_MASK_PDOP);
+    SWREG_write_field(&reg_quality_data_2, &reg_quality_data_2_mask, (uint32_t) gps_quality.cno_max[UBX_CONSTELLATION_GPS], GPSM_REGISTER_QUALITY_DATA_2_MASK_GPS_CN0_MAX);
+    SWREG_write_field(&reg_quality_data_2, &reg_quality_data_2_mask, (uint32_t) gps_quality.cno_mean[UBX_CONSTELLATION_GPS], GPSM_REGISTER_QUALITY_DATA_2_MASK_GPS_CN0_MEAN);
+    SWREG_write_field(&reg_quality_data_2, &reg_quality_data_2_mask, (uint32_t) gps_quality.cno_max[UBX_CONSTELLATION_GLONASS], GPSM_REGISTER_QUALITY_DATA_2_MASK_GLONASS_CN0_MAX);
+    SWREG_write_field(&reg_quality_data_2, &reg_quality_data_2_mask, (uint32_t) gps_quality.cno_mean[UBX_CONSTELLATION_GLONASS], GPSM_REGISTER_QUALITY_DATA_2_MASK_GLONASS_CN0_MEAN);
+    SWREG_write_field(&reg_quality_data_3, &reg_quality_data_3_mask, (uint32_t) gps_quality.cno_max[UBX_CONSTELLATION_GALILEO], GPSM_REGISTER_QUALITY_DATA_3_MASK_GALILEO_CN0_MAX);
+    SWREG_write_field(&reg_quality_data_3, &reg_quality_data_3_mask, (uint32_t) gps_quality.cno_mean[UBX_CONSTELLATION_GALILEO], GPSM_REGISTER_QUALITY_DATA_3_MASK_GALILEO_CN0_MEAN);
+    SWREG_write_field(&reg_quality_data_3, &reg_quality_data_3_mask, (uint32_t) gps_quality.cno_max[UBX_CONSTELLATION_BEIDOU], GPSM_REGISTER_QUALITY_DATA_3_MASK_BEIDOU_CN0_MAX);
+    SWREG_write_field(&reg_quality_data_3, &reg_quality_data_3_mask, (uint32_t) gps_quality.cno_mean[UBX_CONSTELLATION_BEIDOU], GPSM_REGISTER_QUALITY_DATA_3_MASK_BEIDOU_CN0_MEAN);
+    // Write registers.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_QUALITY_DATA_1, reg_quality_data_1, reg_quality_data_1_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_QUALITY_DATA_2, reg_quality_data_2, reg_quality_data_2_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_QUALITY_DATA_3, reg_quality_data_3, reg_quality_data_3_mask);
+errors:
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_QUALITY_DATA_0, reg_quality_data_0, reg_quality_data_0_mask);
+}
+
 /*******************************************************************/
-static NODE_status_t _GPSM_ttrg_callback(void) {
+static void _GPSM_stop_acquisition(void) {
+    // Release GPS driver.
+    GPS_stop_acquisition();
+    // Receiver state is polled by the next process calls, before turning GPS off.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_QUALITY_DATA_0, 0b0, GPSM_REGISTER_QUALITY_DATA_0_MASK_QDV);
+    gpsm_ctx.report_step = GPSM_REPORT_STEP_QUALITY;
+    // Record acquisition metrics.
+    gpsm_ctx.acquisition_duration_seconds = (RTC_get_uptime_seconds() - gpsm_ctx.acquisition_start_time_seconds);
+    gpsm_ctx.acquisition_energy_mj = (gpsm_ctx.acquisition_duration_seconds * (GPSM_ACQUISITION_POWER_MW + GPSM_ACTIVE_ANTENNA_POWER_MW));
+    // Update local flags.
+    gpsm_ctx.flags.tip = 0;
+    gpsm_ctx.flags.gip = 0;
+    gpsm_ctx.acquisition_start_pending = 0;
+    // Update status.
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_HOT_START_STATUS);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_ACQUISITION_ENERGY);
+}
+
+/*******************************************************************/
+static void _GPSM_report_process(void) {
+    // Local variables.
+    uint32_t reg_mga_configuration = 0;
+    uint8_t aopst = 0;
+    // Perform a single receiver poll per call.
+    switch (gpsm_ctx.report_step) {
+    case GPSM_REPORT_STEP_QUALITY:
+        // Read signal quality.
+        _GPSM_read_quality_data();
+        gpsm_ctx.report_step = GPSM_REPORT_STEP_AOP_STATUS;
+        break;
+    case GPSM_REPORT_STEP_AOP_STATUS:
+        // Read autonomous aiding state.
+        NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_MGA_CONFIGURATION, &reg_mga_configuration);
+        if ((gpsm_ctx.flags.gps_power != 0) && (SWREG_read_field(reg_mga_configuration, GPSM_REGISTER_MGA_CONFIGURATION_MASK_AOPEN) != 0)) {
+            if (GPS_get_autonomous_aiding_status(&aopst) == GPS_SUCCESS) {
+                gpsm_ctx.flags.aopst = (aopst == 0) ? 0 : 1;
+            }
+        }
+        gpsm_ctx.report_step = GPSM_REPORT_STEP_NONE;
+        GPSM_update_register(GPSM_REGISTER_ADDRESS_MGA_STATUS);
+        // Turn GPS off is possible.
+        _GPSM_power_request(0);
+        break;
+    default:
+        break;
+    }
+}
+
+/*******************************************************************/
+static NODE_status_t _GPSM_read_time_data(void) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
     GPS_status_t gps_status = GPS_SUCCESS;
     GPS_acquisition_status_t gps_acquisition_status = GPS_ACQUISITION_ERROR_LAST;
     GPS_time_t gps_time;
     uint32_t time_fix_duration = 0;
-    uint32_t reg_timeout = 0;
     uint32_t reg_status_1 = 0;
     uint32_t reg_status_1_mask = 0;
+    uint32_t reg_acquisition_status = 0;
+    uint32_t reg_acquisition_status_mask = 0;
     uint32_t reg_time_data_0 = 0;
     uint32_t reg_time_data_0_mask = 0;
     uint32_t reg_time_data_1 = 0;
     uint32_t reg_time_data_1_mask = 0;
     uint32_t reg_time_data_2 = 0;
     uint32_t reg_time_data_2_mask = 0;
-    // Read status and timeout.
-    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, &reg_status_1);
-    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_CONFIGURATION_1, &reg_timeout);
-    // Reset status flag.
-    SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b0, GPSM_REGISTER_STATUS_1_MASK_TFS);
-    // Turn GPS on.
-    status = _GPSM_power_request(1);
-    if (status != NODE_SUCCESS) goto errors;
-    // Perform time fix.
-    gps_status = GPS_get_time(&gps_time, SWREG_read_field(reg_timeout, GPSM_REGISTER_CONFIGURATION_1_MASK_TIME_TIMEOUT), &time_fix_duration, &gps_acquisition_status);
+    // Read acquisition result.
+    gps_status = GPS_get_time(&gps_time, &time_fix_duration, &gps_acquisition_status);
     GPS_exit_error(NODE_ERROR_BASE_GPS);
     // Check acquisition status.
     if (gps_acquisition_status == GPS_ACQUISITION_SUCCESS) {
-        // Update status flag.
+        // Update status flags.
         SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b1, GPSM_REGISTER_STATUS_1_MASK_TFS);
+        // Update last fix time.
+        gpsm_ctx.last_fix_time_seconds = RTC_get_uptime_seconds();
+        gpsm_ctx.flags.lfv = 1;
+        SWREG_write_field(&reg_acquisition_status, &reg_acquisition_status_mask, 0b1, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TFX);
+        // Start timepulse captures before synchronizing the calendar, so that it is aligned on the next edge.
+        if (gpsm_ctx.flags.cdip != 0) {
+            status = _GPSM_start_clock_discipline_captures();
+            if (status != NODE_SUCCESS) goto errors;
+        }
+        gps_status = GPS_set_calendar(&gps_time);
+        GPS_exit_error(NODE_ERROR_BASE_GPS);
         // Fill registers with time data.
         SWREG_write_field(&reg_time_data_0, &reg_time_data_0_mask, (uint32_t) UNA_convert_year(gps_time.year), GPSM_REGISTER_TIME_DATA_0_MASK_YEAR);
         SWREG_write_field(&reg_time_data_0, &reg_time_data_0_mask, (uint32_t) gps_time.month, GPSM_REGISTER_TIME_DATA_0_MASK_MONTH);
@@ -179,28 +944,29 @@ static NODE_status_t _GPSM_ttrg_callback(void) {
         NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_TIME_DATA_1, reg_time_data_1, reg_time_data_1_mask);
         NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_TIME_DATA_2, reg_time_data_2, reg_time_data_2_mask);
     }
-    // Turn GPS off is possible.
-    status = _GPSM_power_request(0);
-    if (status != NODE_SUCCESS) goto errors;
+    else {
+        // Update status flag.
+        SWREG_write_field(&reg_acquisition_status, &reg_acquisition_status_mask, 0b1, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TTO);
+    }
 errors:
     // Update status.
-    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, reg_status_1, UNA_REGISTER_MASK_ALL);
-    // Turn GPS off is possible.
-    _GPSM_power_request(0);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, reg_status_1, reg_status_1_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, reg_acquisition_status, reg_acquisition_status_mask);
     return status;
 }
 
 /*******************************************************************/
-static NODE_status_t _GPSM_gtrg_callback(void) {
+static NODE_status_t _GPSM_read_geoloc_data(void) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
     GPS_status_t gps_status = GPS_SUCCESS;
     GPS_acquisition_status_t gps_acquisition_status = GPS_ACQUISITION_ERROR_LAST;
     GPS_position_t gps_position;
     uint32_t geoloc_fix_duration = 0;
-    uint32_t reg_timeout = 0;
     uint32_t reg_status_1 = 0;
     uint32_t reg_status_1_mask = 0;
+    uint32_t reg_acquisition_status = 0;
+    uint32_t reg_acquisition_status_mask = 0;
     uint32_t reg_geoloc_data_0 = 0;
     uint32_t reg_geoloc_data_0_mask = 0;
     uint32_t reg_geoloc_data_1 = 0;
@@ -209,21 +975,20 @@ static NODE_status_t _GPSM_gtrg_callback(void) {
     uint32_t reg_geoloc_data_2_mask = 0;
     uint32_t reg_geoloc_data_3 = 0;
     uint32_t reg_geoloc_data_3_mask = 0;
-    // Read status and timeout.
-    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, &reg_status_1);
-    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_CONFIGURATION_1, &reg_timeout);
-    // Reset status flag.
-    SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b0, GPSM_REGISTER_STATUS_1_MASK_GFS);
-    // Turn GPS on.
-    status = _GPSM_power_request(1);
-    if (status != NODE_SUCCESS) goto errors;
-    // Perform time fix.
-    gps_status = GPS_get_position(&gps_position, SWREG_read_field(reg_timeout, GPSM_REGISTER_CONFIGURATION_1_MASK_GEOLOC_TIMEOUT), &geoloc_fix_duration, &gps_acquisition_status);
+    // Read acquisition result.
+    gps_status = GPS_get_position(&gps_position, &geoloc_fix_duration, &gps_acquisition_status);
     GPS_exit_error(NODE_ERROR_BASE_GPS);
+    gps_status = GPS_get_fix_report(&(gpsm_ctx.fix_report));
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_FIX_GATE_STATUS);
     // Check acquisition status.
     if (gps_acquisition_status == GPS_ACQUISITION_SUCCESS) {
-        // Update status flag.
+        // Update status flags.
         SWREG_write_field(&reg_status_1, &reg_status_1_mask, 0b1, GPSM_REGISTER_STATUS_1_MASK_GFS);
+        // Update last fix time.
+        gpsm_ctx.last_fix_time_seconds = RTC_get_uptime_seconds();
+        gpsm_ctx.flags.lfv = 1;
+        SWREG_write_field(&reg_acquisition_status, &reg_acquisition_status_mask, 0b1, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GFX);
         // Fill registers with geoloc data.
         SWREG_write_field(&reg_geoloc_data_0, &reg_geoloc_data_0_mask, (uint32_t) gps_position.lat_north_flag, GPSM_REGISTER_GEOLOC_DATA_0_MASK_NF);
         SWREG_write_field(&reg_geoloc_data_0, &reg_geoloc_data_0_mask, gps_position.lat_seconds, GPSM_REGISTER_GEOLOC_DATA_0_MASK_SECOND);
@@ -240,15 +1005,20 @@ static NODE_status_t _GPSM_gtrg_callback(void) {
         NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOLOC_DATA_1, reg_geoloc_data_1, reg_geoloc_data_1_mask);
         NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOLOC_DATA_2, reg_geoloc_data_2, reg_geoloc_data_2_mask);
         NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOLOC_DATA_3, reg_geoloc_data_3, reg_geoloc_data_3_mask);
+        // Record position in tracking buffer.
+        _GPSM_add_tracking_entry(reg_geoloc_data_0, reg_geoloc_data_1, reg_geoloc_data_2);
+        // Update geofences state.
+        status = _GPSM_geofence_process(&gps_position);
+        if (status != NODE_SUCCESS) goto errors;
+    }
+    else {
+        // Update status flag.
+        SWREG_write_field(&reg_acquisition_status, &reg_acquisition_status_mask, 0b1, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GTO);
     }
-    // Turn GPS off is possible.
-    status = _GPSM_power_request(0);
-    if (status != NODE_SUCCESS) goto errors;
 errors:
     // Update status.
-    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, reg_status_1, UNA_REGISTER_MASK_ALL);
-    // Turn GPS off is possible.
-    _GPSM_power_request(0);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_STATUS_1, reg_status_1, reg_status_1_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, reg_acquisition_status, reg_acquisition_status_mask);
     return status;
 }
 
@@ -273,15 +1043,31 @@ static NODE_status_t _GPSM_tpen_callback(uint8_t state) {
     // Set timepulse.
     gps_status = GPS_set_timepulse(&timepulse_config);
     GPS_exit_error(NODE_ERROR_BASE_GPS);
-    // Turn GPS off is possible.
-    status = _GPSM_power_request(0);
-    if (status != NODE_SUCCESS) goto errors;
 errors:
     // Turn GPS off is possible.
     _GPSM_power_request(0);
     return status;
 }
 
+/*******************************************************************/
+static NODE_status_t _GPSM_tracking_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t reg_tracking_configuration = 0;
+    // Check tracking mode.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_TRACKING_CONFIGURATION, &reg_tracking_configuration);
+    if (SWREG_read_field(reg_tracking_configuration, GPSM_REGISTER_TRACKING_CONFIGURATION_MASK_TKEN) == 0) goto errors;
+    // Wait for period and for any running acquisition or clock discipline to complete.
+    if ((GPSM_is_acquisition_running() != 0) || (GPSM_is_report_pending() != 0) || (gpsm_ctx.flags.cdip != 0) || (RTC_get_uptime_seconds() < gpsm_ctx.tracking_next_time_seconds)) goto errors;
+    // Update next time.
+    gpsm_ctx.tracking_next_time_seconds = RTC_get_uptime_seconds() + ((uint32_t) UNA_get_seconds(SWREG_read_field(reg_tracking_configuration, GPSM_REGISTER_TRACKING_CONFIGURATION_MASK_PERIOD)));
+    // Start position acquisition.
+    status = _GPSM_start_acquisition(GPS_ACQUISITION_TYPE_POSITION);
+    if (status != NODE_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
 /*** GPSM functions ***/
 
 /*******************************************************************/
@@ -291,6 +1077,7 @@ NODE_status_t GPSM_init_registers(void) {
 #ifdef XM_NVM_FACTORY_RESET
     uint32_t reg_value = 0;
     uint32_t reg_mask = 0;
+    uint8_t reg_addr = 0;
     // Timeouts.
     SWREG_write_field(&reg_value, &reg_mask, GPSM_TIME_TIMEOUT_SECONDS,   GPSM_REGISTER_CONFIGURATION_1_MASK_TIME_TIMEOUT);
     SWREG_write_field(&reg_value, &reg_mask, GPSM_GEOLOC_TIMEOUT_SECONDS, GPSM_REGISTER_CONFIGURATION_1_MASK_GEOLOC_TIMEOUT);
@@ -304,15 +1091,87 @@ NODE_status_t GPSM_init_registers(void) {
     reg_mask = 0;
     SWREG_write_field(&reg_value, &reg_mask, GPSM_TIMEPULSE_DUTY_CYCLE, GPSM_REGISTER_CONFIGURATION_3_MASK_TP_DUTY_CYCLE);
     NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_CONFIGURATION_3, reg_value, reg_mask);
+    // Hot start manager.
+    reg_value = 0;
+    reg_mask = 0;
+#ifdef GPSM_BKEN_FORCED_HARDWARE
+    SWREG_write_field(&reg_value, &reg_mask, 0b0, GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_HSEN);
+#else
+    SWREG_write_field(&reg_value, &reg_mask, 0b1, GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_HSEN);
+#endif
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_seconds(GPSM_HOT_START_WINDOW_SECONDS), GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_HOT_WINDOW);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_seconds(GPSM_WARM_START_WINDOW_SECONDS), GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_WARM_WINDOW);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_HOT_START_CONFIGURATION, reg_value, reg_mask);
+    // Tracking mode.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, 0b0, GPSM_REGISTER_TRACKING_CONFIGURATION_MASK_TKEN);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_seconds(GPSM_TRACKING_PERIOD_SECONDS), GPSM_REGISTER_TRACKING_CONFIGURATION_MASK_PERIOD);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_TRACKING_CONFIGURATION, reg_value, reg_mask);
+    // Clock discipline.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, GPSM_DISCIPLINE_WINDOW_SECONDS, GPSM_REGISTER_DISCIPLINE_CONFIGURATION_MASK_WINDOW);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_DISCIPLINE_CONFIGURATION, reg_value, reg_mask);
+    // Power save mode.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, 0b0, GPSM_REGISTER_PSM_CONFIGURATION_MASK_PSEN);
+    SWREG_write_field(&reg_value, &reg_mask, 0b0, GPSM_REGISTER_PSM_CONFIGURATION_MASK_PSMD);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_seconds(GPSM_PSM_UPDATE_PERIOD_SECONDS), GPSM_REGISTER_PSM_CONFIGURATION_MASK_UPDATE_PERIOD);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_seconds(GPSM_PSM_SEARCH_PERIOD_SECONDS), GPSM_REGISTER_PSM_CONFIGURATION_MASK_SEARCH_PERIOD);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_PSM_CONFIGURATION, reg_value, reg_mask);
+    // Assistance data.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, 0b1, GPSM_REGISTER_MGA_CONFIGURATION_MASK_AOPEN);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_MGA_CONFIGURATION, reg_value, reg_mask);
+    // Position quality gate.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, GPSM_FIX_GATE_ACCURACY_DM, GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_ACCURACY_MAX);
+    SWREG_write_field(&reg_value, &reg_mask, GPSM_FIX_GATE_PDOP, GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_PDOP_MAX);
+    SWREG_write_field(&reg_value, &reg_mask, GPSM_FIX_GATE_SATELLITES, GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_SV_MIN);
+    SWREG_write_field(&reg_value, &reg_mask, GPSM_FIX_AVERAGING_DEPTH, GPSM_REGISTER_FIX_GATE_CONFIGURATION_MASK_AVERAGING);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_FIX_GATE_CONFIGURATION, reg_value, reg_mask);
+    // Geofences disabled.
+    for (reg_addr = GPSM_REGISTER_ADDRESS_GEOFENCE_0_CONFIGURATION; reg_addr < GPSM_REGISTER_ADDRESS_GEOFENCE_CONTROL; reg_addr++) {
+        NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, 0, UNA_REGISTER_MASK_ALL);
+    }
 #endif
-    // Init flags.
+    // Init context.
     gpsm_ctx.flags.all = 0;
+    gpsm_ctx.acquisition_start_time_seconds = 0;
+    gpsm_ctx.acquisition_duration_seconds = 0;
+    gpsm_ctx.last_fix_time_seconds = 0;
+    gpsm_ctx.start_type = GPSM_START_TYPE_COLD;
+    gpsm_ctx.report_step = GPSM_REPORT_STEP_NONE;
+    gpsm_ctx.acquisition_energy_mj = 0;
+    gpsm_ctx.tracking_next_time_seconds = 0;
+    gpsm_ctx.discipline_deadline_seconds = 0;
+    gpsm_ctx.power_state = GPSM_POWER_STATE_OFF;
+    gpsm_ctx.geofence_inside = 0;
+    gpsm_ctx.geofence_enter = 0;
+    gpsm_ctx.geofence_exit = 0;
+    gpsm_ctx.fix_report.horizontal_accuracy_mm = 0;
+    gpsm_ctx.fix_report.number_of_fixes = 0;
+    gpsm_ctx.fix_report.gate_reached = 0;
     // Read init state.
     GPSM_update_register(GPSM_REGISTER_ADDRESS_STATUS_1);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_HOT_START_STATUS);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_ACQUISITION_ENERGY);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_DISCIPLINE_STATUS);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_PSM_STATUS);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_GEOFENCE_STATUS);
+    GPSM_update_register(GPSM_REGISTER_ADDRESS_FIX_GATE_STATUS);
     // Load default values.
     _GPSM_load_fixed_configuration();
     _GPSM_load_dynamic_configuration();
     _GPSM_reset_analog_data();
+    _GPSM_clear_tracking();
+    _GPSM_clear_assistance();
+    status = _GPSM_apply_fix_gate();
     return status;
 }
 
@@ -322,6 +1181,9 @@ NODE_status_t GPSM_update_register(uint8_t reg_addr) {
     NODE_status_t status = NODE_SUCCESS;
     uint32_t reg_value = 0;
     uint32_t reg_mask = 0;
+    uint32_t unix_time_seconds = 0;
+    uint32_t pulse_count = 0;
+    uint32_t accuracy_dm = 0;
     // Check address.
     switch (reg_addr) {
     case GPSM_REGISTER_ADDRESS_STATUS_1:
@@ -337,6 +1199,81 @@ NODE_status_t GPSM_update_register(uint8_t reg_addr) {
 #endif
         SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.bkenst), GPSM_REGISTER_STATUS_1_MASK_BKENST);
         break;
+    case GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS:
+        // Acquisitions in progress.
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.flags.tip), GPSM_REGISTER_ACQUISITION_STATUS_MASK_TIP);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.flags.gip), GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP);
+        // Elapsed time of the running or last acquisition.
+        if (GPSM_is_acquisition_running() != 0) {
+            gpsm_ctx.acquisition_duration_seconds = (RTC_get_uptime_seconds() - gpsm_ctx.acquisition_start_time_seconds);
+        }
+        SWREG_write_field(&reg_value, &reg_mask, gpsm_ctx.acquisition_duration_seconds, GPSM_REGISTER_ACQUISITION_STATUS_MASK_ELAPSED_TIME);
+        break;
+    case GPSM_REGISTER_ADDRESS_HOT_START_STATUS:
+        // Start type and time to first fix of the last acquisition.
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.start_type), GPSM_REGISTER_HOT_START_STATUS_MASK_START_TYPE);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.flags.lfv), GPSM_REGISTER_HOT_START_STATUS_MASK_LFV);
+        SWREG_write_field(&reg_value, &reg_mask, gpsm_ctx.acquisition_duration_seconds, GPSM_REGISTER_HOT_START_STATUS_MASK_TTFF);
+        break;
+    case GPSM_REGISTER_ADDRESS_ACQUISITION_ENERGY:
+        // Energy estimation of the last acquisition.
+        SWREG_write_field(&reg_value, &reg_mask, gpsm_ctx.acquisition_energy_mj, GPSM_REGISTER_ACQUISITION_ENERGY_MASK_ENERGY);
+        break;
+    case GPSM_REGISTER_ADDRESS_TRACKING_STATUS:
+        // Ring buffer indexes.
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.tracking_index), GPSM_REGISTER_TRACKING_STATUS_MASK_INDEX);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.tracking_count), GPSM_REGISTER_TRACKING_STATUS_MASK_COUNT);
+        break;
+    case GPSM_REGISTER_ADDRESS_DISCIPLINE_STATUS:
+        // Clock discipline state.
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.flags.cdip), GPSM_REGISTER_DISCIPLINE_STATUS_MASK_CDIP);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.flags.cds), GPSM_REGISTER_DISCIPLINE_STATUS_MASK_CDS);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.flags.cde), GPSM_REGISTER_DISCIPLINE_STATUS_MASK_CDE);
+        SWREG_write_field(&reg_value, &reg_mask, ((GPS_get_calendar(&unix_time_seconds) == GPS_SUCCESS) ? 0b1 : 0b0), GPSM_REGISTER_DISCIPLINE_STATUS_MASK_CAV);
+        pulse_count = GPS_get_clock_discipline_pulse_count();
+        SWREG_write_field(&reg_value, &reg_mask, ((pulse_count > 0xFF) ? 0xFF : pulse_count), GPSM_REGISTER_DISCIPLINE_STATUS_MASK_PULSE_COUNT);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.clock_discipline.hsi_trim), GPSM_REGISTER_DISCIPLINE_STATUS_MASK_HSI_TRIM);
+        break;
+    case GPSM_REGISTER_ADDRESS_CALENDAR:
+        // GPS synchronized UNIX time (0 when never synchronized).
+        if (GPS_get_calendar(&unix_time_seconds) != GPS_SUCCESS) {
+            unix_time_seconds = 0;
+        }
+        SWREG_write_field(&reg_value, &reg_mask, unix_time_seconds, GPSM_REGISTER_CALENDAR_MASK_UNIX_TIME);
+        break;
+    case GPSM_REGISTER_ADDRESS_PSM_STATUS:
+        // Receiver power state.
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.power_state), GPSM_REGISTER_PSM_STATUS_MASK_POWER_STATE);
+        break;
+    case GPSM_REGISTER_ADDRESS_MGA_STATUS:
+        // Assistance buffer state.
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.flags.mge), GPSM_REGISTER_MGA_STATUS_MASK_MGE);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.flags.mgo), GPSM_REGISTER_MGA_STATUS_MASK_MGO);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.flags.aopst), GPSM_REGISTER_MGA_STATUS_MASK_AOPST);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.mga_level), GPSM_REGISTER_MGA_STATUS_MASK_LEVEL);
+        break;
+    case GPSM_REGISTER_ADDRESS_MGA_COUNTERS:
+        // Receiver acknowledgments.
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.mga_ack_count), GPSM_REGISTER_MGA_COUNTERS_MASK_ACK_COUNT);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.mga_nack_count), GPSM_REGISTER_MGA_COUNTERS_MASK_NACK_COUNT);
+        break;
+    case GPSM_REGISTER_ADDRESS_GEOFENCE_STATUS:
+        // Geofences state and transitions since last clear.
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.geofence_inside), GPSM_REGISTER_GEOFENCE_STATUS_MASK_INSIDE);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.geofence_enter), GPSM_REGISTER_GEOFENCE_STATUS_MASK_ENTER);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.geofence_exit), GPSM_REGISTER_GEOFENCE_STATUS_MASK_EXIT);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.flags.gfv), GPSM_REGISTER_GEOFENCE_STATUS_MASK_GFV);
+        break;
+    case GPSM_REGISTER_ADDRESS_FIX_GATE_STATUS:
+        // Quality of the last position.
+        accuracy_dm = (gpsm_ctx.fix_report.horizontal_accuracy_mm / 100);
+        if (accuracy_dm > GPSM_FIX_GATE_ACCURACY_MAX_DM) {
+            accuracy_dm = GPSM_FIX_GATE_ACCURACY_MAX_DM;
+        }
+        SWREG_write_field(&reg_value, &reg_mask, accuracy_dm, GPSM_REGISTER_FIX_GATE_STATUS_MASK_ACCURACY);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.fix_report.number_of_fixes), GPSM_REGISTER_FIX_GATE_STATUS_MASK_FIX_COUNT);
+        SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) gpsm_ctx.fix_report.gate_reached), GPSM_REGISTER_FIX_GATE_STATUS_MASK_FGR);
+        break;
     default:
         // Nothing to do for other registers.
         break;
@@ -351,7 +1288,6 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
 #ifndef GPSM_BKEN_FORCED_HARDWARE
-    GPS_status_t gps_status = GPS_SUCCESS;
     UNA_bit_representation_t bken = 0;
 #endif
     UNA_bit_representation_t pwmd = 0;
@@ -366,10 +1302,109 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
     // Check address.
     switch (reg_addr) {
     case GPSM_REGISTER_ADDRESS_CONFIGURATION_1:
+    case GPSM_REGISTER_ADDRESS_HOT_START_CONFIGURATION:
+    case GPSM_REGISTER_ADDRESS_DISCIPLINE_CONFIGURATION:
+        // Store new value in NVM.
+        if (reg_mask != 0) {
+            NODE_write_nvm(reg_addr, reg_value);
+        }
+        break;
+    case GPSM_REGISTER_ADDRESS_TRACKING_CONFIGURATION:
+        // Store new value in NVM.
+        if (reg_mask != 0) {
+            NODE_write_nvm(reg_addr, reg_value);
+        }
+        // Perform first fix as soon as tracking is enabled.
+        if ((reg_mask & GPSM_REGISTER_TRACKING_CONFIGURATION_MASK_TKEN) != 0) {
+            gpsm_ctx.tracking_next_time_seconds = RTC_get_uptime_seconds();
+        }
+        break;
+    case GPSM_REGISTER_ADDRESS_TRACKING_CONTROL:
+        // TCLR.
+        if ((reg_mask & GPSM_REGISTER_TRACKING_CONTROL_MASK_TCLR) != 0) {
+            // Read bit.
+            if (SWREG_read_field(reg_value, GPSM_REGISTER_TRACKING_CONTROL_MASK_TCLR) != 0) {
+                // Clear request.
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_TRACKING_CONTROL, 0b0, GPSM_REGISTER_TRACKING_CONTROL_MASK_TCLR);
+                // Reset tracking buffer.
+                _GPSM_clear_tracking();
+            }
+        }
+        break;
+    case GPSM_REGISTER_ADDRESS_PSM_CONFIGURATION:
+        // Store new value in NVM.
+        if (reg_mask != 0) {
+            NODE_write_nvm(reg_addr, reg_value);
+        }
+        // Update receiver power mode if running.
+        status = _GPSM_apply_power_save();
+        if (status != NODE_SUCCESS) goto errors;
+        break;
+    case GPSM_REGISTER_ADDRESS_FIX_GATE_CONFIGURATION:
+        // Store new value in NVM.
+        if (reg_mask != 0) {
+            NODE_write_nvm(reg_addr, reg_value);
+        }
+        // Update acquisition criteria.
+        status = _GPSM_apply_fix_gate();
+        if (status != NODE_SUCCESS) goto errors;
+        break;
+    case GPSM_REGISTER_ADDRESS_MGA_CONFIGURATION:
         // Store new value in NVM.
         if (reg_mask != 0) {
             NODE_write_nvm(reg_addr, reg_value);
         }
+        // Receiver configuration is updated by the next process calls.
+        gpsm_ctx.mga_configuration_pending = 1;
+        break;
+    case GPSM_REGISTER_ADDRESS_MGA_CONTROL:
+        // MGCLR.
+        if ((reg_mask & GPSM_REGISTER_MGA_CONTROL_MASK_MGCLR) != 0) {
+            // Read bit.
+            if (SWREG_read_field(reg_value, GPSM_REGISTER_MGA_CONTROL_MASK_MGCLR) != 0) {
+                // Clear request.
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_MGA_CONTROL, 0b0, GPSM_REGISTER_MGA_CONTROL_MASK_MGCLR);
+                // Reset assistance buffer.
+                _GPSM_clear_assistance();
+            }
+        }
+        // MGAPP.
+        if ((reg_mask & GPSM_REGISTER_MGA_CONTROL_MASK_MGAPP) != 0) {
+            // Read bit.
+            if (SWREG_read_field(reg_value, GPSM_REGISTER_MGA_CONTROL_MASK_MGAPP) != 0) {
+                // Clear request.
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_MGA_CONTROL, 0b0, GPSM_REGISTER_MGA_CONTROL_MASK_MGAPP);
+                // Copy data window into assistance buffer, injected by the next process calls if the GPS is on, otherwise before the next acquisition.
+                _GPSM_append_assistance((uint8_t) SWREG_read_field(reg_value, GPSM_REGISTER_MGA_CONTROL_MASK_LENGTH));
+            }
+        }
+        break;
+    case GPSM_REGISTER_ADDRESS_GEOFENCE_CONTROL:
+        // GFCLR.
+        if ((reg_mask & GPSM_REGISTER_GEOFENCE_CONTROL_MASK_GFCLR) != 0) {
+            // Read bit.
+            if (SWREG_read_field(reg_value, GPSM_REGISTER_GEOFENCE_CONTROL_MASK_GFCLR) != 0) {
+                // Clear request.
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_GEOFENCE_CONTROL, 0b0, GPSM_REGISTER_GEOFENCE_CONTROL_MASK_GFCLR);
+                // Clear transition flags.
+                gpsm_ctx.geofence_enter = 0;
+                gpsm_ctx.geofence_exit = 0;
+                GPSM_update_register(GPSM_REGISTER_ADDRESS_GEOFENCE_STATUS);
+            }
+        }
+        break;
+    case GPSM_REGISTER_ADDRESS_DISCIPLINE_CONTROL:
+        // CDTRG.
+        if ((reg_mask & GPSM_REGISTER_DISCIPLINE_CONTROL_MASK_CDTRG) != 0) {
+            // Read bit.
+            if (SWREG_read_field(reg_value, GPSM_REGISTER_DISCIPLINE_CONTROL_MASK_CDTRG) != 0) {
+                // Clear request.
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_DISCIPLINE_CONTROL, 0b0, GPSM_REGISTER_DISCIPLINE_CONTROL_MASK_CDTRG);
+                // Start clock discipline.
+                status = _GPSM_start_clock_discipline();
+                if (status != NODE_SUCCESS) goto errors;
+            }
+        }
         break;
     case GPSM_REGISTER_ADDRESS_CONFIGURATION_2:
     case GPSM_REGISTER_ADDRESS_CONFIGURATION_3:
@@ -392,7 +1427,7 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                 // Clear request.
                 NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, 0b0, GPSM_REGISTER_CONTROL_1_MASK_TTRG);
                 // Start GPS time fix.
-                status = _GPSM_ttrg_callback();
+                status = _GPSM_start_acquisition(GPS_ACQUISITION_TYPE_TIME);
                 if (status != NODE_SUCCESS) goto errors;
             }
         }
@@ -403,7 +1438,7 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                 // Clear request.
                 NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, 0b0, GPSM_REGISTER_CONTROL_1_MASK_GTRG);
                 // Start GPS geolocation fix.
-                status = _GPSM_gtrg_callback();
+                status = _GPSM_start_acquisition(GPS_ACQUISITION_TYPE_POSITION);
                 if (status != NODE_SUCCESS) goto errors;
             }
         }
@@ -413,6 +1448,12 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
             tpen = SWREG_read_field(reg_value, GPSM_REGISTER_CONTROL_1_MASK_TPEN);
             // Compare to current state.
             if (tpen != gpsm_ctx.flags.tpen) {
+                // Timepulse is owned by the clock discipline loop.
+                if (gpsm_ctx.flags.cdip != 0) {
+                    SWREG_write_field(&new_reg_value, &new_reg_mask, gpsm_ctx.flags.tpen, GPSM_REGISTER_CONTROL_1_MASK_TPEN);
+                    status = NODE_ERROR_GPS_STATE;
+                    goto errors;
+                }
                 // Start timepulse.
                 status = _GPSM_tpen_callback(tpen);
                 if (status != NODE_SUCCESS) {
@@ -456,6 +1497,9 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
                     _GPSM_power_control(pwen);
                     // Update local flag.
                     gpsm_ctx.flags.pwen = pwen;
+                    // Apply power save mode.
+                    status = _GPSM_apply_power_save();
+                    if (status != NODE_SUCCESS) goto errors;
                 }
             }
             else {
@@ -475,14 +1519,23 @@ NODE_status_t GPSM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
             // Compare to current state.
             if (bken != gpsm_ctx.bkenst) {
                 // Set backup voltage.
-                gps_status = GPS_set_backup_voltage(bken);
-                GPS_exit_error(NODE_ERROR_BASE_GPS);
+                status = _GPSM_set_backup_voltage(bken);
+                if (status != NODE_SUCCESS) goto errors;
             }
 #endif
         }
         break;
     default:
-        // Nothing to do for other registers.
+        // Geofences definition.
+        if ((reg_addr >= GPSM_REGISTER_ADDRESS_GEOFENCE_0_CONFIGURATION) && (reg_addr < GPSM_REGISTER_ADDRESS_GEOFENCE_CONTROL)) {
+            // Store new value in NVM.
+            if (reg_mask != 0) {
+                NODE_write_nvm(reg_addr, reg_value);
+            }
+            // Restart from an unknown state to avoid reporting false transitions.
+            gpsm_ctx.flags.gfv = 0;
+            GPSM_update_register(GPSM_REGISTER_ADDRESS_GEOFENCE_STATUS);
+        }
         break;
     }
 errors:
@@ -524,4 +1577,91 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+NODE_status_t GPSM_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    GPS_status_t gps_status = GPS_SUCCESS;
+#ifndef GPSM_BKEN_FORCED_HARDWARE
+    // Manage backup voltage.
+    status = _GPSM_hot_start_process();
+    if (status != NODE_SUCCESS) goto errors;
+#endif
+    // Start periodic fix if needed.
+    status = _GPSM_tracking_process();
+    if (status != NODE_SUCCESS) goto errors;
+    // Process clock discipline loop.
+    status = _GPSM_clock_discipline_process();
+    if (status != NODE_SUCCESS) goto errors;
+    // Perform a single receiver exchange per call: assistance data first, then acquisition start and report polls.
+    if (_GPSM_is_injection_pending() != 0) {
+        status = _GPSM_assistance_process();
+        if (status != NODE_SUCCESS) goto errors;
+    }
+    else if ((gpsm_ctx.acquisition_start_pending != 0) && (GPSM_is_report_pending() == 0)) {
+        status = _GPSM_start_gps_acquisition();
+        if (status != NODE_SUCCESS) goto errors;
+    }
+    else {
+        // Read receiver state of the last acquisition.
+        _GPSM_report_process();
+    }
+    // Check acquisition.
+    if ((GPSM_is_acquisition_running() == 0) || (gpsm_ctx.acquisition_start_pending != 0)) goto errors;
+    // Process GPS driver.
+    gps_status = GPS_process();
+    GPS_exit_error(NODE_ERROR_BASE_GPS);
+    // Check acquisition state.
+    switch (GPS_get_acquisition_state()) {
+    case GPS_ACQUISITION_STATE_RUNNING:
+        // Nothing to do.
+        break;
+    case GPS_ACQUISITION_STATE_DONE:
+        // Read result.
+        if (gpsm_ctx.flags.tip != 0) {
+            status = _GPSM_read_time_data();
+        }
+        else {
+            status = _GPSM_read_geoloc_data();
+        }
+        _GPSM_stop_acquisition();
+        break;
+    default:
+        // Acquisition aborted by a GPS power off.
+        _GPSM_stop_acquisition();
+        break;
+    }
+errors:
+    // Release acquisition on driver error.
+    if ((status != NODE_SUCCESS) && (GPSM_is_acquisition_running() != 0)) {
+        _GPSM_stop_acquisition();
+    }
+    // Abort clock discipline if the time fix failed.
+    if ((gpsm_ctx.flags.cdip != 0) && (gpsm_ctx.flags.cdcp == 0) && (GPSM_is_acquisition_running() == 0)) {
+        _GPSM_stop_clock_discipline(0);
+    }
+    return status;
+}
+
+/*******************************************************************/
+uint8_t GPSM_is_acquisition_running(void) {
+    return (((gpsm_ctx.flags.tip != 0) || (gpsm_ctx.flags.gip != 0)) ? 1 : 0);
+}
+
+/*******************************************************************/
+uint8_t GPSM_is_clock_discipline_running(void) {
+    return ((gpsm_ctx.flags.cdip != 0) ? 1 : 0);
+}
+
+/*******************************************************************/
+uint8_t GPSM_is_report_pending(void) {
+    return ((gpsm_ctx.report_step != GPSM_REPORT_STEP_NONE) ? 1 : 0);
+}
+
+/*******************************************************************/
+uint8_t GPSM_is_assistance_pending(void) {
+    // Acquisition start is the last step of the injection sequence.
+    return (((_GPSM_is_injection_pending() != 0) || (gpsm_ctx.acquisition_start_pending != 0)) ? 1 : 0);
+}
+
 #endif /* GPSM */
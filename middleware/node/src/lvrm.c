@@ -10,10 +10,13 @@
 #include "adc.h"
 #include "error.h"
 #include "load.h"
+#include "lvrm_ext_registers.h"
 #include "lvrm_registers.h"
 #include "node.h"
+#include "rtc.h"
 #include "swreg.h"
 #include "una.h"
+#include "xm_flags.h"
 
 #ifdef LVRM
 
@@ -22,15 +25,66 @@
 // Note: IOUT measurement uses LT6106, OPA187 and optionally TMUX7219 chips whose minimum operating voltage is 4.5V.
 #define LVRM_IOUT_MEASUREMENT_VCOM_MIN_MV   4500
 
+#ifdef LVRM_MODE_BMS
+#define LVRM_BATTERY_CAPACITY_UNIT_MAH      100
+#define LVRM_BATTERY_OCV_STEP_PERCENT       10
+
+#define LVRM_SOC_UAS_PER_MAH                3600000
+#define LVRM_SOC_CORRECTION_SHIFT           2
+#define LVRM_SOC_CURRENT_AVERAGE_SHIFT      3
+#define LVRM_SOC_TTE_UNKNOWN                0xFFFF
+#endif
+
 /*** LVRM local structures ***/
 
+#ifdef LVRM_MODE_BMS
+/*******************************************************************/
+typedef enum {
+    LVRM_BATTERY_CHEMISTRY_CUSTOM = 0,
+    LVRM_BATTERY_CHEMISTRY_LEAD_ACID,
+    LVRM_BATTERY_CHEMISTRY_LIFEPO4,
+    LVRM_BATTERY_CHEMISTRY_LI_ION,
+    LVRM_BATTERY_CHEMISTRY_LAST
+} LVRM_battery_chemistry_t;
+
+/*******************************************************************/
+typedef struct {
+    int32_t ocv_mv[LVRM_BATTERY_OCV_NUMBER_OF_POINTS];
+    int64_t capacity_uas;
+    int64_t charge_uas;
+    int32_t current_average_ua;
+    uint32_t last_time_seconds;
+    uint32_t rest_start_time_seconds;
+    uint8_t soc_mode;
+    uint8_t soc_low_threshold_percent;
+    uint8_t soc_high_threshold_percent;
+    uint8_t valid;
+    uint8_t rest;
+} LVRM_soc_context_t;
+#endif
+
 /*******************************************************************/
 typedef struct {
     UNA_bit_representation_t rlstst;
+#ifdef LVRM_MODE_BMS
+    int32_t bms_vbatt_low_threshold_mv;
+    int32_t bms_vbatt_high_threshold_mv;
+    uint32_t bms_next_time_seconds;
+    LVRM_soc_context_t soc;
+#endif
 } LVRM_context_t;
 
 /*** LVRM local global variables ***/
 
+#ifdef LVRM_MODE_BMS
+// Typical open circuit voltages of 12V batteries from 0% to 100% state of charge.
+static const int32_t LVRM_BATTERY_OCV_PRESET_MV[LVRM_BATTERY_CHEMISTRY_LAST - 1][LVRM_BATTERY_OCV_NUMBER_OF_POINTS] = {
+    { 11310, 11510, 11660, 11810, 11960, 12100, 12240, 12370, 12500, 12620, 12730 },
+    { 11200, 12600, 12880, 13000, 13080, 13160, 13240, 13280, 13320, 13400, 13600 },
+    { 9000, 10350, 10650, 10860, 11040, 11220, 11400, 11610, 11850, 12150, 12600 }
+};
+#endif
+
 static LVRM_context_t lvrm_ctx;
 
 /*** LVRM local functions ***/
@@ -85,6 +139,191 @@ static void _LVRM_reset_analog_data(void) {
     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, LVRM_REGISTER_ADDRESS_ANALOG_DATA_2, reg_analog_data_2, reg_analog_data_2_mask);
 }
 
+#ifdef LVRM_MODE_BMS
+/*******************************************************************/
+static void _LVRM_load_battery_configuration(void) {
+    // Local variables.
+    uint8_t reg_addr = 0;
+    uint32_t reg_value = 0;
+    // Load battery registers from NVM.
+    for (reg_addr = LVRM_REGISTER_ADDRESS_BATTERY_CONFIGURATION; reg_addr < LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1; reg_addr++) {
+        // Read NVM.
+        NODE_read_nvm(reg_addr, &reg_value);
+        // Write register.
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, reg_value, UNA_REGISTER_MASK_ALL);
+    }
+}
+
+/*******************************************************************/
+static void _LVRM_load_chemistry_preset(LVRM_battery_chemistry_t chemistry) {
+    // Local variables.
+    uint8_t reg_addr = 0;
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint8_t idx = 0;
+    // Check chemistry.
+    if ((chemistry == LVRM_BATTERY_CHEMISTRY_CUSTOM) || (chemistry >= LVRM_BATTERY_CHEMISTRY_LAST)) return;
+    // Points loop.
+    for (idx = 0; idx < LVRM_BATTERY_OCV_NUMBER_OF_POINTS; idx++) {
+        SWREG_write_field(&reg_value, &reg_mask, UNA_convert_mv(LVRM_BATTERY_OCV_PRESET_MV[chemistry - 1][idx]), (((idx % 2) == 0) ? LVRM_REGISTER_BATTERY_OCV_MASK_OCV_LOW : LVRM_REGISTER_BATTERY_OCV_MASK_OCV_HIGH));
+        // Write register when complete.
+        if (((idx % 2) != 0) || (idx == (LVRM_BATTERY_OCV_NUMBER_OF_POINTS - 1))) {
+            reg_addr = (uint8_t) (LVRM_REGISTER_ADDRESS_BATTERY_OCV_0 + (idx >> 1));
+            NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, reg_value, UNA_REGISTER_MASK_ALL);
+            NODE_write_nvm(reg_addr, reg_value);
+            reg_value = 0;
+            reg_mask = 0;
+        }
+    }
+}
+#endif
+
+#ifdef LVRM_MODE_BMS
+/*******************************************************************/
+static void _LVRM_load_bms_thresholds(void) {
+    // Local variables.
+    uint32_t reg_config_1 = 0;
+    // Program thresholds once for all comparisons.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, LVRM_REGISTER_ADDRESS_CONFIGURATION_1, &reg_config_1);
+    lvrm_ctx.bms_vbatt_low_threshold_mv = UNA_get_mv(SWREG_read_field(reg_config_1, LVRM_REGISTER_CONFIGURATION_1_MASK_VBATT_LOW_THRESHOLD));
+    lvrm_ctx.bms_vbatt_high_threshold_mv = UNA_get_mv(SWREG_read_field(reg_config_1, LVRM_REGISTER_CONFIGURATION_1_MASK_VBATT_HIGH_THRESHOLD));
+    // Force a new check.
+    lvrm_ctx.bms_next_time_seconds = RTC_get_uptime_seconds();
+}
+#endif
+
+#ifdef LVRM_MODE_BMS
+/*******************************************************************/
+static void _LVRM_soc_load_configuration(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint8_t idx = 0;
+    // Battery capacity.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, LVRM_REGISTER_ADDRESS_BATTERY_CONFIGURATION, &reg_value);
+    lvrm_ctx.soc.capacity_uas = ((int64_t) SWREG_read_field(reg_value, LVRM_REGISTER_BATTERY_CONFIGURATION_MASK_CAPACITY)) * ((int64_t) LVRM_BATTERY_CAPACITY_UNIT_MAH) * ((int64_t) LVRM_SOC_UAS_PER_MAH);
+    // Relay control thresholds.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, LVRM_REGISTER_ADDRESS_BMS_CONFIGURATION, &reg_value);
+    lvrm_ctx.soc.soc_mode = (uint8_t) SWREG_read_field(reg_value, LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOCM);
+    lvrm_ctx.soc.soc_low_threshold_percent = (uint8_t) SWREG_read_field(reg_value, LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOC_LOW_THRESHOLD);
+    lvrm_ctx.soc.soc_high_threshold_percent = (uint8_t) SWREG_read_field(reg_value, LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOC_HIGH_THRESHOLD);
+    // Open circuit voltage table.
+    for (idx = 0; idx < LVRM_BATTERY_OCV_NUMBER_OF_POINTS; idx++) {
+        NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, (uint8_t) (LVRM_REGISTER_ADDRESS_BATTERY_OCV_0 + (idx >> 1)), &reg_value);
+        lvrm_ctx.soc.ocv_mv[idx] = UNA_get_mv(SWREG_read_field(reg_value, (((idx % 2) == 0) ? LVRM_REGISTER_BATTERY_OCV_MASK_OCV_LOW : LVRM_REGISTER_BATTERY_OCV_MASK_OCV_HIGH)));
+    }
+    // Restart estimation from the open circuit voltage.
+    lvrm_ctx.soc.valid = 0;
+    lvrm_ctx.bms_next_time_seconds = RTC_get_uptime_seconds();
+}
+#endif
+
+#ifdef LVRM_MODE_BMS
+/*******************************************************************/
+static int64_t _LVRM_soc_get_ocv_charge(int32_t vbatt_mv) {
+    // Local variables.
+    int32_t soc_permille = 0;
+    int32_t delta_mv = 0;
+    uint8_t idx = 0;
+    // Clamp to table limits.
+    if (vbatt_mv <= lvrm_ctx.soc.ocv_mv[0]) {
+        soc_permille = 0;
+    }
+    else if (vbatt_mv >= lvrm_ctx.soc.ocv_mv[LVRM_BATTERY_OCV_NUMBER_OF_POINTS - 1]) {
+        soc_permille = 1000;
+    }
+    else {
+        // Search segment.
+        for (idx = 0; idx < (LVRM_BATTERY_OCV_NUMBER_OF_POINTS - 1); idx++) {
+            if (vbatt_mv < lvrm_ctx.soc.ocv_mv[idx + 1]) break;
+        }
+        // Linear interpolation.
+        soc_permille = (idx * LVRM_BATTERY_OCV_STEP_PERCENT * 10);
+        delta_mv = (lvrm_ctx.soc.ocv_mv[idx + 1] - lvrm_ctx.soc.ocv_mv[idx]);
+        if (delta_mv > 0) {
+            soc_permille += ((vbatt_mv - lvrm_ctx.soc.ocv_mv[idx]) * LVRM_BATTERY_OCV_STEP_PERCENT * 10) / (delta_mv);
+        }
+    }
+    return ((lvrm_ctx.soc.capacity_uas * ((int64_t) soc_permille)) / 1000);
+}
+#endif
+
+#ifdef LVRM_MODE_BMS
+/*******************************************************************/
+static void _LVRM_soc_update(int32_t vbatt_mv, int32_t ibatt_ua) {
+    // Local variables.
+    uint32_t uptime_seconds = RTC_get_uptime_seconds();
+    uint32_t elapsed_seconds = (uptime_seconds - lvrm_ctx.soc.last_time_seconds);
+    int64_t ocv_charge_uas = 0;
+    // Check configuration.
+    if (lvrm_ctx.soc.capacity_uas <= 0) {
+        lvrm_ctx.soc.valid = 0;
+        return;
+    }
+    lvrm_ctx.soc.last_time_seconds = uptime_seconds;
+    // First estimation from the battery voltage.
+    if (lvrm_ctx.soc.valid == 0) {
+        lvrm_ctx.soc.charge_uas = _LVRM_soc_get_ocv_charge(vbatt_mv);
+        lvrm_ctx.soc.current_average_ua = ibatt_ua;
+        lvrm_ctx.soc.rest_start_time_seconds = uptime_seconds;
+        lvrm_ctx.soc.rest = 0;
+        lvrm_ctx.soc.valid = 1;
+        return;
+    }
+    // Coulomb counting.
+    lvrm_ctx.soc.charge_uas -= ((int64_t) ibatt_ua) * ((int64_t) elapsed_seconds);
+    lvrm_ctx.soc.current_average_ua += ((ibatt_ua - lvrm_ctx.soc.current_average_ua) >> LVRM_SOC_CURRENT_AVERAGE_SHIFT);
+    // Rest detection.
+    if (ibatt_ua > LVRM_BMS_SOC_REST_CURRENT_UA) {
+        lvrm_ctx.soc.rest_start_time_seconds = uptime_seconds;
+        lvrm_ctx.soc.rest = 0;
+    }
+    else if ((uptime_seconds - lvrm_ctx.soc.rest_start_time_seconds) >= LVRM_BMS_SOC_REST_DURATION_SECONDS) {
+        lvrm_ctx.soc.rest = 1;
+    }
+    // Voltage correction once the battery voltage has relaxed.
+    if (lvrm_ctx.soc.rest != 0) {
+        ocv_charge_uas = _LVRM_soc_get_ocv_charge(vbatt_mv);
+        lvrm_ctx.soc.charge_uas += ((ocv_charge_uas - lvrm_ctx.soc.charge_uas) >> LVRM_SOC_CORRECTION_SHIFT);
+    }
+    // Clamp.
+    if (lvrm_ctx.soc.charge_uas < 0) {
+        lvrm_ctx.soc.charge_uas = 0;
+    }
+    if (lvrm_ctx.soc.charge_uas > lvrm_ctx.soc.capacity_uas) {
+        lvrm_ctx.soc.charge_uas = lvrm_ctx.soc.capacity_uas;
+    }
+}
+#endif
+
+#ifdef LVRM_MODE_BMS
+/*******************************************************************/
+static uint8_t _LVRM_soc_get_percent(void) {
+    // Local variables.
+    uint8_t soc_percent = 0;
+    // Check capacity.
+    if (lvrm_ctx.soc.capacity_uas > 0) {
+        soc_percent = (uint8_t) ((lvrm_ctx.soc.charge_uas * 100) / (lvrm_ctx.soc.capacity_uas));
+    }
+    return soc_percent;
+}
+#endif
+
+#ifdef LVRM_MODE_BMS
+/*******************************************************************/
+static uint32_t _LVRM_soc_get_time_to_empty_minutes(void) {
+    // Local variables.
+    int64_t tte_minutes = LVRM_SOC_TTE_UNKNOWN;
+    // Check discharge.
+    if (lvrm_ctx.soc.current_average_ua > LVRM_BMS_SOC_REST_CURRENT_UA) {
+        tte_minutes = (lvrm_ctx.soc.charge_uas / ((int64_t) lvrm_ctx.soc.current_average_ua)) / 60;
+        if (tte_minutes >= LVRM_SOC_TTE_UNKNOWN) {
+            tte_minutes = (LVRM_SOC_TTE_UNKNOWN - 1);
+        }
+    }
+    return ((uint32_t) tte_minutes);
+}
+#endif
+
 /*** LVRM functions ***/
 
 /*******************************************************************/
@@ -104,11 +343,31 @@ NODE_status_t LVRM_init_registers(void) {
     reg_mask = 0;
     SWREG_write_field(&reg_value, &reg_mask, 0, LVRM_REGISTER_CONFIGURATION_2_MASK_IOUT_OFFSET);
     NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, LVRM_REGISTER_ADDRESS_CONFIGURATION_2, reg_value, reg_mask);
+#ifdef LVRM_MODE_BMS
+    // Battery chemistry and capacity.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, LVRM_BATTERY_CHEMISTRY, LVRM_REGISTER_BATTERY_CONFIGURATION_MASK_CHEM);
+    SWREG_write_field(&reg_value, &reg_mask, (LVRM_BATTERY_CAPACITY_MAH / LVRM_BATTERY_CAPACITY_UNIT_MAH), LVRM_REGISTER_BATTERY_CONFIGURATION_MASK_CAPACITY);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, LVRM_REGISTER_ADDRESS_BATTERY_CONFIGURATION, reg_value, reg_mask);
+    // State of charge thresholds in BMS mode.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, LVRM_BMS_SOC_MODE, LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOCM);
+    SWREG_write_field(&reg_value, &reg_mask, LVRM_BMS_SOC_LOW_THRESHOLD_PERCENT, LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOC_LOW_THRESHOLD);
+    SWREG_write_field(&reg_value, &reg_mask, LVRM_BMS_SOC_HIGH_THRESHOLD_PERCENT, LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOC_HIGH_THRESHOLD);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, LVRM_REGISTER_ADDRESS_BMS_CONFIGURATION, reg_value, reg_mask);
+#endif
 #endif
     // Load defaults values.
     _LVRM_load_fixed_configuration();
     _LVRM_load_dynamic_configuration();
     _LVRM_reset_analog_data();
+#ifdef LVRM_MODE_BMS
+    _LVRM_load_battery_configuration();
+    _LVRM_load_bms_thresholds();
+    _LVRM_soc_load_configuration();
+#endif
     // Read init state.
     status = LVRM_update_register(LVRM_REGISTER_ADDRESS_STATUS_1);
     if (status != NODE_SUCCESS) goto errors;
@@ -133,6 +392,28 @@ NODE_status_t LVRM_update_register(uint8_t reg_addr) {
 #endif
         SWREG_write_field(&reg_value, &reg_mask, ((uint32_t) lvrm_ctx.rlstst), LVRM_REGISTER_STATUS_1_MASK_RLSTST);
         break;
+#ifdef LVRM_MODE_BMS
+    case LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1:
+        SWREG_write_field(&reg_value, &reg_mask, lvrm_ctx.soc.valid, LVRM_REGISTER_BATTERY_STATUS_1_MASK_SOCV);
+        SWREG_write_field(&reg_value, &reg_mask, lvrm_ctx.soc.rest, LVRM_REGISTER_BATTERY_STATUS_1_MASK_REST);
+        if (lvrm_ctx.soc.valid != 0) {
+            SWREG_write_field(&reg_value, &reg_mask, _LVRM_soc_get_percent(), LVRM_REGISTER_BATTERY_STATUS_1_MASK_SOC);
+            SWREG_write_field(&reg_value, &reg_mask, _LVRM_soc_get_time_to_empty_minutes(), LVRM_REGISTER_BATTERY_STATUS_1_MASK_TTE);
+        }
+        break;
+    case LVRM_REGISTER_ADDRESS_BATTERY_STATUS_2:
+        if (lvrm_ctx.soc.valid != 0) {
+            SWREG_write_field(&reg_value, &reg_mask, (uint32_t) ((lvrm_ctx.soc.charge_uas / LVRM_SOC_UAS_PER_MAH) / LVRM_BATTERY_CAPACITY_UNIT_MAH), LVRM_REGISTER_BATTERY_STATUS_2_MASK_CHARGE);
+            SWREG_write_field(&reg_value, &reg_mask, UNA_convert_ua(lvrm_ctx.soc.current_average_ua), LVRM_REGISTER_BATTERY_STATUS_2_MASK_IAVG);
+        }
+        break;
+#endif
+#ifdef HW2_0
+    case LVRM_REGISTER_ADDRESS_RELAY_STATUS:
+        SWREG_write_field(&reg_value, &reg_mask, LOAD_is_switching(), LVRM_REGISTER_RELAY_STATUS_MASK_SWIP);
+        SWREG_write_field(&reg_value, &reg_mask, LOAD_is_request_pending(), LVRM_REGISTER_RELAY_STATUS_MASK_PEND);
+        break;
+#endif
     default:
         // Nothing to do for other registers.
         break;
@@ -162,7 +443,30 @@ NODE_status_t LVRM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
         if (reg_mask != 0) {
             NODE_write_nvm(reg_addr, reg_value);
         }
+#ifdef LVRM_MODE_BMS
+        _LVRM_load_bms_thresholds();
+#endif
+        break;
+#ifdef LVRM_MODE_BMS
+    case LVRM_REGISTER_ADDRESS_BATTERY_CONFIGURATION:
+    case LVRM_REGISTER_ADDRESS_BMS_CONFIGURATION:
+    case LVRM_REGISTER_ADDRESS_BATTERY_OCV_0:
+    case LVRM_REGISTER_ADDRESS_BATTERY_OCV_1:
+    case LVRM_REGISTER_ADDRESS_BATTERY_OCV_2:
+    case LVRM_REGISTER_ADDRESS_BATTERY_OCV_3:
+    case LVRM_REGISTER_ADDRESS_BATTERY_OCV_4:
+    case LVRM_REGISTER_ADDRESS_BATTERY_OCV_5:
+        // Store new value in NVM.
+        if (reg_mask != 0) {
+            NODE_write_nvm(reg_addr, reg_value);
+        }
+        // Load chemistry preset.
+        if ((reg_addr == LVRM_REGISTER_ADDRESS_BATTERY_CONFIGURATION) && ((reg_mask & LVRM_REGISTER_BATTERY_CONFIGURATION_MASK_CHEM) != 0)) {
+            _LVRM_load_chemistry_preset((LVRM_battery_chemistry_t) SWREG_read_field(reg_value, LVRM_REGISTER_BATTERY_CONFIGURATION_MASK_CHEM));
+        }
+        _LVRM_soc_load_configuration();
         break;
+#endif
     case LVRM_REGISTER_ADDRESS_CONTROL_1:
         // RLST.
         if ((reg_mask & LVRM_REGISTER_CONTROL_1_MASK_RLST) != 0) {
@@ -177,12 +481,12 @@ NODE_status_t LVRM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
 #else
             // Read bit.
             rlst = SWREG_read_field(reg_value, LVRM_REGISTER_CONTROL_1_MASK_RLST);
-            // Compare to current state.
-            if (rlst != lvrm_ctx.rlstst) {
-                // Set relay state.
-                load_status = LOAD_set_output_state(rlst);
-                LOAD_exit_error(NODE_ERROR_BASE_LOAD);
-            }
+            // Set relay state (the request is queued by the driver if a switching sequence is in progress).
+            load_status = LOAD_set_output_state(rlst);
+            LOAD_exit_error(NODE_ERROR_BASE_LOAD);
+#ifdef HW2_0
+            LVRM_update_register(LVRM_REGISTER_ADDRESS_RELAY_STATUS);
+#endif
 #endif
 #endif
         }
@@ -240,30 +544,96 @@ NODE_status_t LVRM_bms_process(void) {
     NODE_status_t status = NODE_SUCCESS;
     ANALOG_status_t analog_status = ANALOG_SUCCESS;
     LOAD_status_t load_status = LOAD_SUCCESS;
-    uint32_t reg_config_1 = 0;
     int32_t vbatt_mv = 0;
+    int32_t ibatt_ua = 0;
+    uint8_t soc_percent = 0;
+    uint32_t period_seconds = LVRM_BMS_MONITORING_PERIOD_MAX_SECONDS;
+    // Check schedule.
+    if (RTC_get_uptime_seconds() < lvrm_ctx.bms_next_time_seconds) goto errors;
+    lvrm_ctx.bms_next_time_seconds = (RTC_get_uptime_seconds() + LVRM_BMS_MONITORING_PERIOD_MIN_SECONDS);
     // Turn analog front-end on.
     POWER_enable(POWER_REQUESTER_ID_LVRM, POWER_DOMAIN_ANALOG, LPTIM_DELAY_MODE_ACTIVE);
     // Check battery voltage.
     analog_status = ANALOG_convert_channel(ANALOG_CHANNEL_VIN_MV, &vbatt_mv);
     ANALOG_exit_error(NODE_ERROR_BASE_ANALOG);
-    // Read thresholds in registers.
-    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, LVRM_REGISTER_ADDRESS_CONFIGURATION_1, &reg_config_1);
-    // Check battery voltage.
-    if (vbatt_mv < UNA_get_mv(SWREG_read_field(reg_config_1, LVRM_REGISTER_CONFIGURATION_1_MASK_VBATT_LOW_THRESHOLD))) {
+    // Battery current flows through the relay.
+    if ((LOAD_get_output_state() != 0) && (vbatt_mv >= LVRM_IOUT_MEASUREMENT_VCOM_MIN_MV)) {
+        analog_status = ANALOG_convert_channel(ANALOG_CHANNEL_IOUT_UA, &ibatt_ua);
+        ANALOG_exit_error(NODE_ERROR_BASE_ANALOG);
+    }
+    POWER_disable(POWER_REQUESTER_ID_LVRM, POWER_DOMAIN_ANALOG);
+    // Update state of charge.
+    _LVRM_soc_update(vbatt_mv, ibatt_ua);
+    soc_percent = _LVRM_soc_get_percent();
+    // Drive relay only when the voltage leaves the window, the low voltage threshold remains a protection in SoC mode.
+    if ((vbatt_mv < lvrm_ctx.bms_vbatt_low_threshold_mv) && (LOAD_get_output_state() != 0)) {
         // Open relay.
         load_status = LOAD_set_output_state(0);
         LOAD_exit_error(NODE_ERROR_BASE_LOAD);
     }
-    if (vbatt_mv > UNA_get_mv(SWREG_read_field(reg_config_1, LVRM_REGISTER_CONFIGURATION_1_MASK_VBATT_HIGH_THRESHOLD))) {
-        // Close relay.
-        load_status = LOAD_set_output_state(1);
-        LOAD_exit_error(NODE_ERROR_BASE_LOAD);
+    if ((lvrm_ctx.soc.soc_mode != 0) && (lvrm_ctx.soc.valid != 0)) {
+        if ((soc_percent < lvrm_ctx.soc.soc_low_threshold_percent) && (LOAD_get_output_state() != 0)) {
+            // Open relay.
+            load_status = LOAD_set_output_state(0);
+            LOAD_exit_error(NODE_ERROR_BASE_LOAD);
+        }
+        if ((soc_percent > lvrm_ctx.soc.soc_high_threshold_percent) && (LOAD_get_output_state() == 0)) {
+            // Close relay.
+            load_status = LOAD_set_output_state(1);
+            LOAD_exit_error(NODE_ERROR_BASE_LOAD);
+        }
+        // Regular period for coulomb counting.
+        period_seconds = LVRM_BMS_SOC_PERIOD_SECONDS;
     }
+    else {
+        if ((vbatt_mv > lvrm_ctx.bms_vbatt_high_threshold_mv) && (LOAD_get_output_state() == 0)) {
+            // Close relay.
+            load_status = LOAD_set_output_state(1);
+            LOAD_exit_error(NODE_ERROR_BASE_LOAD);
+        }
+        // Check faster when the voltage is close to a threshold.
+        if ((vbatt_mv < (lvrm_ctx.bms_vbatt_low_threshold_mv + LVRM_BMS_MONITORING_MARGIN_MV)) || (vbatt_mv > (lvrm_ctx.bms_vbatt_high_threshold_mv - LVRM_BMS_MONITORING_MARGIN_MV))) {
+            period_seconds = LVRM_BMS_MONITORING_PERIOD_MIN_SECONDS;
+        }
+        // Keep coulomb counting accurate while the load is on, when a battery capacity is configured.
+        if ((lvrm_ctx.soc.capacity_uas > 0) && (LOAD_get_output_state() != 0) && (period_seconds > LVRM_BMS_SOC_PERIOD_SECONDS)) {
+            period_seconds = LVRM_BMS_SOC_PERIOD_SECONDS;
+        }
+    }
+    lvrm_ctx.bms_next_time_seconds = (RTC_get_uptime_seconds() + period_seconds);
 errors:
     POWER_disable(POWER_REQUESTER_ID_LVRM, POWER_DOMAIN_ANALOG);
     return status;
 }
 #endif
 
+#ifdef HW2_0
+/*******************************************************************/
+NODE_status_t LVRM_relay_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    LOAD_status_t load_status = LOAD_SUCCESS;
+    uint8_t sequence_done = 0;
+    // Directly exit if the relay is idle.
+    if (LOAD_is_switching() == 0) goto errors;
+    // Process switching sequence.
+    load_status = LOAD_process(&sequence_done);
+    LOAD_exit_error(NODE_ERROR_BASE_LOAD);
+errors:
+    // Update relay state.
+    if (sequence_done != 0) {
+        LVRM_update_register(LVRM_REGISTER_ADDRESS_STATUS_1);
+        LVRM_update_register(LVRM_REGISTER_ADDRESS_RELAY_STATUS);
+    }
+    return status;
+}
+#endif
+
+#ifdef HW2_0
+/*******************************************************************/
+uint8_t LVRM_is_relay_switching(void) {
+    return LOAD_is_switching();
+}
+#endif
+
 #endif /* LVRM */
@@ -132,6 +132,24 @@ errors:
 }
 #endif
 
+/*******************************************************************/
+static UNA_register_access_t _NODE_get_register_access(uint8_t reg_addr) {
+    // Local variables.
+    UNA_register_access_t reg_access = UNA_REGISTER_ACCESS_READ_ONLY;
+#ifdef NODE_EXT_REGISTER_ACCESS
+    // Check extended registers map.
+    if (reg_addr >= NODE_EXT_REGISTER_ADDRESS_BASE) {
+        reg_access = NODE_EXT_REGISTER_ACCESS[reg_addr - NODE_EXT_REGISTER_ADDRESS_BASE];
+    }
+    else {
+        reg_access = NODE_REGISTER_ACCESS[reg_addr];
+    }
+#else
+    reg_access = NODE_REGISTER_ACCESS[reg_addr];
+#endif
+    return reg_access;
+}
+
 /*******************************************************************/
 static NODE_status_t _NODE_update_register(uint8_t reg_addr) {
     // Local variables.
@@ -282,7 +300,7 @@ errors:
 NODE_status_t NODE_process(void) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
-#if (((defined LVRM) && (defined LVRM_MODE_BMS)) || ((defined BPSM) && !(defined BPSM_CHEN_FORCED_HARDWARE)))
+#if (((defined LVRM) && (defined LVRM_MODE_BMS)) || ((defined LVRM) && (defined HW2_0)) || ((defined BPSM) && !(defined BPSM_CHEN_FORCED_HARDWARE)) || (defined UHFM) || (defined GPSM) || (defined SM))
     NODE_status_t node_status = NODE_SUCCESS;
 #endif
     // Reset state to default.
@@ -291,10 +309,30 @@ NODE_status_t NODE_process(void) {
     status = LVRM_bms_process();
     NODE_stack_error(ERROR_BASE_NODE);
 #endif
+#if ((defined LVRM) && (defined HW2_0))
+    node_status = LVRM_relay_process();
+    NODE_stack_error(ERROR_BASE_NODE);
+#endif
 #if ((defined BPSM) && !(defined BPSM_CHEN_FORCED_HARDWARE))
     node_status = BPSM_charge_process();
     NODE_stack_error(ERROR_BASE_NODE);
 #endif
+#ifdef UHFM
+    node_status = UHFM_process();
+    NODE_stack_error(ERROR_BASE_NODE);
+#endif
+#ifdef GPSM
+    node_status = GPSM_process();
+    NODE_stack_error(ERROR_BASE_NODE);
+#endif
+#ifdef SM
+    node_status = SM_process();
+    NODE_stack_error(ERROR_BASE_NODE);
+    // Edges are timestamped with the HSI clock during frequency measurements.
+    if (SM_is_dio_measurement_running() != 0) {
+        node_ctx.state = NODE_STATE_RUNNING;
+    }
+#endif
 #ifdef XM_IOUT_INDICATOR
     // Check measurements period.
     if (RTC_get_uptime_seconds() >= node_ctx.iout_measurements_next_time_seconds) {
@@ -323,7 +361,26 @@ errors:
 
 /*******************************************************************/
 NODE_state_t NODE_get_state(void) {
-    return (node_ctx.state);
+    // Local variables.
+    NODE_state_t state = node_ctx.state;
+#if ((defined LVRM) && (defined HW2_0))
+    // Relay sequence timer is not clocked in stop mode, including when the sequence is started by a command.
+    if (LVRM_is_relay_switching() != 0) {
+        state = NODE_STATE_RUNNING;
+    }
+#endif
+#ifdef GPSM
+    // Checked here since an acquisition can also be started by a command after the node process.
+    if ((GPSM_is_report_pending() != 0) || (GPSM_is_assistance_pending() != 0)) {
+        // Receiver polls and assistance messages are performed one per process call.
+        state = NODE_STATE_BUSY;
+    }
+    else if ((GPSM_is_acquisition_running() != 0) || (GPSM_is_clock_discipline_running() != 0)) {
+        // Keep GPS UART reception and timepulse counters alive during acquisition and clock discipline.
+        state = NODE_STATE_RUNNING;
+    }
+#endif
+    return state;
 }
 
 /*******************************************************************/
@@ -336,7 +393,7 @@ NODE_status_t NODE_write_register(NODE_request_source_t request_source, uint8_t
         goto errors;
     }
     // Check access.
-    if ((request_source == NODE_REQUEST_SOURCE_EXTERNAL) && (NODE_REGISTER_ACCESS[reg_addr] == UNA_REGISTER_ACCESS_READ_ONLY)) {
+    if ((request_source == NODE_REQUEST_SOURCE_EXTERNAL) && (_NODE_get_register_access(reg_addr) == UNA_REGISTER_ACCESS_READ_ONLY)) {
         status = NODE_ERROR_REGISTER_READ_ONLY;
         goto errors;
     }
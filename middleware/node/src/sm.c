@@ -12,8 +12,14 @@
 #include "error.h"
 #include "i2c_address.h"
 #include "load.h"
+#include "lptim.h"
 #include "node.h"
+#include "power.h"
+#include "rtc.h"
 #include "sht3x.h"
+#include "sht3x_periodic.h"
+#include "sm_ext_registers.h"
+#include "sm_logger.h"
 #include "sm_registers.h"
 #include "swreg.h"
 #include "una.h"
@@ -21,6 +27,204 @@
 
 #ifdef SM
 
+/*** SM local macros ***/
+
+#define SM_DIO_DUTY_CYCLE_ERROR_VALUE   0xFFFF
+#define SM_AIN_NUMBER                   4
+
+#define SM_DIGITAL_SENSORS_TABLE_SIZE   2
+#define SM_DIGITAL_SENSOR_INDEX_NONE    0xFF
+
+#define SM_DIO_MEASUREMENT_MEN_MASK_ALL (SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN0 | SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN1 | SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN2 | SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN3)
+
+/*** SM local structures ***/
+
+#ifdef SM_AIN_ENABLE
+/*******************************************************************/
+typedef struct {
+    ANALOG_input_type_t input_type;
+    ANALOG_gain_type_t gain_type;
+    int32_t gain;
+    uint8_t filter_decimation_ratio;
+    uint8_t filter_iir_shift;
+} SM_ain_configuration_t;
+#endif
+
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+/*******************************************************************/
+typedef enum {
+    SM_DIGITAL_SENSOR_TYPE_SHT3X = 0,
+    SM_DIGITAL_SENSOR_TYPE_LAST
+} SM_digital_sensor_type_t;
+#endif
+
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+/*******************************************************************/
+typedef NODE_status_t (*SM_digital_sensor_probe_cb_t)(uint8_t i2c_address);
+typedef NODE_status_t (*SM_digital_sensor_read_cb_t)(uint8_t i2c_address, int32_t* tamb_degrees, int32_t* hamb_percent);
+#endif
+
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+/*******************************************************************/
+typedef struct {
+    SM_digital_sensor_type_t type;
+    uint8_t i2c_address;
+    SM_digital_sensor_probe_cb_t probe;
+    SM_digital_sensor_read_cb_t read;
+} SM_digital_sensor_t;
+#endif
+
+#if ((defined SM_AIN_ENABLE) || (defined SM_DIO_ENABLE) || (defined SM_DIGITAL_SENSORS_ENABLE) || (defined SM_LOGGER_ENABLE))
+/*******************************************************************/
+typedef struct {
+#ifdef SM_AIN_ENABLE
+    uint32_t ain_filter_next_time_seconds;
+#endif
+#ifdef SM_DIO_ENABLE
+    uint32_t dio_counter_saved[DIGITAL_CHANNEL_LAST];
+    uint32_t dio_counter_next_save_time_seconds;
+    uint8_t dio_measurement_channels;
+    uint32_t dio_measurement_start_time_seconds;
+    uint32_t dio_measurement_end_time_seconds;
+    uint32_t dio_measurement_next_time_seconds;
+#endif
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+    uint8_t sensors_detected_mask;
+    uint8_t sensors_main_index;
+    uint8_t sensors_periodic_running;
+    uint8_t sensors_data_valid;
+    int32_t sensors_tamb_degrees;
+    int32_t sensors_hamb_percent;
+    SHT3X_PERIODIC_alert_status_t sensors_alert;
+    uint8_t sensors_temperature_alert_flag;
+    uint8_t sensors_humidity_alert_flag;
+    uint32_t sensors_next_fetch_time_seconds;
+#endif
+#ifdef SM_LOGGER_ENABLE
+    uint32_t logger_time_offset_seconds;
+    uint32_t logger_next_time_seconds;
+    uint8_t logger_restart_flag;
+#endif
+} SM_context_t;
+#endif
+
+/*** SM local global variables ***/
+
+#ifdef SM_DIO_ENABLE
+static const uint32_t SM_DIO_COUNTER_EDGE_MASK[DIGITAL_CHANNEL_LAST] = {
+    SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO0_EDGE,
+    SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO1_EDGE,
+    SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO2_EDGE,
+    SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO3_EDGE
+};
+static const uint32_t SM_DIO_COUNTER_RCEN_MASK[DIGITAL_CHANNEL_LAST] = {
+    SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO0_RCEN,
+    SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO1_RCEN,
+    SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO2_RCEN,
+    SM_REGISTER_DIO_COUNTER_CONFIGURATION_MASK_DIO3_RCEN
+};
+static const uint32_t SM_DIO_COUNTER_DEBOUNCE_MASK[DIGITAL_CHANNEL_LAST] = {
+    SM_REGISTER_DIO_COUNTER_DEBOUNCE_MASK_DIO0,
+    SM_REGISTER_DIO_COUNTER_DEBOUNCE_MASK_DIO1,
+    SM_REGISTER_DIO_COUNTER_DEBOUNCE_MASK_DIO2,
+    SM_REGISTER_DIO_COUNTER_DEBOUNCE_MASK_DIO3
+};
+static const uint32_t SM_DIO_COUNTER_CLR_MASK[DIGITAL_CHANNEL_LAST] = {
+    SM_REGISTER_DIO_COUNTER_CONTROL_MASK_CLR0,
+    SM_REGISTER_DIO_COUNTER_CONTROL_MASK_CLR1,
+    SM_REGISTER_DIO_COUNTER_CONTROL_MASK_CLR2,
+    SM_REGISTER_DIO_COUNTER_CONTROL_MASK_CLR3
+};
+static const uint32_t SM_DIO_MEASUREMENT_MEN_MASK[DIGITAL_CHANNEL_LAST] = {
+    SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN0,
+    SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN1,
+    SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN2,
+    SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_MEN3
+};
+static const uint8_t SM_DIO_DUTY_CYCLE_REGISTER_ADDRESS[DIGITAL_CHANNEL_LAST] = {
+    SM_REGISTER_ADDRESS_DIO_DUTY_CYCLE_1,
+    SM_REGISTER_ADDRESS_DIO_DUTY_CYCLE_1,
+    SM_REGISTER_ADDRESS_DIO_DUTY_CYCLE_2,
+    SM_REGISTER_ADDRESS_DIO_DUTY_CYCLE_2
+};
+static const uint32_t SM_DIO_DUTY_CYCLE_MASK[DIGITAL_CHANNEL_LAST] = {
+    SM_REGISTER_DIO_DUTY_CYCLE_1_MASK_DIO0,
+    SM_REGISTER_DIO_DUTY_CYCLE_1_MASK_DIO1,
+    SM_REGISTER_DIO_DUTY_CYCLE_2_MASK_DIO2,
+    SM_REGISTER_DIO_DUTY_CYCLE_2_MASK_DIO3
+};
+#endif
+
+#ifdef SM_AIN_ENABLE
+static const SM_ain_configuration_t SM_AIN_DEFAULT_CONFIGURATION[SM_AIN_NUMBER] = {
+    { SM_AIN0_INPUT_TYPE, SM_AIN0_GAIN_TYPE, SM_AIN0_GAIN, SM_AIN0_FILTER_DECIMATION_RATIO, SM_AIN0_FILTER_IIR_SHIFT },
+    { SM_AIN1_INPUT_TYPE, SM_AIN1_GAIN_TYPE, SM_AIN1_GAIN, SM_AIN1_FILTER_DECIMATION_RATIO, SM_AIN1_FILTER_IIR_SHIFT },
+    { SM_AIN2_INPUT_TYPE, SM_AIN2_GAIN_TYPE, SM_AIN2_GAIN, SM_AIN2_FILTER_DECIMATION_RATIO, SM_AIN2_FILTER_IIR_SHIFT },
+    { SM_AIN3_INPUT_TYPE, SM_AIN3_GAIN_TYPE, SM_AIN3_GAIN, SM_AIN3_FILTER_DECIMATION_RATIO, SM_AIN3_FILTER_IIR_SHIFT }
+};
+#endif
+
+#ifdef SM_AIN_ENABLE
+static const uint8_t SM_AIN_CONFIGURATION_REGISTER_ADDRESS[SM_AIN_NUMBER] = {
+    SM_REGISTER_ADDRESS_CONFIGURATION_1,
+    SM_REGISTER_ADDRESS_CONFIGURATION_1,
+    SM_REGISTER_ADDRESS_CONFIGURATION_2,
+    SM_REGISTER_ADDRESS_CONFIGURATION_2
+};
+static const uint32_t SM_AIN_CONFIGURATION_GAIN_TYPE_MASK[SM_AIN_NUMBER] = {
+    SM_REGISTER_CONFIGURATION_1_MASK_AI0T,
+    SM_REGISTER_CONFIGURATION_1_MASK_AI1T,
+    SM_REGISTER_CONFIGURATION_2_MASK_AI2T,
+    SM_REGISTER_CONFIGURATION_2_MASK_AI3T
+};
+static const uint32_t SM_AIN_CONFIGURATION_GAIN_MASK[SM_AIN_NUMBER] = {
+    SM_REGISTER_CONFIGURATION_1_MASK_AI0G,
+    SM_REGISTER_CONFIGURATION_1_MASK_AI1G,
+    SM_REGISTER_CONFIGURATION_2_MASK_AI2G,
+    SM_REGISTER_CONFIGURATION_2_MASK_AI3G
+};
+static const uint8_t SM_AIN_DATA_REGISTER_ADDRESS[SM_AIN_NUMBER] = {
+    SM_REGISTER_ADDRESS_ANALOG_DATA_1,
+    SM_REGISTER_ADDRESS_ANALOG_DATA_1,
+    SM_REGISTER_ADDRESS_ANALOG_DATA_2,
+    SM_REGISTER_ADDRESS_ANALOG_DATA_2
+};
+static const uint32_t SM_AIN_DATA_MASK[SM_AIN_NUMBER] = {
+    SM_REGISTER_ANALOG_DATA_1_MASK_VAIN0,
+    SM_REGISTER_ANALOG_DATA_1_MASK_VAIN1,
+    SM_REGISTER_ANALOG_DATA_2_MASK_VAIN2,
+    SM_REGISTER_ANALOG_DATA_2_MASK_VAIN3
+};
+#endif
+
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+// Fetch periods ensuring that a new measurement is available despite the 1 second uptime resolution.
+static const uint32_t SM_SENSORS_FETCH_PERIOD_SECONDS[SHT3X_PERIODIC_RATE_LAST] = { 3, 2, 2, 2, 2 };
+static const uint8_t SM_SENSORS_DATA_REGISTER_ADDRESS[SM_DIGITAL_SENSORS_TABLE_SIZE] = {
+    SM_REGISTER_ADDRESS_SENSORS_DATA_0,
+    SM_REGISTER_ADDRESS_SENSORS_DATA_1
+};
+#endif
+
+#ifdef SM_LOGGER_ENABLE
+static const uint32_t SM_LOGGER_RECORD_DIO_MASK[DIGITAL_CHANNEL_LAST] = {
+    SM_REGISTER_LOGGER_RECORD_0_MASK_DIO0,
+    SM_REGISTER_LOGGER_RECORD_0_MASK_DIO1,
+    SM_REGISTER_LOGGER_RECORD_0_MASK_DIO2,
+    SM_REGISTER_LOGGER_RECORD_0_MASK_DIO3
+};
+static const uint32_t SM_DIGITAL_DATA_DIO_MASK[DIGITAL_CHANNEL_LAST] = {
+    SM_REGISTER_DIGITAL_DATA_MASK_DIO0,
+    SM_REGISTER_DIGITAL_DATA_MASK_DIO1,
+    SM_REGISTER_DIGITAL_DATA_MASK_DIO2,
+    SM_REGISTER_DIGITAL_DATA_MASK_DIO3
+};
+#endif
+
+#if ((defined SM_AIN_ENABLE) || (defined SM_DIO_ENABLE) || (defined SM_DIGITAL_SENSORS_ENABLE) || (defined SM_LOGGER_ENABLE))
+static SM_context_t sm_ctx;
+#endif
+
 /*** SM local functions ***/
 
 /*******************************************************************/
@@ -32,6 +236,9 @@ static void _SM_reset_analog_data(void) {
     uint32_t reg_analog_data_2_mask = 0;
     uint32_t reg_analog_data_3 = 0;
     uint32_t reg_analog_data_3_mask = 0;
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+    uint8_t idx = 0;
+#endif
     // Reset fields to error value.
     // AIN0 / AIN1.
     SWREG_write_field(&reg_analog_data_1, &reg_analog_data_1_mask, UNA_VOLTAGE_ERROR_VALUE, SM_REGISTER_ANALOG_DATA_1_MASK_VAIN0);
@@ -45,6 +252,16 @@ static void _SM_reset_analog_data(void) {
     SWREG_write_field(&reg_analog_data_3, &reg_analog_data_3_mask, UNA_TEMPERATURE_ERROR_VALUE, SM_REGISTER_ANALOG_DATA_3_MASK_TAMB);
     SWREG_write_field(&reg_analog_data_3, &reg_analog_data_3_mask, UNA_HUMIDITY_ERROR_VALUE, SM_REGISTER_ANALOG_DATA_3_MASK_HAMB);
     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_ANALOG_DATA_3, reg_analog_data_3, reg_analog_data_3_mask);
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+    // Shield sensors.
+    reg_analog_data_3 = 0;
+    reg_analog_data_3_mask = 0;
+    SWREG_write_field(&reg_analog_data_3, &reg_analog_data_3_mask, UNA_TEMPERATURE_ERROR_VALUE, SM_REGISTER_SENSORS_DATA_MASK_TAMB);
+    SWREG_write_field(&reg_analog_data_3, &reg_analog_data_3_mask, UNA_HUMIDITY_ERROR_VALUE, SM_REGISTER_SENSORS_DATA_MASK_HAMB);
+    for (idx = 0; idx < SM_DIGITAL_SENSORS_TABLE_SIZE; idx++) {
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_SENSORS_DATA_REGISTER_ADDRESS[idx], reg_analog_data_3, reg_analog_data_3_mask);
+    }
+#endif
 }
 
 /*******************************************************************/
@@ -61,15 +278,666 @@ static void _SM_reset_digital_data(void) {
     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIGITAL_DATA, reg_digital_data, reg_digital_data_mask);
 }
 
+#ifdef SM_AIN_ENABLE
+/*******************************************************************/
+static uint32_t _SM_get_ain_default_configuration(uint8_t ain_index) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Build register from compilation flags.
+    SWREG_write_field(&reg_value, &reg_mask, SM_AIN_DEFAULT_CONFIGURATION[ain_index].input_type, SM_REGISTER_AIN_CONFIGURATION_MASK_TYPE);
+    SWREG_write_field(&reg_value, &reg_mask, SM_AIN_DEFAULT_CONFIGURATION[ain_index].gain_type, SM_REGISTER_AIN_CONFIGURATION_MASK_GT);
+    SWREG_write_field(&reg_value, &reg_mask, (uint32_t) SM_AIN_DEFAULT_CONFIGURATION[ain_index].gain, SM_REGISTER_AIN_CONFIGURATION_MASK_GAIN);
+    SWREG_write_field(&reg_value, &reg_mask, SM_AIN_DEFAULT_CONFIGURATION[ain_index].filter_decimation_ratio, SM_REGISTER_AIN_CONFIGURATION_MASK_DEC);
+    SWREG_write_field(&reg_value, &reg_mask, SM_AIN_DEFAULT_CONFIGURATION[ain_index].filter_iir_shift, SM_REGISTER_AIN_CONFIGURATION_MASK_IIR);
+    return reg_value;
+}
+#endif
+
+#ifdef SM_AIN_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_configure_ain(uint8_t ain_index) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    ANALOG_status_t analog_status = ANALOG_SUCCESS;
+    uint32_t reg_ain_configuration = 0;
+    ANALOG_input_type_t input_type = ANALOG_INPUT_TYPE_VOLTAGE;
+    ANALOG_gain_type_t gain_type = ANALOG_GAIN_TYPE_ATTENUATION;
+    int32_t gain = 0;
+    uint8_t decimation_ratio = 0;
+    uint8_t iir_shift = 0;
+    // Read register.
+    status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, (SM_REGISTER_ADDRESS_AIN_CONFIGURATION_0 + ain_index), &reg_ain_configuration);
+    if (status != NODE_SUCCESS) goto errors;
+    input_type = (ANALOG_input_type_t) SWREG_read_field(reg_ain_configuration, SM_REGISTER_AIN_CONFIGURATION_MASK_TYPE);
+    gain_type = (ANALOG_gain_type_t) SWREG_read_field(reg_ain_configuration, SM_REGISTER_AIN_CONFIGURATION_MASK_GT);
+    gain = (int32_t) SWREG_read_field(reg_ain_configuration, SM_REGISTER_AIN_CONFIGURATION_MASK_GAIN);
+    decimation_ratio = (uint8_t) SWREG_read_field(reg_ain_configuration, SM_REGISTER_AIN_CONFIGURATION_MASK_DEC);
+    iir_shift = (uint8_t) SWREG_read_field(reg_ain_configuration, SM_REGISTER_AIN_CONFIGURATION_MASK_IIR);
+    // Update conversion scale.
+    analog_status = ANALOG_set_channel_configuration((ANALOG_channel_t) (ANALOG_CHANNEL_AIN0_MV + ain_index), input_type, gain_type, gain);
+    ANALOG_exit_error(NODE_ERROR_BASE_ANALOG);
+    // Update digital filter.
+    analog_status = ANALOG_set_channel_filter((ANALOG_channel_t) (ANALOG_CHANNEL_AIN0_MV + ain_index), decimation_ratio, iir_shift);
+    ANALOG_exit_error(NODE_ERROR_BASE_ANALOG);
+errors:
+    return status;
+}
+#endif
+
+#ifdef SM_AIN_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_ain_filter_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    ANALOG_status_t analog_status = ANALOG_SUCCESS;
+    ANALOG_channel_t channel = ANALOG_CHANNEL_AIN0_MV;
+    uint32_t reg_analog_data = 0;
+    uint32_t reg_analog_data_mask = 0;
+    int32_t analog_data = 0;
+    uint8_t filtered_channels = 0;
+    uint8_t updated_channels = 0;
+    uint8_t output_ready = 0;
+    uint8_t idx = 0;
+    // Check sample period.
+    if (RTC_get_uptime_seconds() < sm_ctx.ain_filter_next_time_seconds) goto errors;
+    sm_ctx.ain_filter_next_time_seconds = (RTC_get_uptime_seconds() + SM_AIN_FILTER_SAMPLE_PERIOD_SECONDS);
+    // Select filtered channels.
+    for (idx = 0; idx < SM_AIN_NUMBER; idx++) {
+        if (ANALOG_is_channel_filtered((ANALOG_channel_t) (ANALOG_CHANNEL_AIN0_MV + idx)) != 0) {
+            filtered_channels |= (0b1 << idx);
+        }
+    }
+    if (filtered_channels == 0) goto errors;
+    // Turn analog front-end on.
+    POWER_enable(POWER_REQUESTER_ID_SM, POWER_DOMAIN_ANALOG, LPTIM_DELAY_MODE_ACTIVE);
+    // One sample per period, the decimation period spans the next wake-ups.
+    for (idx = 0; idx < SM_AIN_NUMBER; idx++) {
+        if ((filtered_channels & (0b1 << idx)) == 0) continue;
+        analog_status = ANALOG_filter_channel((ANALOG_channel_t) (ANALOG_CHANNEL_AIN0_MV + idx), &output_ready);
+        ANALOG_exit_error(NODE_ERROR_BASE_ANALOG);
+        if (output_ready != 0) {
+            updated_channels |= (0b1 << idx);
+        }
+    }
+    if (updated_channels == 0) goto errors;
+    // Update MCU voltage used by the analog inputs conversion.
+    analog_status = ANALOG_convert_channel(ANALOG_CHANNEL_VMCU_MV, &analog_data);
+    ANALOG_exit_error(NODE_ERROR_BASE_ANALOG);
+    // Expose filtered values.
+    for (idx = 0; idx < SM_AIN_NUMBER; idx++) {
+        if ((updated_channels & (0b1 << idx)) == 0) continue;
+        channel = (ANALOG_channel_t) (ANALOG_CHANNEL_AIN0_MV + idx);
+        analog_status = ANALOG_convert_channel(channel, &analog_data);
+        ANALOG_exit_error(NODE_ERROR_BASE_ANALOG);
+        reg_analog_data = 0;
+        reg_analog_data_mask = 0;
+        SWREG_write_field(&reg_analog_data, &reg_analog_data_mask, UNA_convert_mv(analog_data), SM_AIN_DATA_MASK[idx]);
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_AIN_DATA_REGISTER_ADDRESS[idx], reg_analog_data, reg_analog_data_mask);
+    }
+errors:
+    POWER_disable(POWER_REQUESTER_ID_SM, POWER_DOMAIN_ANALOG);
+    return status;
+}
+#endif
+
+#ifdef SM_DIO_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_configure_dio_counters(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    DIGITAL_status_t digital_status = DIGITAL_SUCCESS;
+    uint32_t reg_configuration = 0;
+    uint32_t reg_debounce = 0;
+    DIGITAL_counter_edge_t edge = DIGITAL_COUNTER_EDGE_NONE;
+    uint8_t counters_enabled = 0;
+    uint8_t idx = 0;
+    // Read registers.
+    status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIO_COUNTER_CONFIGURATION, &reg_configuration);
+    if (status != NODE_SUCCESS) goto errors;
+    status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIO_COUNTER_DEBOUNCE, &reg_debounce);
+    if (status != NODE_SUCCESS) goto errors;
+    // Check if at least one counter is enabled.
+    for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+        if (SWREG_read_field(reg_configuration, SM_DIO_COUNTER_EDGE_MASK[idx]) != DIGITAL_COUNTER_EDGE_NONE) {
+            counters_enabled = 1;
+        }
+    }
+    // Keep digital front-end powered while counting, including in stop mode.
+    if (counters_enabled != 0) {
+        POWER_enable(POWER_REQUESTER_ID_SM_COUNTERS, POWER_DOMAIN_DIGITAL, LPTIM_DELAY_MODE_STOP);
+    }
+    // Channels loop.
+    for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+        edge = (DIGITAL_counter_edge_t) SWREG_read_field(reg_configuration, SM_DIO_COUNTER_EDGE_MASK[idx]);
+        if (edge != DIGITAL_COUNTER_EDGE_NONE) {
+            digital_status = DIGITAL_start_counter((DIGITAL_channel_t) idx, edge, SWREG_read_field(reg_debounce, SM_DIO_COUNTER_DEBOUNCE_MASK[idx]));
+            DIGITAL_exit_error(NODE_ERROR_BASE_DIGITAL);
+        }
+        else {
+            digital_status = DIGITAL_stop_counter((DIGITAL_channel_t) idx);
+            DIGITAL_exit_error(NODE_ERROR_BASE_DIGITAL);
+        }
+    }
+errors:
+    if (counters_enabled == 0) {
+        POWER_disable(POWER_REQUESTER_ID_SM_COUNTERS, POWER_DOMAIN_DIGITAL);
+    }
+    return status;
+}
+#endif
+
+#ifdef SM_DIO_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_save_dio_counters(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    DIGITAL_status_t digital_status = DIGITAL_SUCCESS;
+    uint32_t count = 0;
+    uint8_t idx = 0;
+    // Channels loop.
+    for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+        digital_status = DIGITAL_read_counter((DIGITAL_channel_t) idx, 0, &count);
+        DIGITAL_exit_error(NODE_ERROR_BASE_DIGITAL);
+        // Limit EEPROM wear by writing changed values only.
+        if (count != sm_ctx.dio_counter_saved[idx]) {
+            status = NODE_write_nvm((SM_REGISTER_ADDRESS_DIO_COUNTER_0 + idx), count);
+            if (status != NODE_SUCCESS) goto errors;
+            sm_ctx.dio_counter_saved[idx] = count;
+        }
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifdef SM_DIO_ENABLE
+/*******************************************************************/
+static void _SM_reset_dio_measurements(void) {
+    // Local variables.
+    uint32_t reg_duty_cycle_1 = 0;
+    uint32_t reg_duty_cycle_1_mask = 0;
+    uint32_t reg_duty_cycle_2 = 0;
+    uint32_t reg_duty_cycle_2_mask = 0;
+    uint8_t idx = 0;
+    // Reset frequencies.
+    for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (SM_REGISTER_ADDRESS_DIO_FREQUENCY_0 + idx), 0, SM_REGISTER_DIO_FREQUENCY_MASK_FREQUENCY);
+    }
+    // Reset duty cycles to error value.
+    SWREG_write_field(&reg_duty_cycle_1, &reg_duty_cycle_1_mask, SM_DIO_DUTY_CYCLE_ERROR_VALUE, SM_REGISTER_DIO_DUTY_CYCLE_1_MASK_DIO0);
+    SWREG_write_field(&reg_duty_cycle_1, &reg_duty_cycle_1_mask, SM_DIO_DUTY_CYCLE_ERROR_VALUE, SM_REGISTER_DIO_DUTY_CYCLE_1_MASK_DIO1);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIO_DUTY_CYCLE_1, reg_duty_cycle_1, reg_duty_cycle_1_mask);
+    SWREG_write_field(&reg_duty_cycle_2, &reg_duty_cycle_2_mask, SM_DIO_DUTY_CYCLE_ERROR_VALUE, SM_REGISTER_DIO_DUTY_CYCLE_2_MASK_DIO2);
+    SWREG_write_field(&reg_duty_cycle_2, &reg_duty_cycle_2_mask, SM_DIO_DUTY_CYCLE_ERROR_VALUE, SM_REGISTER_DIO_DUTY_CYCLE_2_MASK_DIO3);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIO_DUTY_CYCLE_2, reg_duty_cycle_2, reg_duty_cycle_2_mask);
+}
+#endif
+
+#ifdef SM_DIO_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_start_dio_measurements(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    DIGITAL_status_t digital_status = DIGITAL_SUCCESS;
+    uint32_t reg_configuration = 0;
+    uint32_t window_seconds = 0;
+    uint8_t idx = 0;
+    // Read configuration.
+    status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIO_MEASUREMENT_CONFIGURATION, &reg_configuration);
+    if (status != NODE_SUCCESS) goto errors;
+    window_seconds = SWREG_read_field(reg_configuration, SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_WINDOW);
+    if (window_seconds == 0) {
+        window_seconds = 1;
+    }
+    // Turn digital front-end on.
+    POWER_enable(POWER_REQUESTER_ID_SM_FREQUENCY, POWER_DOMAIN_DIGITAL, LPTIM_DELAY_MODE_SLEEP);
+    // Channels loop.
+    for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+        if (SWREG_read_field(reg_configuration, SM_DIO_MEASUREMENT_MEN_MASK[idx]) == 0) continue;
+        digital_status = DIGITAL_start_measurement((DIGITAL_channel_t) idx);
+        DIGITAL_exit_error(NODE_ERROR_BASE_DIGITAL);
+        sm_ctx.dio_measurement_channels |= (0b1 << idx);
+    }
+    // Update window.
+    sm_ctx.dio_measurement_start_time_seconds = RTC_get_uptime_seconds();
+    sm_ctx.dio_measurement_end_time_seconds = (sm_ctx.dio_measurement_start_time_seconds + window_seconds);
+errors:
+    if (sm_ctx.dio_measurement_channels == 0) {
+        POWER_disable(POWER_REQUESTER_ID_SM_FREQUENCY, POWER_DOMAIN_DIGITAL);
+    }
+    return status;
+}
+#endif
+
+#ifdef SM_DIO_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_stop_dio_measurements(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    DIGITAL_status_t digital_status = DIGITAL_SUCCESS;
+    DIGITAL_signal_t signal;
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint8_t idx = 0;
+    // Channels loop.
+    for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+        if ((sm_ctx.dio_measurement_channels & (0b1 << idx)) == 0) continue;
+        sm_ctx.dio_measurement_channels &= ~(0b1 << idx);
+        digital_status = DIGITAL_stop_measurement((DIGITAL_channel_t) idx, &signal);
+        DIGITAL_exit_error(NODE_ERROR_BASE_DIGITAL);
+        // Write registers.
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (SM_REGISTER_ADDRESS_DIO_FREQUENCY_0 + idx), signal.frequency_mhz, SM_REGISTER_DIO_FREQUENCY_MASK_FREQUENCY);
+        reg_value = 0;
+        reg_mask = 0;
+        SWREG_write_field(&reg_value, &reg_mask, (uint32_t) signal.duty_cycle_permille, SM_DIO_DUTY_CYCLE_MASK[idx]);
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_DIO_DUTY_CYCLE_REGISTER_ADDRESS[idx], reg_value, reg_mask);
+    }
+errors:
+    sm_ctx.dio_measurement_channels = 0;
+    POWER_disable(POWER_REQUESTER_ID_SM_FREQUENCY, POWER_DOMAIN_DIGITAL);
+    return status;
+}
+#endif
+
+#ifdef SM_DIO_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_dio_measurement_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t reg_configuration = 0;
+    // Read configuration.
+    status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIO_MEASUREMENT_CONFIGURATION, &reg_configuration);
+    if (status != NODE_SUCCESS) goto errors;
+    // Check running window.
+    if (sm_ctx.dio_measurement_channels != 0) {
+        if (RTC_get_uptime_seconds() < sm_ctx.dio_measurement_end_time_seconds) goto errors;
+        // Update next time (null period means continuous measurement).
+        sm_ctx.dio_measurement_next_time_seconds = (sm_ctx.dio_measurement_start_time_seconds + SWREG_read_field(reg_configuration, SM_REGISTER_DIO_MEASUREMENT_CONFIGURATION_MASK_PERIOD));
+        // Compute results.
+        status = _SM_stop_dio_measurements();
+        if (status != NODE_SUCCESS) goto errors;
+    }
+    // Check enabled channels and period.
+    if ((reg_configuration & SM_DIO_MEASUREMENT_MEN_MASK_ALL) == 0) goto errors;
+    if (RTC_get_uptime_seconds() < sm_ctx.dio_measurement_next_time_seconds) goto errors;
+    // Start new window.
+    status = _SM_start_dio_measurements();
+    if (status != NODE_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_sht3x_probe(uint8_t i2c_address) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    SHT3X_PERIODIC_status_t sht3x_periodic_status = SHT3X_PERIODIC_SUCCESS;
+    // Check sensor presence.
+    sht3x_periodic_status = SHT3X_PERIODIC_probe(i2c_address);
+    SHT3X_PERIODIC_exit_error(NODE_ERROR_BASE_SHT3X_PERIODIC);
+errors:
+    return status;
+}
+#endif
+
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_sht3x_read(uint8_t i2c_address, int32_t* tamb_degrees, int32_t* hamb_percent) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    SHT3X_status_t sht3x_status = SHT3X_SUCCESS;
+    // Single shot measurement.
+    sht3x_status = SHT3X_get_temperature_humidity(i2c_address, tamb_degrees, hamb_percent);
+    SHT3X_exit_error(NODE_ERROR_BASE_SHT3X);
+errors:
+    return status;
+}
+#endif
+
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+// Supported shield sensors, scanned in this order at boot.
+static const SM_digital_sensor_t SM_DIGITAL_SENSORS[SM_DIGITAL_SENSORS_TABLE_SIZE] = {
+    { SM_DIGITAL_SENSOR_TYPE_SHT3X, I2C_ADDRESS_SHT30, &_SM_sht3x_probe, &_SM_sht3x_read },
+    { SM_DIGITAL_SENSOR_TYPE_SHT3X, I2C_ADDRESS_SHT30_SECONDARY, &_SM_sht3x_probe, &_SM_sht3x_read }
+};
+#endif
+
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+/*******************************************************************/
+static void _SM_scan_sensors(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint8_t idx = 0;
+    // Reset detection.
+    sm_ctx.sensors_detected_mask = 0;
+    sm_ctx.sensors_main_index = SM_DIGITAL_SENSOR_INDEX_NONE;
+    // Turn sensors on.
+    POWER_enable(POWER_REQUESTER_ID_SM, POWER_DOMAIN_SENSORS, LPTIM_DELAY_MODE_STOP);
+    // Probe all supported sensors.
+    for (idx = 0; idx < SM_DIGITAL_SENSORS_TABLE_SIZE; idx++) {
+        // Missing sensors are expected and not reported in the error stack.
+        status = SM_DIGITAL_SENSORS[idx].probe(SM_DIGITAL_SENSORS[idx].i2c_address);
+        if (status != NODE_SUCCESS) continue;
+        sm_ctx.sensors_detected_mask |= (0b1 << idx);
+        // First detected sensor is the main one.
+        if (sm_ctx.sensors_main_index == SM_DIGITAL_SENSOR_INDEX_NONE) {
+            sm_ctx.sensors_main_index = idx;
+        }
+    }
+    POWER_disable(POWER_REQUESTER_ID_SM, POWER_DOMAIN_SENSORS);
+    // Update register.
+    SWREG_write_field(&reg_value, &reg_mask, sm_ctx.sensors_detected_mask, SM_REGISTER_SENSORS_DETECTION_MASK_DETECTED);
+    SWREG_write_field(&reg_value, &reg_mask, sm_ctx.sensors_main_index, SM_REGISTER_SENSORS_DETECTION_MASK_MAIN);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_SENSORS_DETECTION, reg_value, reg_mask);
+}
+#endif
+
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_configure_sensors(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    SHT3X_PERIODIC_status_t sht3x_periodic_status = SHT3X_PERIODIC_SUCCESS;
+    SHT3X_PERIODIC_alert_limits_t limits;
+    SHT3X_PERIODIC_rate_t rate = SHT3X_PERIODIC_RATE_0_5_MPS;
+    uint32_t reg_configuration = 0;
+    uint32_t reg_alert_configuration = 0;
+    // Read registers.
+    status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_SENSORS_CONFIGURATION, &reg_configuration);
+    if (status != NODE_SUCCESS) goto errors;
+    status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_SENSORS_ALERT_CONFIGURATION, &reg_alert_configuration);
+    if (status != NODE_SUCCESS) goto errors;
+    // Stop current acquisition.
+    if (sm_ctx.sensors_periodic_running != 0) {
+        sm_ctx.sensors_periodic_running = 0;
+        sht3x_periodic_status = SHT3X_PERIODIC_stop(SM_DIGITAL_SENSORS[sm_ctx.sensors_main_index].i2c_address);
+        SHT3X_PERIODIC_exit_error(NODE_ERROR_BASE_SHT3X_PERIODIC);
+    }
+    sm_ctx.sensors_data_valid = 0;
+    sm_ctx.sensors_alert.temperature_alert = 0;
+    sm_ctx.sensors_alert.humidity_alert = 0;
+    // Check mode.
+    if (SWREG_read_field(reg_configuration, SM_REGISTER_SENSORS_CONFIGURATION_MASK_PMEN) == 0) goto errors;
+    // Periodic mode requires a SHT3x main sensor.
+    if (sm_ctx.sensors_main_index == SM_DIGITAL_SENSOR_INDEX_NONE) goto errors;
+    if (SM_DIGITAL_SENSORS[sm_ctx.sensors_main_index].type != SM_DIGITAL_SENSOR_TYPE_SHT3X) goto errors;
+    rate = (SHT3X_PERIODIC_rate_t) SWREG_read_field(reg_configuration, SM_REGISTER_SENSORS_CONFIGURATION_MASK_RATE);
+    if (rate >= SHT3X_PERIODIC_RATE_LAST) {
+        status = NODE_ERROR_REGISTER_FIELD_RANGE;
+        goto errors;
+    }
+    // Keep sensors powered between measurements.
+    POWER_enable(POWER_REQUESTER_ID_SM_SENSORS, POWER_DOMAIN_SENSORS, LPTIM_DELAY_MODE_STOP);
+    // Program thresholds.
+    limits.temperature_high_degrees = (int32_t) ((int8_t) SWREG_read_field(reg_alert_configuration, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_THIGH));
+    limits.temperature_low_degrees = (int32_t) ((int8_t) SWREG_read_field(reg_alert_configuration, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_TLOW));
+    limits.temperature_hysteresis_degrees = SM_SENSORS_ALERT_HYSTERESIS_DEGREES;
+    limits.humidity_high_percent = (int32_t) SWREG_read_field(reg_alert_configuration, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_HHIGH);
+    limits.humidity_low_percent = (int32_t) SWREG_read_field(reg_alert_configuration, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_HLOW);
+    limits.humidity_hysteresis_percent = SM_SENSORS_ALERT_HYSTERESIS_PERCENT;
+    sht3x_periodic_status = SHT3X_PERIODIC_set_alert_limits(SM_DIGITAL_SENSORS[sm_ctx.sensors_main_index].i2c_address, &limits);
+    SHT3X_PERIODIC_exit_error(NODE_ERROR_BASE_SHT3X_PERIODIC);
+    // Start periodic measurements.
+    sht3x_periodic_status = SHT3X_PERIODIC_start(SM_DIGITAL_SENSORS[sm_ctx.sensors_main_index].i2c_address, rate);
+    SHT3X_PERIODIC_exit_error(NODE_ERROR_BASE_SHT3X_PERIODIC);
+    sm_ctx.sensors_periodic_running = 1;
+    sm_ctx.sensors_next_fetch_time_seconds = (RTC_get_uptime_seconds() + SM_SENSORS_FETCH_PERIOD_SECONDS[rate]);
+errors:
+    if (sm_ctx.sensors_periodic_running == 0) {
+        POWER_disable(POWER_REQUESTER_ID_SM_SENSORS, POWER_DOMAIN_SENSORS);
+    }
+    return status;
+}
+#endif
+
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_sensors_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    SHT3X_PERIODIC_status_t sht3x_periodic_status = SHT3X_PERIODIC_SUCCESS;
+    SHT3X_PERIODIC_alert_status_t alert_status;
+    uint32_t reg_configuration = 0;
+    SHT3X_PERIODIC_rate_t rate = SHT3X_PERIODIC_RATE_0_5_MPS;
+    // Check mode and period.
+    if (sm_ctx.sensors_periodic_running == 0) goto errors;
+    if (RTC_get_uptime_seconds() < sm_ctx.sensors_next_fetch_time_seconds) goto errors;
+    // Update next time.
+    status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_SENSORS_CONFIGURATION, &reg_configuration);
+    if (status != NODE_SUCCESS) goto errors;
+    rate = (SHT3X_PERIODIC_rate_t) SWREG_read_field(reg_configuration, SM_REGISTER_SENSORS_CONFIGURATION_MASK_RATE);
+    sm_ctx.sensors_next_fetch_time_seconds = (RTC_get_uptime_seconds() + SM_SENSORS_FETCH_PERIOD_SECONDS[(rate < SHT3X_PERIODIC_RATE_LAST) ? rate : SHT3X_PERIODIC_RATE_0_5_MPS]);
+    // Fetch last result.
+    sm_ctx.sensors_data_valid = 0;
+    sht3x_periodic_status = SHT3X_PERIODIC_read(SM_DIGITAL_SENSORS[sm_ctx.sensors_main_index].i2c_address, &sm_ctx.sensors_tamb_degrees, &sm_ctx.sensors_hamb_percent);
+    SHT3X_PERIODIC_exit_error(NODE_ERROR_BASE_SHT3X_PERIODIC);
+    sm_ctx.sensors_data_valid = 1;
+    // Check thresholds crossings.
+    sht3x_periodic_status = SHT3X_PERIODIC_get_alert_status(SM_DIGITAL_SENSORS[sm_ctx.sensors_main_index].i2c_address, &alert_status);
+    SHT3X_PERIODIC_exit_error(NODE_ERROR_BASE_SHT3X_PERIODIC);
+    if (alert_status.temperature_alert != sm_ctx.sensors_alert.temperature_alert) {
+        sm_ctx.sensors_temperature_alert_flag = 1;
+    }
+    if (alert_status.humidity_alert != sm_ctx.sensors_alert.humidity_alert) {
+        sm_ctx.sensors_humidity_alert_flag = 1;
+    }
+    sm_ctx.sensors_alert = alert_status;
+errors:
+    return status;
+}
+#endif
+
+#ifdef SM_LOGGER_ENABLE
+/*******************************************************************/
+static uint32_t _SM_get_logger_time_seconds(void) {
+    return (RTC_get_uptime_seconds() + sm_ctx.logger_time_offset_seconds);
+}
+#endif
+
+#ifdef SM_LOGGER_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_init_logger(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t record[SM_LOGGER_RECORD_SIZE_WORDS];
+    uint16_t count = 0;
+    // Recover records store.
+    status = SM_LOGGER_init();
+    if (status != NODE_SUCCESS) goto errors;
+    // Continue logger time after the last record.
+    sm_ctx.logger_time_offset_seconds = 0;
+    sm_ctx.logger_restart_flag = 1;
+    count = SM_LOGGER_get_count();
+    if (count > 0) {
+        status = SM_LOGGER_read((count - 1), record);
+        if (status != NODE_SUCCESS) goto errors;
+        sm_ctx.logger_time_offset_seconds = (SWREG_read_field(record[1], SM_REGISTER_LOGGER_RECORD_1_MASK_TIME) + 1);
+    }
+    sm_ctx.logger_next_time_seconds = RTC_get_uptime_seconds();
+errors:
+    return status;
+}
+#endif
+
+#ifdef SM_LOGGER_ENABLE
+/*******************************************************************/
+static NODE_status_t _SM_logger_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t reg_configuration = 0;
+    uint32_t reg_digital_data = 0;
+    uint32_t record[SM_LOGGER_RECORD_SIZE_WORDS];
+    uint32_t record_mask = 0;
+    uint32_t period_seconds = 0;
+    ANALOG_status_t analog_status = ANALOG_SUCCESS;
+    int32_t vmcu_mv = 0;
+    uint8_t idx = 0;
+    // Read configuration.
+    status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_LOGGER_CONFIGURATION, &reg_configuration);
+    if (status != NODE_SUCCESS) goto errors;
+    period_seconds = SWREG_read_field(reg_configuration, SM_REGISTER_LOGGER_CONFIGURATION_MASK_PERIOD);
+    // Check schedule.
+    if ((SWREG_read_field(reg_configuration, SM_REGISTER_LOGGER_CONFIGURATION_MASK_LEN) == 0) || (period_seconds == 0)) goto errors;
+    if (RTC_get_uptime_seconds() < sm_ctx.logger_next_time_seconds) goto errors;
+    sm_ctx.logger_next_time_seconds = (RTC_get_uptime_seconds() + period_seconds);
+    // Turn analog front-end on.
+    POWER_enable(POWER_REQUESTER_ID_SM, POWER_DOMAIN_ANALOG, LPTIM_DELAY_MODE_ACTIVE);
+    // Update MCU voltage used by the analog inputs conversion.
+    analog_status = ANALOG_convert_channel(ANALOG_CHANNEL_VMCU_MV, &vmcu_mv);
+    ANALOG_exit_error(NODE_ERROR_BASE_ANALOG);
+    // Perform measurements.
+    status = SM_mtrg_callback();
+    POWER_disable(POWER_REQUESTER_ID_SM, POWER_DOMAIN_ANALOG);
+    if (status != NODE_SUCCESS) goto errors;
+    // Header.
+    for (idx = 0; idx < SM_LOGGER_RECORD_SIZE_WORDS; idx++) {
+        record[idx] = 0;
+    }
+    status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIGITAL_DATA, &reg_digital_data);
+    if (status != NODE_SUCCESS) goto errors;
+    for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+        SWREG_write_field(&(record[0]), &record_mask, SWREG_read_field(reg_digital_data, SM_DIGITAL_DATA_DIO_MASK[idx]), SM_LOGGER_RECORD_DIO_MASK[idx]);
+    }
+    // Timestamp.
+    SWREG_write_field(&(record[1]), &record_mask, _SM_get_logger_time_seconds(), SM_REGISTER_LOGGER_RECORD_1_MASK_TIME);
+    SWREG_write_field(&(record[1]), &record_mask, sm_ctx.logger_restart_flag, SM_REGISTER_LOGGER_RECORD_1_MASK_RST);
+    // Analog data.
+    for (idx = 0; idx < 3; idx++) {
+        status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, (uint8_t) (SM_REGISTER_ADDRESS_ANALOG_DATA_1 + idx), &(record[2 + idx]));
+        if (status != NODE_SUCCESS) goto errors;
+    }
+    // Store record.
+    status = SM_LOGGER_append(record);
+    if (status != NODE_SUCCESS) goto errors;
+    sm_ctx.logger_restart_flag = 0;
+errors:
+    POWER_disable(POWER_REQUESTER_ID_SM, POWER_DOMAIN_ANALOG);
+    return status;
+}
+#endif
+
 /*** SM functions ***/
 
 /*******************************************************************/
 NODE_status_t SM_init_registers(void) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
+#if ((defined SM_AIN_ENABLE) || (defined SM_DIO_ENABLE) || (defined SM_DIGITAL_SENSORS_ENABLE) || (defined SM_LOGGER_ENABLE))
+    uint32_t reg_value = 0;
+#endif
+#ifdef SM_DIO_ENABLE
+    DIGITAL_status_t digital_status = DIGITAL_SUCCESS;
+#endif
+#if ((defined SM_AIN_ENABLE) || (defined SM_DIO_ENABLE))
+    uint8_t idx = 0;
+#endif
+#if ((defined XM_NVM_FACTORY_RESET) && (defined SM_DIGITAL_SENSORS_ENABLE))
+    uint32_t reg_mask = 0;
+#endif
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+    // Detect shield sensors.
+    sm_ctx.sensors_periodic_running = 0;
+    _SM_scan_sensors();
+#endif
+#if ((defined XM_NVM_FACTORY_RESET) && (defined SM_AIN_ENABLE))
+    // Analog inputs front-end.
+    for (idx = 0; idx < SM_AIN_NUMBER; idx++) {
+        NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, (SM_REGISTER_ADDRESS_AIN_CONFIGURATION_0 + idx), _SM_get_ain_default_configuration(idx), UNA_REGISTER_MASK_ALL);
+    }
+#endif
+#if ((defined XM_NVM_FACTORY_RESET) && (defined SM_LOGGER_ENABLE))
+    // Logger disabled.
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_LOGGER_CONFIGURATION, 0, UNA_REGISTER_MASK_ALL);
+#endif
+#if ((defined XM_NVM_FACTORY_RESET) && (defined SM_DIO_ENABLE))
+    // DIO counters disabled and cleared.
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_DIO_COUNTER_CONFIGURATION, 0, UNA_REGISTER_MASK_ALL);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_DIO_COUNTER_DEBOUNCE, 0, UNA_REGISTER_MASK_ALL);
+    for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+        NODE_write_nvm((SM_REGISTER_ADDRESS_DIO_COUNTER_0 + idx), 0);
+    }
+    // DIO measurements disabled.
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_DIO_MEASUREMENT_CONFIGURATION, 0, UNA_REGISTER_MASK_ALL);
+#endif
+#if ((defined XM_NVM_FACTORY_RESET) && (defined SM_DIGITAL_SENSORS_ENABLE))
+    // Sensors alert thresholds.
+    SWREG_write_field(&reg_value, &reg_mask, (uint8_t) SM_SENSORS_ALERT_THIGH_DEGREES, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_THIGH);
+    SWREG_write_field(&reg_value, &reg_mask, (uint8_t) SM_SENSORS_ALERT_TLOW_DEGREES, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_TLOW);
+    SWREG_write_field(&reg_value, &reg_mask, SM_SENSORS_ALERT_HHIGH_PERCENT, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_HHIGH);
+    SWREG_write_field(&reg_value, &reg_mask, SM_SENSORS_ALERT_HLOW_PERCENT, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_HLOW);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_SENSORS_ALERT_CONFIGURATION, reg_value, reg_mask);
+    // Single shot mode by default.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, 0b0, SM_REGISTER_SENSORS_CONFIGURATION_MASK_PMEN);
+    SWREG_write_field(&reg_value, &reg_mask, SM_SENSORS_PERIODIC_RATE, SM_REGISTER_SENSORS_CONFIGURATION_MASK_RATE);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_SENSORS_CONFIGURATION, reg_value, reg_mask);
+#endif
     // Load default values.
     _SM_reset_analog_data();
     _SM_reset_digital_data();
+#ifdef SM_DIO_ENABLE
+    _SM_reset_dio_measurements();
+    // Load DIO measurements configuration from NVM.
+    NODE_read_nvm(SM_REGISTER_ADDRESS_DIO_MEASUREMENT_CONFIGURATION, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIO_MEASUREMENT_CONFIGURATION, reg_value, UNA_REGISTER_MASK_ALL);
+    sm_ctx.dio_measurement_channels = 0;
+    sm_ctx.dio_measurement_next_time_seconds = 0;
+    // Load DIO counters configuration from NVM.
+    NODE_read_nvm(SM_REGISTER_ADDRESS_DIO_COUNTER_CONFIGURATION, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIO_COUNTER_CONFIGURATION, reg_value, UNA_REGISTER_MASK_ALL);
+    NODE_read_nvm(SM_REGISTER_ADDRESS_DIO_COUNTER_DEBOUNCE, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIO_COUNTER_DEBOUNCE, reg_value, UNA_REGISTER_MASK_ALL);
+    // Restore counters.
+    for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+        NODE_read_nvm((SM_REGISTER_ADDRESS_DIO_COUNTER_0 + idx), &reg_value);
+        sm_ctx.dio_counter_saved[idx] = reg_value;
+        digital_status = DIGITAL_set_counter((DIGITAL_channel_t) idx, reg_value);
+        DIGITAL_exit_error(NODE_ERROR_BASE_DIGITAL);
+    }
+    sm_ctx.dio_counter_next_save_time_seconds = SM_DIO_COUNTER_SAVE_PERIOD_SECONDS;
+    // Start counters.
+    status = _SM_configure_dio_counters();
+    if (status != NODE_SUCCESS) goto errors;
+#endif
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+    // Load sensors configuration from NVM.
+    NODE_read_nvm(SM_REGISTER_ADDRESS_SENSORS_ALERT_CONFIGURATION, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_SENSORS_ALERT_CONFIGURATION, reg_value, UNA_REGISTER_MASK_ALL);
+    NODE_read_nvm(SM_REGISTER_ADDRESS_SENSORS_CONFIGURATION, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_SENSORS_CONFIGURATION, reg_value, UNA_REGISTER_MASK_ALL);
+    sm_ctx.sensors_temperature_alert_flag = 0;
+    sm_ctx.sensors_humidity_alert_flag = 0;
+    // Start periodic mode if enabled.
+    status = _SM_configure_sensors();
+    if (status != NODE_SUCCESS) goto errors;
+#endif
+#ifdef SM_LOGGER_ENABLE
+    // Recover records and load configuration from NVM.
+    status = _SM_init_logger();
+    if (status != NODE_SUCCESS) goto errors;
+    NODE_read_nvm(SM_REGISTER_ADDRESS_LOGGER_CONFIGURATION, &reg_value);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_LOGGER_CONFIGURATION, reg_value, UNA_REGISTER_MASK_ALL);
+#endif
+#ifdef SM_AIN_ENABLE
+    // Load analog inputs configuration from NVM.
+    for (idx = 0; idx < SM_AIN_NUMBER; idx++) {
+        NODE_read_nvm((SM_REGISTER_ADDRESS_AIN_CONFIGURATION_0 + idx), &reg_value);
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (SM_REGISTER_ADDRESS_AIN_CONFIGURATION_0 + idx), reg_value, UNA_REGISTER_MASK_ALL);
+        status = _SM_configure_ain(idx);
+        // Use default front-end if the stored configuration is invalid.
+        if (status != NODE_SUCCESS) {
+            NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (SM_REGISTER_ADDRESS_AIN_CONFIGURATION_0 + idx), _SM_get_ain_default_configuration(idx), UNA_REGISTER_MASK_ALL);
+            status = _SM_configure_ain(idx);
+            if (status != NODE_SUCCESS) goto errors;
+        }
+    }
+#endif
     // Read init state.
     status = SM_update_register(SM_REGISTER_ADDRESS_CONFIGURATION_0);
     if (status != NODE_SUCCESS) goto errors;
@@ -87,6 +955,21 @@ NODE_status_t SM_update_register(uint8_t reg_addr) {
     NODE_status_t status = NODE_SUCCESS;
     uint32_t reg_value = 0;
     uint32_t reg_mask = 0;
+#ifdef SM_AIN_ENABLE
+    uint32_t reg_ain_configuration = 0;
+    uint8_t idx = 0;
+#endif
+#ifdef SM_LOGGER_ENABLE
+    uint32_t record[SM_LOGGER_RECORD_SIZE_WORDS];
+    uint32_t reg_read_pointer = 0;
+    uint16_t record_index = 0;
+#endif
+#ifdef SM_DIO_ENABLE
+    DIGITAL_status_t digital_status = DIGITAL_SUCCESS;
+    DIGITAL_channel_t channel = DIGITAL_CHANNEL_DIO0;
+    uint32_t reg_configuration = 0;
+    uint32_t count = 0;
+#endif
     // Check address.
     switch (reg_addr) {
     case SM_REGISTER_ADDRESS_CONFIGURATION_0:
@@ -111,18 +994,71 @@ NODE_status_t SM_update_register(uint8_t reg_addr) {
         break;
 #ifdef SM_AIN_ENABLE
     case SM_REGISTER_ADDRESS_CONFIGURATION_1:
-        // Analog inputs type and gain.
-        SWREG_write_field(&reg_value, &reg_mask, ((SM_AIN0_GAIN_TYPE == ANALOG_GAIN_TYPE_AMPLIFICATION) ? 0b1 : 0b0), SM_REGISTER_CONFIGURATION_1_MASK_AI0T);
-        SWREG_write_field(&reg_value, &reg_mask, SM_AIN0_GAIN, SM_REGISTER_CONFIGURATION_1_MASK_AI0G);
-        SWREG_write_field(&reg_value, &reg_mask, ((SM_AIN1_GAIN_TYPE == ANALOG_GAIN_TYPE_AMPLIFICATION) ? 0b1 : 0b0), SM_REGISTER_CONFIGURATION_1_MASK_AI1T);
-        SWREG_write_field(&reg_value, &reg_mask, SM_AIN1_GAIN, SM_REGISTER_CONFIGURATION_1_MASK_AI1G);
-        break;
     case SM_REGISTER_ADDRESS_CONFIGURATION_2:
         // Analog inputs type and gain.
-        SWREG_write_field(&reg_value, &reg_mask, ((SM_AIN2_GAIN_TYPE == ANALOG_GAIN_TYPE_AMPLIFICATION) ? 0b1 : 0b0), SM_REGISTER_CONFIGURATION_2_MASK_AI2T);
-        SWREG_write_field(&reg_value, &reg_mask, SM_AIN2_GAIN, SM_REGISTER_CONFIGURATION_2_MASK_AI2G);
-        SWREG_write_field(&reg_value, &reg_mask, ((SM_AIN2_GAIN_TYPE == ANALOG_GAIN_TYPE_AMPLIFICATION) ? 0b1 : 0b0), SM_REGISTER_CONFIGURATION_2_MASK_AI3T);
-        SWREG_write_field(&reg_value, &reg_mask, SM_AIN2_GAIN, SM_REGISTER_CONFIGURATION_2_MASK_AI3G);
+        for (idx = 0; idx < SM_AIN_NUMBER; idx++) {
+            // Check register.
+            if (SM_AIN_CONFIGURATION_REGISTER_ADDRESS[idx] != reg_addr) continue;
+            status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, (SM_REGISTER_ADDRESS_AIN_CONFIGURATION_0 + idx), &reg_ain_configuration);
+            if (status != NODE_SUCCESS) goto errors;
+            SWREG_write_field(&reg_value, &reg_mask, SWREG_read_field(reg_ain_configuration, SM_REGISTER_AIN_CONFIGURATION_MASK_GT), SM_AIN_CONFIGURATION_GAIN_TYPE_MASK[idx]);
+            SWREG_write_field(&reg_value, &reg_mask, SWREG_read_field(reg_ain_configuration, SM_REGISTER_AIN_CONFIGURATION_MASK_GAIN), SM_AIN_CONFIGURATION_GAIN_MASK[idx]);
+        }
+        break;
+#endif
+#ifdef SM_DIO_ENABLE
+    case SM_REGISTER_ADDRESS_DIO_COUNTER_0:
+    case SM_REGISTER_ADDRESS_DIO_COUNTER_1:
+    case SM_REGISTER_ADDRESS_DIO_COUNTER_2:
+    case SM_REGISTER_ADDRESS_DIO_COUNTER_3:
+        // Read configuration.
+        status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIO_COUNTER_CONFIGURATION, &reg_configuration);
+        if (status != NODE_SUCCESS) goto errors;
+        channel = (DIGITAL_channel_t) (reg_addr - SM_REGISTER_ADDRESS_DIO_COUNTER_0);
+        // Read counter and clear it if required.
+        digital_status = DIGITAL_read_counter(channel, (uint8_t) SWREG_read_field(reg_configuration, SM_DIO_COUNTER_RCEN_MASK[channel]), &count);
+        DIGITAL_exit_error(NODE_ERROR_BASE_DIGITAL);
+        SWREG_write_field(&reg_value, &reg_mask, count, SM_REGISTER_DIO_COUNTER_MASK_COUNT);
+        break;
+#endif
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+    case SM_REGISTER_ADDRESS_SENSORS_STATUS:
+        // Current alerts.
+        SWREG_write_field(&reg_value, &reg_mask, sm_ctx.sensors_periodic_running, SM_REGISTER_SENSORS_STATUS_MASK_PMST);
+        SWREG_write_field(&reg_value, &reg_mask, sm_ctx.sensors_alert.temperature_alert, SM_REGISTER_SENSORS_STATUS_MASK_TA);
+        SWREG_write_field(&reg_value, &reg_mask, sm_ctx.sensors_alert.humidity_alert, SM_REGISTER_SENSORS_STATUS_MASK_HA);
+        // Thresholds crossings since last read.
+        SWREG_write_field(&reg_value, &reg_mask, sm_ctx.sensors_temperature_alert_flag, SM_REGISTER_SENSORS_STATUS_MASK_TAF);
+        SWREG_write_field(&reg_value, &reg_mask, sm_ctx.sensors_humidity_alert_flag, SM_REGISTER_SENSORS_STATUS_MASK_HAF);
+        sm_ctx.sensors_temperature_alert_flag = 0;
+        sm_ctx.sensors_humidity_alert_flag = 0;
+        break;
+#endif
+#ifdef SM_LOGGER_ENABLE
+    case SM_REGISTER_ADDRESS_LOGGER_STATUS:
+        SWREG_write_field(&reg_value, &reg_mask, SM_LOGGER_get_count(), SM_REGISTER_LOGGER_STATUS_MASK_COUNT);
+        SWREG_write_field(&reg_value, &reg_mask, SM_LOGGER_get_capacity(), SM_REGISTER_LOGGER_STATUS_MASK_CAPACITY);
+        break;
+    case SM_REGISTER_ADDRESS_LOGGER_TIME:
+        SWREG_write_field(&reg_value, &reg_mask, _SM_get_logger_time_seconds(), SM_REGISTER_LOGGER_TIME_MASK_TIME);
+        break;
+    case SM_REGISTER_ADDRESS_LOGGER_RECORD_0:
+    case SM_REGISTER_ADDRESS_LOGGER_RECORD_1:
+    case SM_REGISTER_ADDRESS_LOGGER_RECORD_2:
+    case SM_REGISTER_ADDRESS_LOGGER_RECORD_3:
+    case SM_REGISTER_ADDRESS_LOGGER_RECORD_4:
+        // Read record pointed by the window.
+        status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_LOGGER_READ_POINTER, &reg_read_pointer);
+        if (status != NODE_SUCCESS) goto errors;
+        record_index = (uint16_t) SWREG_read_field(reg_read_pointer, SM_REGISTER_LOGGER_READ_POINTER_MASK_INDEX);
+        status = SM_LOGGER_read(record_index, record);
+        if (status != NODE_SUCCESS) goto errors;
+        reg_value = record[reg_addr - SM_REGISTER_ADDRESS_LOGGER_RECORD_0];
+        reg_mask = UNA_REGISTER_MASK_ALL;
+        // Move to next record after the last word.
+        if ((reg_addr == SM_REGISTER_ADDRESS_LOGGER_RECORD_4) && (record_index < SM_LOGGER_get_count())) {
+            NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_LOGGER_READ_POINTER, (uint32_t) (record_index + 1), SM_REGISTER_LOGGER_READ_POINTER_MASK_INDEX);
+        }
         break;
 #endif
     default:
@@ -130,6 +1066,9 @@ NODE_status_t SM_update_register(uint8_t reg_addr) {
         break;
     }
     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, reg_value, reg_mask);
+#if ((defined SM_AIN_ENABLE) || (defined SM_DIO_ENABLE) || (defined SM_LOGGER_ENABLE))
+errors:
+#endif
     return status;
 }
 
@@ -137,9 +1076,121 @@ NODE_status_t SM_update_register(uint8_t reg_addr) {
 NODE_status_t SM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
+#ifdef SM_DIO_ENABLE
+    DIGITAL_status_t digital_status = DIGITAL_SUCCESS;
+    uint8_t idx = 0;
+#endif
+#if ((defined SM_AIN_ENABLE) || (defined SM_DIO_ENABLE) || (defined SM_DIGITAL_SENSORS_ENABLE) || (defined SM_LOGGER_ENABLE))
+    uint32_t reg_value = 0;
+    // Read register.
+    status = NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, &reg_value);
+    if (status != NODE_SUCCESS) goto errors;
+    // Check address.
+    switch (reg_addr) {
+#ifdef SM_AIN_ENABLE
+    case SM_REGISTER_ADDRESS_AIN_CONFIGURATION_0:
+    case SM_REGISTER_ADDRESS_AIN_CONFIGURATION_1:
+    case SM_REGISTER_ADDRESS_AIN_CONFIGURATION_2:
+    case SM_REGISTER_ADDRESS_AIN_CONFIGURATION_3:
+        // Update conversion scale, invalid settings are not stored.
+        status = _SM_configure_ain(reg_addr - SM_REGISTER_ADDRESS_AIN_CONFIGURATION_0);
+        if (status != NODE_SUCCESS) goto errors;
+        // Store new value in NVM.
+        if (reg_mask != 0) {
+            NODE_write_nvm(reg_addr, reg_value);
+        }
+        break;
+#endif
+#ifdef SM_DIO_ENABLE
+    case SM_REGISTER_ADDRESS_DIO_COUNTER_CONFIGURATION:
+    case SM_REGISTER_ADDRESS_DIO_COUNTER_DEBOUNCE:
+        // Store new value in NVM.
+        if (reg_mask != 0) {
+            NODE_write_nvm(reg_addr, reg_value);
+        }
+        // Update counters.
+        status = _SM_configure_dio_counters();
+        if (status != NODE_SUCCESS) goto errors;
+        break;
+    case SM_REGISTER_ADDRESS_DIO_MEASUREMENT_CONFIGURATION:
+        // Store new value in NVM.
+        if (reg_mask != 0) {
+            NODE_write_nvm(reg_addr, reg_value);
+        }
+        // Abort current window and restart with the new configuration.
+        if (sm_ctx.dio_measurement_channels != 0) {
+            status = _SM_stop_dio_measurements();
+            if (status != NODE_SUCCESS) goto errors;
+        }
+        _SM_reset_dio_measurements();
+        sm_ctx.dio_measurement_next_time_seconds = RTC_get_uptime_seconds();
+        break;
+    case SM_REGISTER_ADDRESS_DIO_COUNTER_CONTROL:
+        // Channels loop.
+        for (idx = 0; idx < DIGITAL_CHANNEL_LAST; idx++) {
+            // CLRx.
+            if ((reg_mask & SM_DIO_COUNTER_CLR_MASK[idx]) == 0) continue;
+            // Read bit.
+            if (SWREG_read_field(reg_value, SM_DIO_COUNTER_CLR_MASK[idx]) != 0) {
+                // Clear request.
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_DIO_COUNTER_CONTROL, 0b0, SM_DIO_COUNTER_CLR_MASK[idx]);
+                // Reset counter.
+                digital_status = DIGITAL_set_counter((DIGITAL_channel_t) idx, 0);
+                DIGITAL_exit_error(NODE_ERROR_BASE_DIGITAL);
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (SM_REGISTER_ADDRESS_DIO_COUNTER_0 + idx), 0, UNA_REGISTER_MASK_ALL);
+                // Save new value.
+                status = NODE_write_nvm((SM_REGISTER_ADDRESS_DIO_COUNTER_0 + idx), 0);
+                if (status != NODE_SUCCESS) goto errors;
+                sm_ctx.dio_counter_saved[idx] = 0;
+            }
+        }
+        break;
+#endif
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+    case SM_REGISTER_ADDRESS_SENSORS_CONFIGURATION:
+    case SM_REGISTER_ADDRESS_SENSORS_ALERT_CONFIGURATION:
+        // Store new value in NVM.
+        if (reg_mask != 0) {
+            NODE_write_nvm(reg_addr, reg_value);
+        }
+        // Restart acquisition with new settings.
+        status = _SM_configure_sensors();
+        if (status != NODE_SUCCESS) goto errors;
+        break;
+#endif
+#ifdef SM_LOGGER_ENABLE
+    case SM_REGISTER_ADDRESS_LOGGER_CONFIGURATION:
+        // Store new value in NVM.
+        if (reg_mask != 0) {
+            NODE_write_nvm(reg_addr, reg_value);
+        }
+        // Restart schedule with a record.
+        sm_ctx.logger_next_time_seconds = RTC_get_uptime_seconds();
+        break;
+    case SM_REGISTER_ADDRESS_LOGGER_CONTROL:
+        // CLR.
+        if ((reg_mask & SM_REGISTER_LOGGER_CONTROL_MASK_CLR) != 0) {
+            // Read bit.
+            if (SWREG_read_field(reg_value, SM_REGISTER_LOGGER_CONTROL_MASK_CLR) != 0) {
+                // Clear request.
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_LOGGER_CONTROL, 0b0, SM_REGISTER_LOGGER_CONTROL_MASK_CLR);
+                // Erase records.
+                status = SM_LOGGER_clear();
+                if (status != NODE_SUCCESS) goto errors;
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_LOGGER_READ_POINTER, 0, UNA_REGISTER_MASK_ALL);
+            }
+        }
+        break;
+#endif
+    default:
+        break;
+    }
+errors:
+#else
     // None control bit in SM registers.
     UNUSED(reg_addr);
     UNUSED(reg_mask);
+#endif
     return status;
 }
 
@@ -162,11 +1213,13 @@ NODE_status_t SM_mtrg_callback(void) {
     uint32_t reg_digital_data_mask = 0;
 #endif
 #ifdef SM_DIGITAL_SENSORS_ENABLE
-    SHT3X_status_t sht3x_status = SHT3X_SUCCESS;
     int32_t tamb_degrees = 0;
     int32_t hamb_percent = 0;
     uint32_t reg_analog_data_3 = 0;
     uint32_t reg_analog_data_3_mask = 0;
+    uint32_t reg_sensors_data = 0;
+    uint32_t reg_sensors_data_mask = 0;
+    uint8_t idx = 0;
 #endif
     // Reset results.
     _SM_reset_analog_data();
@@ -217,14 +1270,36 @@ NODE_status_t SM_mtrg_callback(void) {
 #endif
 #ifdef SM_DIGITAL_SENSORS_ENABLE
     // Turn sensors on.
-    POWER_enable(POWER_REQUESTER_ID_SM, POWER_DOMAIN_SENSORS, LPTIM_DELAY_MODE_STOP);
-    // TAMB.
-    sht3x_status = SHT3X_get_temperature_humidity(I2C_ADDRESS_SHT30, &tamb_degrees, &hamb_percent);
-    SHT3X_exit_error(NODE_ERROR_BASE_SHT3X);
-    SWREG_write_field(&reg_analog_data_3, &reg_analog_data_3_mask, UNA_convert_degrees(tamb_degrees), SM_REGISTER_ANALOG_DATA_3_MASK_TAMB);
-    SWREG_write_field(&reg_analog_data_3, &reg_analog_data_3_mask, (uint32_t) hamb_percent, SM_REGISTER_ANALOG_DATA_3_MASK_HAMB);
-    // Write register.
-    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_ANALOG_DATA_3, reg_analog_data_3, reg_analog_data_3_mask);
+    if (sm_ctx.sensors_detected_mask != 0) {
+        POWER_enable(POWER_REQUESTER_ID_SM, POWER_DOMAIN_SENSORS, LPTIM_DELAY_MODE_STOP);
+    }
+    // Detected sensors loop.
+    for (idx = 0; idx < SM_DIGITAL_SENSORS_TABLE_SIZE; idx++) {
+        // Skip missing sensors.
+        if ((sm_ctx.sensors_detected_mask & (0b1 << idx)) == 0) continue;
+        if ((idx == sm_ctx.sensors_main_index) && (sm_ctx.sensors_periodic_running != 0)) {
+            // Directly use the last periodic result.
+            if (sm_ctx.sensors_data_valid == 0) continue;
+            tamb_degrees = sm_ctx.sensors_tamb_degrees;
+            hamb_percent = sm_ctx.sensors_hamb_percent;
+        }
+        else {
+            // Single shot measurement.
+            status = SM_DIGITAL_SENSORS[idx].read(SM_DIGITAL_SENSORS[idx].i2c_address, &tamb_degrees, &hamb_percent);
+            if (status != NODE_SUCCESS) goto errors;
+        }
+        // Sensor data.
+        reg_sensors_data = 0;
+        reg_sensors_data_mask = 0;
+        SWREG_write_field(&reg_sensors_data, &reg_sensors_data_mask, UNA_convert_degrees(tamb_degrees), SM_REGISTER_SENSORS_DATA_MASK_TAMB);
+        SWREG_write_field(&reg_sensors_data, &reg_sensors_data_mask, (uint32_t) hamb_percent, SM_REGISTER_SENSORS_DATA_MASK_HAMB);
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_SENSORS_DATA_REGISTER_ADDRESS[idx], reg_sensors_data, reg_sensors_data_mask);
+        // Main sensor also feeds the common TAMB and HAMB fields.
+        if (idx != sm_ctx.sensors_main_index) continue;
+        SWREG_write_field(&reg_analog_data_3, &reg_analog_data_3_mask, UNA_convert_degrees(tamb_degrees), SM_REGISTER_ANALOG_DATA_3_MASK_TAMB);
+        SWREG_write_field(&reg_analog_data_3, &reg_analog_data_3_mask, (uint32_t) hamb_percent, SM_REGISTER_ANALOG_DATA_3_MASK_HAMB);
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, SM_REGISTER_ADDRESS_ANALOG_DATA_3, reg_analog_data_3, reg_analog_data_3_mask);
+    }
 #endif
 errors:
 #ifdef SM_DIO_ENABLE
@@ -236,4 +1311,51 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+NODE_status_t SM_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+#ifdef SM_AIN_ENABLE
+    // Background analog inputs filtering.
+    status = _SM_ain_filter_process();
+    if (status != NODE_SUCCESS) goto errors;
+#endif
+#ifdef SM_DIO_ENABLE
+    // Check save period.
+    if (RTC_get_uptime_seconds() >= sm_ctx.dio_counter_next_save_time_seconds) {
+        // Update next time.
+        sm_ctx.dio_counter_next_save_time_seconds = RTC_get_uptime_seconds() + SM_DIO_COUNTER_SAVE_PERIOD_SECONDS;
+        // Save counters which have changed.
+        status = _SM_save_dio_counters();
+        if (status != NODE_SUCCESS) goto errors;
+    }
+    // Frequency and duty cycle measurements.
+    status = _SM_dio_measurement_process();
+    if (status != NODE_SUCCESS) goto errors;
+#endif
+#ifdef SM_DIGITAL_SENSORS_ENABLE
+    // Periodic temperature and humidity.
+    status = _SM_sensors_process();
+    if (status != NODE_SUCCESS) goto errors;
+#endif
+#ifdef SM_LOGGER_ENABLE
+    // Autonomous data logging.
+    status = _SM_logger_process();
+    if (status != NODE_SUCCESS) goto errors;
+#endif
+#if ((defined SM_AIN_ENABLE) || (defined SM_DIO_ENABLE) || (defined SM_DIGITAL_SENSORS_ENABLE) || (defined SM_LOGGER_ENABLE))
+errors:
+#endif
+    return status;
+}
+
+/*******************************************************************/
+uint8_t SM_is_dio_measurement_running(void) {
+#ifdef SM_DIO_ENABLE
+    return ((sm_ctx.dio_measurement_channels != 0) ? 1 : 0);
+#else
+    return 0;
+#endif
+}
+
 #endif /* SM */
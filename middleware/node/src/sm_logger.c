@@ -0,0 +1,257 @@
+/*
+ * sm_logger.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "sm_logger.h"
+
+#include "error.h"
+#include "node.h"
+#include "nvm.h"
+#include "nvm_address.h"
+#include "types.h"
+#include "xm_flags.h"
+
+#if ((defined SM) && (defined SM_LOGGER_ENABLE))
+
+/*** SM LOGGER local macros ***/
+
+#define SM_LOGGER_RECORD_SIZE_BYTES     (SM_LOGGER_RECORD_SIZE_WORDS << 2)
+#define SM_LOGGER_CAPACITY              (SM_LOGGER_NVM_SIZE_BYTES / SM_LOGGER_RECORD_SIZE_BYTES)
+
+// Sequence field is located in the two first bytes of the record and checksum in the third one.
+#define SM_LOGGER_SEQUENCE_BYTE_INDEX   0
+#define SM_LOGGER_CHECKSUM_BYTE_INDEX   2
+
+#define SM_LOGGER_SEQUENCE_EMPTY        0
+#define SM_LOGGER_SEQUENCE_MAX          0xFFFF
+
+#define SM_LOGGER_SLOT_NONE             0xFFFF
+
+/*** SM LOGGER local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint16_t count;
+    uint16_t write_slot;
+    uint16_t next_sequence;
+} SM_LOGGER_context_t;
+
+/*** SM LOGGER local global variables ***/
+
+static SM_LOGGER_context_t sm_logger_ctx;
+
+/*** SM LOGGER local functions ***/
+
+/*******************************************************************/
+static uint16_t _SM_LOGGER_get_next_sequence(uint16_t sequence) {
+    // Skip empty value on roll-over.
+    return ((sequence >= SM_LOGGER_SEQUENCE_MAX) ? 1 : (sequence + 1));
+}
+
+/*******************************************************************/
+static NVM_address_t _SM_LOGGER_get_address(uint16_t slot, uint8_t byte_index) {
+    return ((NVM_address_t) (NVM_ADDRESS_SM_LOGGER + (slot * SM_LOGGER_RECORD_SIZE_BYTES) + byte_index));
+}
+
+/*******************************************************************/
+static uint8_t _SM_LOGGER_compute_checksum(uint8_t* record_bytes) {
+    // Local variables.
+    uint8_t checksum = 0;
+    uint8_t idx = 0;
+    // Bytes loop.
+    for (idx = 0; idx < SM_LOGGER_RECORD_SIZE_BYTES; idx++) {
+        if (idx == SM_LOGGER_CHECKSUM_BYTE_INDEX) continue;
+        checksum += record_bytes[idx];
+    }
+    // Complement so that an erased record is never valid.
+    return ((uint8_t) (~checksum));
+}
+
+/*******************************************************************/
+static NODE_status_t _SM_LOGGER_read_slot(uint16_t slot, uint8_t* record_bytes, uint16_t* sequence) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    NVM_status_t nvm_status = NVM_SUCCESS;
+    uint8_t idx = 0;
+    // Read record.
+    for (idx = 0; idx < SM_LOGGER_RECORD_SIZE_BYTES; idx++) {
+        nvm_status = NVM_read_byte(_SM_LOGGER_get_address(slot, idx), &(record_bytes[idx]));
+        NVM_exit_error(NODE_ERROR_BASE_NVM);
+    }
+    (*sequence) = (uint16_t) (record_bytes[SM_LOGGER_SEQUENCE_BYTE_INDEX] | (record_bytes[SM_LOGGER_SEQUENCE_BYTE_INDEX + 1] << 8));
+    // Corrupted records are considered as empty.
+    if (_SM_LOGGER_compute_checksum(record_bytes) != record_bytes[SM_LOGGER_CHECKSUM_BYTE_INDEX]) {
+        (*sequence) = SM_LOGGER_SEQUENCE_EMPTY;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NODE_status_t _SM_LOGGER_erase_slot(uint16_t slot) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    NVM_status_t nvm_status = NVM_SUCCESS;
+    // Reset sequence field.
+    nvm_status = NVM_write_byte(_SM_LOGGER_get_address(slot, SM_LOGGER_SEQUENCE_BYTE_INDEX), SM_LOGGER_SEQUENCE_EMPTY);
+    NVM_exit_error(NODE_ERROR_BASE_NVM);
+    nvm_status = NVM_write_byte(_SM_LOGGER_get_address(slot, (SM_LOGGER_SEQUENCE_BYTE_INDEX + 1)), SM_LOGGER_SEQUENCE_EMPTY);
+    NVM_exit_error(NODE_ERROR_BASE_NVM);
+errors:
+    return status;
+}
+
+/*** SM LOGGER functions ***/
+
+/*******************************************************************/
+NODE_status_t SM_LOGGER_init(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint8_t record_bytes[SM_LOGGER_RECORD_SIZE_BYTES];
+    uint16_t slot_sequence[SM_LOGGER_CAPACITY];
+    uint16_t head_slot = SM_LOGGER_SLOT_NONE;
+    uint16_t previous_slot = 0;
+    uint16_t slot = 0;
+    // Init context.
+    sm_logger_ctx.count = 0;
+    sm_logger_ctx.write_slot = 0;
+    sm_logger_ctx.next_sequence = _SM_LOGGER_get_next_sequence(SM_LOGGER_SEQUENCE_EMPTY);
+    // Read all sequence numbers.
+    for (slot = 0; slot < SM_LOGGER_CAPACITY; slot++) {
+        status = _SM_LOGGER_read_slot(slot, record_bytes, &(slot_sequence[slot]));
+        if (status != NODE_SUCCESS) goto errors;
+    }
+    // Newest record is the one which is not followed by its successor.
+    for (slot = 0; slot < SM_LOGGER_CAPACITY; slot++) {
+        if (slot_sequence[slot] == SM_LOGGER_SEQUENCE_EMPTY) continue;
+        if (slot_sequence[(slot + 1) % SM_LOGGER_CAPACITY] != _SM_LOGGER_get_next_sequence(slot_sequence[slot])) {
+            head_slot = slot;
+        }
+    }
+    // Check if the store is empty.
+    if (head_slot == SM_LOGGER_SLOT_NONE) goto errors;
+    // Count chained records backward.
+    slot = head_slot;
+    sm_logger_ctx.count = 1;
+    while (sm_logger_ctx.count < SM_LOGGER_CAPACITY) {
+        previous_slot = ((slot + SM_LOGGER_CAPACITY - 1) % SM_LOGGER_CAPACITY);
+        if (slot_sequence[previous_slot] == SM_LOGGER_SEQUENCE_EMPTY) break;
+        if (_SM_LOGGER_get_next_sequence(slot_sequence[previous_slot]) != slot_sequence[slot]) break;
+        slot = previous_slot;
+        sm_logger_ctx.count++;
+    }
+    sm_logger_ctx.write_slot = ((head_slot + 1) % SM_LOGGER_CAPACITY);
+    sm_logger_ctx.next_sequence = _SM_LOGGER_get_next_sequence(slot_sequence[head_slot]);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+NODE_status_t SM_LOGGER_append(uint32_t* record) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    NVM_status_t nvm_status = NVM_SUCCESS;
+    uint8_t record_bytes[SM_LOGGER_RECORD_SIZE_BYTES];
+    uint8_t idx = 0;
+    // Check parameter.
+    if (record == NULL) {
+        status = NODE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Build record.
+    for (idx = 0; idx < SM_LOGGER_RECORD_SIZE_BYTES; idx++) {
+        record_bytes[idx] = (uint8_t) ((record[idx >> 2] >> ((idx & 0x03) << 3)) & 0xFF);
+    }
+    record_bytes[SM_LOGGER_SEQUENCE_BYTE_INDEX] = (uint8_t) ((sm_logger_ctx.next_sequence >> 0) & 0xFF);
+    record_bytes[SM_LOGGER_SEQUENCE_BYTE_INDEX + 1] = (uint8_t) ((sm_logger_ctx.next_sequence >> 8) & 0xFF);
+    record_bytes[SM_LOGGER_CHECKSUM_BYTE_INDEX] = _SM_LOGGER_compute_checksum(record_bytes);
+    // Invalidate slot first so that an interrupted write is discarded on recovery.
+    status = _SM_LOGGER_erase_slot(sm_logger_ctx.write_slot);
+    if (status != NODE_SUCCESS) goto errors;
+    // Write payload.
+    for (idx = 0; idx < SM_LOGGER_RECORD_SIZE_BYTES; idx++) {
+        if ((idx == SM_LOGGER_SEQUENCE_BYTE_INDEX) || (idx == (SM_LOGGER_SEQUENCE_BYTE_INDEX + 1)) || (idx == SM_LOGGER_CHECKSUM_BYTE_INDEX)) continue;
+        nvm_status = NVM_write_byte(_SM_LOGGER_get_address(sm_logger_ctx.write_slot, idx), record_bytes[idx]);
+        NVM_exit_error(NODE_ERROR_BASE_NVM);
+    }
+    // Commit record with checksum and sequence.
+    nvm_status = NVM_write_byte(_SM_LOGGER_get_address(sm_logger_ctx.write_slot, SM_LOGGER_CHECKSUM_BYTE_INDEX), record_bytes[SM_LOGGER_CHECKSUM_BYTE_INDEX]);
+    NVM_exit_error(NODE_ERROR_BASE_NVM);
+    nvm_status = NVM_write_byte(_SM_LOGGER_get_address(sm_logger_ctx.write_slot, SM_LOGGER_SEQUENCE_BYTE_INDEX), record_bytes[SM_LOGGER_SEQUENCE_BYTE_INDEX]);
+    NVM_exit_error(NODE_ERROR_BASE_NVM);
+    nvm_status = NVM_write_byte(_SM_LOGGER_get_address(sm_logger_ctx.write_slot, (SM_LOGGER_SEQUENCE_BYTE_INDEX + 1)), record_bytes[SM_LOGGER_SEQUENCE_BYTE_INDEX + 1]);
+    NVM_exit_error(NODE_ERROR_BASE_NVM);
+    // Update context.
+    sm_logger_ctx.write_slot = ((sm_logger_ctx.write_slot + 1) % SM_LOGGER_CAPACITY);
+    sm_logger_ctx.next_sequence = _SM_LOGGER_get_next_sequence(sm_logger_ctx.next_sequence);
+    if (sm_logger_ctx.count < SM_LOGGER_CAPACITY) {
+        sm_logger_ctx.count++;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+NODE_status_t SM_LOGGER_read(uint16_t record_index, uint32_t* record) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint8_t record_bytes[SM_LOGGER_RECORD_SIZE_BYTES];
+    uint16_t sequence = SM_LOGGER_SEQUENCE_EMPTY;
+    uint16_t slot = 0;
+    uint8_t idx = 0;
+    // Check parameter.
+    if (record == NULL) {
+        status = NODE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Reset output.
+    for (idx = 0; idx < SM_LOGGER_RECORD_SIZE_WORDS; idx++) {
+        record[idx] = 0;
+    }
+    // Check index.
+    if (record_index >= sm_logger_ctx.count) goto errors;
+    // Convert to slot.
+    slot = ((sm_logger_ctx.write_slot + SM_LOGGER_CAPACITY - sm_logger_ctx.count + record_index) % SM_LOGGER_CAPACITY);
+    status = _SM_LOGGER_read_slot(slot, record_bytes, &sequence);
+    if (status != NODE_SUCCESS) goto errors;
+    if (sequence == SM_LOGGER_SEQUENCE_EMPTY) goto errors;
+    // Build words.
+    for (idx = 0; idx < SM_LOGGER_RECORD_SIZE_BYTES; idx++) {
+        record[idx >> 2] |= ((uint32_t) record_bytes[idx]) << ((idx & 0x03) << 3);
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+NODE_status_t SM_LOGGER_clear(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint16_t slot = 0;
+    // Slots loop.
+    for (slot = 0; slot < SM_LOGGER_CAPACITY; slot++) {
+        status = _SM_LOGGER_erase_slot(slot);
+        if (status != NODE_SUCCESS) goto errors;
+    }
+    // Reset context.
+    sm_logger_ctx.count = 0;
+    sm_logger_ctx.write_slot = 0;
+    sm_logger_ctx.next_sequence = _SM_LOGGER_get_next_sequence(SM_LOGGER_SEQUENCE_EMPTY);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+uint16_t SM_LOGGER_get_count(void) {
+    return (sm_logger_ctx.count);
+}
+
+/*******************************************************************/
+uint16_t SM_LOGGER_get_capacity(void) {
+    return (SM_LOGGER_CAPACITY);
+}
+
+#endif /* SM and SM_LOGGER_ENABLE */
@@ -14,11 +14,14 @@
 #include "node.h"
 #include "nvm.h"
 #include "nvm_address.h"
+#include "rtc.h"
 #include "s2lp.h"
 #include "swreg.h"
 #include "una.h"
+#include "xm_flags.h"
 #include "manuf/mcu_api.h"
 #include "manuf/rf_api.h"
+#include "rf_api_ext.h"
 #include "sigfox_ep_addon_rfp_api.h"
 #include "sigfox_ep_api.h"
 #include "sigfox_rc.h"
@@ -34,6 +37,21 @@
 #define UHFM_ADC_MEASUREMENTS_RF_FREQUENCY_HZ       830000000
 #define UHFM_ADC_RADIO_STABILIZATION_DELAY_MS       100
 
+#define UHFM_PER_NUMBER_OF_ITERATIONS_DEFAULT_VALUE 10
+#define UHFM_PER_PERIOD_SECONDS_DEFAULT_VALUE       10
+// Each iteration runs one blocking RFP test mode from the main loop: the bus is not served during the test frames and,
+// in bidirectional mode, during the downlink window (up to 25 seconds). The period guarantees the node answers between two iterations.
+#define UHFM_PER_PERIOD_SECONDS_MIN                 10
+
+#define UHFM_STATISTICS_COUNTER_MAX                 0xFFFF
+#define UHFM_STATISTICS_NUMBER_OF_REGISTERS         (UHFM_REGISTER_ADDRESS_STATISTICS_4 - UHFM_REGISTER_ADDRESS_STATISTICS_0)
+
+// Work arena budget of each board (STM32L041K6 with 8kB of RAM on HW1.0).
+// Note: the actual size is reported as the uhfm_work_arena symbol size (arm-none-eabi-nm -S) since objects are built with -fdata-sections.
+#ifdef HW1_0
+#define UHFM_WORK_ARENA_SIZE_MAX_BYTES              256
+#endif
+
 /*** UHFM local structures ***/
 
 /*******************************************************************/
@@ -41,13 +59,77 @@ typedef union {
     struct {
         unsigned cwen :1;
         unsigned rsen :1;
+        unsigned per :1;
+        unsigned per_bidirectional :1;
     };
     uint8_t all;
 } UHFM_flags_t;
 
+/*******************************************************************/
+typedef struct {
+    uint16_t number_of_iterations;
+    uint16_t iteration;
+    uint32_t period_seconds;
+    uint32_t next_time_seconds;
+    uint16_t ul_frame_count;
+    uint16_t dl_frame_count;
+    uint16_t dl_error_count;
+    uint16_t dl_crc_error_count;
+    int32_t dl_rssi_sum;
+    int16_t dl_rssi_min;
+    int16_t dl_rssi_max;
+    int16_t dl_rssi_last;
+} UHFM_per_context_t;
+
+/*******************************************************************/
+typedef struct {
+    uint8_t history_index;
+    uint8_t history_count;
+    uint16_t ul_message_count;
+    uint16_t ul_success_count;
+    uint16_t dl_request_count;
+    uint16_t dl_success_count;
+    int32_t dl_rssi_sum;
+    int16_t dl_rssi_min;
+    int16_t dl_rssi_max;
+    uint32_t saved[UHFM_STATISTICS_NUMBER_OF_REGISTERS];
+    uint32_t next_save_time_seconds;
+} UHFM_statistics_context_t;
+
+/*******************************************************************/
+typedef union {
+    // Sigfox message (STRG).
+    struct {
+        SIGFOX_EP_API_config_t lib_config;
+        SIGFOX_EP_API_application_message_t application_message;
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+        SIGFOX_EP_API_control_message_t control_message;
+#endif
+        sfx_u8 ul_payload[SIGFOX_UL_PAYLOAD_MAX_SIZE_BYTES];
+        sfx_u8 dl_payload[SIGFOX_DL_PAYLOAD_SIZE_BYTES];
+        sfx_u8 nvm_data[SIGFOX_NVM_DATA_SIZE_BYTES];
+    } send;
+    // Sigfox RFP test mode (TTRG and PER campaign).
+    struct {
+        SIGFOX_EP_ADDON_RFP_API_config_t addon_config;
+        SIGFOX_EP_ADDON_RFP_API_test_mode_t test_mode;
+        sfx_u8 dl_phy_content[SIGFOX_DL_PHY_CONTENT_SIZE_BYTES];
+    } test;
+    // Radio test modes (CWEN and RSEN).
+    struct {
+        RF_API_radio_parameters_t radio_params;
+    } radio;
+} UHFM_work_arena_t;
+
+_Static_assert(sizeof(UHFM_work_arena_t) <= UHFM_WORK_ARENA_SIZE_MAX_BYTES, "UHFM work arena exceeds the board budget");
+
 /*** UHFM local global variables ***/
 
 static UHFM_flags_t uhfm_flags;
+static UHFM_per_context_t uhfm_per_ctx;
+static UHFM_statistics_context_t uhfm_statistics_ctx;
+// Working buffer shared by the mutually exclusive radio modes.
+static UHFM_work_arena_t uhfm_work_arena;
 
 /*** UHFM local functions ***/
 
@@ -103,7 +185,7 @@ static NODE_status_t _UHFM_is_radio_free(void) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
     // Compare state.
-    if (POWER_get_state(POWER_DOMAIN_RADIO) != 0) {
+    if ((POWER_get_state(POWER_DOMAIN_RADIO) != 0) || (uhfm_flags.per != 0)) {
         status = NODE_ERROR_RADIO_STATE;
         goto errors;
     }
@@ -111,28 +193,187 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+static void _UHFM_update_statistics_registers(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // History status.
+    SWREG_write_field(&reg_value, &reg_mask, (uint32_t) uhfm_statistics_ctx.history_index, UHFM_REGISTER_HISTORY_STATUS_MASK_INDEX);
+    SWREG_write_field(&reg_value, &reg_mask, (uint32_t) uhfm_statistics_ctx.history_count, UHFM_REGISTER_HISTORY_STATUS_MASK_COUNT);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_HISTORY_STATUS, reg_value, reg_mask);
+    // Uplink counters.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, (uint32_t) uhfm_statistics_ctx.ul_message_count, UHFM_REGISTER_STATISTICS_0_MASK_UL_MESSAGE_COUNT);
+    SWREG_write_field(&reg_value, &reg_mask, (uint32_t) uhfm_statistics_ctx.ul_success_count, UHFM_REGISTER_STATISTICS_0_MASK_UL_SUCCESS_COUNT);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_STATISTICS_0, reg_value, reg_mask);
+    // Downlink counters.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, (uint32_t) uhfm_statistics_ctx.dl_request_count, UHFM_REGISTER_STATISTICS_1_MASK_DL_REQUEST_COUNT);
+    SWREG_write_field(&reg_value, &reg_mask, (uint32_t) uhfm_statistics_ctx.dl_success_count, UHFM_REGISTER_STATISTICS_1_MASK_DL_SUCCESS_COUNT);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_STATISTICS_1, reg_value, reg_mask);
+    // Downlink RSSI.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_STATISTICS_2, (uint32_t) uhfm_statistics_ctx.dl_rssi_sum, UHFM_REGISTER_STATISTICS_2_MASK_DL_RSSI_SUM);
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_dbm(uhfm_statistics_ctx.dl_rssi_min), UHFM_REGISTER_STATISTICS_3_MASK_DL_RSSI_MIN);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_dbm(uhfm_statistics_ctx.dl_rssi_max), UHFM_REGISTER_STATISTICS_3_MASK_DL_RSSI_MAX);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_STATISTICS_3, reg_value, reg_mask);
+    // Computed rates and mean.
+    reg_value = 0;
+    reg_mask = 0;
+    if (uhfm_statistics_ctx.ul_message_count != 0) {
+        SWREG_write_field(&reg_value, &reg_mask, ((((uint32_t) uhfm_statistics_ctx.ul_success_count) * 100) / ((uint32_t) uhfm_statistics_ctx.ul_message_count)), UHFM_REGISTER_STATISTICS_4_MASK_UL_SUCCESS_RATE);
+    }
+    if (uhfm_statistics_ctx.dl_request_count != 0) {
+        SWREG_write_field(&reg_value, &reg_mask, ((((uint32_t) uhfm_statistics_ctx.dl_success_count) * 100) / ((uint32_t) uhfm_statistics_ctx.dl_request_count)), UHFM_REGISTER_STATISTICS_4_MASK_DL_SUCCESS_RATE);
+    }
+    if (uhfm_statistics_ctx.dl_success_count != 0) {
+        SWREG_write_field(&reg_value, &reg_mask, UNA_convert_dbm((int16_t) (uhfm_statistics_ctx.dl_rssi_sum / ((int32_t) uhfm_statistics_ctx.dl_success_count))), UHFM_REGISTER_STATISTICS_4_MASK_DL_RSSI_MEAN);
+    }
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_STATISTICS_4, reg_value, UNA_REGISTER_MASK_ALL);
+}
+
+/*******************************************************************/
+static void _UHFM_store_statistics(void) {
+    // Local variables.
+    uint8_t reg_addr = 0;
+    uint32_t reg_value = 0;
+    uint8_t idx = 0;
+    // Store aggregated counters in NVM.
+    for (reg_addr = UHFM_REGISTER_ADDRESS_STATISTICS_0; reg_addr < UHFM_REGISTER_ADDRESS_STATISTICS_4; reg_addr++) {
+        // Read register.
+        NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, &reg_value);
+        // Limit EEPROM wear by writing changed values only.
+        idx = (uint8_t) (reg_addr - UHFM_REGISTER_ADDRESS_STATISTICS_0);
+        if (reg_value != uhfm_statistics_ctx.saved[idx]) {
+            NODE_write_nvm(reg_addr, reg_value);
+            uhfm_statistics_ctx.saved[idx] = reg_value;
+        }
+    }
+}
+
+/*******************************************************************/
+static void _UHFM_load_statistics(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint8_t idx = 0;
+    // Reset history.
+    uhfm_statistics_ctx.history_index = 0;
+    uhfm_statistics_ctx.history_count = 0;
+    // Keep NVM content as reference for the next periodic save.
+    for (idx = 0; idx < UHFM_STATISTICS_NUMBER_OF_REGISTERS; idx++) {
+        NODE_read_nvm((UHFM_REGISTER_ADDRESS_STATISTICS_0 + idx), &(uhfm_statistics_ctx.saved[idx]));
+    }
+    uhfm_statistics_ctx.next_save_time_seconds = UHFM_STATISTICS_SAVE_PERIOD_SECONDS;
+    // Read aggregated counters from NVM.
+    NODE_read_nvm(UHFM_REGISTER_ADDRESS_STATISTICS_0, &reg_value);
+    uhfm_statistics_ctx.ul_message_count = (uint16_t) SWREG_read_field(reg_value, UHFM_REGISTER_STATISTICS_0_MASK_UL_MESSAGE_COUNT);
+    uhfm_statistics_ctx.ul_success_count = (uint16_t) SWREG_read_field(reg_value, UHFM_REGISTER_STATISTICS_0_MASK_UL_SUCCESS_COUNT);
+    NODE_read_nvm(UHFM_REGISTER_ADDRESS_STATISTICS_1, &reg_value);
+    uhfm_statistics_ctx.dl_request_count = (uint16_t) SWREG_read_field(reg_value, UHFM_REGISTER_STATISTICS_1_MASK_DL_REQUEST_COUNT);
+    uhfm_statistics_ctx.dl_success_count = (uint16_t) SWREG_read_field(reg_value, UHFM_REGISTER_STATISTICS_1_MASK_DL_SUCCESS_COUNT);
+    NODE_read_nvm(UHFM_REGISTER_ADDRESS_STATISTICS_2, &reg_value);
+    uhfm_statistics_ctx.dl_rssi_sum = (int32_t) reg_value;
+    NODE_read_nvm(UHFM_REGISTER_ADDRESS_STATISTICS_3, &reg_value);
+    uhfm_statistics_ctx.dl_rssi_min = (int16_t) UNA_get_dbm(SWREG_read_field(reg_value, UHFM_REGISTER_STATISTICS_3_MASK_DL_RSSI_MIN));
+    uhfm_statistics_ctx.dl_rssi_max = (int16_t) UNA_get_dbm(SWREG_read_field(reg_value, UHFM_REGISTER_STATISTICS_3_MASK_DL_RSSI_MAX));
+    // Update registers.
+    _UHFM_update_statistics_registers();
+}
+
+/*******************************************************************/
+static void _UHFM_clear_statistics(void) {
+    // Local variables.
+    uint8_t reg_addr = 0;
+    // Reset context.
+    uhfm_statistics_ctx.history_index = 0;
+    uhfm_statistics_ctx.history_count = 0;
+    uhfm_statistics_ctx.ul_message_count = 0;
+    uhfm_statistics_ctx.ul_success_count = 0;
+    uhfm_statistics_ctx.dl_request_count = 0;
+    uhfm_statistics_ctx.dl_success_count = 0;
+    uhfm_statistics_ctx.dl_rssi_sum = 0;
+    uhfm_statistics_ctx.dl_rssi_min = 0;
+    uhfm_statistics_ctx.dl_rssi_max = 0;
+    // Reset history registers.
+    for (reg_addr = UHFM_REGISTER_ADDRESS_HISTORY_DATA_0; reg_addr <= UHFM_REGISTER_ADDRESS_HISTORY_DATA_15; reg_addr++) {
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, 0, UNA_REGISTER_MASK_ALL);
+    }
+    // Update registers and NVM.
+    _UHFM_update_statistics_registers();
+    _UHFM_store_statistics();
+}
+
+/*******************************************************************/
+static void _UHFM_add_history_entry(uint32_t message_counter, SIGFOX_EP_API_message_status_t message_status, sfx_bool bidirectional_flag, sfx_s16 dl_rssi_dbm) {
+    // Local variables.
+    uint8_t reg_addr = (UHFM_REGISTER_ADDRESS_HISTORY_DATA_0 + (uhfm_statistics_ctx.history_index * UHFM_HISTORY_NUMBER_OF_REGISTERS_PER_ENTRY));
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Write history entry.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, reg_addr, RTC_get_uptime_seconds(), UHFM_REGISTER_HISTORY_ENTRY_0_MASK_TIMESTAMP);
+    SWREG_write_field(&reg_value, &reg_mask, message_counter, UHFM_REGISTER_HISTORY_ENTRY_1_MASK_MESSAGE_COUNTER);
+    SWREG_write_field(&reg_value, &reg_mask, (uint32_t) (message_status.all), UHFM_REGISTER_HISTORY_ENTRY_1_MASK_MESSAGE_STATUS);
+    SWREG_write_field(&reg_value, &reg_mask, ((message_status.field.dl_frame != 0) ? UNA_convert_dbm(dl_rssi_dbm) : 0), UHFM_REGISTER_HISTORY_ENTRY_1_MASK_DL_RSSI);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, (reg_addr + 1), reg_value, UNA_REGISTER_MASK_ALL);
+    // Update ring buffer indexes.
+    uhfm_statistics_ctx.history_index = (uint8_t) ((uhfm_statistics_ctx.history_index + 1) % UHFM_HISTORY_DEPTH);
+    if (uhfm_statistics_ctx.history_count < UHFM_HISTORY_DEPTH) {
+        uhfm_statistics_ctx.history_count++;
+    }
+    // Halve uplink counters on saturation to keep the success rate meaningful.
+    if (uhfm_statistics_ctx.ul_message_count >= UHFM_STATISTICS_COUNTER_MAX) {
+        uhfm_statistics_ctx.ul_message_count >>= 1;
+        uhfm_statistics_ctx.ul_success_count >>= 1;
+    }
+    // Update uplink statistics.
+    uhfm_statistics_ctx.ul_message_count++;
+    if ((message_status.field.ul_frame_1 != 0) || (message_status.field.ul_frame_2 != 0) || (message_status.field.ul_frame_3 != 0)) {
+        uhfm_statistics_ctx.ul_success_count++;
+    }
+    // Update downlink statistics.
+    if (bidirectional_flag != SIGFOX_FALSE) {
+        // Halve downlink counters on saturation.
+        if (uhfm_statistics_ctx.dl_request_count >= UHFM_STATISTICS_COUNTER_MAX) {
+            uhfm_statistics_ctx.dl_request_count >>= 1;
+            uhfm_statistics_ctx.dl_success_count >>= 1;
+            uhfm_statistics_ctx.dl_rssi_sum /= 2;
+        }
+        uhfm_statistics_ctx.dl_request_count++;
+        if (message_status.field.dl_frame != 0) {
+            // Update RSSI extremes.
+            if ((uhfm_statistics_ctx.dl_success_count == 0) || (dl_rssi_dbm < uhfm_statistics_ctx.dl_rssi_min)) {
+                uhfm_statistics_ctx.dl_rssi_min = (int16_t) dl_rssi_dbm;
+            }
+            if ((uhfm_statistics_ctx.dl_success_count == 0) || (dl_rssi_dbm > uhfm_statistics_ctx.dl_rssi_max)) {
+                uhfm_statistics_ctx.dl_rssi_max = (int16_t) dl_rssi_dbm;
+            }
+            uhfm_statistics_ctx.dl_rssi_sum += (int32_t) dl_rssi_dbm;
+            uhfm_statistics_ctx.dl_success_count++;
+        }
+    }
+    // Update registers and NVM.
+    _UHFM_update_statistics_registers();
+}
+
 /*******************************************************************/
 static NODE_status_t _UHFM_strg_callback(void) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
     SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
     MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
-    SIGFOX_EP_API_config_t lib_config;
-    SIGFOX_EP_API_application_message_t application_message;
-#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
-    SIGFOX_EP_API_control_message_t control_message;
-#endif
     SIGFOX_EP_API_message_status_t message_status;
     uint32_t reg_status_1 = 0;
     uint32_t reg_status_1_mask = 0;
     uint32_t reg_config_0 = 0;
     uint32_t reg_control_1 = 0;
     sfx_bool bidirectional_flag = 0;
-    sfx_u8 ul_payload[SIGFOX_UL_PAYLOAD_MAX_SIZE_BYTES];
+    sfx_bool message_sent = SIGFOX_FALSE;
     sfx_u8 ul_payload_size = 0;
-    sfx_u8 dl_payload[SIGFOX_DL_PAYLOAD_SIZE_BYTES];
     sfx_s16 dl_rssi_dbm = 0;
-    sfx_u8 nvm_data[SIGFOX_NVM_DATA_SIZE_BYTES];
     uint32_t message_counter = 0;
     // Reset status.
     message_status.all = 0;
@@ -143,9 +384,15 @@ static NODE_status_t _UHFM_strg_callback(void) {
     status = _UHFM_is_radio_free();
     if (status != NODE_SUCCESS) goto errors;
     // Open library.
-    lib_config.rc = &SIGFOX_RC1;
-    sigfox_ep_api_status = SIGFOX_EP_API_open(&lib_config);
+    uhfm_work_arena.send.lib_config.rc = &SIGFOX_RC1;
+    sigfox_ep_api_status = SIGFOX_EP_API_open(&uhfm_work_arena.send.lib_config);
     SIGFOX_EP_API_check_status(NODE_ERROR_SIGFOX_EP_API);
+    // Read current message counter.
+    mcu_api_status = MCU_API_get_nvm((sfx_u8*) uhfm_work_arena.send.nvm_data, SIGFOX_NVM_DATA_SIZE_BYTES);
+    MCU_API_check_status(NODE_ERROR_SIGFOX_MCU_API);
+    // Compute message counter.
+    message_counter = (sfx_u32) (message_counter | ((((sfx_u32) uhfm_work_arena.send.nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_MSB]) << 8) & 0xFF00));
+    message_counter = (sfx_u32) (message_counter | ((((sfx_u32) uhfm_work_arena.send.nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_LSB]) << 0) & 0x00FF));
 #ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
     // Check control message flag.
     if (SWREG_read_field(reg_control_1, UHFM_REGISTER_CONTROL_1_MASK_CMSG) == 0) {
@@ -153,51 +400,44 @@ static NODE_status_t _UHFM_strg_callback(void) {
         // Get payload size.
         ul_payload_size = (sfx_u8) SWREG_read_field(reg_control_1, UHFM_REGISTER_CONTROL_1_MASK_UL_PAYLOAD_SIZE);
         // Read UL payload.
-        NODE_read_byte_array(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_UL_PAYLOAD_0, (uint8_t*) ul_payload, ul_payload_size);
+        NODE_read_byte_array(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_UL_PAYLOAD_0, (uint8_t*) uhfm_work_arena.send.ul_payload, ul_payload_size);
         // Update bidirectional flag.
         bidirectional_flag = (sfx_bool) SWREG_read_field(reg_control_1, UHFM_REGISTER_CONTROL_1_MASK_BF);
-        // Read current message counter.
-        if (bidirectional_flag == SIGFOX_TRUE) {
-            // Read memory.
-            mcu_api_status = MCU_API_get_nvm((sfx_u8*) nvm_data, SIGFOX_NVM_DATA_SIZE_BYTES);
-            MCU_API_check_status(NODE_ERROR_SIGFOX_MCU_API);
-            // Compute message counter.
-            message_counter = (sfx_u32) (message_counter | ((((sfx_u32) nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_MSB]) << 8) & 0xFF00));
-            message_counter = (sfx_u32) (message_counter | ((((sfx_u32) nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_LSB]) << 0) & 0x00FF));
-        }
         // Build message structure.
-        application_message.common_parameters.number_of_frames = (sfx_u8) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_NFR);
-        application_message.common_parameters.ul_bit_rate = (SIGFOX_ul_bit_rate_t) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_BR);
+        uhfm_work_arena.send.application_message.common_parameters.number_of_frames = (sfx_u8) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_NFR);
+        uhfm_work_arena.send.application_message.common_parameters.ul_bit_rate = (SIGFOX_ul_bit_rate_t) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_BR);
 #ifdef SIGFOX_EP_PUBLIC_KEY_CAPABLE
-        application_message.common_parameters.ep_key_type = SIGFOX_EP_KEY_PRIVATE;
+        uhfm_work_arena.send.application_message.common_parameters.ep_key_type = SIGFOX_EP_KEY_PRIVATE;
 #endif
-        application_message.type = (SIGFOX_application_message_type_t) SWREG_read_field(reg_control_1, UHFM_REGISTER_CONTROL_1_MASK_MSGT);
-        application_message.bidirectional_flag = bidirectional_flag;
-        application_message.ul_payload = (sfx_u8*) ul_payload;
-        application_message.ul_payload_size_bytes = ul_payload_size;
+        uhfm_work_arena.send.application_message.type = (SIGFOX_application_message_type_t) SWREG_read_field(reg_control_1, UHFM_REGISTER_CONTROL_1_MASK_MSGT);
+        uhfm_work_arena.send.application_message.bidirectional_flag = bidirectional_flag;
+        uhfm_work_arena.send.application_message.ul_payload = (sfx_u8*) uhfm_work_arena.send.ul_payload;
+        uhfm_work_arena.send.application_message.ul_payload_size_bytes = ul_payload_size;
         // Send message.
-        sigfox_ep_api_status = SIGFOX_EP_API_send_application_message(&application_message);
+        message_sent = SIGFOX_TRUE;
+        sigfox_ep_api_status = SIGFOX_EP_API_send_application_message(&uhfm_work_arena.send.application_message);
         SIGFOX_EP_API_check_status(NODE_ERROR_SIGFOX_EP_API);
         // Read message status.
         message_status = SIGFOX_EP_API_get_message_status();
         // Check bidirectional flag.
-        if ((application_message.bidirectional_flag != 0) && (message_status.field.dl_frame != 0)) {
+        if ((uhfm_work_arena.send.application_message.bidirectional_flag != 0) && (message_status.field.dl_frame != 0)) {
             // Read downlink data.
-            sigfox_ep_api_status = SIGFOX_EP_API_get_dl_payload(dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES, &dl_rssi_dbm);
+            sigfox_ep_api_status = SIGFOX_EP_API_get_dl_payload(uhfm_work_arena.send.dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES, &dl_rssi_dbm);
             SIGFOX_EP_API_check_status(NODE_ERROR_SIGFOX_EP_API);
             // Write DL payload registers and RSSI.
-            NODE_write_byte_array(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_DL_PAYLOAD_0, (uint8_t*) dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES);
+            NODE_write_byte_array(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_DL_PAYLOAD_0, (uint8_t*) uhfm_work_arena.send.dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES);
             SWREG_write_field(&reg_status_1, &reg_status_1_mask, UNA_convert_dbm(dl_rssi_dbm), UHFM_REGISTER_STATUS_1_MASK_DL_RSSI);
         }
 #ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
     }
     else {
-        control_message.common_parameters.number_of_frames = (sfx_u8) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_NFR);
-        control_message.common_parameters.ul_bit_rate = (SIGFOX_ul_bit_rate_t) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_BR);
-        control_message.common_parameters.ep_key_type = SIGFOX_EP_KEY_PRIVATE;
-        control_message.type = SIGFOX_CONTROL_MESSAGE_TYPE_KEEP_ALIVE;
+        uhfm_work_arena.send.control_message.common_parameters.number_of_frames = (sfx_u8) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_NFR);
+        uhfm_work_arena.send.control_message.common_parameters.ul_bit_rate = (SIGFOX_ul_bit_rate_t) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_BR);
+        uhfm_work_arena.send.control_message.common_parameters.ep_key_type = SIGFOX_EP_KEY_PRIVATE;
+        uhfm_work_arena.send.control_message.type = SIGFOX_CONTROL_MESSAGE_TYPE_KEEP_ALIVE;
         // Send message.
-        sigfox_ep_api_status = SIGFOX_EP_API_send_control_message(&control_message);
+        message_sent = SIGFOX_TRUE;
+        sigfox_ep_api_status = SIGFOX_EP_API_send_control_message(&uhfm_work_arena.send.control_message);
         SIGFOX_EP_API_check_status(NODE_ERROR_SIGFOX_EP_API);
         // Read message status.
         message_status = SIGFOX_EP_API_get_message_status();
@@ -213,6 +453,10 @@ errors:
         SWREG_write_field(&reg_status_1, &reg_status_1_mask, (message_counter + 1), UHFM_REGISTER_STATUS_1_MASK_BIDIRECTIONAL_MC);
     }
     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_STATUS_1, reg_status_1, reg_status_1_mask);
+    // Update history and statistics only if a message has been sent.
+    if (message_sent != SIGFOX_FALSE) {
+        _UHFM_add_history_entry((message_counter + 1), message_status, bidirectional_flag, dl_rssi_dbm);
+    }
     // Return status.
     return status;
 }
@@ -222,8 +466,6 @@ static NODE_status_t _UHFM_ttrg_callback(void) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
     SIGFOX_EP_ADDON_RFP_API_status_t sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
-    SIGFOX_EP_ADDON_RFP_API_config_t addon_config;
-    SIGFOX_EP_ADDON_RFP_API_test_mode_t test_mode;
     uint32_t reg_config_0 = 0;
     uint32_t reg_control_1 = 0;
     // Read configuration registers.
@@ -233,13 +475,13 @@ static NODE_status_t _UHFM_ttrg_callback(void) {
     status = _UHFM_is_radio_free();
     if (status != NODE_SUCCESS) goto errors;
     // Open addon.
-    addon_config.rc = &SIGFOX_RC1;
-    sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_open(&addon_config);
+    uhfm_work_arena.test.addon_config.rc = &SIGFOX_RC1;
+    sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_open(&uhfm_work_arena.test.addon_config);
     _UHFM_sigfox_ep_addon_rfp_exit_error();
     // Call test mode function.
-    test_mode.test_mode_reference = (SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t) SWREG_read_field(reg_control_1, UHFM_REGISTER_CONTROL_1_MASK_RFP_TEST_MODE);
-    test_mode.ul_bit_rate = (SIGFOX_ul_bit_rate_t) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_BR);
-    sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_test_mode(&test_mode);
+    uhfm_work_arena.test.test_mode.test_mode_reference = (SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t) SWREG_read_field(reg_control_1, UHFM_REGISTER_CONTROL_1_MASK_RFP_TEST_MODE);
+    uhfm_work_arena.test.test_mode.ul_bit_rate = (SIGFOX_ul_bit_rate_t) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_BR);
+    sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_test_mode(&(uhfm_work_arena.test.test_mode));
     _UHFM_sigfox_ep_addon_rfp_exit_error();
 errors:
     // Close addon.
@@ -253,19 +495,18 @@ static NODE_status_t _UHFM_cwen_callback(uint8_t state) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
     RF_API_status_t rf_api_status = RF_API_SUCCESS;
-    RF_API_radio_parameters_t radio_params;
     uint32_t reg_radio_test_0 = 0;
     uint32_t reg_radio_test_1 = 0;
     // Read RF frequency and CW power.
     NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_RADIO_TEST_0, &reg_radio_test_0);
     NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_RADIO_TEST_1, &reg_radio_test_1);
     // Radio configuration.
-    radio_params.rf_mode = RF_API_MODE_TX;
-    radio_params.frequency_hz = (sfx_u32) SWREG_read_field(reg_radio_test_0, UHFM_REGISTER_RADIO_TEST_0_MASK_RF_FREQUENCY);
-    radio_params.modulation = RF_API_MODULATION_NONE;
-    radio_params.bit_rate_bps = 0;
-    radio_params.tx_power_dbm_eirp = (sfx_s8) UNA_get_dbm(SWREG_read_field(reg_radio_test_1, UHFM_REGISTER_RADIO_TEST_1_MASK_TX_POWER));
-    radio_params.deviation_hz = 0;
+    uhfm_work_arena.radio.radio_params.rf_mode = RF_API_MODE_TX;
+    uhfm_work_arena.radio.radio_params.frequency_hz = (sfx_u32) SWREG_read_field(reg_radio_test_0, UHFM_REGISTER_RADIO_TEST_0_MASK_RF_FREQUENCY);
+    uhfm_work_arena.radio.radio_params.modulation = RF_API_MODULATION_NONE;
+    uhfm_work_arena.radio.radio_params.bit_rate_bps = 0;
+    uhfm_work_arena.radio.radio_params.tx_power_dbm_eirp = (sfx_s8) UNA_get_dbm(SWREG_read_field(reg_radio_test_1, UHFM_REGISTER_RADIO_TEST_1_MASK_TX_POWER));
+    uhfm_work_arena.radio.radio_params.deviation_hz = 0;
     // Check state.
     if (state == 0) {
         // Stop CW.
@@ -281,7 +522,7 @@ static NODE_status_t _UHFM_cwen_callback(uint8_t state) {
         // Init radio.
         rf_api_status = RF_API_wake_up();
         RF_API_check_status(NODE_ERROR_SIGFOX_RF_API);
-        rf_api_status = RF_API_init(&radio_params);
+        rf_api_status = RF_API_init(&(uhfm_work_arena.radio.radio_params));
         RF_API_check_status(NODE_ERROR_SIGFOX_RF_API);
         // Start CW.
         rf_api_status = RF_API_start_continuous_wave();
@@ -304,18 +545,17 @@ static NODE_status_t _UHFM_rsen_callback(uint8_t state) {
     // Local variables.
     NODE_status_t status = NODE_SUCCESS;
     RF_API_status_t rf_api_status = RF_API_SUCCESS;
-    RF_API_radio_parameters_t radio_params;
     S2LP_status_t s2lp_status = S2LP_SUCCESS;
     uint32_t reg_radio_test_0 = 0;
     // Read RF frequency.
     NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_RADIO_TEST_0, &reg_radio_test_0);
     // Radio configuration.
-    radio_params.rf_mode = RF_API_MODE_RX;
-    radio_params.frequency_hz = (sfx_u32) SWREG_read_field(reg_radio_test_0, UHFM_REGISTER_RADIO_TEST_0_MASK_RF_FREQUENCY);
-    radio_params.modulation = RF_API_MODULATION_NONE;
-    radio_params.bit_rate_bps = 0;
-    radio_params.tx_power_dbm_eirp = 0;
-    radio_params.deviation_hz = 0;
+    uhfm_work_arena.radio.radio_params.rf_mode = RF_API_MODE_RX;
+    uhfm_work_arena.radio.radio_params.frequency_hz = (sfx_u32) SWREG_read_field(reg_radio_test_0, UHFM_REGISTER_RADIO_TEST_0_MASK_RF_FREQUENCY);
+    uhfm_work_arena.radio.radio_params.modulation = RF_API_MODULATION_NONE;
+    uhfm_work_arena.radio.radio_params.bit_rate_bps = 0;
+    uhfm_work_arena.radio.radio_params.tx_power_dbm_eirp = 0;
+    uhfm_work_arena.radio.radio_params.deviation_hz = 0;
     // Check state.
     if (state == 0) {
         // Stop continuous listening.
@@ -331,7 +571,7 @@ static NODE_status_t _UHFM_rsen_callback(uint8_t state) {
         // Init radio.
         rf_api_status = RF_API_wake_up();
         RF_API_check_status(NODE_ERROR_SIGFOX_RF_API);
-        rf_api_status = RF_API_init(&radio_params);
+        rf_api_status = RF_API_init(&(uhfm_work_arena.radio.radio_params));
         RF_API_check_status(NODE_ERROR_SIGFOX_RF_API);
         // Start continuous listening.
         s2lp_status = S2LP_send_command(S2LP_COMMAND_READY);
@@ -353,6 +593,169 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+static void _UHFM_per_update_registers(void) {
+    // Local variables.
+    uint32_t reg_per_status = 0;
+    uint32_t reg_per_status_mask = 0;
+    uint32_t reg_per_data_0 = 0;
+    uint32_t reg_per_data_0_mask = 0;
+    uint32_t reg_per_data_1 = 0;
+    uint32_t reg_per_data_1_mask = 0;
+    uint32_t reg_per_data_2 = 0;
+    uint32_t reg_per_data_2_mask = 0;
+    // Campaign progress.
+    SWREG_write_field(&reg_per_status, &reg_per_status_mask, (uint32_t) uhfm_flags.per, UHFM_REGISTER_PER_STATUS_MASK_PRST);
+    SWREG_write_field(&reg_per_status, &reg_per_status_mask, (uint32_t) uhfm_per_ctx.iteration, UHFM_REGISTER_PER_STATUS_MASK_ITERATION);
+    // Frames counters.
+    SWREG_write_field(&reg_per_data_0, &reg_per_data_0_mask, (uint32_t) uhfm_per_ctx.ul_frame_count, UHFM_REGISTER_PER_DATA_0_MASK_UL_FRAME_COUNT);
+    SWREG_write_field(&reg_per_data_0, &reg_per_data_0_mask, (uint32_t) uhfm_per_ctx.dl_frame_count, UHFM_REGISTER_PER_DATA_0_MASK_DL_FRAME_COUNT);
+    SWREG_write_field(&reg_per_data_1, &reg_per_data_1_mask, (uint32_t) uhfm_per_ctx.dl_error_count, UHFM_REGISTER_PER_DATA_1_MASK_DL_ERROR_COUNT);
+    SWREG_write_field(&reg_per_data_2, &reg_per_data_2_mask, (uint32_t) uhfm_per_ctx.dl_crc_error_count, UHFM_REGISTER_PER_DATA_2_MASK_DL_CRC_ERROR_COUNT);
+    // RSSI statistics are only relevant if at least one downlink frame has been received.
+    if (uhfm_per_ctx.dl_frame_count != 0) {
+        SWREG_write_field(&reg_per_data_1, &reg_per_data_1_mask, UNA_convert_dbm(uhfm_per_ctx.dl_rssi_min), UHFM_REGISTER_PER_DATA_1_MASK_DL_RSSI_MIN);
+        SWREG_write_field(&reg_per_data_1, &reg_per_data_1_mask, UNA_convert_dbm(uhfm_per_ctx.dl_rssi_max), UHFM_REGISTER_PER_DATA_1_MASK_DL_RSSI_MAX);
+        SWREG_write_field(&reg_per_data_2, &reg_per_data_2_mask, UNA_convert_dbm((int16_t) (uhfm_per_ctx.dl_rssi_sum / ((int32_t) uhfm_per_ctx.dl_frame_count))), UHFM_REGISTER_PER_DATA_2_MASK_DL_RSSI_MEAN);
+        SWREG_write_field(&reg_per_data_2, &reg_per_data_2_mask, UNA_convert_dbm(uhfm_per_ctx.dl_rssi_last), UHFM_REGISTER_PER_DATA_2_MASK_DL_RSSI_LAST);
+    }
+    // Write registers.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_STATUS, reg_per_status, reg_per_status_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_DATA_0, reg_per_data_0, reg_per_data_0_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_DATA_1, reg_per_data_1, reg_per_data_1_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_DATA_2, reg_per_data_2, reg_per_data_2_mask);
+}
+
+/*******************************************************************/
+static NODE_status_t _UHFM_per_start(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    uint32_t reg_per_config = 0;
+    uint32_t reg_per_config_mask = 0;
+    // Check radio state.
+    status = _UHFM_is_radio_free();
+    if (status != NODE_SUCCESS) goto errors;
+    // Read configuration.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_CONFIGURATION, &reg_per_config);
+    uhfm_per_ctx.number_of_iterations = (uint16_t) SWREG_read_field(reg_per_config, UHFM_REGISTER_PER_CONFIGURATION_MASK_NUMBER_OF_ITERATIONS);
+    uhfm_per_ctx.period_seconds = (uint32_t) UNA_get_seconds(SWREG_read_field(reg_per_config, UHFM_REGISTER_PER_CONFIGURATION_MASK_PERIOD));
+    // Check parameters.
+    if (uhfm_per_ctx.number_of_iterations == 0) {
+        status = NODE_ERROR_REGISTER_FIELD_RANGE;
+        goto errors;
+    }
+    // Enforce minimum period so that the node goes back to the main loop between two messages.
+    if (uhfm_per_ctx.period_seconds < UHFM_PER_PERIOD_SECONDS_MIN) {
+        uhfm_per_ctx.period_seconds = UHFM_PER_PERIOD_SECONDS_MIN;
+        // Report effective period.
+        SWREG_write_field(&reg_per_config, &reg_per_config_mask, UNA_convert_seconds(uhfm_per_ctx.period_seconds), UHFM_REGISTER_PER_CONFIGURATION_MASK_PERIOD);
+        NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_CONFIGURATION, reg_per_config, reg_per_config_mask);
+    }
+    // Reset statistics.
+    uhfm_per_ctx.iteration = 0;
+    uhfm_per_ctx.next_time_seconds = RTC_get_uptime_seconds();
+    uhfm_per_ctx.ul_frame_count = 0;
+    uhfm_per_ctx.dl_frame_count = 0;
+    uhfm_per_ctx.dl_error_count = 0;
+    uhfm_per_ctx.dl_crc_error_count = 0;
+    uhfm_per_ctx.dl_rssi_sum = 0;
+    uhfm_per_ctx.dl_rssi_min = 0;
+    uhfm_per_ctx.dl_rssi_max = 0;
+    uhfm_per_ctx.dl_rssi_last = 0;
+    // Update flags.
+    uhfm_flags.per_bidirectional = (SWREG_read_field(reg_per_config, UHFM_REGISTER_PER_CONFIGURATION_MASK_MODE) == 0) ? 0 : 1;
+    uhfm_flags.per = 1;
+    // Reset registers.
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_STATUS, 0, UNA_REGISTER_MASK_ALL);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_DATA_0, 0, UNA_REGISTER_MASK_ALL);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_DATA_1, 0, UNA_REGISTER_MASK_ALL);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_DATA_2, 0, UNA_REGISTER_MASK_ALL);
+    _UHFM_per_update_registers();
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static void _UHFM_per_stop(uint8_t done_flag, uint8_t error_flag) {
+    // Local variables.
+    uint32_t reg_per_status = 0;
+    uint32_t reg_per_status_mask = 0;
+    // Update flag.
+    uhfm_flags.per = 0;
+    // Update status.
+    SWREG_write_field(&reg_per_status, &reg_per_status_mask, 0b0, UHFM_REGISTER_PER_STATUS_MASK_PRST);
+    SWREG_write_field(&reg_per_status, &reg_per_status_mask, (uint32_t) done_flag, UHFM_REGISTER_PER_STATUS_MASK_PDNE);
+    SWREG_write_field(&reg_per_status, &reg_per_status_mask, (uint32_t) error_flag, UHFM_REGISTER_PER_STATUS_MASK_PERR);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_STATUS, reg_per_status, reg_per_status_mask);
+}
+
+/*******************************************************************/
+static NODE_status_t _UHFM_per_iteration(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    SIGFOX_EP_ADDON_RFP_API_status_t sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    RF_API_status_t rf_api_status = RF_API_SUCCESS;
+    uint32_t reg_config_0 = 0;
+    uint32_t reg_control_1 = 0;
+    sfx_u32 dl_phy_frame_count = 0;
+    sfx_s16 dl_rssi_dbm = 0;
+    // Read configuration registers.
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_CONFIGURATION_0, &reg_config_0);
+    NODE_read_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_CONTROL_1, &reg_control_1);
+    // Check radio state.
+    if (POWER_get_state(POWER_DOMAIN_RADIO) != 0) {
+        status = NODE_ERROR_RADIO_STATE;
+        goto errors;
+    }
+    // Open addon.
+    uhfm_work_arena.test.addon_config.rc = &SIGFOX_RC1;
+    sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_open(&uhfm_work_arena.test.addon_config);
+    _UHFM_sigfox_ep_addon_rfp_exit_error();
+    // Downlink frames detected by the radio during the test mode.
+    dl_phy_frame_count = RF_API_get_dl_phy_frame_count();
+    // Run the test mode selected for TTRG.
+    uhfm_work_arena.test.test_mode.test_mode_reference = (SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t) SWREG_read_field(reg_control_1, UHFM_REGISTER_CONTROL_1_MASK_RFP_TEST_MODE);
+    uhfm_work_arena.test.test_mode.ul_bit_rate = (SIGFOX_ul_bit_rate_t) SWREG_read_field(reg_config_0, UHFM_REGISTER_CONFIGURATION_0_MASK_BR);
+    sigfox_ep_addon_rfp_status = SIGFOX_EP_ADDON_RFP_API_test_mode(&(uhfm_work_arena.test.test_mode));
+    dl_phy_frame_count = (RF_API_get_dl_phy_frame_count() - dl_phy_frame_count);
+    // Uplink only test modes: any failure aborts the campaign.
+    if (uhfm_flags.per_bidirectional == 0) {
+        _UHFM_sigfox_ep_addon_rfp_exit_error();
+    }
+    uhfm_per_ctx.ul_frame_count++;
+    // Downlink test modes fail when no valid frame has been received.
+    if (uhfm_flags.per_bidirectional != 0) {
+        if (sigfox_ep_addon_rfp_status == SIGFOX_EP_ADDON_RFP_API_SUCCESS) {
+            // Read downlink RSSI.
+            rf_api_status = RF_API_get_dl_phy_content_and_rssi(uhfm_work_arena.test.dl_phy_content, SIGFOX_DL_PHY_CONTENT_SIZE_BYTES, &dl_rssi_dbm);
+            RF_API_check_status(NODE_ERROR_SIGFOX_RF_API);
+            // Update RSSI statistics.
+            if ((uhfm_per_ctx.dl_frame_count == 0) || (dl_rssi_dbm < uhfm_per_ctx.dl_rssi_min)) {
+                uhfm_per_ctx.dl_rssi_min = (int16_t) dl_rssi_dbm;
+            }
+            if ((uhfm_per_ctx.dl_frame_count == 0) || (dl_rssi_dbm > uhfm_per_ctx.dl_rssi_max)) {
+                uhfm_per_ctx.dl_rssi_max = (int16_t) dl_rssi_dbm;
+            }
+            uhfm_per_ctx.dl_rssi_last = (int16_t) dl_rssi_dbm;
+            uhfm_per_ctx.dl_rssi_sum += (int32_t) dl_rssi_dbm;
+            uhfm_per_ctx.dl_frame_count++;
+        }
+        else if (dl_phy_frame_count != 0) {
+            // Frame received by the radio but rejected by the addon (CRC or authentication failure).
+            uhfm_per_ctx.dl_crc_error_count++;
+        }
+        else {
+            // Nothing received during the downlink window.
+            // Note: the addon status does not tell a radio failure apart from a missed frame, which is counted here as well.
+            uhfm_per_ctx.dl_error_count++;
+        }
+    }
+errors:
+    // Close addon.
+    SIGFOX_EP_ADDON_RFP_API_close();
+    return status;
+}
+
 /*** UHFM functions ***/
 
 /*******************************************************************/
@@ -361,9 +764,9 @@ NODE_status_t UHFM_init_registers(void) {
     NODE_status_t status = NODE_SUCCESS;
     uint8_t idx = 0;
     uint8_t sigfox_ep_tab[SIGFOX_EP_KEY_SIZE_BYTES];
-#ifdef XM_NVM_FACTORY_RESET
     uint32_t reg_value = 0;
     uint32_t reg_mask = 0;
+#ifdef XM_NVM_FACTORY_RESET
     // TX power, NFR, bit rate and RC.
     SWREG_write_field(&reg_value, &reg_mask, UNA_convert_dbm(SIGFOX_EP_TX_POWER_DBM_EIRP), UHFM_REGISTER_CONFIGURATION_0_MASK_TX_POWER);
     SWREG_write_field(&reg_value, &reg_mask, 0b11, UHFM_REGISTER_CONFIGURATION_0_MASK_NFR);
@@ -376,9 +779,23 @@ NODE_status_t UHFM_init_registers(void) {
     SWREG_write_field(&reg_value, &reg_mask, SIGFOX_EP_T_IFU_MS, UHFM_REGISTER_CONFIGURATION_1_MASK_TIFU);
     SWREG_write_field(&reg_value, &reg_mask, SIGFOX_EP_T_CONF_MS, UHFM_REGISTER_CONFIGURATION_1_MASK_TCONF);
     NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_CONFIGURATION_1, reg_value, reg_mask);
+    // History and statistics.
+    _UHFM_clear_statistics();
 #endif
-    // Init flags.
+    // Init flags and context.
     uhfm_flags.all = 0;
+    uhfm_per_ctx.number_of_iterations = 0;
+    uhfm_per_ctx.iteration = 0;
+    uhfm_per_ctx.period_seconds = 0;
+    uhfm_per_ctx.next_time_seconds = 0;
+    uhfm_per_ctx.ul_frame_count = 0;
+    uhfm_per_ctx.dl_frame_count = 0;
+    uhfm_per_ctx.dl_error_count = 0;
+    uhfm_per_ctx.dl_crc_error_count = 0;
+    uhfm_per_ctx.dl_rssi_sum = 0;
+    uhfm_per_ctx.dl_rssi_min = 0;
+    uhfm_per_ctx.dl_rssi_max = 0;
+    uhfm_per_ctx.dl_rssi_last = 0;
     // Sigfox EP ID register.
     for (idx = 0; idx < SIGFOX_EP_ID_SIZE_BYTES; idx++) {
         NVM_read_byte((NVM_ADDRESS_SIGFOX_EP_ID + idx), &(sigfox_ep_tab[idx]));
@@ -391,9 +808,16 @@ NODE_status_t UHFM_init_registers(void) {
     NODE_write_byte_array(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_EP_KEY_0, (uint8_t*) sigfox_ep_tab, SIGFOX_EP_KEY_SIZE_BYTES);
     // Load default values.
     _UHFM_load_dynamic_configuration();
+    _UHFM_load_statistics();
     _UHFM_reset_analog_data();
     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_RADIO_TEST_0, UHFM_REGISTER_RADIO_TEST_0_DEFAULT_VALUE, UNA_REGISTER_MASK_ALL);
     NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_RADIO_TEST_1, UHFM_REGISTER_RADIO_TEST_1_DEFAULT_VALUE, UNA_REGISTER_MASK_ALL);
+    // PER campaign default configuration.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, UHFM_PER_NUMBER_OF_ITERATIONS_DEFAULT_VALUE, UHFM_REGISTER_PER_CONFIGURATION_MASK_NUMBER_OF_ITERATIONS);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_seconds(UHFM_PER_PERIOD_SECONDS_DEFAULT_VALUE), UHFM_REGISTER_PER_CONFIGURATION_MASK_PERIOD);
+    NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_CONFIGURATION, reg_value, reg_mask);
     return status;
 }
 
@@ -505,6 +929,43 @@ NODE_status_t UHFM_check_register(uint8_t reg_addr, uint32_t reg_mask) {
             }
         }
         break;
+    case UHFM_REGISTER_ADDRESS_HISTORY_CONTROL:
+        // HCLR.
+        if ((reg_mask & UHFM_REGISTER_HISTORY_CONTROL_MASK_HCLR) != 0) {
+            // Read bit.
+            if (SWREG_read_field(reg_value, UHFM_REGISTER_HISTORY_CONTROL_MASK_HCLR) != 0) {
+                // Clear request.
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_HISTORY_CONTROL, 0b0, UHFM_REGISTER_HISTORY_CONTROL_MASK_HCLR);
+                // Reset history and statistics.
+                _UHFM_clear_statistics();
+            }
+        }
+        break;
+    case UHFM_REGISTER_ADDRESS_PER_CONTROL:
+        // PTRG.
+        if ((reg_mask & UHFM_REGISTER_PER_CONTROL_MASK_PTRG) != 0) {
+            // Read bit.
+            if (SWREG_read_field(reg_value, UHFM_REGISTER_PER_CONTROL_MASK_PTRG) != 0) {
+                // Clear request.
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_CONTROL, 0b0, UHFM_REGISTER_PER_CONTROL_MASK_PTRG);
+                // Start packet error rate campaign.
+                status = _UHFM_per_start();
+                if (status != NODE_SUCCESS) goto errors;
+            }
+        }
+        // PSTP.
+        if ((reg_mask & UHFM_REGISTER_PER_CONTROL_MASK_PSTP) != 0) {
+            // Read bit.
+            if (SWREG_read_field(reg_value, UHFM_REGISTER_PER_CONTROL_MASK_PSTP) != 0) {
+                // Clear request.
+                NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, UHFM_REGISTER_ADDRESS_PER_CONTROL, 0b0, UHFM_REGISTER_PER_CONTROL_MASK_PSTP);
+                // Abort campaign.
+                if (uhfm_flags.per != 0) {
+                    _UHFM_per_stop(0, 0);
+                }
+            }
+        }
+        break;
     default:
         // Nothing to do for other registers.
         break;
@@ -574,4 +1035,41 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+NODE_status_t UHFM_process(void) {
+    // Local variables.
+    NODE_status_t status = NODE_SUCCESS;
+    // Check statistics save period.
+    if (RTC_get_uptime_seconds() >= uhfm_statistics_ctx.next_save_time_seconds) {
+        // Update next time.
+        uhfm_statistics_ctx.next_save_time_seconds = RTC_get_uptime_seconds() + UHFM_STATISTICS_SAVE_PERIOD_SECONDS;
+        // Save statistics which have changed.
+        _UHFM_store_statistics();
+    }
+    // Check campaign state and period.
+    if ((uhfm_flags.per != 0) && (RTC_get_uptime_seconds() >= uhfm_per_ctx.next_time_seconds)) {
+        // Perform iteration.
+        status = _UHFM_per_iteration();
+        if (status != NODE_SUCCESS) {
+            // Abort campaign.
+            _UHFM_per_stop(0, 1);
+            goto errors;
+        }
+        // Update next time and iteration index.
+        uhfm_per_ctx.next_time_seconds = RTC_get_uptime_seconds() + uhfm_per_ctx.period_seconds;
+        uhfm_per_ctx.iteration++;
+        // Check end of campaign.
+        if (uhfm_per_ctx.iteration >= uhfm_per_ctx.number_of_iterations) {
+            uhfm_flags.per = 0;
+        }
+        _UHFM_per_update_registers();
+        // Set done flag.
+        if (uhfm_flags.per == 0) {
+            _UHFM_per_stop(1, 0);
+        }
+    }
+errors:
+    return status;
+}
+
 #endif /* UHFM */
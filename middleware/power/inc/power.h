@@ -56,6 +56,9 @@ typedef enum {
     POWER_REQUESTER_ID_LVRM,
     POWER_REQUESTER_ID_RRM,
     POWER_REQUESTER_ID_SM,
+    POWER_REQUESTER_ID_SM_COUNTERS,
+    POWER_REQUESTER_ID_SM_FREQUENCY,
+    POWER_REQUESTER_ID_SM_SENSORS,
     POWER_REQUESTER_ID_MCU_API,
     POWER_REQUESTER_ID_RF_API,
     POWER_REQUESTER_ID_LAST
@@ -0,0 +1,29 @@
+/*
+ * rf_api_ext.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RF_API_EXT_H__
+#define __RF_API_EXT_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+
+/*** RF API EXT functions ***/
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*!******************************************************************
+ * \fn sfx_u32 RF_API_get_dl_phy_frame_count(void)
+ * \brief Get the number of downlink frames detected by the radio (sync word match), before the library CRC and authentication checks.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of downlink frames read from the radio FIFO since power-on.
+ *******************************************************************/
+sfx_u32 RF_API_get_dl_phy_frame_count(void);
+#endif
+
+#endif /* __RF_API_EXT_H__ */
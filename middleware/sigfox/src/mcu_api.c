@@ -167,9 +167,11 @@ MCU_API_status_t MCU_API_timer_status(MCU_API_timer_instance_t timer_instance, s
     // Local variables.
     MCU_API_status_t status = MCU_API_SUCCESS;
     TIM_status_t tim_status = TIM_SUCCESS;
-    // Read status.
-    tim_status = TIM_MCH_get_channel_status(MCU_API_TIMER_INSTANCE, (TIM_channel_t) timer_instance, timer_has_elapsed);
+    uint8_t channel_elapsed = 0;
+    // Read status (sfx_bool size is compiler dependent, the driver flag is converted explicitly).
+    tim_status = TIM_MCH_get_channel_status(MCU_API_TIMER_INSTANCE, (TIM_channel_t) timer_instance, &channel_elapsed);
     TIM_stack_exit_error(ERROR_BASE_TIM_MCU_API, (MCU_API_status_t) MCU_API_ERROR_DRIVER_TIM);
+    (*timer_has_elapsed) = (channel_elapsed == 0) ? SIGFOX_FALSE : SIGFOX_TRUE;
 errors:
     SIGFOX_RETURN();
 }
@@ -52,6 +52,7 @@
 #include "nvic_priority.h"
 #include "power.h"
 #include "pwr.h"
+#include "rf_api_ext.h"
 #include "rfe.h"
 #include "s2lp.h"
 #include "types.h"
@@ -133,9 +134,8 @@ typedef struct {
     // Common.
     RF_API_state_t state;
     volatile RF_API_flags_t flags;
-    // TX.
+    // TX (the same buffer is used for ramps, symbols and padding since they are loaded sequentially).
     sfx_u8 symbol_fifo_buffer[RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES];
-    sfx_u8 ramp_fifo_buffer[RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES];
     sfx_u8 tx_bitstream[SIGFOX_UL_BITSTREAM_SIZE_BYTES];
     sfx_u8 tx_bitstream_size_bytes;
     sfx_u8 tx_byte_idx;
@@ -145,6 +145,7 @@ typedef struct {
     // RX.
     sfx_u8 dl_phy_content[SIGFOX_DL_PHY_CONTENT_SIZE_BYTES];
     sfx_s16 dl_rssi_dbm;
+    sfx_u32 dl_phy_frame_count;
 #endif
 } RF_API_context_t;
 
@@ -219,13 +220,13 @@ static RF_API_status_t _RF_API_internal_process(void) {
     case RF_API_STATE_TX_RAMP_UP:
         // Fill ramp-up.
         for (idx = 0; idx < RF_API_SYMBOL_PROFILE_SIZE_BYTES; idx++) {
-            rf_api_ctx.ramp_fifo_buffer[(2 * idx)] = 0; // Deviation.
-            rf_api_ctx.ramp_fifo_buffer[(2 * idx) + 1] = RF_API_RAMP_AMPLITUDE_PROFILE[RF_API_SYMBOL_PROFILE_SIZE_BYTES - idx - 1]; // PA output power.
+            rf_api_ctx.symbol_fifo_buffer[(2 * idx)] = 0; // Deviation.
+            rf_api_ctx.symbol_fifo_buffer[(2 * idx) + 1] = RF_API_RAMP_AMPLITUDE_PROFILE[RF_API_SYMBOL_PROFILE_SIZE_BYTES - idx - 1]; // PA output power.
         }
         // Load ramp-up buffer into FIFO.
         s2lp_status = S2LP_send_command(S2LP_COMMAND_FLUSHTXFIFO);
         S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
-        s2lp_status = S2LP_write_fifo((sfx_u8*) rf_api_ctx.ramp_fifo_buffer, RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES);
+        s2lp_status = S2LP_write_fifo((sfx_u8*) rf_api_ctx.symbol_fifo_buffer, RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES);
         S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
         // Enable external GPIO interrupt.
         s2lp_status = S2LP_clear_all_irq();
@@ -296,11 +297,11 @@ static RF_API_status_t _RF_API_internal_process(void) {
         if (s2lp_irq_flag != 0) {
             // Fill ramp-down.
             for (idx = 0; idx < RF_API_SYMBOL_PROFILE_SIZE_BYTES; idx++) {
-                rf_api_ctx.ramp_fifo_buffer[(2 * idx)] = 0; // FDEV.
-                rf_api_ctx.ramp_fifo_buffer[(2 * idx) + 1] = RF_API_RAMP_AMPLITUDE_PROFILE[idx]; // PA output power for ramp-down.
+                rf_api_ctx.symbol_fifo_buffer[(2 * idx)] = 0; // FDEV.
+                rf_api_ctx.symbol_fifo_buffer[(2 * idx) + 1] = RF_API_RAMP_AMPLITUDE_PROFILE[idx]; // PA output power for ramp-down.
             }
             // Load ramp-down buffer into FIFO.
-            s2lp_status = S2LP_write_fifo((sfx_u8*) rf_api_ctx.ramp_fifo_buffer, RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES);
+            s2lp_status = S2LP_write_fifo((sfx_u8*) rf_api_ctx.symbol_fifo_buffer, RF_API_SYMBOL_FIFO_BUFFER_SIZE_BYTES);
             S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
             // Update state.
             rf_api_ctx.state = RF_API_STATE_TX_PADDING_BIT;
@@ -379,6 +380,7 @@ static RF_API_status_t _RF_API_internal_process(void) {
             S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
             rfe_status = RFE_get_rssi(S2LP_RSSI_TYPE_SYNC_WORD, &rf_api_ctx.dl_rssi_dbm);
             RFE_stack_exit_error(ERROR_BASE_RFE, (RF_API_status_t) RF_API_ERROR_DRIVER_RFE);
+            rf_api_ctx.dl_phy_frame_count++;
             // Stop radio.
             s2lp_status = S2LP_send_command(S2LP_COMMAND_SABORT);
             S2LP_stack_exit_error(ERROR_BASE_S2LP, (RF_API_status_t) RF_API_ERROR_DRIVER_S2LP);
@@ -712,6 +714,13 @@ errors:
 }
 #endif
 
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*******************************************************************/
+sfx_u32 RF_API_get_dl_phy_frame_count(void) {
+    return rf_api_ctx.dl_phy_frame_count;
+}
+#endif
+
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT)
 /*******************************************************************/
 RF_API_status_t RF_API_carrier_sense(RF_API_carrier_sense_parameters_t *carrier_sense_params) {
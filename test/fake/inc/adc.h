@@ -0,0 +1,80 @@
+/*
+ * adc.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __ADC_H__
+#define __ADC_H__
+
+#include "error.h"
+#include "stm32l0xx_drivers_flags.h"
+#include "types.h"
+
+/*** ADC macros ***/
+
+#define ADC_FULL_SCALE      4095
+#define ADC_INIT_DELAY_MS   100
+
+/*** ADC structures ***/
+
+/*!******************************************************************
+ * \enum ADC_status_t
+ * \brief ADC driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    ADC_SUCCESS = 0,
+    ADC_ERROR_TIMEOUT,
+    // Last base value.
+    ADC_ERROR_BASE_LAST = 0x0100
+} ADC_status_t;
+
+/*!******************************************************************
+ * \enum ADC_channel_t
+ * \brief ADC channels list.
+ *******************************************************************/
+typedef enum {
+    ADC_CHANNEL_IN0 = 0,
+    ADC_CHANNEL_IN1,
+    ADC_CHANNEL_IN2,
+    ADC_CHANNEL_IN3,
+    ADC_CHANNEL_IN4,
+    ADC_CHANNEL_IN5,
+    ADC_CHANNEL_IN6,
+    ADC_CHANNEL_IN7,
+    ADC_CHANNEL_IN8,
+    ADC_CHANNEL_IN9,
+    ADC_CHANNEL_VREFINT,
+    ADC_CHANNEL_TEMPERATURE_SENSOR,
+    ADC_CHANNEL_LAST
+} ADC_channel_t;
+
+/*!******************************************************************
+ * \struct ADC_gpio_t
+ * \brief ADC GPIOs list.
+ *******************************************************************/
+typedef struct {
+    uint8_t number_of_pins;
+} ADC_gpio_t;
+
+/*** ADC functions ***/
+
+ADC_status_t ADC_init(const ADC_gpio_t* pins);
+ADC_status_t ADC_de_init(void);
+ADC_status_t ADC_convert_channel(ADC_channel_t channel, int32_t* adc_data_12bits);
+int32_t ADC_get_vrefint_voltage_mv(void);
+ADC_status_t ADC_compute_vmcu(int32_t vrefint_12bits, int32_t vrefint_mv, int32_t* vmcu_mv);
+ADC_status_t ADC_compute_tmcu(int32_t vmcu_mv, int32_t tmcu_12bits, int32_t* tmcu_degrees);
+
+/*******************************************************************/
+#define ADC_exit_error(base) { ERROR_check_exit(adc_status, ADC_SUCCESS, base) }
+
+/*******************************************************************/
+#define ADC_stack_error(base) { ERROR_check_stack(adc_status, ADC_SUCCESS, base) }
+
+/*******************************************************************/
+#define ADC_stack_exit_error(base, code) { ERROR_check_stack_exit(adc_status, ADC_SUCCESS, base, code) }
+
+#endif /* __ADC_H__ */
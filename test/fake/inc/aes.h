@@ -0,0 +1,67 @@
+/*
+ * aes.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __AES_H__
+#define __AES_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** AES structures ***/
+
+/*!******************************************************************
+ * \enum AES_status_t
+ * \brief AES driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    AES_SUCCESS = 0,
+    AES_ERROR_TIMEOUT,
+    // Last base value.
+    AES_ERROR_BASE_LAST = 0x0100
+} AES_status_t;
+
+/*** AES functions ***/
+
+/*!******************************************************************
+ * \fn void AES_init(void)
+ * \brief Init AES peripheral.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void AES_init(void);
+
+/*!******************************************************************
+ * \fn void AES_de_init(void)
+ * \brief Release AES peripheral.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void AES_de_init(void);
+
+/*!******************************************************************
+ * \fn AES_status_t AES_encrypt(uint8_t* data_in, uint8_t* data_out, uint8_t* key)
+ * \brief Compute AES-128 of a single block (software model of the peripheral).
+ * \param[in]   data_in: Input data (16 bytes).
+ * \param[in]   key: AES key (16 bytes).
+ * \param[out]  data_out: Output data (16 bytes), may be the input buffer.
+ * \retval      Function execution status.
+ *******************************************************************/
+AES_status_t AES_encrypt(uint8_t* data_in, uint8_t* data_out, uint8_t* key);
+
+/*******************************************************************/
+#define AES_exit_error(base) { ERROR_check_exit(aes_status, AES_SUCCESS, base) }
+
+/*******************************************************************/
+#define AES_stack_error(base) { ERROR_check_stack(aes_status, AES_SUCCESS, base) }
+
+/*******************************************************************/
+#define AES_stack_exit_error(base, code) { ERROR_check_stack_exit(aes_status, AES_SUCCESS, base, code) }
+
+#endif /* __AES_H__ */
@@ -0,0 +1,25 @@
+/*
+ * bpsm_registers.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __BPSM_REGISTERS_H__
+#define __BPSM_REGISTERS_H__
+
+#include "common_registers.h"
+#include "types.h"
+#include "una.h"
+
+/*** BPSM REGISTERS structures ***/
+
+/*!******************************************************************
+ * \enum BPSM_register_address_t
+ * \brief BPSM registers map (host fake of the UNA library map).
+ *******************************************************************/
+typedef enum {
+    BPSM_REGISTER_ADDRESS_LAST = COMMON_REGISTER_ADDRESS_LAST
+} BPSM_register_address_t;
+
+#endif /* __BPSM_REGISTERS_H__ */
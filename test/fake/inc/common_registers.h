@@ -0,0 +1,61 @@
+/*
+ * common_registers.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __COMMON_REGISTERS_H__
+#define __COMMON_REGISTERS_H__
+
+#include "types.h"
+#include "una.h"
+
+/*** COMMON REGISTERS macros ***/
+
+#define COMMON_REGISTER_NODE_ID_MASK_NODE_ADDR          0x000000FF
+#define COMMON_REGISTER_NODE_ID_MASK_BOARD_ID           0x0000FF00
+
+#define COMMON_REGISTER_STATUS_0_MASK_RESET_FLAGS       0x000000FF
+#define COMMON_REGISTER_STATUS_0_MASK_BF                0x00000100
+#define COMMON_REGISTER_STATUS_0_MASK_ESF               0x00000200
+
+#define COMMON_REGISTER_CONTROL_0_MASK_RTRG             0x00000001
+#define COMMON_REGISTER_CONTROL_0_MASK_MTRG             0x00000002
+#define COMMON_REGISTER_CONTROL_0_MASK_BFC              0x00000004
+
+#define COMMON_REGISTER_ANALOG_DATA_0_MASK_VMCU         0x0000FFFF
+#define COMMON_REGISTER_ANALOG_DATA_0_MASK_TMCU         0x00FF0000
+
+// Access rights of the common registers, to be expanded at the beginning of each board access table.
+#define COMMON_REGISTER_ACCESS \
+    UNA_REGISTER_ACCESS_READ_ONLY, \
+    UNA_REGISTER_ACCESS_READ_ONLY, \
+    UNA_REGISTER_ACCESS_READ_ONLY, \
+    UNA_REGISTER_ACCESS_READ_ONLY, \
+    UNA_REGISTER_ACCESS_READ_ONLY, \
+    UNA_REGISTER_ACCESS_READ_ONLY, \
+    UNA_REGISTER_ACCESS_READ_ONLY, \
+    UNA_REGISTER_ACCESS_READ_WRITE, \
+    UNA_REGISTER_ACCESS_READ_ONLY,
+
+/*** COMMON REGISTERS structures ***/
+
+/*!******************************************************************
+ * \enum COMMON_register_address_t
+ * \brief Common registers map (host fake of the UNA library map).
+ *******************************************************************/
+typedef enum {
+    COMMON_REGISTER_ADDRESS_NODE_ID = 0,
+    COMMON_REGISTER_ADDRESS_HW_VERSION,
+    COMMON_REGISTER_ADDRESS_SW_VERSION_0,
+    COMMON_REGISTER_ADDRESS_SW_VERSION_1,
+    COMMON_REGISTER_ADDRESS_ERROR_STACK,
+    COMMON_REGISTER_ADDRESS_RESERVED,
+    COMMON_REGISTER_ADDRESS_STATUS_0,
+    COMMON_REGISTER_ADDRESS_CONTROL_0,
+    COMMON_REGISTER_ADDRESS_ANALOG_DATA_0,
+    COMMON_REGISTER_ADDRESS_LAST
+} COMMON_register_address_t;
+
+#endif /* __COMMON_REGISTERS_H__ */
@@ -0,0 +1,25 @@
+/*
+ * ddrm_registers.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __DDRM_REGISTERS_H__
+#define __DDRM_REGISTERS_H__
+
+#include "common_registers.h"
+#include "types.h"
+#include "una.h"
+
+/*** DDRM REGISTERS structures ***/
+
+/*!******************************************************************
+ * \enum DDRM_register_address_t
+ * \brief DDRM registers map (host fake of the UNA library map).
+ *******************************************************************/
+typedef enum {
+    DDRM_REGISTER_ADDRESS_LAST = COMMON_REGISTER_ADDRESS_LAST
+} DDRM_register_address_t;
+
+#endif /* __DDRM_REGISTERS_H__ */
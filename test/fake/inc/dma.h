@@ -0,0 +1,122 @@
+/*
+ * dma.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __DMA_H__
+#define __DMA_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** DMA structures ***/
+
+/*!******************************************************************
+ * \enum DMA_status_t
+ * \brief DMA driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    DMA_SUCCESS = 0,
+    DMA_ERROR_NULL_PARAMETER,
+    DMA_ERROR_CHANNEL,
+    DMA_ERROR_UNINITIALIZED,
+    // Last base value.
+    DMA_ERROR_BASE_LAST = 0x0100
+} DMA_status_t;
+
+/*!******************************************************************
+ * \enum DMA_channel_t
+ * \brief DMA channels list.
+ *******************************************************************/
+typedef enum {
+    DMA_CHANNEL_1 = 0,
+    DMA_CHANNEL_2,
+    DMA_CHANNEL_3,
+    DMA_CHANNEL_4,
+    DMA_CHANNEL_5,
+    DMA_CHANNEL_6,
+    DMA_CHANNEL_7,
+    DMA_CHANNEL_LAST
+} DMA_channel_t;
+
+/*!******************************************************************
+ * \enum DMA_direction_t
+ * \brief DMA transfer directions.
+ *******************************************************************/
+typedef enum {
+    DMA_DIRECTION_PERIPHERAL_TO_MEMORY = 0,
+    DMA_DIRECTION_MEMORY_TO_PERIPHERAL,
+    DMA_DIRECTION_LAST
+} DMA_direction_t;
+
+/*!******************************************************************
+ * \enum DMA_transfer_size_t
+ * \brief DMA transfer data sizes.
+ *******************************************************************/
+typedef enum {
+    DMA_TRANSFER_SIZE_8_BITS = 0,
+    DMA_TRANSFER_SIZE_16_BITS,
+    DMA_TRANSFER_SIZE_32_BITS,
+    DMA_TRANSFER_SIZE_LAST
+} DMA_transfer_size_t;
+
+/*!******************************************************************
+ * \enum DMA_priority_t
+ * \brief DMA channel priorities.
+ *******************************************************************/
+typedef enum {
+    DMA_PRIORITY_LOW = 0,
+    DMA_PRIORITY_MEDIUM,
+    DMA_PRIORITY_HIGH,
+    DMA_PRIORITY_VERY_HIGH,
+    DMA_PRIORITY_LAST
+} DMA_priority_t;
+
+/*!******************************************************************
+ * \brief DMA transfer interrupt callback.
+ *******************************************************************/
+typedef void (*DMA_transfer_irq_cb_t)(void);
+
+/*!******************************************************************
+ * \struct DMA_configuration_t
+ * \brief DMA channel configuration.
+ *******************************************************************/
+typedef struct {
+    DMA_direction_t direction;
+    DMA_transfer_irq_cb_t full_transfer_irq_callback;
+    DMA_transfer_irq_cb_t half_transfer_irq_callback;
+    uint32_t memory_address;
+    DMA_transfer_size_t memory_data_size;
+    uint8_t memory_address_increment;
+    uint32_t peripheral_address;
+    DMA_transfer_size_t peripheral_data_size;
+    uint8_t peripheral_address_increment;
+    uint16_t number_of_data;
+    uint8_t circular_mode;
+    DMA_priority_t priority;
+    uint8_t request_number;
+    uint8_t nvic_priority;
+} DMA_configuration_t;
+
+/*** DMA functions ***/
+
+DMA_status_t DMA_init(DMA_channel_t channel, DMA_configuration_t* configuration);
+DMA_status_t DMA_de_init(DMA_channel_t channel);
+DMA_status_t DMA_start(DMA_channel_t channel);
+DMA_status_t DMA_stop(DMA_channel_t channel);
+DMA_status_t DMA_set_memory_address(DMA_channel_t channel, uint32_t memory_address, uint16_t number_of_data);
+DMA_status_t DMA_get_number_of_transfered_data(DMA_channel_t channel, uint16_t* number_of_transfered_data);
+
+/*******************************************************************/
+#define DMA_exit_error(base) { ERROR_check_exit(dma_status, DMA_SUCCESS, base) }
+
+/*******************************************************************/
+#define DMA_stack_error(base) { ERROR_check_stack(dma_status, DMA_SUCCESS, base) }
+
+/*******************************************************************/
+#define DMA_stack_exit_error(base, code) { ERROR_check_stack_exit(dma_status, DMA_SUCCESS, base, code) }
+
+#endif /* __DMA_H__ */
@@ -0,0 +1,65 @@
+/*
+ * error.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __ERROR_H__
+#define __ERROR_H__
+
+#include "types.h"
+
+/*** ERROR structures ***/
+
+/*!******************************************************************
+ * \typedef ERROR_code_t
+ * \brief Error code type (host fake of embedded-utils).
+ *******************************************************************/
+typedef uint16_t ERROR_code_t;
+
+/*** ERROR functions ***/
+
+/*!******************************************************************
+ * \fn void ERROR_stack_add(ERROR_code_t code)
+ * \brief Add error to stack.
+ * \param[in]   code: Error code to store.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void ERROR_stack_add(ERROR_code_t code);
+
+/*!******************************************************************
+ * \fn uint8_t ERROR_stack_is_empty(void)
+ * \brief Check if error stack is empty.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      1 if the error stack is empty, 0 otherwise.
+ *******************************************************************/
+uint8_t ERROR_stack_is_empty(void);
+
+/*******************************************************************/
+#define ERROR_check_exit(driver_status, driver_success, driver_error_base) { \
+    if (driver_status != driver_success) { \
+        status = (driver_error_base + driver_status); \
+        goto errors; \
+    } \
+}
+
+/*******************************************************************/
+#define ERROR_check_stack(driver_status, driver_success, driver_error_base) { \
+    if (driver_status != driver_success) { \
+        ERROR_stack_add((ERROR_code_t) (driver_error_base + driver_status)); \
+    } \
+}
+
+/*******************************************************************/
+#define ERROR_check_stack_exit(driver_status, driver_success, driver_error_base, code) { \
+    if (driver_status != driver_success) { \
+        ERROR_stack_add((ERROR_code_t) (driver_error_base + driver_status)); \
+        status = code; \
+        goto errors; \
+    } \
+}
+
+#endif /* __ERROR_H__ */
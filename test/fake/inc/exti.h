@@ -0,0 +1,40 @@
+/*
+ * exti.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __EXTI_H__
+#define __EXTI_H__
+
+#include "gpio.h"
+#include "types.h"
+
+/*** EXTI structures ***/
+
+/*!******************************************************************
+ * \enum EXTI_trigger_t
+ * \brief EXTI trigger modes (host fake).
+ *******************************************************************/
+typedef enum {
+    EXTI_TRIGGER_RISING_EDGE = 0,
+    EXTI_TRIGGER_FALLING_EDGE,
+    EXTI_TRIGGER_ANY_EDGE,
+    EXTI_TRIGGER_LAST
+} EXTI_trigger_t;
+
+/*!******************************************************************
+ * \brief EXTI GPIO interrupt callback.
+ *******************************************************************/
+typedef void (*EXTI_gpio_irq_cb_t)(void);
+
+/*** EXTI functions ***/
+
+void EXTI_configure_gpio(const GPIO_pin_t* gpio, GPIO_pull_resistor_t pull_resistor, EXTI_trigger_t trigger, EXTI_gpio_irq_cb_t irq_callback, uint8_t nvic_priority);
+void EXTI_release_gpio(const GPIO_pin_t* gpio, GPIO_mode_t released_mode);
+void EXTI_enable_gpio_interrupt(const GPIO_pin_t* gpio);
+void EXTI_disable_gpio_interrupt(const GPIO_pin_t* gpio);
+void EXTI_clear_gpio_flag(const GPIO_pin_t* gpio);
+
+#endif /* __EXTI_H__ */
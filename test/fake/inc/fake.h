@@ -0,0 +1,505 @@
+/*
+ * fake.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __FAKE_H__
+#define __FAKE_H__
+
+#include "gpio.h"
+#include "s2lp.h"
+#include "sigfox_types.h"
+#include "tim.h"
+#include "types.h"
+
+/*** FAKE macros ***/
+
+#define FAKE_NVM_SIZE_BYTES             6144
+#define FAKE_NVM_WRITE_LIMIT_NONE       0xFFFFFFFF
+
+#define FAKE_RADIO_MESSAGES_MAX         64
+
+#define FAKE_S2LP_STREAM_SIZE_BYTES     65536
+
+#define FAKE_GPS_REPLIES_MAX            8
+#define FAKE_GPS_REPLY_SIZE_BYTES       512
+#define FAKE_GPS_TX_SIZE_BYTES          2048
+#define FAKE_GPS_MGA_MESSAGES_MAX       32
+
+#define FAKE_SHT3X_SENSORS_MAX          2
+
+/*** FAKE structures ***/
+
+/*!******************************************************************
+ * \struct FAKE_radio_message_t
+ * \brief Message recorded by the simulated radio.
+ *******************************************************************/
+typedef struct {
+    uint32_t start_time_seconds;
+    uint32_t end_time_seconds;
+    uint8_t number_of_frames;
+    uint8_t bidirectional_flag;
+    uint8_t ul_payload[SIGFOX_UL_PAYLOAD_MAX_SIZE_BYTES];
+    uint8_t ul_payload_size_bytes;
+} FAKE_radio_message_t;
+
+/*!******************************************************************
+ * \struct FAKE_radio_test_mode_t
+ * \brief RFP test mode recorded by the simulated radio.
+ *******************************************************************/
+typedef struct {
+    uint32_t start_time_seconds;
+    uint32_t end_time_seconds;
+    uint8_t test_mode_reference;
+    uint8_t ul_bit_rate;
+} FAKE_radio_test_mode_t;
+
+/*!******************************************************************
+ * \struct FAKE_radio_t
+ * \brief Simulated radio behavior and records.
+ *******************************************************************/
+typedef struct {
+    // Behavior.
+    uint8_t open_error;
+    uint8_t send_error;
+    uint32_t ul_frame_duration_seconds;
+    uint32_t dl_window_duration_seconds;
+    uint32_t dl_loss_mask;
+    uint32_t dl_crc_error_mask;
+    int16_t dl_rssi_dbm[FAKE_RADIO_MESSAGES_MAX];
+    // Records.
+    uint32_t open_count;
+    uint32_t close_count;
+    uint32_t message_count;
+    FAKE_radio_message_t messages[FAKE_RADIO_MESSAGES_MAX];
+    uint32_t dl_phy_frame_count;
+    uint32_t test_mode_count;
+    FAKE_radio_test_mode_t test_modes[FAKE_RADIO_MESSAGES_MAX];
+} FAKE_radio_t;
+
+/*!******************************************************************
+ * \struct FAKE_s2lp_t
+ * \brief Simulated S2LP transceiver behavior and records.
+ *******************************************************************/
+typedef struct {
+    // Behavior.
+    uint8_t dl_available;
+    uint8_t dl_phy_content[SIGFOX_DL_PHY_CONTENT_SIZE_BYTES];
+    int16_t rssi_dbm;
+    // Records.
+    S2LP_state_t state;
+    uint8_t stream[FAKE_S2LP_STREAM_SIZE_BYTES];
+    uint32_t stream_size_bytes;
+    uint32_t fifo_write_count;
+    uint32_t fifo_write_bytes;
+    uint32_t wake_up_count;
+    uint8_t fifo_level_min;
+    uint8_t fifo_level_max;
+    uint8_t fifo_overflow;
+    uint8_t fifo_underrun;
+} FAKE_s2lp_t;
+
+/*!******************************************************************
+ * \struct FAKE_gps_reply_t
+ * \brief Frame sent by the simulated GPS receiver when a given UBX message is written.
+ *******************************************************************/
+typedef struct {
+    uint8_t message_class;
+    uint8_t message_id;
+    uint8_t data[FAKE_GPS_REPLY_SIZE_BYTES];
+    uint32_t size_bytes;
+} FAKE_gps_reply_t;
+
+/*!******************************************************************
+ * \struct FAKE_gps_t
+ * \brief Simulated GPS receiver, USART / DMA pair and GPS middleware behavior and records.
+ *******************************************************************/
+typedef struct {
+    // Behavior.
+    FAKE_gps_reply_t replies[FAKE_GPS_REPLIES_MAX];
+    uint8_t number_of_replies;
+    uint32_t mga_nack_mask;
+    // Records.
+    uint8_t tx_data[FAKE_GPS_TX_SIZE_BYTES];
+    uint32_t tx_size_bytes;
+    uint32_t tx_message_count;
+    uint32_t rx_size_bytes;
+    uint32_t rx_lost_bytes;
+    uint32_t rxne_irq_count;
+    uint32_t dma_irq_count;
+    uint32_t idle_irq_count;
+    // GPS middleware records.
+    uint32_t exchange_count;
+    uint32_t aiding_configuration_count;
+    uint8_t autonomous_aiding_enable;
+    uint32_t mga_message_count;
+    uint8_t mga_message_ids[FAKE_GPS_MGA_MESSAGES_MAX];
+    uint32_t acquisition_start_count;
+    uint32_t acquisition_start_mga_message_count;
+    uint8_t acquisition_running;
+} FAKE_gps_t;
+
+/*!******************************************************************
+ * \struct FAKE_load_t
+ * \brief Simulated load output (relay) behavior and records.
+ *******************************************************************/
+typedef struct {
+    // Behavior.
+    uint32_t sequence_process_count;
+    // Records.
+    uint8_t output_state;
+    uint32_t set_count;
+    uint32_t switch_count;
+    uint8_t switching;
+    uint8_t sequence_state;
+    uint32_t sequence_remaining_count;
+    uint8_t request_pending;
+    uint8_t pending_state;
+} FAKE_load_t;
+
+/*!******************************************************************
+ * \struct FAKE_sht3x_sensor_t
+ * \brief Simulated SHT3x sensor behavior and records.
+ *******************************************************************/
+typedef struct {
+    // Behavior.
+    uint8_t i2c_address;
+    uint8_t present;
+    int32_t temperature_degrees;
+    int32_t humidity_percent;
+    uint8_t crc_error;
+    // Records.
+    uint8_t periodic_running;
+    uint16_t periodic_command;
+    uint16_t status_register;
+    uint16_t alert_high_set;
+    uint16_t alert_high_clear;
+    uint16_t alert_low_clear;
+    uint16_t alert_low_set;
+    uint32_t single_shot_count;
+    uint32_t fetch_count;
+    uint32_t fetch_nack_count;
+    uint32_t reset_count;
+} FAKE_sht3x_sensor_t;
+
+/*!******************************************************************
+ * \struct FAKE_sht3x_t
+ * \brief Simulated sensors I2C bus behavior and records.
+ *******************************************************************/
+typedef struct {
+    // Behavior.
+    FAKE_sht3x_sensor_t sensors[FAKE_SHT3X_SENSORS_MAX];
+    // Records.
+    uint32_t transfer_count;
+    uint32_t nack_count;
+} FAKE_sht3x_t;
+
+/*!******************************************************************
+ * \struct FAKE_tim_t
+ * \brief Simulated multi-channel timer records (Sigfox timer instance).
+ *******************************************************************/
+typedef struct {
+    uint8_t initialized;
+    uint8_t channel_running[TIM_CHANNEL_LAST];
+    uint64_t channel_deadline_us[TIM_CHANNEL_LAST];
+    TIM_waiting_mode_t channel_waiting_mode[TIM_CHANNEL_LAST];
+    uint32_t start_count;
+    uint32_t wait_count;
+} FAKE_tim_t;
+
+/*** FAKE global variables ***/
+
+extern FAKE_radio_t fake_radio;
+extern FAKE_s2lp_t fake_s2lp;
+extern FAKE_gps_t fake_gps;
+extern FAKE_load_t fake_load;
+extern FAKE_sht3x_t fake_sht3x;
+extern FAKE_tim_t fake_tim;
+
+/*** FAKE functions ***/
+
+/*!******************************************************************
+ * \fn void FAKE_reset(void)
+ * \brief Reset all fakes (clock, NVM, power domains, radio, error stack).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_reset(void);
+
+/*!******************************************************************
+ * \fn void FAKE_s2lp_reset(void)
+ * \brief Reset the simulated transceiver (FIFO, state, interrupt line and records).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_s2lp_reset(void);
+
+/*!******************************************************************
+ * \fn void FAKE_exti_reset(void)
+ * \brief Release all simulated external interrupt lines.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_exti_reset(void);
+
+/*!******************************************************************
+ * \fn void FAKE_exti_set_gpio(const GPIO_pin_t* gpio, uint8_t state)
+ * \brief Drive an input level and run its interrupt callback if the edge matches the configured trigger.
+ * \param[in]   gpio: GPIO to drive.
+ * \param[in]   state: New input level.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_exti_set_gpio(const GPIO_pin_t* gpio, uint8_t state);
+
+/*!******************************************************************
+ * \fn void FAKE_exti_trigger(const GPIO_pin_t* gpio)
+ * \brief Run the interrupt callback of a line if it is enabled, whatever the input level.
+ * \param[in]   gpio: GPIO of the line.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_exti_trigger(const GPIO_pin_t* gpio);
+
+/*!******************************************************************
+ * \fn void FAKE_timebase_reset(void)
+ * \brief Reset the simulated LSE and HSI clocks (no error, no calibration, default trimming).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_timebase_reset(void);
+
+/*!******************************************************************
+ * \fn void FAKE_timebase_set_clock_errors(int32_t lse_error_ppb, int32_t hsi_error_ppm)
+ * \brief Set the frequency errors of the simulated clocks against the simulated time.
+ * \param[in]   lse_error_ppb: LSE error without RTC smooth calibration.
+ * \param[in]   hsi_error_ppm: HSI error at the default trimming value.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_timebase_set_clock_errors(int32_t lse_error_ppb, int32_t hsi_error_ppm);
+
+/*!******************************************************************
+ * \fn uint8_t FAKE_timebase_get_rtc_direct_read(void)
+ * \brief Get the number of pending RTC direct read requests.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of requests (shadow registers are bypassed when non zero).
+ *******************************************************************/
+uint8_t FAKE_timebase_get_rtc_direct_read(void);
+
+/*!******************************************************************
+ * \fn void FAKE_load_reset(void)
+ * \brief Reset the simulated load output (open relay, single process call switching sequence).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_load_reset(void);
+
+/*!******************************************************************
+ * \fn void FAKE_tim_reset(void)
+ * \brief Reset the simulated multi-channel timer (all channels stopped).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_tim_reset(void);
+
+/*!******************************************************************
+ * \fn void FAKE_tim_sleep(void)
+ * \brief Advance the fake clock to the nearest running channel deadline, as a sleeping MCU woken up by the timer interrupt.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_tim_sleep(void);
+
+/*!******************************************************************
+ * \fn void FAKE_gps_reset(void)
+ * \brief Reset the simulated GPS receiver, USART and DMA channels.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_gps_reset(void);
+
+/*!******************************************************************
+ * \fn void FAKE_gps_add_reply(uint8_t message_class, uint8_t message_id, uint8_t* data, uint32_t size_bytes)
+ * \brief Program the bytes sent by the receiver each time a UBX message is written on the USART.
+ * \param[in]   message_class: Class of the written message.
+ * \param[in]   message_id: Identifier of the written message.
+ * \param[in]   data: Reply bytes.
+ * \param[in]   size_bytes: Number of reply bytes.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_gps_add_reply(uint8_t message_class, uint8_t message_id, uint8_t* data, uint32_t size_bytes);
+
+/*!******************************************************************
+ * \fn void FAKE_gps_receive(uint8_t* data, uint32_t size_bytes)
+ * \brief Transmit bytes from the receiver to the MCU (RXNE interrupt or DMA request depending on the USART configuration).
+ * \param[in]   data: Bytes to transmit.
+ * \param[in]   size_bytes: Number of bytes.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_gps_receive(uint8_t* data, uint32_t size_bytes);
+
+/*!******************************************************************
+ * \fn uint32_t FAKE_gps_build_ubx_frame(uint8_t message_class, uint8_t message_id, uint8_t* payload, uint16_t payload_size_bytes, uint8_t* frame)
+ * \brief Build a UBX frame (header and checksum).
+ * \param[in]   message_class: Message class.
+ * \param[in]   message_id: Message identifier.
+ * \param[in]   payload: Message payload.
+ * \param[in]   payload_size_bytes: Payload size.
+ * \param[out]  frame: Pointer to the frame (payload size + 8 bytes).
+ * \retval      Frame size in bytes.
+ *******************************************************************/
+uint32_t FAKE_gps_build_ubx_frame(uint8_t message_class, uint8_t message_id, uint8_t* payload, uint16_t payload_size_bytes, uint8_t* frame);
+
+/*!******************************************************************
+ * \fn void FAKE_sht3x_reset(void)
+ * \brief Reset the simulated sensors I2C bus (SHT3x sensors absent at 0x44 and 0x45).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ * \note        Not called by FAKE_reset() since the sensors model is only linked in the SM tests.
+ *******************************************************************/
+void FAKE_sht3x_reset(void);
+
+/*!******************************************************************
+ * \fn void FAKE_set_uptime_seconds(uint32_t uptime_seconds)
+ * \brief Set the simulated uptime.
+ * \param[in]   uptime_seconds: New uptime in seconds.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_set_uptime_seconds(uint32_t uptime_seconds);
+
+/*!******************************************************************
+ * \fn void FAKE_advance_milliseconds(uint32_t delay_ms)
+ * \brief Advance the simulated clock.
+ * \param[in]   delay_ms: Elapsed time in ms.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_advance_milliseconds(uint32_t delay_ms);
+
+/*!******************************************************************
+ * \fn void FAKE_advance_microseconds(uint32_t delay_us)
+ * \brief Advance the simulated clock with microsecond resolution.
+ * \param[in]   delay_us: Elapsed time in us.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_advance_microseconds(uint32_t delay_us);
+
+/*!******************************************************************
+ * \fn uint32_t FAKE_get_milliseconds(void)
+ * \brief Get the simulated clock in ms.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Simulated time in ms.
+ *******************************************************************/
+uint32_t FAKE_get_milliseconds(void);
+
+/*!******************************************************************
+ * \fn uint64_t FAKE_get_microseconds(void)
+ * \brief Get the simulated clock in us.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Simulated time in us.
+ *******************************************************************/
+uint64_t FAKE_get_microseconds(void);
+
+/*!******************************************************************
+ * \fn uint32_t FAKE_get_nvm_write_count(void)
+ * \brief Get the number of bytes written in the simulated EEPROM.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of NVM byte writes since the last reset.
+ *******************************************************************/
+uint32_t FAKE_get_nvm_write_count(void);
+
+/*!******************************************************************
+ * \fn void FAKE_set_nvm_write_limit(uint32_t nvm_write_count)
+ * \brief Simulate a power loss: bytes writes are lost once the NVM write count reaches the limit.
+ * \param[in]   nvm_write_count: Write count limit, FAKE_NVM_WRITE_LIMIT_NONE to disable.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_set_nvm_write_limit(uint32_t nvm_write_count);
+
+/*!******************************************************************
+ * \fn uint32_t FAKE_get_delay_count(void)
+ * \brief Get the number of blocking delays performed.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of LPTIM delay calls since the last reset.
+ *******************************************************************/
+uint32_t FAKE_get_delay_count(void);
+
+/*!******************************************************************
+ * \fn uint32_t FAKE_get_power_off_count(uint8_t domain)
+ * \brief Get the number of times a power domain was turned off.
+ * \param[in]   domain: Power domain.
+ * \param[out]  none
+ * \retval      Number of power domain turn off since the last reset.
+ *******************************************************************/
+uint32_t FAKE_get_power_off_count(uint8_t domain);
+
+/*!******************************************************************
+ * \fn uint32_t FAKE_get_power_request_count(uint8_t requester_id)
+ * \brief Get the number of power domain enable requests of a requester.
+ * \param[in]   requester_id: Power requester.
+ * \param[out]  none
+ * \retval      Number of enable requests since the last reset.
+ *******************************************************************/
+uint32_t FAKE_get_power_request_count(uint8_t requester_id);
+
+/*!******************************************************************
+ * \fn uint32_t FAKE_get_adc_conversion_count(void)
+ * \brief Get the number of ADC conversions performed.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of ADC conversions since the last reset.
+ *******************************************************************/
+uint32_t FAKE_get_adc_conversion_count(void);
+
+/*!******************************************************************
+ * \fn void FAKE_set_analog_data(uint8_t channel, int32_t analog_data)
+ * \brief Set the value returned by an analog channel.
+ * \param[in]   channel: Analog channel.
+ * \param[in]   analog_data: Value to return.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_set_analog_data(uint8_t channel, int32_t analog_data);
+
+/*!******************************************************************
+ * \fn int32_t FAKE_get_analog_data(uint8_t channel)
+ * \brief Get the value returned by an analog channel.
+ * \param[in]   channel: Analog channel.
+ * \param[out]  none
+ * \retval      Value set with FAKE_set_analog_data.
+ *******************************************************************/
+int32_t FAKE_get_analog_data(uint8_t channel);
+
+/*!******************************************************************
+ * \fn void FAKE_set_adc_data(uint8_t channel, int32_t adc_data_12bits)
+ * \brief Set the raw code returned by an ADC channel.
+ * \param[in]   channel: ADC channel.
+ * \param[in]   adc_data_12bits: Code to return.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void FAKE_set_adc_data(uint8_t channel, int32_t adc_data_12bits);
+
+#endif /* __FAKE_H__ */
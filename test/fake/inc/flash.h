@@ -0,0 +1,37 @@
+/*
+ * flash.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __FLASH_H__
+#define __FLASH_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** FLASH structures ***/
+
+/*!******************************************************************
+ * \enum FLASH_status_t
+ * \brief FLASH driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    FLASH_SUCCESS = 0,
+    FLASH_ERROR_TIMEOUT,
+    // Last base value.
+    FLASH_ERROR_BASE_LAST = 0x0100
+} FLASH_status_t;
+
+/*******************************************************************/
+#define FLASH_exit_error(base) { ERROR_check_exit(flash_status, FLASH_SUCCESS, base) }
+
+/*******************************************************************/
+#define FLASH_stack_error(base) { ERROR_check_stack(flash_status, FLASH_SUCCESS, base) }
+
+/*******************************************************************/
+#define FLASH_stack_exit_error(base, code) { ERROR_check_stack_exit(flash_status, FLASH_SUCCESS, base, code) }
+
+#endif /* __FLASH_H__ */
@@ -0,0 +1,34 @@
+/*
+ * gpio_mapping.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __GPIO_MAPPING_H__
+#define __GPIO_MAPPING_H__
+
+#include "adc.h"
+#include "gpio.h"
+#include "i2c.h"
+#include "usart.h"
+
+/*** GPIO MAPPING global variables ***/
+
+// Analog inputs.
+extern const ADC_gpio_t GPIO_ADC;
+// S2LP GPIOs.
+extern const GPIO_pin_t GPIO_S2LP_GPIO0;
+// Digital inputs.
+extern const GPIO_pin_t GPIO_DIO0;
+extern const GPIO_pin_t GPIO_DIO1;
+extern const GPIO_pin_t GPIO_DIO2;
+extern const GPIO_pin_t GPIO_DIO3;
+// GPS.
+extern const GPIO_pin_t GPIO_GPS_VBCKP;
+extern const USART_gpio_t GPIO_GPS_USART;
+extern const GPIO_pin_t GPIO_GPS_TIMEPULSE;
+// Sensors.
+extern const I2C_gpio_t GPIO_SENSORS_I2C;
+
+#endif /* __GPIO_MAPPING_H__ */
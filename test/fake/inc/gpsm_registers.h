@@ -0,0 +1,113 @@
+/*
+ * gpsm_registers.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __GPSM_REGISTERS_H__
+#define __GPSM_REGISTERS_H__
+
+#include "common_registers.h"
+#include "types.h"
+#include "una.h"
+
+/*** GPSM REGISTERS macros ***/
+
+#define GPSM_REGISTER_ADDRESS_BASE                          COMMON_REGISTER_ADDRESS_LAST
+
+#define GPSM_REGISTER_CONFIGURATION_0_MASK_AAF              0x00000001
+#define GPSM_REGISTER_CONFIGURATION_0_MASK_BKFH             0x00000002
+
+#define GPSM_REGISTER_CONFIGURATION_1_MASK_TIME_TIMEOUT     0x0000FFFF
+#define GPSM_REGISTER_CONFIGURATION_1_MASK_GEOLOC_TIMEOUT   0xFFFF0000
+
+#define GPSM_REGISTER_CONFIGURATION_2_MASK_TP_FREQUENCY     0xFFFFFFFF
+
+#define GPSM_REGISTER_CONFIGURATION_3_MASK_TP_DUTY_CYCLE    0x000000FF
+
+#define GPSM_REGISTER_STATUS_1_MASK_TFS                     0x00000001
+#define GPSM_REGISTER_STATUS_1_MASK_GFS                     0x00000002
+#define GPSM_REGISTER_STATUS_1_MASK_BKENST                  0x0000000C
+#define GPSM_REGISTER_STATUS_1_MASK_TPST                    0x00000010
+#define GPSM_REGISTER_STATUS_1_MASK_PWST                    0x00000020
+
+#define GPSM_REGISTER_CONTROL_1_MASK_TTRG                   0x00000001
+#define GPSM_REGISTER_CONTROL_1_MASK_GTRG                   0x00000002
+#define GPSM_REGISTER_CONTROL_1_MASK_TPEN                   0x00000004
+#define GPSM_REGISTER_CONTROL_1_MASK_PWMD                   0x00000008
+#define GPSM_REGISTER_CONTROL_1_MASK_PWEN                   0x00000010
+#define GPSM_REGISTER_CONTROL_1_MASK_BKEN                   0x00000020
+
+#define GPSM_REGISTER_TIME_DATA_0_MASK_DATE                 0x000000FF
+#define GPSM_REGISTER_TIME_DATA_0_MASK_MONTH                0x0000FF00
+#define GPSM_REGISTER_TIME_DATA_0_MASK_YEAR                 0x00FF0000
+
+#define GPSM_REGISTER_TIME_DATA_1_MASK_SECOND               0x000000FF
+#define GPSM_REGISTER_TIME_DATA_1_MASK_MINUTE               0x0000FF00
+#define GPSM_REGISTER_TIME_DATA_1_MASK_HOUR                 0x00FF0000
+
+#define GPSM_REGISTER_TIME_DATA_2_MASK_FIX_DURATION         0x0000FFFF
+
+#define GPSM_REGISTER_GEOLOC_DATA_0_MASK_NF                 0x00000001
+#define GPSM_REGISTER_GEOLOC_DATA_0_MASK_SECOND             0x0001FFFE
+#define GPSM_REGISTER_GEOLOC_DATA_0_MASK_MINUTE             0x00FC0000
+#define GPSM_REGISTER_GEOLOC_DATA_0_MASK_DEGREE             0xFF000000
+
+#define GPSM_REGISTER_GEOLOC_DATA_1_MASK_EF                 0x00000001
+#define GPSM_REGISTER_GEOLOC_DATA_1_MASK_SECOND             0x0001FFFE
+#define GPSM_REGISTER_GEOLOC_DATA_1_MASK_MINUTE             0x00FC0000
+#define GPSM_REGISTER_GEOLOC_DATA_1_MASK_DEGREE             0xFF000000
+
+#define GPSM_REGISTER_GEOLOC_DATA_2_MASK_ALTITUDE           0xFFFFFFFF
+
+#define GPSM_REGISTER_GEOLOC_DATA_3_MASK_FIX_DURATION       0x0000FFFF
+
+#define GPSM_REGISTER_ANALOG_DATA_1_MASK_VGPS               0x0000FFFF
+#define GPSM_REGISTER_ANALOG_DATA_1_MASK_VANT               0xFFFF0000
+
+/*** GPSM REGISTERS structures ***/
+
+/*!******************************************************************
+ * \enum GPSM_register_address_t
+ * \brief GPSM registers map (host fake of the UNA library map).
+ *******************************************************************/
+typedef enum {
+    GPSM_REGISTER_ADDRESS_CONFIGURATION_0 = GPSM_REGISTER_ADDRESS_BASE,
+    GPSM_REGISTER_ADDRESS_CONFIGURATION_1,
+    GPSM_REGISTER_ADDRESS_CONFIGURATION_2,
+    GPSM_REGISTER_ADDRESS_CONFIGURATION_3,
+    GPSM_REGISTER_ADDRESS_STATUS_1,
+    GPSM_REGISTER_ADDRESS_CONTROL_1,
+    GPSM_REGISTER_ADDRESS_TIME_DATA_0,
+    GPSM_REGISTER_ADDRESS_TIME_DATA_1,
+    GPSM_REGISTER_ADDRESS_TIME_DATA_2,
+    GPSM_REGISTER_ADDRESS_GEOLOC_DATA_0,
+    GPSM_REGISTER_ADDRESS_GEOLOC_DATA_1,
+    GPSM_REGISTER_ADDRESS_GEOLOC_DATA_2,
+    GPSM_REGISTER_ADDRESS_GEOLOC_DATA_3,
+    GPSM_REGISTER_ADDRESS_ANALOG_DATA_1,
+    GPSM_REGISTER_ADDRESS_LAST
+} GPSM_register_address_t;
+
+/*** GPSM REGISTERS global variables ***/
+
+static const UNA_register_access_t GPSM_REGISTER_ACCESS[GPSM_REGISTER_ADDRESS_LAST] = {
+    COMMON_REGISTER_ACCESS
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY
+};
+
+#endif /* __GPSM_REGISTERS_H__ */
@@ -0,0 +1,66 @@
+/*
+ * i2c.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __I2C_H__
+#define __I2C_H__
+
+#include "error.h"
+#include "gpio.h"
+#include "types.h"
+
+/*** I2C structures ***/
+
+/*!******************************************************************
+ * \enum I2C_status_t
+ * \brief I2C driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    I2C_SUCCESS = 0,
+    I2C_ERROR_NULL_PARAMETER,
+    I2C_ERROR_INSTANCE,
+    I2C_ERROR_TIMEOUT,
+    I2C_ERROR_NACK,
+    // Last base value.
+    I2C_ERROR_BASE_LAST = 0x0100
+} I2C_status_t;
+
+/*!******************************************************************
+ * \enum I2C_instance_t
+ * \brief I2C instances list.
+ *******************************************************************/
+typedef enum {
+    I2C_INSTANCE_I2C1 = 0,
+    I2C_INSTANCE_LAST
+} I2C_instance_t;
+
+/*!******************************************************************
+ * \struct I2C_gpio_t
+ * \brief I2C GPIO pins list.
+ *******************************************************************/
+typedef struct {
+    const GPIO_pin_t* scl;
+    const GPIO_pin_t* sda;
+} I2C_gpio_t;
+
+/*** I2C functions ***/
+
+I2C_status_t I2C_init(I2C_instance_t instance, const I2C_gpio_t* pins);
+I2C_status_t I2C_de_init(I2C_instance_t instance, const I2C_gpio_t* pins);
+I2C_status_t I2C_write(I2C_instance_t instance, uint8_t slave_address, uint8_t* data, uint8_t data_size_bytes, uint8_t stop_flag);
+I2C_status_t I2C_read(I2C_instance_t instance, uint8_t slave_address, uint8_t* data, uint8_t data_size_bytes);
+
+/*******************************************************************/
+#define I2C_exit_error(base) { ERROR_check_exit(i2c_status, I2C_SUCCESS, base) }
+
+/*******************************************************************/
+#define I2C_stack_error(base) { ERROR_check_stack(i2c_status, I2C_SUCCESS, base) }
+
+/*******************************************************************/
+#define I2C_stack_exit_error(base, code) { ERROR_check_stack_exit(i2c_status, I2C_SUCCESS, base, code) }
+
+#endif /* __I2C_H__ */
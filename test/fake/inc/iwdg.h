@@ -0,0 +1,48 @@
+/*
+ * iwdg.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __IWDG_H__
+#define __IWDG_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** IWDG structures ***/
+
+/*!******************************************************************
+ * \enum IWDG_status_t
+ * \brief IWDG driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    IWDG_SUCCESS = 0,
+    IWDG_ERROR_TIMEOUT,
+    // Last base value.
+    IWDG_ERROR_BASE_LAST = 0x0100
+} IWDG_status_t;
+
+/*** IWDG functions ***/
+
+/*!******************************************************************
+ * \fn void IWDG_reload(void)
+ * \brief Reload watchdog counter.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void IWDG_reload(void);
+
+/*******************************************************************/
+#define IWDG_exit_error(base) { ERROR_check_exit(iwdg_status, IWDG_SUCCESS, base) }
+
+/*******************************************************************/
+#define IWDG_stack_error(base) { ERROR_check_stack(iwdg_status, IWDG_SUCCESS, base) }
+
+/*******************************************************************/
+#define IWDG_stack_exit_error(base, code) { ERROR_check_stack_exit(iwdg_status, IWDG_SUCCESS, base, code) }
+
+#endif /* __IWDG_H__ */
@@ -0,0 +1,61 @@
+/*
+ * lptim.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LPTIM_H__
+#define __LPTIM_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** LPTIM structures ***/
+
+/*!******************************************************************
+ * \enum LPTIM_status_t
+ * \brief LPTIM driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    LPTIM_SUCCESS = 0,
+    LPTIM_ERROR_DELAY_UNDERFLOW,
+    LPTIM_ERROR_DELAY_MODE,
+    // Last base value.
+    LPTIM_ERROR_BASE_LAST = 0x0100
+} LPTIM_status_t;
+
+/*!******************************************************************
+ * \enum LPTIM_delay_mode_t
+ * \brief LPTIM delay waiting modes.
+ *******************************************************************/
+typedef enum {
+    LPTIM_DELAY_MODE_ACTIVE = 0,
+    LPTIM_DELAY_MODE_SLEEP,
+    LPTIM_DELAY_MODE_STOP,
+    LPTIM_DELAY_MODE_LAST
+} LPTIM_delay_mode_t;
+
+/*** LPTIM functions ***/
+
+/*!******************************************************************
+ * \fn LPTIM_status_t LPTIM_delay_milliseconds(uint32_t delay_ms, LPTIM_delay_mode_t delay_mode)
+ * \brief Delay function (advances the fake clock).
+ * \param[in]   delay_ms: Delay to wait in ms.
+ * \param[in]   delay_mode: Delay waiting mode.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+LPTIM_status_t LPTIM_delay_milliseconds(uint32_t delay_ms, LPTIM_delay_mode_t delay_mode);
+
+/*******************************************************************/
+#define LPTIM_exit_error(base) { ERROR_check_exit(lptim_status, LPTIM_SUCCESS, base) }
+
+/*******************************************************************/
+#define LPTIM_stack_error(base) { ERROR_check_stack(lptim_status, LPTIM_SUCCESS, base) }
+
+/*******************************************************************/
+#define LPTIM_stack_exit_error(base, code) { ERROR_check_stack_exit(lptim_status, LPTIM_SUCCESS, base, code) }
+
+#endif /* __LPTIM_H__ */
@@ -0,0 +1,37 @@
+/*
+ * lpuart.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __LPUART_H__
+#define __LPUART_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** LPUART structures ***/
+
+/*!******************************************************************
+ * \enum LPUART_status_t
+ * \brief LPUART driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    LPUART_SUCCESS = 0,
+    LPUART_ERROR_TIMEOUT,
+    // Last base value.
+    LPUART_ERROR_BASE_LAST = 0x0100
+} LPUART_status_t;
+
+/*******************************************************************/
+#define LPUART_exit_error(base) { ERROR_check_exit(lpuart_status, LPUART_SUCCESS, base) }
+
+/*******************************************************************/
+#define LPUART_stack_error(base) { ERROR_check_stack(lpuart_status, LPUART_SUCCESS, base) }
+
+/*******************************************************************/
+#define LPUART_stack_exit_error(base, code) { ERROR_check_stack_exit(lpuart_status, LPUART_SUCCESS, base, code) }
+
+#endif /* __LPUART_H__ */
@@ -0,0 +1,218 @@
+/*
+ * mcu_api.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __MCU_API_H__
+#define __MCU_API_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+
+/*** MCU API structures ***/
+
+/*!******************************************************************
+ * \enum MCU_API_status_t
+ * \brief MCU API error codes (host fake, custom codes are defined by the implementation).
+ *******************************************************************/
+typedef enum {
+    MCU_API_SUCCESS = 0,
+    MCU_API_ERROR
+} MCU_API_status_t;
+
+/*!******************************************************************
+ * \struct MCU_API_config_t
+ * \brief MCU API configuration structure.
+ *******************************************************************/
+typedef struct {
+    const SIGFOX_rc_t* rc;
+} MCU_API_config_t;
+
+/*!******************************************************************
+ * \enum MCU_API_timer_instance_t
+ * \brief MCU API timer instances.
+ *******************************************************************/
+typedef enum {
+    MCU_API_TIMER_INSTANCE_T_IFX = 0,
+    MCU_API_TIMER_INSTANCE_T_CONF,
+    MCU_API_TIMER_INSTANCE_T_W,
+    MCU_API_TIMER_INSTANCE_T_RX,
+    MCU_API_TIMER_INSTANCE_LAST
+} MCU_API_timer_instance_t;
+
+/*!******************************************************************
+ * \enum MCU_API_timer_reason_t
+ * \brief MCU API timer reasons.
+ *******************************************************************/
+typedef enum {
+    MCU_API_TIMER_REASON_T_IFX = 0,
+    MCU_API_TIMER_REASON_T_CONF,
+    MCU_API_TIMER_REASON_T_W,
+    MCU_API_TIMER_REASON_T_RX,
+    MCU_API_TIMER_REASON_LAST
+} MCU_API_timer_reason_t;
+
+/*!******************************************************************
+ * \struct MCU_API_timer_t
+ * \brief MCU API timer parameters.
+ *******************************************************************/
+typedef struct {
+    MCU_API_timer_instance_t instance;
+    MCU_API_timer_reason_t reason;
+    sfx_u32 duration_ms;
+} MCU_API_timer_t;
+
+/*!******************************************************************
+ * \struct MCU_API_encryption_data_t
+ * \brief MCU API encryption parameters.
+ *******************************************************************/
+typedef struct {
+    sfx_u8* data;
+    sfx_u8 data_size_bytes;
+#ifdef SIGFOX_EP_PUBLIC_KEY_CAPABLE
+    SIGFOX_ep_key_t key;
+#endif
+} MCU_API_encryption_data_t;
+
+/*!******************************************************************
+ * \enum MCU_API_latency_t
+ * \brief MCU API latency sources.
+ *******************************************************************/
+typedef enum {
+    MCU_API_LATENCY_GET_VOLTAGE_TEMPERATURE = 0,
+    MCU_API_LATENCY_LAST
+} MCU_API_latency_t;
+
+/*** MCU API functions ***/
+
+#if (defined SIGFOX_EP_ASYNCHRONOUS) || (defined SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE)
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_open(MCU_API_config_t* mcu_api_config)
+ * \brief Open the MCU driver.
+ * \param[in]   mcu_api_config: Pointer to the MCU API configuration.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_open(MCU_API_config_t* mcu_api_config);
+#endif
+
+#ifdef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_close(void)
+ * \brief Close the MCU driver.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_close(void);
+#endif
+
+#ifdef SIGFOX_EP_TIMER_REQUIRED
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_timer_start(MCU_API_timer_t* timer)
+ * \brief Start a Sigfox timer.
+ * \param[in]   timer: Pointer to the timer parameters.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_timer_start(MCU_API_timer_t* timer);
+
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_timer_stop(MCU_API_timer_instance_t timer_instance)
+ * \brief Stop a Sigfox timer.
+ * \param[in]   timer_instance: Timer to stop.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_timer_stop(MCU_API_timer_instance_t timer_instance);
+
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_timer_status(MCU_API_timer_instance_t timer_instance, sfx_bool* timer_has_elapsed)
+ * \brief Get the status of a Sigfox timer.
+ * \param[in]   timer_instance: Timer to read.
+ * \param[out]  timer_has_elapsed: Pointer to the timer status.
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_timer_status(MCU_API_timer_instance_t timer_instance, sfx_bool* timer_has_elapsed);
+
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_timer_wait_cplt(MCU_API_timer_instance_t timer_instance)
+ * \brief Wait for a Sigfox timer completion.
+ * \param[in]   timer_instance: Timer to wait for.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_timer_wait_cplt(MCU_API_timer_instance_t timer_instance);
+#endif
+
+#ifdef SIGFOX_EP_AES_HW
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_aes_128_cbc_encrypt(MCU_API_encryption_data_t* aes_data)
+ * \brief Encrypt data with the device key.
+ * \param[in]   aes_data: Pointer to the data to encrypt.
+ * \param[out]  aes_data: Encrypted data (in place).
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_aes_128_cbc_encrypt(MCU_API_encryption_data_t* aes_data);
+#endif
+
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_get_ep_id(sfx_u8* ep_id, sfx_u8 ep_id_size_bytes)
+ * \brief Read the device ID.
+ * \param[in]   ep_id_size_bytes: Number of bytes to read.
+ * \param[out]  ep_id: Device ID.
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_get_ep_id(sfx_u8* ep_id, sfx_u8 ep_id_size_bytes);
+
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_get_nvm(sfx_u8* nvm_data, sfx_u8 nvm_data_size_bytes)
+ * \brief Read the Sigfox NVM data.
+ * \param[in]   nvm_data_size_bytes: Number of bytes to read.
+ * \param[out]  nvm_data: Read data.
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_get_nvm(sfx_u8* nvm_data, sfx_u8 nvm_data_size_bytes);
+
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_set_nvm(sfx_u8* nvm_data, sfx_u8 nvm_data_size_bytes)
+ * \brief Write the Sigfox NVM data.
+ * \param[in]   nvm_data: Data to write.
+ * \param[in]   nvm_data_size_bytes: Number of bytes to write.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_set_nvm(sfx_u8* nvm_data, sfx_u8 nvm_data_size_bytes);
+
+#if (defined SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE) || (defined SIGFOX_EP_BIDIRECTIONAL)
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_get_voltage_temperature(sfx_u16* voltage_idle_mv, sfx_u16* voltage_tx_mv, sfx_s16* temperature_tenth_degrees)
+ * \brief Measure the MCU supply voltage and temperature.
+ * \param[in]   none
+ * \param[out]  voltage_idle_mv: Supply voltage in idle state.
+ * \param[out]  voltage_tx_mv: Supply voltage during transmission.
+ * \param[out]  temperature_tenth_degrees: MCU temperature in 1/10 degrees.
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_get_voltage_temperature(sfx_u16* voltage_idle_mv, sfx_u16* voltage_tx_mv, sfx_s16* temperature_tenth_degrees);
+#endif
+
+#if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION) && (defined SIGFOX_EP_BIDIRECTIONAL)
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_get_latency(MCU_API_latency_t latency_type, sfx_u32* latency_ms)
+ * \brief Read the latency of an MCU operation.
+ * \param[in]   latency_type: Operation to read.
+ * \param[out]  latency_ms: Latency in ms.
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_get_latency(MCU_API_latency_t latency_type, sfx_u32* latency_ms);
+#endif
+
+/*******************************************************************/
+#define MCU_API_check_status(error) { if (mcu_api_status != MCU_API_SUCCESS) { SIGFOX_EXIT_ERROR(error) } }
+
+#endif /* __MCU_API_H__ */
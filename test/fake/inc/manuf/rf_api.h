@@ -0,0 +1,123 @@
+/*
+ * rf_api.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RF_API_H__
+#define __RF_API_H__
+
+#include "sigfox_types.h"
+
+/*** RF API structures ***/
+
+/*!******************************************************************
+ * \enum RF_API_status_t
+ * \brief RF API error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    RF_API_SUCCESS = 0,
+    RF_API_ERROR
+} RF_API_status_t;
+
+/*!******************************************************************
+ * \enum RF_API_mode_t
+ * \brief Radio modes.
+ *******************************************************************/
+typedef enum {
+    RF_API_MODE_TX = 0,
+    RF_API_MODE_RX,
+    RF_API_MODE_LAST
+} RF_API_mode_t;
+
+/*!******************************************************************
+ * \enum RF_API_modulation_t
+ * \brief Radio modulations.
+ *******************************************************************/
+typedef enum {
+    RF_API_MODULATION_NONE = 0,
+    RF_API_MODULATION_DBPSK,
+    RF_API_MODULATION_GFSK,
+    RF_API_MODULATION_LAST
+} RF_API_modulation_t;
+
+/*!******************************************************************
+ * \enum RF_API_latency_t
+ * \brief Radio latency types.
+ *******************************************************************/
+typedef enum {
+    RF_API_LATENCY_WAKE_UP = 0,
+    RF_API_LATENCY_INIT_TX,
+    RF_API_LATENCY_SEND_START,
+    RF_API_LATENCY_SEND_STOP,
+    RF_API_LATENCY_DE_INIT_TX,
+    RF_API_LATENCY_SLEEP,
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    RF_API_LATENCY_INIT_RX,
+    RF_API_LATENCY_RECEIVE_START,
+    RF_API_LATENCY_RECEIVE_STOP,
+    RF_API_LATENCY_DE_INIT_RX,
+#endif
+    RF_API_LATENCY_LAST
+} RF_API_latency_t;
+
+/*!******************************************************************
+ * \struct RF_API_config_t
+ * \brief Radio configuration.
+ *******************************************************************/
+typedef struct {
+    const SIGFOX_rc_t* rc;
+} RF_API_config_t;
+
+/*!******************************************************************
+ * \struct RF_API_radio_parameters_t
+ * \brief Radio parameters.
+ *******************************************************************/
+typedef struct {
+    RF_API_mode_t rf_mode;
+    sfx_u32 frequency_hz;
+    RF_API_modulation_t modulation;
+    sfx_u16 bit_rate_bps;
+    sfx_s8 tx_power_dbm_eirp;
+    sfx_u32 deviation_hz;
+} RF_API_radio_parameters_t;
+
+/*!******************************************************************
+ * \struct RF_API_tx_data_t
+ * \brief Uplink bitstream to send.
+ *******************************************************************/
+typedef struct {
+    sfx_u8* bitstream;
+    sfx_u8 bitstream_size_bytes;
+} RF_API_tx_data_t;
+
+/*!******************************************************************
+ * \struct RF_API_rx_data_t
+ * \brief Downlink reception result.
+ *******************************************************************/
+typedef struct {
+    sfx_bool data_received;
+} RF_API_rx_data_t;
+
+/*** RF API functions ***/
+
+RF_API_status_t RF_API_open(RF_API_config_t* rf_api_config);
+RF_API_status_t RF_API_close(void);
+RF_API_status_t RF_API_wake_up(void);
+RF_API_status_t RF_API_sleep(void);
+RF_API_status_t RF_API_init(RF_API_radio_parameters_t* radio_parameters);
+RF_API_status_t RF_API_de_init(void);
+RF_API_status_t RF_API_send(RF_API_tx_data_t* tx_data);
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+RF_API_status_t RF_API_receive(RF_API_rx_data_t* rx_data);
+RF_API_status_t RF_API_get_dl_phy_content_and_rssi(sfx_u8* dl_phy_content, sfx_u8 dl_phy_content_size, sfx_s16* dl_rssi_dbm);
+#endif
+RF_API_status_t RF_API_get_latency(RF_API_latency_t latency_type, sfx_u32* latency_ms);
+RF_API_status_t RF_API_start_continuous_wave(void);
+void RF_API_error(void);
+
+/*******************************************************************/
+#define RF_API_check_status(error) { if (rf_api_status != RF_API_SUCCESS) { SIGFOX_EXIT_ERROR(error) } }
+
+#endif /* __RF_API_H__ */
@@ -0,0 +1,37 @@
+/*
+ * math.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __MATH_H__
+#define __MATH_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** MATH structures ***/
+
+/*!******************************************************************
+ * \enum MATH_status_t
+ * \brief MATH driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    MATH_SUCCESS = 0,
+    MATH_ERROR_NULL_PARAMETER,
+    // Last base value.
+    MATH_ERROR_BASE_LAST = 0x0100
+} MATH_status_t;
+
+/*******************************************************************/
+#define MATH_exit_error(base) { ERROR_check_exit(math_status, MATH_SUCCESS, base) }
+
+/*******************************************************************/
+#define MATH_stack_error(base) { ERROR_check_stack(math_status, MATH_SUCCESS, base) }
+
+/*******************************************************************/
+#define MATH_stack_exit_error(base, code) { ERROR_check_stack_exit(math_status, MATH_SUCCESS, base, code) }
+
+#endif /* __MATH_H__ */
@@ -0,0 +1,101 @@
+/*
+ * neom8x.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __NEOM8X_H__
+#define __NEOM8X_H__
+
+#include "error.h"
+#include "neom8x_driver_flags.h"
+#include "types.h"
+
+/*** NEOM8X structures ***/
+
+/*!******************************************************************
+ * \enum NEOM8X_status_t
+ * \brief NEOM8X driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    NEOM8X_SUCCESS = 0,
+    NEOM8X_ERROR_NULL_PARAMETER,
+    NEOM8X_ERROR_TIMEOUT,
+    // Low level drivers errors.
+    NEOM8X_ERROR_BASE_GPIO = 0x0100,
+    NEOM8X_ERROR_BASE_UART = (NEOM8X_ERROR_BASE_GPIO + NEOM8X_DRIVER_GPIO_ERROR_BASE_LAST),
+    NEOM8X_ERROR_BASE_DELAY = (NEOM8X_ERROR_BASE_UART + NEOM8X_DRIVER_UART_ERROR_BASE_LAST),
+    // Last base value.
+    NEOM8X_ERROR_BASE_LAST = (NEOM8X_ERROR_BASE_DELAY + NEOM8X_DRIVER_DELAY_ERROR_BASE_LAST)
+} NEOM8X_status_t;
+
+/*!******************************************************************
+ * \enum NEOM8X_acquisition_status_t
+ * \brief GPS acquisition status.
+ *******************************************************************/
+typedef enum {
+    NEOM8X_ACQUISITION_STATUS_FAIL = 0,
+    NEOM8X_ACQUISITION_STATUS_FOUND,
+    NEOM8X_ACQUISITION_STATUS_STABLE,
+    NEOM8X_ACQUISITION_STATUS_LAST
+} NEOM8X_acquisition_status_t;
+
+/*!******************************************************************
+ * \struct NEOM8X_time_t
+ * \brief GPS time structure.
+ *******************************************************************/
+typedef struct {
+    uint16_t year;
+    uint8_t month;
+    uint8_t date;
+    uint8_t hours;
+    uint8_t minutes;
+    uint8_t seconds;
+} NEOM8X_time_t;
+
+/*!******************************************************************
+ * \struct NEOM8X_position_t
+ * \brief GPS position structure.
+ *******************************************************************/
+typedef struct {
+    uint8_t lat_degrees;
+    uint8_t lat_minutes;
+    uint32_t lat_seconds;
+    uint8_t lat_north_flag;
+    uint8_t long_degrees;
+    uint8_t long_minutes;
+    uint32_t long_seconds;
+    uint8_t long_east_flag;
+    uint32_t altitude;
+} NEOM8X_position_t;
+
+/*!******************************************************************
+ * \struct NEOM8X_timepulse_configuration_t
+ * \brief Timepulse signal parameters.
+ *******************************************************************/
+typedef struct {
+    uint8_t active;
+    uint32_t frequency_hz;
+    uint8_t duty_cycle_percent;
+} NEOM8X_timepulse_configuration_t;
+
+/*** NEOM8X functions ***/
+
+NEOM8X_status_t NEOM8X_init(void);
+NEOM8X_status_t NEOM8X_de_init(void);
+NEOM8X_status_t NEOM8X_set_backup_voltage(uint8_t state);
+uint8_t NEOM8X_get_backup_voltage(void);
+NEOM8X_status_t NEOM8X_set_timepulse(NEOM8X_timepulse_configuration_t* configuration);
+
+/*******************************************************************/
+#define NEOM8X_exit_error(base) { ERROR_check_exit(neom8x_status, NEOM8X_SUCCESS, base) }
+
+/*******************************************************************/
+#define NEOM8X_stack_error(base) { ERROR_check_stack(neom8x_status, NEOM8X_SUCCESS, base) }
+
+/*******************************************************************/
+#define NEOM8X_stack_exit_error(base, code) { ERROR_check_stack_exit(neom8x_status, NEOM8X_SUCCESS, base, code) }
+
+#endif /* __NEOM8X_H__ */
@@ -0,0 +1,41 @@
+/*
+ * neom8x_hw.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __NEOM8X_HW_H__
+#define __NEOM8X_HW_H__
+
+#include "neom8x.h"
+#include "types.h"
+
+/*** NEOM8X HW structures ***/
+
+/*!******************************************************************
+ * \brief NEOM8X RX interrupt callback.
+ *******************************************************************/
+typedef void (*NEOM8X_HW_rx_irq_cb_t)(uint8_t data);
+
+/*!******************************************************************
+ * \struct NEOM8X_HW_configuration_t
+ * \brief NEOM8X hardware interface configuration (host fake).
+ *******************************************************************/
+typedef struct {
+    uint32_t uart_baud_rate;
+    NEOM8X_HW_rx_irq_cb_t rx_irq_callback;
+} NEOM8X_HW_configuration_t;
+
+/*** NEOM8X HW functions ***/
+
+NEOM8X_status_t NEOM8X_HW_init(NEOM8X_HW_configuration_t* configuration);
+NEOM8X_status_t NEOM8X_HW_de_init(void);
+NEOM8X_status_t NEOM8X_HW_send_message(uint8_t* message, uint32_t message_size_bytes);
+NEOM8X_status_t NEOM8X_HW_start_rx(void);
+NEOM8X_status_t NEOM8X_HW_stop_rx(void);
+NEOM8X_status_t NEOM8X_HW_delay_milliseconds(uint32_t delay_ms);
+NEOM8X_status_t NEOM8X_HW_set_backup_voltage(uint8_t state);
+uint8_t NEOM8X_HW_get_backup_voltage(void);
+
+#endif /* __NEOM8X_HW_H__ */
@@ -0,0 +1,65 @@
+/*
+ * nvm.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __NVM_H__
+#define __NVM_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** NVM structures ***/
+
+/*!******************************************************************
+ * \enum NVM_status_t
+ * \brief NVM driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    NVM_SUCCESS = 0,
+    NVM_ERROR_NULL_PARAMETER,
+    NVM_ERROR_ADDRESS,
+    // Last base value.
+    NVM_ERROR_BASE_LAST = 0x0100
+} NVM_status_t;
+
+/*!******************************************************************
+ * \typedef NVM_address_t
+ * \brief NVM address type.
+ *******************************************************************/
+typedef uint32_t NVM_address_t;
+
+/*** NVM functions ***/
+
+/*!******************************************************************
+ * \fn NVM_status_t NVM_read_byte(NVM_address_t address, uint8_t* data)
+ * \brief Read byte in fake EEPROM.
+ * \param[in]   address: Address to read.
+ * \param[out]  data: Pointer to byte that will contain the read value.
+ * \retval      Function execution status.
+ *******************************************************************/
+NVM_status_t NVM_read_byte(NVM_address_t address, uint8_t* data);
+
+/*!******************************************************************
+ * \fn NVM_status_t NVM_write_byte(NVM_address_t address, uint8_t data)
+ * \brief Write byte in fake EEPROM.
+ * \param[in]   address: Address to write.
+ * \param[in]   data: Byte to write.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NVM_status_t NVM_write_byte(NVM_address_t address, uint8_t data);
+
+/*******************************************************************/
+#define NVM_exit_error(base) { ERROR_check_exit(nvm_status, NVM_SUCCESS, base) }
+
+/*******************************************************************/
+#define NVM_stack_error(base) { ERROR_check_stack(nvm_status, NVM_SUCCESS, base) }
+
+/*******************************************************************/
+#define NVM_stack_exit_error(base, code) { ERROR_check_stack_exit(nvm_status, NVM_SUCCESS, base, code) }
+
+#endif /* __NVM_H__ */
@@ -0,0 +1,37 @@
+/*
+ * parser.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __PARSER_H__
+#define __PARSER_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** PARSER structures ***/
+
+/*!******************************************************************
+ * \enum PARSER_status_t
+ * \brief PARSER driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    PARSER_SUCCESS = 0,
+    PARSER_ERROR_NULL_PARAMETER,
+    // Last base value.
+    PARSER_ERROR_BASE_LAST = 0x0100
+} PARSER_status_t;
+
+/*******************************************************************/
+#define PARSER_exit_error(base) { ERROR_check_exit(parser_status, PARSER_SUCCESS, base) }
+
+/*******************************************************************/
+#define PARSER_stack_error(base) { ERROR_check_stack(parser_status, PARSER_SUCCESS, base) }
+
+/*******************************************************************/
+#define PARSER_stack_exit_error(base, code) { ERROR_check_stack_exit(parser_status, PARSER_SUCCESS, base, code) }
+
+#endif /* __PARSER_H__ */
@@ -0,0 +1,24 @@
+/*
+ * pwr.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __PWR_H__
+#define __PWR_H__
+
+#include "types.h"
+
+/*** PWR functions ***/
+
+/*!******************************************************************
+ * \fn void PWR_enter_sleep_mode(void)
+ * \brief Enter sleep mode (host fake: runs the pending simulated interrupts).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void PWR_enter_sleep_mode(void);
+
+#endif /* __PWR_H__ */
@@ -0,0 +1,37 @@
+/*
+ * rcc.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RCC_H__
+#define __RCC_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** RCC structures ***/
+
+/*!******************************************************************
+ * \enum RCC_status_t
+ * \brief RCC driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    RCC_SUCCESS = 0,
+    RCC_ERROR_TIMEOUT,
+    // Last base value.
+    RCC_ERROR_BASE_LAST = 0x0100
+} RCC_status_t;
+
+/*******************************************************************/
+#define RCC_exit_error(base) { ERROR_check_exit(rcc_status, RCC_SUCCESS, base) }
+
+/*******************************************************************/
+#define RCC_stack_error(base) { ERROR_check_stack(rcc_status, RCC_SUCCESS, base) }
+
+/*******************************************************************/
+#define RCC_stack_exit_error(base, code) { ERROR_check_stack_exit(rcc_status, RCC_SUCCESS, base, code) }
+
+#endif /* __RCC_H__ */
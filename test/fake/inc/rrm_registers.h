@@ -0,0 +1,25 @@
+/*
+ * rrm_registers.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RRM_REGISTERS_H__
+#define __RRM_REGISTERS_H__
+
+#include "common_registers.h"
+#include "types.h"
+#include "una.h"
+
+/*** RRM REGISTERS structures ***/
+
+/*!******************************************************************
+ * \enum RRM_register_address_t
+ * \brief RRM registers map (host fake of the UNA library map).
+ *******************************************************************/
+typedef enum {
+    RRM_REGISTER_ADDRESS_LAST = COMMON_REGISTER_ADDRESS_LAST
+} RRM_register_address_t;
+
+#endif /* __RRM_REGISTERS_H__ */
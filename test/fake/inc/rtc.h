@@ -0,0 +1,48 @@
+/*
+ * rtc.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RTC_H__
+#define __RTC_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** RTC structures ***/
+
+/*!******************************************************************
+ * \enum RTC_status_t
+ * \brief RTC driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    RTC_SUCCESS = 0,
+    RTC_ERROR_WAKEUP_TIMER_RUNNING,
+    // Last base value.
+    RTC_ERROR_BASE_LAST = 0x0100
+} RTC_status_t;
+
+/*** RTC functions ***/
+
+/*!******************************************************************
+ * \fn uint32_t RTC_get_uptime_seconds(void)
+ * \brief Get fake uptime.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      MCU uptime in seconds.
+ *******************************************************************/
+uint32_t RTC_get_uptime_seconds(void);
+
+/*******************************************************************/
+#define RTC_exit_error(base) { ERROR_check_exit(rtc_status, RTC_SUCCESS, base) }
+
+/*******************************************************************/
+#define RTC_stack_error(base) { ERROR_check_stack(rtc_status, RTC_SUCCESS, base) }
+
+/*******************************************************************/
+#define RTC_stack_exit_error(base, code) { ERROR_check_stack_exit(rtc_status, RTC_SUCCESS, base, code) }
+
+#endif /* __RTC_H__ */
@@ -0,0 +1,255 @@
+/*
+ * s2lp.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __S2LP_H__
+#define __S2LP_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** S2LP macros ***/
+
+#define S2LP_EXIT_SHUTDOWN_DELAY_MS     2
+
+#define S2LP_FIFO_SIZE_BYTES            128
+
+/*** S2LP structures ***/
+
+/*!******************************************************************
+ * \enum S2LP_status_t
+ * \brief S2LP driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    S2LP_SUCCESS = 0,
+    S2LP_ERROR_NULL_PARAMETER,
+    S2LP_ERROR_STATE_TIMEOUT,
+    S2LP_ERROR_TX_FIFO_OVERFLOW,
+    // Last base value.
+    S2LP_ERROR_BASE_LAST = 0x0100
+} S2LP_status_t;
+
+/*!******************************************************************
+ * \enum S2LP_command_t
+ * \brief S2LP commands list.
+ *******************************************************************/
+typedef enum {
+    S2LP_COMMAND_TX = 0x60,
+    S2LP_COMMAND_RX = 0x61,
+    S2LP_COMMAND_READY = 0x62,
+    S2LP_COMMAND_STANDBY = 0x63,
+    S2LP_COMMAND_SLEEP = 0x64,
+    S2LP_COMMAND_LOCKRX = 0x65,
+    S2LP_COMMAND_LOCKTX = 0x66,
+    S2LP_COMMAND_SABORT = 0x67,
+    S2LP_COMMAND_SRES = 0x70,
+    S2LP_COMMAND_FLUSHRXFIFO = 0x71,
+    S2LP_COMMAND_FLUSHTXFIFO = 0x72
+} S2LP_command_t;
+
+/*!******************************************************************
+ * \enum S2LP_state_t
+ * \brief S2LP states list.
+ *******************************************************************/
+typedef enum {
+    S2LP_STATE_READY = 0x00,
+    S2LP_STATE_LOCK = 0x0C,
+    S2LP_STATE_RX = 0x30,
+    S2LP_STATE_TX = 0x5C
+} S2LP_state_t;
+
+/*!******************************************************************
+ * \enum S2LP_oscillator_t
+ * \brief S2LP oscillator types.
+ *******************************************************************/
+typedef enum {
+    S2LP_OSCILLATOR_QUARTZ = 0,
+    S2LP_OSCILLATOR_TCXO,
+    S2LP_OSCILLATOR_LAST
+} S2LP_oscillator_t;
+
+/*!******************************************************************
+ * \enum S2LP_modulation_t
+ * \brief S2LP modulations list.
+ *******************************************************************/
+typedef enum {
+    S2LP_MODULATION_2FSK = 0,
+    S2LP_MODULATION_4FSK,
+    S2LP_MODULATION_2GFSK_BT1,
+    S2LP_MODULATION_4GFSK_BT1,
+    S2LP_MODULATION_ASK_OOK,
+    S2LP_MODULATION_POLAR,
+    S2LP_MODULATION_NONE,
+    S2LP_MODULATION_2GFSK_BT05,
+    S2LP_MODULATION_4GFSK_BT05,
+    S2LP_MODULATION_LAST
+} S2LP_modulation_t;
+
+/*!******************************************************************
+ * \enum S2LP_gpio_t
+ * \brief S2LP GPIOs list.
+ *******************************************************************/
+typedef enum {
+    S2LP_GPIO0 = 0,
+    S2LP_GPIO1,
+    S2LP_GPIO2,
+    S2LP_GPIO3,
+    S2LP_GPIO_LAST
+} S2LP_gpio_t;
+
+/*!******************************************************************
+ * \enum S2LP_gpio_mode_t
+ * \brief S2LP GPIO modes.
+ *******************************************************************/
+typedef enum {
+    S2LP_GPIO_MODE_IN = 0x01,
+    S2LP_GPIO_MODE_OUT_LOW_POWER = 0x02,
+    S2LP_GPIO_MODE_OUT_HIGH_POWER = 0x03,
+    S2LP_GPIO_MODE_LAST
+} S2LP_gpio_mode_t;
+
+/*!******************************************************************
+ * \enum S2LP_gpio_output_function_t
+ * \brief S2LP GPIO output functions.
+ *******************************************************************/
+typedef enum {
+    S2LP_GPIO_OUTPUT_FUNCTION_NIRQ = 0,
+    S2LP_GPIO_OUTPUT_FUNCTION_LAST
+} S2LP_gpio_output_function_t;
+
+/*!******************************************************************
+ * \enum S2LP_fifo_flag_direction_t
+ * \brief S2LP FIFO flags direction.
+ *******************************************************************/
+typedef enum {
+    S2LP_FIFO_FLAG_DIRECTION_TX = 0,
+    S2LP_FIFO_FLAG_DIRECTION_RX,
+    S2LP_FIFO_FLAG_DIRECTION_LAST
+} S2LP_fifo_flag_direction_t;
+
+/*!******************************************************************
+ * \enum S2LP_fifo_threshold_t
+ * \brief S2LP FIFO thresholds.
+ *******************************************************************/
+typedef enum {
+    S2LP_FIFO_THRESHOLD_RX_FULL = 0,
+    S2LP_FIFO_THRESHOLD_RX_EMPTY,
+    S2LP_FIFO_THRESHOLD_TX_FULL,
+    S2LP_FIFO_THRESHOLD_TX_EMPTY,
+    S2LP_FIFO_THRESHOLD_LAST
+} S2LP_fifo_threshold_t;
+
+/*!******************************************************************
+ * \enum S2LP_irq_index_t
+ * \brief S2LP interrupts list.
+ *******************************************************************/
+typedef enum {
+    S2LP_IRQ_INDEX_RX_DATA_READY = 0,
+    S2LP_IRQ_INDEX_TX_FIFO_ALMOST_EMPTY = 5,
+    S2LP_IRQ_INDEX_LAST = 32
+} S2LP_irq_index_t;
+
+/*!******************************************************************
+ * \enum S2LP_tx_source_t
+ * \brief S2LP TX data sources.
+ *******************************************************************/
+typedef enum {
+    S2LP_TX_SOURCE_NORMAL = 0,
+    S2LP_TX_SOURCE_FIFO,
+    S2LP_TX_SOURCE_LAST
+} S2LP_tx_source_t;
+
+/*!******************************************************************
+ * \enum S2LP_rx_source_t
+ * \brief S2LP RX data sources.
+ *******************************************************************/
+typedef enum {
+    S2LP_RX_SOURCE_NORMAL = 0,
+    S2LP_RX_SOURCE_FIFO,
+    S2LP_RX_SOURCE_LAST
+} S2LP_rx_source_t;
+
+/*!******************************************************************
+ * \enum S2LP_afc_mode_t
+ * \brief S2LP AFC modes.
+ *******************************************************************/
+typedef enum {
+    S2LP_AFC_MODE_DISABLE = 0,
+    S2LP_AFC_MODE_ENABLE,
+    S2LP_AFC_MODE_LAST
+} S2LP_afc_mode_t;
+
+/*!******************************************************************
+ * \enum S2LP_preamble_pattern_t
+ * \brief S2LP preamble patterns.
+ *******************************************************************/
+typedef enum {
+    S2LP_PREAMBLE_PATTERN_0101 = 0,
+    S2LP_PREAMBLE_PATTERN_1010,
+    S2LP_PREAMBLE_PATTERN_LAST
+} S2LP_preamble_pattern_t;
+
+/*!******************************************************************
+ * \enum S2LP_crc_mode_t
+ * \brief S2LP CRC modes.
+ *******************************************************************/
+typedef enum {
+    S2LP_CRC_MODE_DISABLED = 0,
+    S2LP_CRC_MODE_LAST
+} S2LP_crc_mode_t;
+
+/*!******************************************************************
+ * \enum S2LP_rssi_t
+ * \brief S2LP RSSI types.
+ *******************************************************************/
+typedef enum {
+    S2LP_RSSI_TYPE_RUN = 0,
+    S2LP_RSSI_TYPE_SYNC_WORD,
+    S2LP_RSSI_TYPE_LAST
+} S2LP_rssi_t;
+
+/*** S2LP functions ***/
+
+S2LP_status_t S2LP_shutdown(uint8_t shutdown_enable);
+S2LP_status_t S2LP_send_command(S2LP_command_t command);
+S2LP_status_t S2LP_wait_for_state(S2LP_state_t new_state);
+S2LP_status_t S2LP_set_oscillator(S2LP_oscillator_t oscillator);
+S2LP_status_t S2LP_wait_for_oscillator(void);
+S2LP_status_t S2LP_set_common_configuration(void);
+S2LP_status_t S2LP_set_smps_frequency(uint32_t frequency_hz);
+S2LP_status_t S2LP_set_modulation(S2LP_modulation_t modulation);
+S2LP_status_t S2LP_set_rf_frequency(uint32_t frequency_hz);
+S2LP_status_t S2LP_set_fsk_deviation(uint32_t deviation_hz);
+S2LP_status_t S2LP_set_datarate(uint32_t datarate_bps);
+S2LP_status_t S2LP_set_rf_output_power(int8_t output_power_dbm);
+S2LP_status_t S2LP_set_tx_source(S2LP_tx_source_t tx_source);
+S2LP_status_t S2LP_set_rx_source(S2LP_rx_source_t rx_source);
+S2LP_status_t S2LP_set_rx_bandwidth(uint32_t rxbw_hz, S2LP_afc_mode_t afc_mode);
+S2LP_status_t S2LP_set_rssi_threshold(int16_t rssi_threshold_dbm);
+S2LP_status_t S2LP_set_preamble_detector(uint8_t preamble_size_2bits, S2LP_preamble_pattern_t preamble_pattern);
+S2LP_status_t S2LP_set_sync_word(uint8_t* sync_word, uint8_t sync_word_size_bits);
+S2LP_status_t S2LP_set_packet_format(uint8_t packet_size_bytes, S2LP_crc_mode_t crc_mode);
+S2LP_status_t S2LP_configure_gpio(S2LP_gpio_t gpio, S2LP_gpio_mode_t mode, S2LP_gpio_output_function_t function, S2LP_fifo_flag_direction_t fifo_flag_direction);
+S2LP_status_t S2LP_set_fifo_threshold(S2LP_fifo_threshold_t fifo_threshold, uint8_t threshold_value);
+S2LP_status_t S2LP_configure_irq(S2LP_irq_index_t irq_index, uint8_t irq_enable);
+S2LP_status_t S2LP_get_irq_flag(S2LP_irq_index_t irq_index, uint8_t* irq_flag);
+S2LP_status_t S2LP_disable_all_irq(void);
+S2LP_status_t S2LP_clear_all_irq(void);
+S2LP_status_t S2LP_write_fifo(uint8_t* tx_data, uint8_t tx_data_size);
+S2LP_status_t S2LP_read_fifo(uint8_t* rx_data, uint8_t rx_data_size);
+S2LP_status_t S2LP_get_rssi(S2LP_rssi_t rssi_type, int16_t* rssi_dbm);
+
+/*******************************************************************/
+#define S2LP_exit_error(base) { ERROR_check_exit(s2lp_status, S2LP_SUCCESS, base) }
+
+/*******************************************************************/
+#define S2LP_stack_error(base) { ERROR_check_stack(s2lp_status, S2LP_SUCCESS, base) }
+
+/*******************************************************************/
+#define S2LP_stack_exit_error(base, code) { ERROR_check_stack_exit(s2lp_status, S2LP_SUCCESS, base, code) }
+
+#endif /* __S2LP_H__ */
@@ -0,0 +1,46 @@
+/*
+ * sht3x.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SHT3X_H__
+#define __SHT3X_H__
+
+#include "error.h"
+#include "sht3x_driver_flags.h"
+#include "types.h"
+
+/*** SHT3X structures ***/
+
+/*!******************************************************************
+ * \enum SHT3X_status_t
+ * \brief SHT3X driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    SHT3X_SUCCESS = 0,
+    SHT3X_ERROR_NULL_PARAMETER,
+    SHT3X_ERROR_CRC,
+    // Low level drivers errors.
+    SHT3X_ERROR_BASE_I2C = 0x0100,
+    SHT3X_ERROR_BASE_DELAY = (SHT3X_ERROR_BASE_I2C + SHT3X_DRIVER_I2C_ERROR_BASE_LAST),
+    // Last base value.
+    SHT3X_ERROR_BASE_LAST = (SHT3X_ERROR_BASE_DELAY + SHT3X_DRIVER_DELAY_ERROR_BASE_LAST)
+} SHT3X_status_t;
+
+/*** SHT3X functions ***/
+
+SHT3X_status_t SHT3X_get_temperature_humidity(uint8_t i2c_address, int32_t* temperature_degrees, int32_t* humidity_percent);
+
+/*******************************************************************/
+#define SHT3X_exit_error(base) { ERROR_check_exit(sht3x_status, SHT3X_SUCCESS, base) }
+
+/*******************************************************************/
+#define SHT3X_stack_error(base) { ERROR_check_stack(sht3x_status, SHT3X_SUCCESS, base) }
+
+/*******************************************************************/
+#define SHT3X_stack_exit_error(base, code) { ERROR_check_stack_exit(sht3x_status, SHT3X_SUCCESS, base, code) }
+
+#endif /* __SHT3X_H__ */
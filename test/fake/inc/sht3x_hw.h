@@ -0,0 +1,22 @@
+/*
+ * sht3x_hw.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SHT3X_HW_H__
+#define __SHT3X_HW_H__
+
+#include "sht3x.h"
+#include "types.h"
+
+/*** SHT3X HW functions ***/
+
+SHT3X_status_t SHT3X_HW_init(void);
+SHT3X_status_t SHT3X_HW_de_init(void);
+SHT3X_status_t SHT3X_HW_i2c_write(uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes, uint8_t stop_flag);
+SHT3X_status_t SHT3X_HW_i2c_read(uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes);
+SHT3X_status_t SHT3X_HW_delay_milliseconds(uint32_t delay_ms);
+
+#endif /* __SHT3X_HW_H__ */
@@ -0,0 +1,85 @@
+/*
+ * sigfox_ep_addon_rfp_api.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SIGFOX_EP_ADDON_RFP_API_H__
+#define __SIGFOX_EP_ADDON_RFP_API_H__
+
+#include "sigfox_types.h"
+
+/*** SIGFOX EP ADDON RFP API structures ***/
+
+/*!******************************************************************
+ * \enum SIGFOX_EP_ADDON_RFP_API_status_t
+ * \brief RF & protocol addon error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_RFP_API_SUCCESS = 0,
+    SIGFOX_EP_ADDON_RFP_API_ERROR_STATE,
+    SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE,
+    SIGFOX_EP_ADDON_RFP_API_ERROR_LAST
+} SIGFOX_EP_ADDON_RFP_API_status_t;
+
+/*!******************************************************************
+ * \enum SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t
+ * \brief RF & protocol test modes.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_RFP_API_TEST_MODE_C = 0,
+    SIGFOX_EP_ADDON_RFP_API_TEST_MODE_J,
+    SIGFOX_EP_ADDON_RFP_API_TEST_MODE_F,
+    SIGFOX_EP_ADDON_RFP_API_TEST_MODE_D,
+    SIGFOX_EP_ADDON_RFP_API_TEST_MODE_E,
+    SIGFOX_EP_ADDON_RFP_API_TEST_MODE_LAST
+} SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_config_t
+ * \brief Addon opening parameters.
+ *******************************************************************/
+typedef struct {
+    const SIGFOX_rc_t* rc;
+} SIGFOX_EP_ADDON_RFP_API_config_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_test_mode_t
+ * \brief Test mode parameters.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t test_mode_reference;
+    SIGFOX_ul_bit_rate_t ul_bit_rate;
+} SIGFOX_EP_ADDON_RFP_API_test_mode_t;
+
+/*** SIGFOX EP ADDON RFP API functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_open(SIGFOX_EP_ADDON_RFP_API_config_t* config)
+ * \brief Open the addon.
+ * \param[in]   config: Addon configuration.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_open(SIGFOX_EP_ADDON_RFP_API_config_t* config);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_close(void)
+ * \brief Close the addon.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_close(void);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t* test_mode)
+ * \brief Run a test mode.
+ * \param[in]   test_mode: Test mode parameters.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t* test_mode);
+
+#endif /* __SIGFOX_EP_ADDON_RFP_API_H__ */
@@ -0,0 +1,125 @@
+/*
+ * sigfox_ep_api.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SIGFOX_EP_API_H__
+#define __SIGFOX_EP_API_H__
+
+#include "sigfox_types.h"
+
+/*** SIGFOX EP API structures ***/
+
+/*!******************************************************************
+ * \enum SIGFOX_EP_API_status_t
+ * \brief Sigfox EP library error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_API_SUCCESS = 0,
+    SIGFOX_EP_API_ERROR_NULL_PARAMETER,
+    SIGFOX_EP_API_ERROR_STATE,
+    SIGFOX_EP_API_ERROR_RF,
+    SIGFOX_EP_API_ERROR_LAST
+} SIGFOX_EP_API_status_t;
+
+/*!******************************************************************
+ * \union SIGFOX_EP_API_message_status_t
+ * \brief Message status bit field.
+ *******************************************************************/
+typedef union {
+    sfx_u8 all;
+    struct {
+        unsigned ul_frame_1 : 1;
+        unsigned ul_frame_2 : 1;
+        unsigned ul_frame_3 : 1;
+        unsigned dl_frame : 1;
+        unsigned dl_conf_frame : 1;
+        unsigned network_error : 1;
+        unsigned execution_error : 1;
+    } field;
+} SIGFOX_EP_API_message_status_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_API_config_t
+ * \brief Library opening parameters.
+ *******************************************************************/
+typedef struct {
+    const SIGFOX_rc_t* rc;
+} SIGFOX_EP_API_config_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_API_common_t
+ * \brief Common message parameters.
+ *******************************************************************/
+typedef struct {
+    sfx_u8 number_of_frames;
+    SIGFOX_ul_bit_rate_t ul_bit_rate;
+    SIGFOX_ep_key_t ep_key_type;
+} SIGFOX_EP_API_common_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_API_application_message_t
+ * \brief Application message parameters.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_API_common_t common_parameters;
+    SIGFOX_application_message_type_t type;
+    sfx_u8* ul_payload;
+    sfx_u8 ul_payload_size_bytes;
+    sfx_bool bidirectional_flag;
+} SIGFOX_EP_API_application_message_t;
+
+/*** SIGFOX EP API functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_EP_API_open(SIGFOX_EP_API_config_t* config)
+ * \brief Open the simulated library.
+ * \param[in]   config: Library configuration.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_open(SIGFOX_EP_API_config_t* config);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_EP_API_close(void)
+ * \brief Close the simulated library.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_close(void);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_EP_API_send_application_message(SIGFOX_EP_API_application_message_t* application_message)
+ * \brief Send a message on the simulated radio.
+ * \param[in]   application_message: Message parameters.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_send_application_message(SIGFOX_EP_API_application_message_t* application_message);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_message_status_t SIGFOX_EP_API_get_message_status(void)
+ * \brief Get the status of the last message.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Message status.
+ *******************************************************************/
+SIGFOX_EP_API_message_status_t SIGFOX_EP_API_get_message_status(void);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_EP_API_get_dl_payload(sfx_u8* dl_payload, sfx_u8 dl_payload_size, sfx_s16* dl_rssi_dbm)
+ * \brief Read the downlink payload of the last message.
+ * \param[in]   dl_payload_size: Payload buffer size.
+ * \param[out]  dl_payload: Downlink payload.
+ * \param[out]  dl_rssi_dbm: Downlink RSSI.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_get_dl_payload(sfx_u8* dl_payload, sfx_u8 dl_payload_size, sfx_s16* dl_rssi_dbm);
+
+/*******************************************************************/
+#define SIGFOX_EP_API_check_status(error) { if (sigfox_ep_api_status != SIGFOX_EP_API_SUCCESS) { SIGFOX_EXIT_ERROR(error) } }
+
+#endif /* __SIGFOX_EP_API_H__ */
@@ -0,0 +1,30 @@
+/*
+ * sigfox_error.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SIGFOX_ERROR_H__
+#define __SIGFOX_ERROR_H__
+
+#include "sigfox_types.h"
+
+/*** SIGFOX ERROR structures ***/
+
+/*!******************************************************************
+ * \enum SIGFOX_error_source_t
+ * \brief Sigfox library error sources (host fake).
+ *******************************************************************/
+typedef enum {
+    SIGFOX_ERROR_SOURCE_NONE = 0,
+    SIGFOX_ERROR_SOURCE_LAST
+} SIGFOX_error_source_t;
+
+/*******************************************************************/
+#define SIGFOX_CHECK_STATUS(success) { if (status != success) goto errors; }
+
+/*******************************************************************/
+#define SIGFOX_RETURN() { return status; }
+
+#endif /* __SIGFOX_ERROR_H__ */
@@ -0,0 +1,17 @@
+/*
+ * sigfox_rc.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SIGFOX_RC_H__
+#define __SIGFOX_RC_H__
+
+#include "sigfox_types.h"
+
+/*** SIGFOX RC global variables ***/
+
+extern const SIGFOX_rc_t SIGFOX_RC1;
+
+#endif /* __SIGFOX_RC_H__ */
@@ -0,0 +1,103 @@
+/*
+ * sigfox_types.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SIGFOX_TYPES_H__
+#define __SIGFOX_TYPES_H__
+
+#include "sigfox_ep_flags.h"
+
+/*** SIGFOX TYPES macros ***/
+
+#define SIGFOX_NULL                                 ((void*) 0)
+
+#define SIGFOX_EP_ID_SIZE_BYTES                     4
+#define SIGFOX_EP_KEY_SIZE_BYTES                    16
+#define SIGFOX_UL_PAYLOAD_MAX_SIZE_BYTES            12
+#define SIGFOX_DL_PAYLOAD_SIZE_BYTES                8
+#define SIGFOX_UL_BITSTREAM_SIZE_BYTES              26
+#define SIGFOX_DL_PHY_CONTENT_SIZE_BYTES            15
+#define SIGFOX_DL_FT_SIZE_BYTES                     2
+#define SIGFOX_DL_FT                                { 0xB2, 0x27 }
+
+#define SIGFOX_NVM_DATA_INDEX_RANDOM_VALUE_MSB      0
+#define SIGFOX_NVM_DATA_INDEX_RANDOM_VALUE_LSB      1
+#define SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_MSB   2
+#define SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_LSB   3
+#define SIGFOX_NVM_DATA_SIZE_BYTES                  4
+
+#if (defined SIGFOX_EP_BIDIRECTIONAL) || (defined SIGFOX_EP_CERTIFICATION)
+#define SIGFOX_EP_TIMER_REQUIRED
+#endif
+
+#define SIGFOX_UNUSED(x)                            ((void) x)
+
+/*** SIGFOX TYPES structures ***/
+
+typedef unsigned char       sfx_u8;
+typedef signed char         sfx_s8;
+typedef unsigned short      sfx_u16;
+typedef signed short        sfx_s16;
+typedef unsigned int        sfx_u32;
+typedef signed int          sfx_s32;
+
+/*!******************************************************************
+ * \enum sfx_bool
+ * \brief Sigfox boolean type.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_FALSE = 0,
+    SIGFOX_TRUE
+} sfx_bool;
+
+/*!******************************************************************
+ * \enum SIGFOX_ul_bit_rate_t
+ * \brief Sigfox uplink bit rates.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_UL_BIT_RATE_100BPS = 0,
+    SIGFOX_UL_BIT_RATE_600BPS,
+    SIGFOX_UL_BIT_RATE_LAST
+} SIGFOX_ul_bit_rate_t;
+
+/*!******************************************************************
+ * \enum SIGFOX_ep_key_t
+ * \brief Sigfox end-point keys.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_KEY_PRIVATE = 0,
+    SIGFOX_EP_KEY_PUBLIC,
+    SIGFOX_EP_KEY_LAST
+} SIGFOX_ep_key_t;
+
+/*!******************************************************************
+ * \enum SIGFOX_application_message_type_t
+ * \brief Sigfox application message types.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_APPLICATION_MESSAGE_TYPE_EMPTY = 0,
+    SIGFOX_APPLICATION_MESSAGE_TYPE_BIT0,
+    SIGFOX_APPLICATION_MESSAGE_TYPE_BIT1,
+    SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY,
+    SIGFOX_APPLICATION_MESSAGE_TYPE_LAST
+} SIGFOX_application_message_type_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_rc_t
+ * \brief Sigfox radio configuration.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 f_ul_hz;
+    sfx_u32 f_dl_hz;
+} SIGFOX_rc_t;
+
+/*******************************************************************/
+#define SIGFOX_EXIT_ERROR(error) { \
+    status = error; \
+    goto errors; \
+}
+
+#endif /* __SIGFOX_TYPES_H__ */
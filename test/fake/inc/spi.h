@@ -0,0 +1,37 @@
+/*
+ * spi.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SPI_H__
+#define __SPI_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** SPI structures ***/
+
+/*!******************************************************************
+ * \enum SPI_status_t
+ * \brief SPI driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    SPI_SUCCESS = 0,
+    SPI_ERROR_TIMEOUT,
+    // Last base value.
+    SPI_ERROR_BASE_LAST = 0x0100
+} SPI_status_t;
+
+/*******************************************************************/
+#define SPI_exit_error(base) { ERROR_check_exit(spi_status, SPI_SUCCESS, base) }
+
+/*******************************************************************/
+#define SPI_stack_error(base) { ERROR_check_stack(spi_status, SPI_SUCCESS, base) }
+
+/*******************************************************************/
+#define SPI_stack_exit_error(base, code) { ERROR_check_stack_exit(spi_status, SPI_SUCCESS, base, code) }
+
+#endif /* __SPI_H__ */
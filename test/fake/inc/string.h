@@ -0,0 +1,37 @@
+/*
+ * string.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __STRING_H__
+#define __STRING_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** STRING structures ***/
+
+/*!******************************************************************
+ * \enum STRING_status_t
+ * \brief STRING driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    STRING_SUCCESS = 0,
+    STRING_ERROR_NULL_PARAMETER,
+    // Last base value.
+    STRING_ERROR_BASE_LAST = 0x0100
+} STRING_status_t;
+
+/*******************************************************************/
+#define STRING_exit_error(base) { ERROR_check_exit(string_status, STRING_SUCCESS, base) }
+
+/*******************************************************************/
+#define STRING_stack_error(base) { ERROR_check_stack(string_status, STRING_SUCCESS, base) }
+
+/*******************************************************************/
+#define STRING_stack_exit_error(base, code) { ERROR_check_stack_exit(string_status, STRING_SUCCESS, base, code) }
+
+#endif /* __STRING_H__ */
@@ -0,0 +1,48 @@
+/*
+ * swreg.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __SWREG_H__
+#define __SWREG_H__
+
+#include "types.h"
+
+/*** SWREG functions ***/
+
+/*!******************************************************************
+ * \fn void SWREG_modify_register(uint32_t* reg_value, uint32_t new_reg_value, uint32_t reg_mask)
+ * \brief Modify the bits of a register selected by a mask.
+ * \param[in]   reg_value: Pointer to the register to modify.
+ * \param[in]   new_reg_value: New register value.
+ * \param[in]   reg_mask: Bits to modify.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SWREG_modify_register(uint32_t* reg_value, uint32_t new_reg_value, uint32_t reg_mask);
+
+/*!******************************************************************
+ * \fn void SWREG_write_field(uint32_t* reg_value, uint32_t* reg_mask, uint32_t field_value, uint32_t field_mask)
+ * \brief Write a field in a register value and add it to the register mask.
+ * \param[in]   reg_value: Pointer to the register value.
+ * \param[in]   reg_mask: Pointer to the register mask.
+ * \param[in]   field_value: Field value to write.
+ * \param[in]   field_mask: Field mask.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SWREG_write_field(uint32_t* reg_value, uint32_t* reg_mask, uint32_t field_value, uint32_t field_mask);
+
+/*!******************************************************************
+ * \fn uint32_t SWREG_read_field(uint32_t reg_value, uint32_t field_mask)
+ * \brief Read a field in a register value.
+ * \param[in]   reg_value: Register value.
+ * \param[in]   field_mask: Field mask.
+ * \param[out]  none
+ * \retval      Field value.
+ *******************************************************************/
+uint32_t SWREG_read_field(uint32_t reg_value, uint32_t field_mask);
+
+#endif /* __SWREG_H__ */
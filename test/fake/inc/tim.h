@@ -0,0 +1,137 @@
+/*
+ * tim.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TIM_H__
+#define __TIM_H__
+
+#include "error.h"
+#include "stm32l0xx_drivers_flags.h"
+#include "types.h"
+
+/*** TIM structures ***/
+
+/*!******************************************************************
+ * \enum TIM_status_t
+ * \brief TIM driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    TIM_SUCCESS = 0,
+    TIM_ERROR_NULL_PARAMETER,
+    TIM_ERROR_INSTANCE,
+    TIM_ERROR_CHANNEL,
+    // Last base value.
+    TIM_ERROR_BASE_LAST = 0x0100
+} TIM_status_t;
+
+/*!******************************************************************
+ * \enum TIM_instance_t
+ * \brief Timer instances list.
+ *******************************************************************/
+typedef enum {
+    TIM_INSTANCE_TIM2 = 0,
+    TIM_INSTANCE_TIM21,
+    TIM_INSTANCE_TIM22,
+    TIM_INSTANCE_LAST
+} TIM_instance_t;
+
+/*!******************************************************************
+ * \enum TIM_channel_t
+ * \brief Timer channels list.
+ *******************************************************************/
+typedef enum {
+    TIM_CHANNEL_1 = 0,
+    TIM_CHANNEL_2,
+    TIM_CHANNEL_3,
+    TIM_CHANNEL_4,
+    TIM_CHANNEL_LAST
+} TIM_channel_t;
+
+/*!******************************************************************
+ * \enum TIM_waiting_mode_t
+ * \brief Timer completion waiting modes.
+ *******************************************************************/
+typedef enum {
+    TIM_WAITING_MODE_ACTIVE = 0,
+    TIM_WAITING_MODE_SLEEP,
+    TIM_WAITING_MODE_LOW_POWER_SLEEP,
+    TIM_WAITING_MODE_LAST
+} TIM_waiting_mode_t;
+
+/*** TIM functions ***/
+
+/*!******************************************************************
+ * \fn TIM_status_t TIM_MCH_init(TIM_instance_t instance, uint8_t nvic_priority)
+ * \brief Init a timer peripheral in multi-channel mode.
+ * \param[in]   instance: Timer instance to use.
+ * \param[in]   nvic_priority: Interrupt priority.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TIM_status_t TIM_MCH_init(TIM_instance_t instance, uint8_t nvic_priority);
+
+/*!******************************************************************
+ * \fn TIM_status_t TIM_MCH_de_init(TIM_instance_t instance)
+ * \brief Release a timer peripheral.
+ * \param[in]   instance: Timer instance to release.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TIM_status_t TIM_MCH_de_init(TIM_instance_t instance);
+
+/*!******************************************************************
+ * \fn TIM_status_t TIM_MCH_start_channel(TIM_instance_t instance, TIM_channel_t channel, uint32_t duration_ms, TIM_waiting_mode_t waiting_mode)
+ * \brief Start a timer channel (deadline on the fake clock).
+ * \param[in]   instance: Timer instance to use.
+ * \param[in]   channel: Channel to start.
+ * \param[in]   duration_ms: Channel duration in ms.
+ * \param[in]   waiting_mode: Completion waiting mode.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TIM_status_t TIM_MCH_start_channel(TIM_instance_t instance, TIM_channel_t channel, uint32_t duration_ms, TIM_waiting_mode_t waiting_mode);
+
+/*!******************************************************************
+ * \fn TIM_status_t TIM_MCH_stop_channel(TIM_instance_t instance, TIM_channel_t channel)
+ * \brief Stop a timer channel.
+ * \param[in]   instance: Timer instance to use.
+ * \param[in]   channel: Channel to stop.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TIM_status_t TIM_MCH_stop_channel(TIM_instance_t instance, TIM_channel_t channel);
+
+/*!******************************************************************
+ * \fn TIM_status_t TIM_MCH_get_channel_status(TIM_instance_t instance, TIM_channel_t channel, uint8_t* channel_elapsed)
+ * \brief Read the status of a timer channel.
+ * \param[in]   instance: Timer instance to use.
+ * \param[in]   channel: Channel to read.
+ * \param[out]  channel_elapsed: Pointer to the channel completion flag.
+ * \retval      Function execution status.
+ *******************************************************************/
+TIM_status_t TIM_MCH_get_channel_status(TIM_instance_t instance, TIM_channel_t channel, uint8_t* channel_elapsed);
+
+/*!******************************************************************
+ * \fn TIM_status_t TIM_MCH_wait_channel_completion(TIM_instance_t instance, TIM_channel_t channel)
+ * \brief Wait for a timer channel completion (advances the fake clock).
+ * \param[in]   instance: Timer instance to use.
+ * \param[in]   channel: Channel to wait for.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TIM_status_t TIM_MCH_wait_channel_completion(TIM_instance_t instance, TIM_channel_t channel);
+
+/*******************************************************************/
+#define TIM_exit_error(base) { ERROR_check_exit(tim_status, TIM_SUCCESS, base) }
+
+/*******************************************************************/
+#define TIM_stack_error(base) { ERROR_check_stack(tim_status, TIM_SUCCESS, base) }
+
+/*******************************************************************/
+#define TIM_stack_exit_error(base, code) { ERROR_check_stack_exit(tim_status, TIM_SUCCESS, base, code) }
+
+#endif /* __TIM_H__ */
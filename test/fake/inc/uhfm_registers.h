@@ -0,0 +1,99 @@
+/*
+ * uhfm_registers.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UHFM_REGISTERS_H__
+#define __UHFM_REGISTERS_H__
+
+#include "common_registers.h"
+#include "types.h"
+#include "una.h"
+
+/*** UHFM REGISTERS macros ***/
+
+#define UHFM_REGISTER_ADDRESS_BASE                      COMMON_REGISTER_ADDRESS_LAST
+
+#define UHFM_REGISTER_CONFIGURATION_0_MASK_TX_POWER     0x000000FF
+#define UHFM_REGISTER_CONFIGURATION_0_MASK_NFR          0x00000300
+#define UHFM_REGISTER_CONFIGURATION_0_MASK_BR           0x00000C00
+#define UHFM_REGISTER_CONFIGURATION_0_MASK_RC           0x0000F000
+
+#define UHFM_REGISTER_CONFIGURATION_1_MASK_TIFU         0x00000FFF
+#define UHFM_REGISTER_CONFIGURATION_1_MASK_TCONF        0x00FFF000
+
+#define UHFM_REGISTER_STATUS_1_MASK_MESSAGE_STATUS      0x000000FF
+#define UHFM_REGISTER_STATUS_1_MASK_DL_RSSI             0x0000FF00
+#define UHFM_REGISTER_STATUS_1_MASK_BIDIRECTIONAL_MC    0x0FFF0000
+
+#define UHFM_REGISTER_CONTROL_1_MASK_STRG               0x00000001
+#define UHFM_REGISTER_CONTROL_1_MASK_TTRG               0x00000002
+#define UHFM_REGISTER_CONTROL_1_MASK_CWEN               0x00000004
+#define UHFM_REGISTER_CONTROL_1_MASK_RSEN               0x00000008
+#define UHFM_REGISTER_CONTROL_1_MASK_BF                 0x00000010
+#define UHFM_REGISTER_CONTROL_1_MASK_CMSG               0x00000020
+#define UHFM_REGISTER_CONTROL_1_MASK_MSGT               0x000000C0
+#define UHFM_REGISTER_CONTROL_1_MASK_UL_PAYLOAD_SIZE    0x00000F00
+#define UHFM_REGISTER_CONTROL_1_MASK_RFP_TEST_MODE      0x0000F000
+
+#define UHFM_REGISTER_RADIO_TEST_0_MASK_RF_FREQUENCY    0xFFFFFFFF
+
+#define UHFM_REGISTER_RADIO_TEST_1_MASK_TX_POWER        0x000000FF
+#define UHFM_REGISTER_RADIO_TEST_1_MASK_RSSI            0x0000FF00
+
+#define UHFM_REGISTER_ANALOG_DATA_1_MASK_VRF_TX         0x0000FFFF
+#define UHFM_REGISTER_ANALOG_DATA_1_MASK_VRF_RX         0xFFFF0000
+
+/*** UHFM REGISTERS structures ***/
+
+/*!******************************************************************
+ * \enum UHFM_register_address_t
+ * \brief UHFM registers map (host fake of the UNA library map).
+ *******************************************************************/
+typedef enum {
+    UHFM_REGISTER_ADDRESS_EP_ID = UHFM_REGISTER_ADDRESS_BASE,
+    UHFM_REGISTER_ADDRESS_EP_KEY_0,
+    UHFM_REGISTER_ADDRESS_EP_KEY_1,
+    UHFM_REGISTER_ADDRESS_EP_KEY_2,
+    UHFM_REGISTER_ADDRESS_EP_KEY_3,
+    UHFM_REGISTER_ADDRESS_CONFIGURATION_0,
+    UHFM_REGISTER_ADDRESS_CONFIGURATION_1,
+    UHFM_REGISTER_ADDRESS_STATUS_1,
+    UHFM_REGISTER_ADDRESS_CONTROL_1,
+    UHFM_REGISTER_ADDRESS_UL_PAYLOAD_0,
+    UHFM_REGISTER_ADDRESS_UL_PAYLOAD_1,
+    UHFM_REGISTER_ADDRESS_UL_PAYLOAD_2,
+    UHFM_REGISTER_ADDRESS_DL_PAYLOAD_0,
+    UHFM_REGISTER_ADDRESS_DL_PAYLOAD_1,
+    UHFM_REGISTER_ADDRESS_RADIO_TEST_0,
+    UHFM_REGISTER_ADDRESS_RADIO_TEST_1,
+    UHFM_REGISTER_ADDRESS_ANALOG_DATA_1,
+    UHFM_REGISTER_ADDRESS_LAST
+} UHFM_register_address_t;
+
+/*** UHFM REGISTERS global variables ***/
+
+static const UNA_register_access_t UHFM_REGISTER_ACCESS[UHFM_REGISTER_ADDRESS_LAST] = {
+    COMMON_REGISTER_ACCESS
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_ONLY,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_READ_ONLY
+};
+
+#endif /* __UHFM_REGISTERS_H__ */
@@ -0,0 +1,148 @@
+/*
+ * una.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_H__
+#define __UNA_H__
+
+#include "types.h"
+
+/*** UNA macros ***/
+
+#define UNA_REGISTER_MASK_ALL           0xFFFFFFFF
+
+#define UNA_VOLTAGE_ERROR_VALUE         0xFFFF
+#define UNA_TEMPERATURE_ERROR_VALUE     0x7F
+#define UNA_HUMIDITY_ERROR_VALUE        0xFF
+
+/*** UNA structures ***/
+
+/*!******************************************************************
+ * \enum UNA_board_id_t
+ * \brief UNA boards identifiers.
+ *******************************************************************/
+typedef enum {
+    UNA_BOARD_ID_LVRM = 0,
+    UNA_BOARD_ID_BPSM,
+    UNA_BOARD_ID_DDRM,
+    UNA_BOARD_ID_UHFM,
+    UNA_BOARD_ID_GPSM,
+    UNA_BOARD_ID_SM,
+    UNA_BOARD_ID_RRM,
+    UNA_BOARD_ID_LAST
+} UNA_board_id_t;
+
+/*!******************************************************************
+ * \enum UNA_register_access_t
+ * \brief UNA register access rights.
+ *******************************************************************/
+typedef enum {
+    UNA_REGISTER_ACCESS_READ_ONLY = 0,
+    UNA_REGISTER_ACCESS_READ_WRITE,
+    UNA_REGISTER_ACCESS_LAST
+} UNA_register_access_t;
+
+/*!******************************************************************
+ * \enum UNA_bit_representation_t
+ * \brief UNA single bit representation.
+ *******************************************************************/
+typedef enum {
+    UNA_BIT_0 = 0b00,
+    UNA_BIT_1 = 0b01,
+    UNA_BIT_FORCED_HARDWARE = 0b10,
+    UNA_BIT_ERROR = 0b11
+} UNA_bit_representation_t;
+
+/*!******************************************************************
+ * \typedef UNA_node_address_t
+ * \brief UNA node address type.
+ *******************************************************************/
+typedef uint8_t UNA_node_address_t;
+
+/*** UNA functions ***/
+
+/*!******************************************************************
+ * \fn uint32_t UNA_convert_seconds(uint32_t time_seconds)
+ * \brief Convert a duration to register format (2-bit unit, 6-bit value).
+ * \param[in]   time_seconds: Duration in seconds.
+ * \param[out]  none
+ * \retval      Register field value.
+ *******************************************************************/
+uint32_t UNA_convert_seconds(uint32_t time_seconds);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_get_seconds(uint32_t field)
+ * \brief Convert a register field to a duration in seconds.
+ * \param[in]   field: Register field value.
+ * \param[out]  none
+ * \retval      Duration in seconds.
+ *******************************************************************/
+uint32_t UNA_get_seconds(uint32_t field);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_convert_mv(int32_t voltage_mv)
+ * \brief Convert a voltage to register format.
+ * \param[in]   voltage_mv: Voltage in mV.
+ * \param[out]  none
+ * \retval      Register field value.
+ *******************************************************************/
+uint32_t UNA_convert_mv(int32_t voltage_mv);
+
+/*!******************************************************************
+ * \fn int32_t UNA_get_mv(uint32_t field)
+ * \brief Convert a register field to a voltage.
+ * \param[in]   field: Register field value.
+ * \param[out]  none
+ * \retval      Voltage in mV.
+ *******************************************************************/
+int32_t UNA_get_mv(uint32_t field);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_convert_ua(int32_t current_ua)
+ * \brief Convert a current to register format.
+ * \param[in]   current_ua: Current in uA.
+ * \param[out]  none
+ * \retval      Register field value.
+ *******************************************************************/
+uint32_t UNA_convert_ua(int32_t current_ua);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_convert_dbm(int16_t rf_power_dbm)
+ * \brief Convert a RF power to register format.
+ * \param[in]   rf_power_dbm: RF power in dBm.
+ * \param[out]  none
+ * \retval      Register field value.
+ *******************************************************************/
+uint32_t UNA_convert_dbm(int16_t rf_power_dbm);
+
+/*!******************************************************************
+ * \fn int16_t UNA_get_dbm(uint32_t field)
+ * \brief Convert a register field to a RF power.
+ * \param[in]   field: Register field value.
+ * \param[out]  none
+ * \retval      RF power in dBm.
+ *******************************************************************/
+int16_t UNA_get_dbm(uint32_t field);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_convert_degrees(int32_t temperature_degrees)
+ * \brief Convert a temperature to register format.
+ * \param[in]   temperature_degrees: Temperature in degrees.
+ * \param[out]  none
+ * \retval      Register field value.
+ *******************************************************************/
+uint32_t UNA_convert_degrees(int32_t temperature_degrees);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_convert_year(uint16_t year)
+ * \brief Convert a year to register format.
+ * \param[in]   year: Year to convert.
+ * \param[out]  none
+ * \retval      Register field value.
+ *******************************************************************/
+uint32_t UNA_convert_year(uint16_t year);
+
+#endif /* __UNA_H__ */
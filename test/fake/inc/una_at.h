@@ -0,0 +1,37 @@
+/*
+ * una_at.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_AT_H__
+#define __UNA_AT_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** UNA_AT structures ***/
+
+/*!******************************************************************
+ * \enum UNA_AT_status_t
+ * \brief UNA_AT driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_AT_SUCCESS = 0,
+    UNA_AT_ERROR_NULL_PARAMETER,
+    // Last base value.
+    UNA_AT_ERROR_BASE_LAST = 0x0100
+} UNA_AT_status_t;
+
+/*******************************************************************/
+#define UNA_AT_exit_error(base) { ERROR_check_exit(una_at_status, UNA_AT_SUCCESS, base) }
+
+/*******************************************************************/
+#define UNA_AT_stack_error(base) { ERROR_check_stack(una_at_status, UNA_AT_SUCCESS, base) }
+
+/*******************************************************************/
+#define UNA_AT_stack_exit_error(base, code) { ERROR_check_stack_exit(una_at_status, UNA_AT_SUCCESS, base, code) }
+
+#endif /* __UNA_AT_H__ */
@@ -0,0 +1,87 @@
+/*
+ * usart.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __USART_H__
+#define __USART_H__
+
+#include "error.h"
+#include "gpio.h"
+#include "types.h"
+
+/*** USART structures ***/
+
+/*!******************************************************************
+ * \enum USART_status_t
+ * \brief USART driver error codes (host fake).
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    USART_SUCCESS = 0,
+    USART_ERROR_NULL_PARAMETER,
+    USART_ERROR_INSTANCE,
+    USART_ERROR_TIMEOUT,
+    // Last base value.
+    USART_ERROR_BASE_LAST = 0x0100
+} USART_status_t;
+
+/*!******************************************************************
+ * \enum USART_instance_t
+ * \brief USART instances list.
+ *******************************************************************/
+typedef enum {
+    USART_INSTANCE_USART2 = 0,
+    USART_INSTANCE_LAST
+} USART_instance_t;
+
+/*!******************************************************************
+ * \struct USART_gpio_t
+ * \brief USART GPIOs list.
+ *******************************************************************/
+typedef struct {
+    const GPIO_pin_t* tx;
+    const GPIO_pin_t* rx;
+} USART_gpio_t;
+
+/*!******************************************************************
+ * \brief USART RX interrupt callback.
+ *******************************************************************/
+typedef void (*USART_rx_irq_cb_t)(uint8_t data);
+
+/*!******************************************************************
+ * \brief USART IDLE line interrupt callback.
+ *******************************************************************/
+typedef void (*USART_idle_irq_cb_t)(void);
+
+/*!******************************************************************
+ * \struct USART_configuration_t
+ * \brief USART configuration structure.
+ *******************************************************************/
+typedef struct {
+    uint32_t baud_rate;
+    uint8_t nvic_priority;
+    USART_rx_irq_cb_t rxne_callback;
+    USART_idle_irq_cb_t idle_callback;
+} USART_configuration_t;
+
+/*** USART functions ***/
+
+USART_status_t USART_init(USART_instance_t instance, const USART_gpio_t* pins, USART_configuration_t* configuration);
+USART_status_t USART_de_init(USART_instance_t instance, const USART_gpio_t* pins);
+USART_status_t USART_enable_rx(USART_instance_t instance);
+USART_status_t USART_disable_rx(USART_instance_t instance);
+USART_status_t USART_write(USART_instance_t instance, uint8_t* data, uint32_t data_size_bytes);
+
+/*******************************************************************/
+#define USART_exit_error(base) { ERROR_check_exit(usart_status, USART_SUCCESS, base) }
+
+/*******************************************************************/
+#define USART_stack_error(base) { ERROR_check_stack(usart_status, USART_SUCCESS, base) }
+
+/*******************************************************************/
+#define USART_stack_exit_error(base, code) { ERROR_check_stack_exit(usart_status, USART_SUCCESS, base, code) }
+
+#endif /* __USART_H__ */
@@ -0,0 +1,33 @@
+/*
+ * usart_registers.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __USART_REGISTERS_H__
+#define __USART_REGISTERS_H__
+
+#include "types.h"
+
+/*** USART REGISTERS structures ***/
+
+/*!******************************************************************
+ * \struct USART_registers_t
+ * \brief USART registers used by the drivers (host fake).
+ *******************************************************************/
+typedef struct {
+    volatile uint32_t CR1;
+    volatile uint32_t CR3;
+    volatile uint32_t RDR;
+} USART_registers_t;
+
+/*** USART REGISTERS global variables ***/
+
+extern USART_registers_t fake_usart2;
+
+/*** USART REGISTERS macros ***/
+
+#define USART2  ((USART_registers_t*) &fake_usart2)
+
+#endif /* __USART_REGISTERS_H__ */
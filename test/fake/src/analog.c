@@ -0,0 +1,20 @@
+/*
+ * analog.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "analog.h"
+
+#include "fake.h"
+#include "types.h"
+
+/*** ANALOG functions ***/
+
+/*******************************************************************/
+ANALOG_status_t ANALOG_convert_channel(ANALOG_channel_t channel, int32_t* analog_data) {
+    if (analog_data == NULL) return ANALOG_ERROR_NULL_PARAMETER;
+    (*analog_data) = FAKE_get_analog_data((uint8_t) channel);
+    return ANALOG_SUCCESS;
+}
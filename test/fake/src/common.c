@@ -0,0 +1,33 @@
+/*
+ * common.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "common.h"
+
+#include "common_registers.h"
+#include "node.h"
+#include "types.h"
+#include "una.h"
+
+/*** COMMON functions ***/
+
+/*******************************************************************/
+NODE_status_t COMMON_init_registers(UNA_node_address_t self_address) {
+    return NODE_write_register(NODE_REQUEST_SOURCE_INTERNAL, COMMON_REGISTER_ADDRESS_NODE_ID, self_address, COMMON_REGISTER_NODE_ID_MASK_NODE_ADDR);
+}
+
+/*******************************************************************/
+NODE_status_t COMMON_update_register(uint8_t reg_addr) {
+    UNUSED(reg_addr);
+    return NODE_SUCCESS;
+}
+
+/*******************************************************************/
+NODE_status_t COMMON_check_register(uint8_t reg_addr, uint32_t reg_mask) {
+    UNUSED(reg_addr);
+    UNUSED(reg_mask);
+    return NODE_SUCCESS;
+}
@@ -0,0 +1,125 @@
+/*
+ * exti.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "exti.h"
+
+#include "fake.h"
+#include "gpio.h"
+#include "gpio_mapping.h"
+#include "types.h"
+
+/*** EXTI local macros ***/
+
+#define EXTI_NUMBER_OF_LINES    16
+
+/*** EXTI local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    EXTI_gpio_irq_cb_t irq_callback;
+    EXTI_trigger_t trigger;
+    uint8_t enable;
+} EXTI_line_t;
+
+/*** EXTI local global variables ***/
+
+// One line per pin number as on the MCU.
+static EXTI_line_t exti_line[EXTI_NUMBER_OF_LINES];
+
+/*** EXTI global variables ***/
+
+const GPIO_pin_t GPIO_DIO0 = { 1, 4 };
+const GPIO_pin_t GPIO_DIO1 = { 1, 5 };
+const GPIO_pin_t GPIO_DIO2 = { 1, 6 };
+const GPIO_pin_t GPIO_DIO3 = { 1, 7 };
+
+/*** EXTI local functions ***/
+
+/*******************************************************************/
+static EXTI_line_t* _EXTI_get_line(const GPIO_pin_t* gpio) {
+    return (((gpio->pin) < EXTI_NUMBER_OF_LINES) ? &(exti_line[gpio->pin]) : NULL);
+}
+
+/*** EXTI functions ***/
+
+/*******************************************************************/
+void FAKE_exti_reset(void) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Release all lines.
+    for (idx = 0; idx < EXTI_NUMBER_OF_LINES; idx++) {
+        exti_line[idx].irq_callback = NULL;
+        exti_line[idx].trigger = EXTI_TRIGGER_RISING_EDGE;
+        exti_line[idx].enable = 0;
+    }
+}
+
+/*******************************************************************/
+void FAKE_exti_set_gpio(const GPIO_pin_t* gpio, uint8_t state) {
+    // Local variables.
+    EXTI_line_t* line = _EXTI_get_line(gpio);
+    uint8_t previous_state = GPIO_read(gpio);
+    // Update input level.
+    GPIO_write(gpio, state);
+    if ((line == NULL) || (state == previous_state)) return;
+    // Check edge polarity.
+    if (((line->trigger) == EXTI_TRIGGER_RISING_EDGE) && (state == 0)) return;
+    if (((line->trigger) == EXTI_TRIGGER_FALLING_EDGE) && (state != 0)) return;
+    FAKE_exti_trigger(gpio);
+}
+
+/*******************************************************************/
+void FAKE_exti_trigger(const GPIO_pin_t* gpio) {
+    // Local variables.
+    EXTI_line_t* line = _EXTI_get_line(gpio);
+    // Run interrupt handler.
+    if ((line != NULL) && ((line->enable) != 0) && ((line->irq_callback) != NULL)) {
+        line->irq_callback();
+    }
+}
+
+/*******************************************************************/
+void EXTI_configure_gpio(const GPIO_pin_t* gpio, GPIO_pull_resistor_t pull_resistor, EXTI_trigger_t trigger, EXTI_gpio_irq_cb_t irq_callback, uint8_t nvic_priority) {
+    // Local variables.
+    EXTI_line_t* line = _EXTI_get_line(gpio);
+    UNUSED(pull_resistor);
+    UNUSED(nvic_priority);
+    if (line == NULL) return;
+    line->irq_callback = irq_callback;
+    line->trigger = trigger;
+}
+
+/*******************************************************************/
+void EXTI_release_gpio(const GPIO_pin_t* gpio, GPIO_mode_t released_mode) {
+    // Local variables.
+    EXTI_line_t* line = _EXTI_get_line(gpio);
+    UNUSED(released_mode);
+    if (line == NULL) return;
+    line->irq_callback = NULL;
+    line->enable = 0;
+}
+
+/*******************************************************************/
+void EXTI_enable_gpio_interrupt(const GPIO_pin_t* gpio) {
+    // Local variables.
+    EXTI_line_t* line = _EXTI_get_line(gpio);
+    if (line == NULL) return;
+    line->enable = 1;
+}
+
+/*******************************************************************/
+void EXTI_disable_gpio_interrupt(const GPIO_pin_t* gpio) {
+    // Local variables.
+    EXTI_line_t* line = _EXTI_get_line(gpio);
+    if (line == NULL) return;
+    line->enable = 0;
+}
+
+/*******************************************************************/
+void EXTI_clear_gpio_flag(const GPIO_pin_t* gpio) {
+    UNUSED(gpio);
+}
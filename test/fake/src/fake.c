@@ -0,0 +1,340 @@
+/*
+ * fake.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+
+#include "adc.h"
+#include "analog.h"
+#include "error.h"
+#include "gpio.h"
+#include "gpio_mapping.h"
+#include "led.h"
+#include "lptim.h"
+#include "nvm.h"
+#include "power.h"
+#include "rtc.h"
+#include "types.h"
+#include "xm_flags.h"
+
+/*** FAKE local macros ***/
+
+#define FAKE_ERROR_STACK_DEPTH  32
+#define FAKE_GPIO_PORTS         8
+#define FAKE_GPIO_PINS          16
+#define FAKE_ADC_VREFINT_MV     1200
+
+/*** FAKE local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint64_t time_us;
+    uint32_t delay_count;
+    uint8_t nvm[FAKE_NVM_SIZE_BYTES];
+    uint32_t nvm_write_count;
+    uint32_t nvm_write_limit;
+    ERROR_code_t error_stack[FAKE_ERROR_STACK_DEPTH];
+    uint8_t error_stack_count;
+    uint32_t power_requesters[POWER_DOMAIN_LAST];
+    uint32_t power_off_count[POWER_DOMAIN_LAST];
+    uint32_t power_request_count[POWER_REQUESTER_ID_LAST];
+    int32_t analog_data[ANALOG_CHANNEL_LAST];
+    int32_t adc_data[ADC_CHANNEL_LAST];
+    uint32_t adc_conversion_count;
+    uint8_t gpio_state[FAKE_GPIO_PORTS][FAKE_GPIO_PINS];
+} FAKE_context_t;
+
+/*** FAKE global variables ***/
+
+FAKE_radio_t fake_radio;
+const ADC_gpio_t GPIO_ADC = { 0 };
+
+/*** FAKE local global variables ***/
+
+static FAKE_context_t fake_ctx;
+
+/*** FAKE functions ***/
+
+/*******************************************************************/
+void FAKE_reset(void) {
+    // Local variables.
+    uint8_t* ctx_bytes = (uint8_t*) &fake_ctx;
+    uint8_t* radio_bytes = (uint8_t*) &fake_radio;
+    uint32_t idx = 0;
+    // Reset contexts.
+    for (idx = 0; idx < sizeof(FAKE_context_t); idx++) {
+        ctx_bytes[idx] = 0;
+    }
+    for (idx = 0; idx < sizeof(FAKE_radio_t); idx++) {
+        radio_bytes[idx] = 0;
+    }
+    // Default radio timings.
+    fake_radio.ul_frame_duration_seconds = 2;
+    fake_radio.dl_window_duration_seconds = 25;
+    // No power loss.
+    fake_ctx.nvm_write_limit = FAKE_NVM_WRITE_LIMIT_NONE;
+    // Reset interrupt lines, clocks, transceiver, GPS receiver, load and timer models.
+    FAKE_exti_reset();
+    FAKE_timebase_reset();
+    FAKE_s2lp_reset();
+    FAKE_gps_reset();
+    FAKE_load_reset();
+    FAKE_tim_reset();
+}
+
+/*******************************************************************/
+void FAKE_set_uptime_seconds(uint32_t uptime_seconds) {
+    fake_ctx.time_us = (((uint64_t) uptime_seconds) * 1000000);
+}
+
+/*******************************************************************/
+void FAKE_advance_milliseconds(uint32_t delay_ms) {
+    fake_ctx.time_us += (((uint64_t) delay_ms) * 1000);
+}
+
+/*******************************************************************/
+void FAKE_advance_microseconds(uint32_t delay_us) {
+    fake_ctx.time_us += delay_us;
+}
+
+/*******************************************************************/
+uint32_t FAKE_get_milliseconds(void) {
+    return ((uint32_t) (fake_ctx.time_us / 1000));
+}
+
+/*******************************************************************/
+uint64_t FAKE_get_microseconds(void) {
+    return (fake_ctx.time_us);
+}
+
+/*******************************************************************/
+uint32_t FAKE_get_nvm_write_count(void) {
+    return (fake_ctx.nvm_write_count);
+}
+
+/*******************************************************************/
+void FAKE_set_nvm_write_limit(uint32_t nvm_write_count) {
+    fake_ctx.nvm_write_limit = nvm_write_count;
+}
+
+/*******************************************************************/
+uint32_t FAKE_get_delay_count(void) {
+    return (fake_ctx.delay_count);
+}
+
+/*******************************************************************/
+uint32_t FAKE_get_power_off_count(uint8_t domain) {
+    return ((domain < POWER_DOMAIN_LAST) ? fake_ctx.power_off_count[domain] : 0);
+}
+
+/*******************************************************************/
+uint32_t FAKE_get_power_request_count(uint8_t requester_id) {
+    return ((requester_id < POWER_REQUESTER_ID_LAST) ? fake_ctx.power_request_count[requester_id] : 0);
+}
+
+/*******************************************************************/
+uint32_t FAKE_get_adc_conversion_count(void) {
+    return (fake_ctx.adc_conversion_count);
+}
+
+/*******************************************************************/
+void FAKE_set_analog_data(uint8_t channel, int32_t analog_data) {
+    if (channel < ANALOG_CHANNEL_LAST) {
+        fake_ctx.analog_data[channel] = analog_data;
+    }
+}
+
+/*******************************************************************/
+int32_t FAKE_get_analog_data(uint8_t channel) {
+    return ((channel < ANALOG_CHANNEL_LAST) ? fake_ctx.analog_data[channel] : 0);
+}
+
+/*******************************************************************/
+void FAKE_set_adc_data(uint8_t channel, int32_t adc_data_12bits) {
+    if (channel < ADC_CHANNEL_LAST) {
+        fake_ctx.adc_data[channel] = adc_data_12bits;
+    }
+}
+
+/*** ERROR functions ***/
+
+/*******************************************************************/
+void ERROR_stack_add(ERROR_code_t code) {
+    if (fake_ctx.error_stack_count < FAKE_ERROR_STACK_DEPTH) {
+        fake_ctx.error_stack[fake_ctx.error_stack_count++] = code;
+    }
+}
+
+/*******************************************************************/
+uint8_t ERROR_stack_is_empty(void) {
+    return ((fake_ctx.error_stack_count == 0) ? 1 : 0);
+}
+
+/*** GPIO functions ***/
+
+/*******************************************************************/
+void GPIO_configure(const GPIO_pin_t* gpio, GPIO_mode_t mode, GPIO_output_type_t output_type, GPIO_output_speed_t output_speed, GPIO_pull_resistor_t pull_resistor) {
+    UNUSED(gpio);
+    UNUSED(mode);
+    UNUSED(output_type);
+    UNUSED(output_speed);
+    UNUSED(pull_resistor);
+}
+
+/*******************************************************************/
+void GPIO_write(const GPIO_pin_t* gpio, uint8_t state) {
+    if (((gpio->port) < FAKE_GPIO_PORTS) && ((gpio->pin) < FAKE_GPIO_PINS)) {
+        fake_ctx.gpio_state[gpio->port][gpio->pin] = state;
+    }
+}
+
+/*******************************************************************/
+uint8_t GPIO_read(const GPIO_pin_t* gpio) {
+    return ((((gpio->port) < FAKE_GPIO_PORTS) && ((gpio->pin) < FAKE_GPIO_PINS)) ? fake_ctx.gpio_state[gpio->port][gpio->pin] : 0);
+}
+
+/*** RTC functions ***/
+
+/*******************************************************************/
+uint32_t RTC_get_uptime_seconds(void) {
+    return ((uint32_t) (fake_ctx.time_us / 1000000));
+}
+
+/*** LPTIM functions ***/
+
+/*******************************************************************/
+LPTIM_status_t LPTIM_delay_milliseconds(uint32_t delay_ms, LPTIM_delay_mode_t delay_mode) {
+    UNUSED(delay_mode);
+    fake_ctx.delay_count++;
+    fake_ctx.time_us += (((uint64_t) delay_ms) * 1000);
+    return LPTIM_SUCCESS;
+}
+
+/*** NVM functions ***/
+
+/*******************************************************************/
+NVM_status_t NVM_read_byte(NVM_address_t address, uint8_t* data) {
+    if (data == NULL) return NVM_ERROR_NULL_PARAMETER;
+    if (address >= FAKE_NVM_SIZE_BYTES) return NVM_ERROR_ADDRESS;
+    (*data) = fake_ctx.nvm[address];
+    return NVM_SUCCESS;
+}
+
+/*******************************************************************/
+NVM_status_t NVM_write_byte(NVM_address_t address, uint8_t data) {
+    if (address >= FAKE_NVM_SIZE_BYTES) return NVM_ERROR_ADDRESS;
+    // Writes are lost once the MCU is powered off.
+    if (fake_ctx.nvm_write_count >= fake_ctx.nvm_write_limit) return NVM_SUCCESS;
+    fake_ctx.nvm[address] = data;
+    fake_ctx.nvm_write_count++;
+    return NVM_SUCCESS;
+}
+
+/*** POWER functions ***/
+
+/*******************************************************************/
+void POWER_init(void) {
+    // Nothing to do.
+}
+
+/*******************************************************************/
+void POWER_enable(POWER_requester_id_t requester_id, POWER_domain_t domain, LPTIM_delay_mode_t delay_mode) {
+    UNUSED(delay_mode);
+    if ((domain < POWER_DOMAIN_LAST) && (requester_id < POWER_REQUESTER_ID_LAST)) {
+        fake_ctx.power_requesters[domain] |= (0b1 << requester_id);
+        fake_ctx.power_request_count[requester_id]++;
+    }
+}
+
+/*******************************************************************/
+void POWER_disable(POWER_requester_id_t requester_id, POWER_domain_t domain) {
+    if ((domain < POWER_DOMAIN_LAST) && (requester_id < POWER_REQUESTER_ID_LAST)) {
+        // Count effective turn off only.
+        if (fake_ctx.power_requesters[domain] == (uint32_t) (0b1 << requester_id)) {
+            fake_ctx.power_off_count[domain]++;
+        }
+        fake_ctx.power_requesters[domain] &= ~(0b1 << requester_id);
+    }
+}
+
+/*******************************************************************/
+uint8_t POWER_get_state(POWER_domain_t domain) {
+    return (((domain < POWER_DOMAIN_LAST) && (fake_ctx.power_requesters[domain] != 0)) ? 1 : 0);
+}
+
+/*** ADC functions ***/
+
+/*******************************************************************/
+ADC_status_t ADC_init(const ADC_gpio_t* pins) {
+    UNUSED(pins);
+    return ADC_SUCCESS;
+}
+
+/*******************************************************************/
+ADC_status_t ADC_de_init(void) {
+    return ADC_SUCCESS;
+}
+
+/*******************************************************************/
+ADC_status_t ADC_convert_channel(ADC_channel_t channel, int32_t* adc_data_12bits) {
+    if ((adc_data_12bits == NULL) || (channel >= ADC_CHANNEL_LAST)) return ADC_ERROR_TIMEOUT;
+    (*adc_data_12bits) = fake_ctx.adc_data[channel];
+    fake_ctx.adc_conversion_count++;
+    return ADC_SUCCESS;
+}
+
+/*******************************************************************/
+int32_t ADC_get_vrefint_voltage_mv(void) {
+    return FAKE_ADC_VREFINT_MV;
+}
+
+/*******************************************************************/
+ADC_status_t ADC_compute_vmcu(int32_t vrefint_12bits, int32_t vrefint_mv, int32_t* vmcu_mv) {
+    if ((vmcu_mv == NULL) || (vrefint_12bits == 0)) return ADC_ERROR_TIMEOUT;
+    (*vmcu_mv) = ((vrefint_mv * ADC_FULL_SCALE) / vrefint_12bits);
+    return ADC_SUCCESS;
+}
+
+/*******************************************************************/
+ADC_status_t ADC_compute_tmcu(int32_t vmcu_mv, int32_t tmcu_12bits, int32_t* tmcu_degrees) {
+    UNUSED(vmcu_mv);
+    UNUSED(tmcu_12bits);
+    if (tmcu_degrees == NULL) return ADC_ERROR_TIMEOUT;
+    (*tmcu_degrees) = 25;
+    return ADC_SUCCESS;
+}
+
+#ifdef XM_RGB_LED
+
+/*** LED functions ***/
+
+/*******************************************************************/
+LED_status_t LED_init(void) {
+    return LED_SUCCESS;
+}
+
+/*******************************************************************/
+LED_status_t LED_de_init(void) {
+    return LED_SUCCESS;
+}
+
+/*******************************************************************/
+LED_status_t LED_start_single_blink(uint32_t blink_duration_ms, LED_color_t color) {
+    UNUSED(color);
+    if (blink_duration_ms == 0) return LED_ERROR_NULL_DURATION;
+    return LED_SUCCESS;
+}
+
+/*******************************************************************/
+LED_status_t LED_stop_blink(void) {
+    return LED_SUCCESS;
+}
+
+/*******************************************************************/
+uint8_t LED_is_single_blink_done(void) {
+    return 1;
+}
+#endif /* XM_RGB_LED */
@@ -0,0 +1,247 @@
+/*
+ * gps.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "gps.h"
+
+#include "fake.h"
+#include "types.h"
+#include "ubx.h"
+
+#ifdef GPSM
+
+/*** GPS local macros ***/
+
+#define GPS_UBX_SYNC_CHAR_1         0xB5
+#define GPS_UBX_SYNC_CHAR_2         0x62
+#define GPS_UBX_CLASS_MGA           0x13
+#define GPS_UBX_HEADER_SIZE_BYTES   6
+#define GPS_UBX_CHECKSUM_SIZE_BYTES 2
+
+/*** GPS local global variables ***/
+
+static uint8_t gps_backup_voltage = 0;
+
+/*** GPS functions ***/
+
+/*******************************************************************/
+GPS_status_t GPS_init(void) {
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_de_init(void) {
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_start_acquisition(GPS_acquisition_type_t acquisition_type, uint32_t timeout_seconds) {
+    UNUSED(timeout_seconds);
+    if (acquisition_type >= GPS_ACQUISITION_TYPE_LAST) return GPS_ERROR_ACQUISITION_TYPE;
+    // Record the assistance messages injected before the acquisition.
+    fake_gps.exchange_count++;
+    fake_gps.acquisition_start_count++;
+    fake_gps.acquisition_start_mga_message_count = fake_gps.mga_message_count;
+    fake_gps.acquisition_running = 1;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_stop_acquisition(void) {
+    fake_gps.acquisition_running = 0;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_process(void) {
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_acquisition_state_t GPS_get_acquisition_state(void) {
+    return ((fake_gps.acquisition_running != 0) ? GPS_ACQUISITION_STATE_RUNNING : GPS_ACQUISITION_STATE_IDLE);
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_time(GPS_time_t* gps_time, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status) {
+    if ((gps_time == NULL) || (acquisition_duration_seconds == NULL) || (acquisition_status == NULL)) return GPS_ERROR_NULL_PARAMETER;
+    (*acquisition_duration_seconds) = 0;
+    (*acquisition_status) = GPS_ACQUISITION_ERROR_TIMEOUT;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_position(GPS_position_t* gps_position, uint32_t* acquisition_duration_seconds, GPS_acquisition_status_t* acquisition_status) {
+    if ((gps_position == NULL) || (acquisition_duration_seconds == NULL) || (acquisition_status == NULL)) return GPS_ERROR_NULL_PARAMETER;
+    (*acquisition_duration_seconds) = 0;
+    (*acquisition_status) = GPS_ACQUISITION_ERROR_TIMEOUT;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_set_fix_quality_gate(GPS_fix_quality_gate_t* fix_quality_gate) {
+    if (fix_quality_gate == NULL) return GPS_ERROR_NULL_PARAMETER;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_fix_report(GPS_fix_report_t* fix_report) {
+    if (fix_report == NULL) return GPS_ERROR_NULL_PARAMETER;
+    fix_report->horizontal_accuracy_mm = 0;
+    fix_report->number_of_fixes = 0;
+    fix_report->gate_reached = 0;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_set_backup_voltage(uint8_t state) {
+    gps_backup_voltage = state;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+uint8_t GPS_get_backup_voltage(void) {
+    return gps_backup_voltage;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_set_timepulse(GPS_timepulse_configuration_t* configuration) {
+    if (configuration == NULL) return GPS_ERROR_NULL_PARAMETER;
+    fake_gps.exchange_count++;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_set_power_mode(GPS_power_mode_configuration_t* configuration) {
+    if (configuration == NULL) return GPS_ERROR_NULL_PARAMETER;
+    fake_gps.exchange_count++;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_set_aiding_configuration(uint8_t autonomous_aiding_enable) {
+    fake_gps.exchange_count++;
+    fake_gps.aiding_configuration_count++;
+    fake_gps.autonomous_aiding_enable = autonomous_aiding_enable;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_inject_assistance(uint8_t* data, uint32_t data_size_bytes, uint32_t* frame_size_bytes, uint8_t* acknowledged) {
+    // Local variables.
+    uint32_t payload_size_bytes = 0;
+    uint8_t checksum_a = 0;
+    uint8_t checksum_b = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((data == NULL) || (frame_size_bytes == NULL) || (acknowledged == NULL)) return GPS_ERROR_NULL_PARAMETER;
+    (*frame_size_bytes) = 0;
+    (*acknowledged) = 0;
+    // Same framing rules as the UBX driver.
+    if (data_size_bytes < GPS_UBX_HEADER_SIZE_BYTES) return GPS_SUCCESS;
+    if ((data[0] != GPS_UBX_SYNC_CHAR_1) || (data[1] != GPS_UBX_SYNC_CHAR_2) || (data[2] != GPS_UBX_CLASS_MGA)) return (GPS_ERROR_BASE_UBX + UBX_ERROR_FRAME);
+    payload_size_bytes = (uint32_t) (data[4] | (data[5] << 8));
+    if (data_size_bytes < (GPS_UBX_HEADER_SIZE_BYTES + payload_size_bytes + GPS_UBX_CHECKSUM_SIZE_BYTES)) return GPS_SUCCESS;
+    for (idx = 2; idx < (GPS_UBX_HEADER_SIZE_BYTES + payload_size_bytes); idx++) {
+        checksum_a = (uint8_t) (checksum_a + data[idx]);
+        checksum_b = (uint8_t) (checksum_b + checksum_a);
+    }
+    if ((data[GPS_UBX_HEADER_SIZE_BYTES + payload_size_bytes] != checksum_a) || (data[GPS_UBX_HEADER_SIZE_BYTES + payload_size_bytes + 1] != checksum_b)) return (GPS_ERROR_BASE_UBX + UBX_ERROR_FRAME);
+    (*frame_size_bytes) = (GPS_UBX_HEADER_SIZE_BYTES + payload_size_bytes + GPS_UBX_CHECKSUM_SIZE_BYTES);
+    // Record message and reply with MGA-ACK.
+    if (fake_gps.mga_message_count < FAKE_GPS_MGA_MESSAGES_MAX) {
+        fake_gps.mga_message_ids[fake_gps.mga_message_count] = data[3];
+        (*acknowledged) = (((fake_gps.mga_nack_mask >> fake_gps.mga_message_count) & 0b1) == 0) ? 1 : 0;
+    }
+    fake_gps.exchange_count++;
+    fake_gps.mga_message_count++;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_autonomous_aiding_status(uint8_t* autonomous_aiding_running) {
+    if (autonomous_aiding_running == NULL) return GPS_ERROR_NULL_PARAMETER;
+    fake_gps.exchange_count++;
+    (*autonomous_aiding_running) = 0;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_quality(GPS_quality_t* gps_quality) {
+    // Local variables.
+    uint8_t* quality_bytes = (uint8_t*) gps_quality;
+    uint32_t idx = 0;
+    // Check parameter.
+    if (gps_quality == NULL) return GPS_ERROR_NULL_PARAMETER;
+    fake_gps.exchange_count++;
+    for (idx = 0; idx < sizeof(GPS_quality_t); idx++) {
+        quality_bytes[idx] = 0;
+    }
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_start_clock_discipline(void) {
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_stop_clock_discipline(void) {
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_process_clock_discipline(void) {
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+uint32_t GPS_get_clock_discipline_pulse_count(void) {
+    return 0;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_apply_clock_discipline(GPS_clock_discipline_t* clock_discipline) {
+    if (clock_discipline == NULL) return GPS_ERROR_NULL_PARAMETER;
+    return GPS_ERROR_CLOCK_DISCIPLINE_PULSES;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_set_calendar(GPS_time_t* gps_time) {
+    if (gps_time == NULL) return GPS_ERROR_NULL_PARAMETER;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_calendar(uint32_t* unix_time_seconds) {
+    if (unix_time_seconds == NULL) return GPS_ERROR_NULL_PARAMETER;
+    return GPS_ERROR_CALENDAR;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_convert_position(GPS_position_t* gps_position, GPS_coordinates_t* coordinates) {
+    if ((gps_position == NULL) || (coordinates == NULL)) return GPS_ERROR_NULL_PARAMETER;
+    coordinates->latitude = 0;
+    coordinates->longitude = 0;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_get_distance(GPS_coordinates_t* point_1, GPS_coordinates_t* point_2, uint32_t* distance_m) {
+    if ((point_1 == NULL) || (point_2 == NULL) || (distance_m == NULL)) return GPS_ERROR_NULL_PARAMETER;
+    (*distance_m) = 0;
+    return GPS_SUCCESS;
+}
+
+/*******************************************************************/
+GPS_status_t GPS_is_inside_polygon(GPS_coordinates_t* point, GPS_coordinates_t* vertices, uint8_t number_of_vertices, uint8_t* inside) {
+    UNUSED(number_of_vertices);
+    if ((point == NULL) || (vertices == NULL) || (inside == NULL)) return GPS_ERROR_NULL_PARAMETER;
+    (*inside) = 0;
+    return GPS_SUCCESS;
+}
+
+#endif /* GPSM */
@@ -0,0 +1,114 @@
+/*
+ * load.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "load.h"
+
+#include "fake.h"
+#include "types.h"
+#include "xm_flags.h"
+
+/*** LOAD global variables ***/
+
+FAKE_load_t fake_load;
+
+/*** LOAD local functions ***/
+
+#if (defined LVRM) && (defined HW2_0)
+/*******************************************************************/
+static void _LOAD_start_sequence(uint8_t state) {
+    fake_load.switching = 1;
+    fake_load.sequence_state = state;
+    fake_load.sequence_remaining_count = fake_load.sequence_process_count;
+}
+#endif
+
+/*** LOAD functions ***/
+
+/*******************************************************************/
+void FAKE_load_reset(void) {
+    // Local variables.
+    uint8_t* load_bytes = (uint8_t*) &fake_load;
+    uint32_t idx = 0;
+    // Reset context.
+    for (idx = 0; idx < sizeof(FAKE_load_t); idx++) {
+        load_bytes[idx] = 0;
+    }
+    fake_load.sequence_process_count = 1;
+}
+
+#ifdef XM_LOAD_CONTROL
+
+/*******************************************************************/
+void LOAD_init(void) {
+    fake_load.output_state = 0;
+}
+
+/*******************************************************************/
+LOAD_status_t LOAD_set_output_state(uint8_t state) {
+    fake_load.set_count++;
+#if (defined LVRM) && (defined HW2_0)
+    // Queue request during a switching sequence.
+    if (fake_load.switching != 0) {
+        fake_load.request_pending = 1;
+        fake_load.pending_state = state;
+    }
+    else {
+        _LOAD_start_sequence(state);
+    }
+#else
+    if (state != fake_load.output_state) {
+        fake_load.switch_count++;
+    }
+    fake_load.output_state = state;
+#endif
+    return LOAD_SUCCESS;
+}
+
+/*******************************************************************/
+uint8_t LOAD_get_output_state(void) {
+    return fake_load.output_state;
+}
+
+#if (defined LVRM) && (defined HW2_0)
+/*******************************************************************/
+LOAD_status_t LOAD_process(uint8_t* sequence_done) {
+    // Check parameter.
+    if (sequence_done == NULL) return LOAD_ERROR_STATE;
+    (*sequence_done) = 0;
+    if (fake_load.switching == 0) return LOAD_SUCCESS;
+    // Coil pulse.
+    if (fake_load.sequence_remaining_count > 0) {
+        fake_load.sequence_remaining_count--;
+    }
+    if (fake_load.sequence_remaining_count > 0) return LOAD_SUCCESS;
+    // End of sequence.
+    if (fake_load.sequence_state != fake_load.output_state) {
+        fake_load.switch_count++;
+    }
+    fake_load.output_state = fake_load.sequence_state;
+    fake_load.switching = 0;
+    (*sequence_done) = 1;
+    // Execute queued request.
+    if (fake_load.request_pending != 0) {
+        fake_load.request_pending = 0;
+        _LOAD_start_sequence(fake_load.pending_state);
+    }
+    return LOAD_SUCCESS;
+}
+
+/*******************************************************************/
+uint8_t LOAD_is_switching(void) {
+    return fake_load.switching;
+}
+
+/*******************************************************************/
+uint8_t LOAD_is_request_pending(void) {
+    return fake_load.request_pending;
+}
+#endif
+
+#endif /* XM_LOAD_CONTROL */
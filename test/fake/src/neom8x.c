@@ -0,0 +1,326 @@
+/*
+ * neom8x.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+
+#include "dma.h"
+#include "gpio.h"
+#include "gpio_mapping.h"
+#include "types.h"
+#include "usart.h"
+#include "usart_registers.h"
+
+/*** NEOM8X local macros ***/
+
+#define NEOM8X_UBX_SYNC_CHAR_1      0xB5
+#define NEOM8X_UBX_SYNC_CHAR_2      0x62
+#define NEOM8X_UBX_HEADER_SIZE      6
+
+#define NEOM8X_USART_CR1_RE         (0b1 << 2)
+#define NEOM8X_USART_CR1_IDLEIE     (0b1 << 4)
+#define NEOM8X_USART_CR1_RXNEIE     (0b1 << 5)
+#define NEOM8X_USART_CR3_DMAR       (0b1 << 6)
+
+/*** NEOM8X local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t initialized;
+    uint8_t started;
+    DMA_configuration_t configuration;
+    uint16_t number_of_transfered_data;
+} NEOM8X_dma_channel_t;
+
+/*******************************************************************/
+typedef struct {
+    // USART.
+    uint8_t usart_initialized;
+    USART_rx_irq_cb_t rxne_callback;
+    USART_idle_irq_cb_t idle_callback;
+    // DMA channels.
+    NEOM8X_dma_channel_t dma[DMA_CHANNEL_LAST];
+} NEOM8X_context_t;
+
+/*** NEOM8X local global variables ***/
+
+static NEOM8X_context_t neom8x_ctx;
+static const GPIO_pin_t GPIO_GPS_TX = { 1, 1 };
+static const GPIO_pin_t GPIO_GPS_RX = { 1, 2 };
+
+/*** NEOM8X global variables ***/
+
+const GPIO_pin_t GPIO_GPS_VBCKP = { 1, 0 };
+const USART_gpio_t GPIO_GPS_USART = { &GPIO_GPS_TX, &GPIO_GPS_RX };
+USART_registers_t fake_usart2;
+FAKE_gps_t fake_gps;
+
+/*** NEOM8X local functions ***/
+
+/*******************************************************************/
+static uint8_t _NEOM8X_dma_request(uint8_t data) {
+    // Local variables.
+    NEOM8X_dma_channel_t* channel = NULL;
+    volatile uint8_t* memory = NULL;
+    uint16_t half_transfer = 0;
+    uint8_t idx = 0;
+    // Search the channel connected to the USART data register.
+    for (idx = 0; idx < DMA_CHANNEL_LAST; idx++) {
+        if ((neom8x_ctx.dma[idx].started != 0) && (neom8x_ctx.dma[idx].configuration.peripheral_address == (uint32_t) (unsigned long) &(USART2->RDR))) {
+            channel = &(neom8x_ctx.dma[idx]);
+            break;
+        }
+    }
+    if (channel == NULL) return 0;
+    // Write memory.
+    memory = (volatile uint8_t*) (unsigned long) (channel->configuration.memory_address);
+    memory[channel->number_of_transfered_data] = data;
+    channel->number_of_transfered_data++;
+    half_transfer = (uint16_t) ((channel->configuration.number_of_data) >> 1);
+    // Half transfer interrupt.
+    if ((channel->number_of_transfered_data) == half_transfer) {
+        fake_gps.dma_irq_count++;
+        if ((channel->configuration.half_transfer_irq_callback) != NULL) {
+            channel->configuration.half_transfer_irq_callback();
+        }
+    }
+    // Full transfer interrupt, the counter is reloaded before the interrupt in circular mode.
+    if ((channel->number_of_transfered_data) >= (channel->configuration.number_of_data)) {
+        if ((channel->configuration.circular_mode) != 0) {
+            channel->number_of_transfered_data = 0;
+        }
+        else {
+            channel->started = 0;
+        }
+        fake_gps.dma_irq_count++;
+        if ((channel->configuration.full_transfer_irq_callback) != NULL) {
+            channel->configuration.full_transfer_irq_callback();
+        }
+    }
+    return 1;
+}
+
+/*******************************************************************/
+static void _NEOM8X_receive_byte(uint8_t data) {
+    fake_gps.rx_size_bytes++;
+    // Receiver must be enabled.
+    if ((neom8x_ctx.usart_initialized == 0) || (((USART2->CR1) & NEOM8X_USART_CR1_RE) == 0)) goto errors;
+    USART2->RDR = data;
+    // DMA request.
+    if (((USART2->CR3) & NEOM8X_USART_CR3_DMAR) != 0) {
+        if (_NEOM8X_dma_request(data) == 0) goto errors;
+        return;
+    }
+    // RXNE interrupt.
+    if ((((USART2->CR1) & NEOM8X_USART_CR1_RXNEIE) != 0) && (neom8x_ctx.rxne_callback != NULL)) {
+        fake_gps.rxne_irq_count++;
+        neom8x_ctx.rxne_callback(data);
+        return;
+    }
+errors:
+    fake_gps.rx_lost_bytes++;
+}
+
+/*** NEOM8X functions ***/
+
+/*******************************************************************/
+void FAKE_gps_reset(void) {
+    // Local variables.
+    uint8_t* ctx_bytes = (uint8_t*) &neom8x_ctx;
+    uint8_t* fake_bytes = (uint8_t*) &fake_gps;
+    uint32_t idx = 0;
+    // Reset contexts.
+    for (idx = 0; idx < sizeof(NEOM8X_context_t); idx++) {
+        ctx_bytes[idx] = 0;
+    }
+    for (idx = 0; idx < sizeof(FAKE_gps_t); idx++) {
+        fake_bytes[idx] = 0;
+    }
+    USART2->CR1 = 0;
+    USART2->CR3 = 0;
+    USART2->RDR = 0;
+}
+
+/*******************************************************************/
+void FAKE_gps_add_reply(uint8_t message_class, uint8_t message_id, uint8_t* data, uint32_t size_bytes) {
+    // Local variables.
+    FAKE_gps_reply_t* reply = NULL;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((fake_gps.number_of_replies >= FAKE_GPS_REPLIES_MAX) || (size_bytes > FAKE_GPS_REPLY_SIZE_BYTES)) return;
+    reply = &(fake_gps.replies[fake_gps.number_of_replies++]);
+    reply->message_class = message_class;
+    reply->message_id = message_id;
+    reply->size_bytes = size_bytes;
+    for (idx = 0; idx < size_bytes; idx++) {
+        reply->data[idx] = data[idx];
+    }
+}
+
+/*******************************************************************/
+void FAKE_gps_receive(uint8_t* data, uint32_t size_bytes) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Bytes are transmitted one by one.
+    for (idx = 0; idx < size_bytes; idx++) {
+        _NEOM8X_receive_byte(data[idx]);
+    }
+    // Line is idle after the last byte.
+    if ((size_bytes != 0) && (((USART2->CR1) & NEOM8X_USART_CR1_IDLEIE) != 0) && (neom8x_ctx.idle_callback != NULL)) {
+        fake_gps.idle_irq_count++;
+        neom8x_ctx.idle_callback();
+    }
+}
+
+/*******************************************************************/
+uint32_t FAKE_gps_build_ubx_frame(uint8_t message_class, uint8_t message_id, uint8_t* payload, uint16_t payload_size_bytes, uint8_t* frame) {
+    // Local variables.
+    uint8_t checksum_a = 0;
+    uint8_t checksum_b = 0;
+    uint32_t idx = 0;
+    // Header.
+    frame[0] = NEOM8X_UBX_SYNC_CHAR_1;
+    frame[1] = NEOM8X_UBX_SYNC_CHAR_2;
+    frame[2] = message_class;
+    frame[3] = message_id;
+    frame[4] = (uint8_t) (payload_size_bytes & 0xFF);
+    frame[5] = (uint8_t) (payload_size_bytes >> 8);
+    for (idx = 0; idx < payload_size_bytes; idx++) {
+        frame[NEOM8X_UBX_HEADER_SIZE + idx] = payload[idx];
+    }
+    // Fletcher checksum from class to end of payload.
+    for (idx = 2; idx < (uint32_t) (NEOM8X_UBX_HEADER_SIZE + payload_size_bytes); idx++) {
+        checksum_a = (uint8_t) (checksum_a + frame[idx]);
+        checksum_b = (uint8_t) (checksum_b + checksum_a);
+    }
+    frame[NEOM8X_UBX_HEADER_SIZE + payload_size_bytes] = checksum_a;
+    frame[NEOM8X_UBX_HEADER_SIZE + payload_size_bytes + 1] = checksum_b;
+    return (uint32_t) (NEOM8X_UBX_HEADER_SIZE + payload_size_bytes + 2);
+}
+
+/*** USART functions ***/
+
+/*******************************************************************/
+USART_status_t USART_init(USART_instance_t instance, const USART_gpio_t* pins, USART_configuration_t* configuration) {
+    if ((pins == NULL) || (configuration == NULL)) return USART_ERROR_NULL_PARAMETER;
+    if (instance >= USART_INSTANCE_LAST) return USART_ERROR_INSTANCE;
+    neom8x_ctx.usart_initialized = 1;
+    neom8x_ctx.rxne_callback = (configuration->rxne_callback);
+    neom8x_ctx.idle_callback = (configuration->idle_callback);
+    USART2->CR1 = 0;
+    USART2->CR3 = 0;
+    return USART_SUCCESS;
+}
+
+/*******************************************************************/
+USART_status_t USART_de_init(USART_instance_t instance, const USART_gpio_t* pins) {
+    if (pins == NULL) return USART_ERROR_NULL_PARAMETER;
+    if (instance >= USART_INSTANCE_LAST) return USART_ERROR_INSTANCE;
+    neom8x_ctx.usart_initialized = 0;
+    USART2->CR1 = 0;
+    USART2->CR3 = 0;
+    return USART_SUCCESS;
+}
+
+/*******************************************************************/
+USART_status_t USART_enable_rx(USART_instance_t instance) {
+    if (instance >= USART_INSTANCE_LAST) return USART_ERROR_INSTANCE;
+    USART2->CR1 |= (NEOM8X_USART_CR1_RE | NEOM8X_USART_CR1_RXNEIE);
+    // IDLE interrupt is only enabled when a callback is given.
+    if (neom8x_ctx.idle_callback != NULL) {
+        USART2->CR1 |= NEOM8X_USART_CR1_IDLEIE;
+    }
+    return USART_SUCCESS;
+}
+
+/*******************************************************************/
+USART_status_t USART_disable_rx(USART_instance_t instance) {
+    if (instance >= USART_INSTANCE_LAST) return USART_ERROR_INSTANCE;
+    USART2->CR1 &= ~(NEOM8X_USART_CR1_RE | NEOM8X_USART_CR1_RXNEIE | NEOM8X_USART_CR1_IDLEIE);
+    return USART_SUCCESS;
+}
+
+/*******************************************************************/
+USART_status_t USART_write(USART_instance_t instance, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    FAKE_gps_reply_t* reply = NULL;
+    uint32_t idx = 0;
+    // Check parameters.
+    if (data == NULL) return USART_ERROR_NULL_PARAMETER;
+    if (instance >= USART_INSTANCE_LAST) return USART_ERROR_INSTANCE;
+    // Record transmitted bytes.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        if (fake_gps.tx_size_bytes < FAKE_GPS_TX_SIZE_BYTES) {
+            fake_gps.tx_data[fake_gps.tx_size_bytes++] = data[idx];
+        }
+    }
+    fake_gps.tx_message_count++;
+    // Receiver answers UBX messages immediately.
+    if ((data_size_bytes < NEOM8X_UBX_HEADER_SIZE) || (data[0] != NEOM8X_UBX_SYNC_CHAR_1) || (data[1] != NEOM8X_UBX_SYNC_CHAR_2)) goto errors;
+    for (idx = 0; idx < fake_gps.number_of_replies; idx++) {
+        reply = &(fake_gps.replies[idx]);
+        if (((reply->message_class) == data[2]) && ((reply->message_id) == data[3])) {
+            FAKE_gps_receive(reply->data, reply->size_bytes);
+        }
+    }
+errors:
+    return USART_SUCCESS;
+}
+
+/*** DMA functions ***/
+
+/*******************************************************************/
+DMA_status_t DMA_init(DMA_channel_t channel, DMA_configuration_t* configuration) {
+    if (configuration == NULL) return DMA_ERROR_NULL_PARAMETER;
+    if (channel >= DMA_CHANNEL_LAST) return DMA_ERROR_CHANNEL;
+    neom8x_ctx.dma[channel].configuration = (*configuration);
+    neom8x_ctx.dma[channel].initialized = 1;
+    neom8x_ctx.dma[channel].started = 0;
+    neom8x_ctx.dma[channel].number_of_transfered_data = 0;
+    return DMA_SUCCESS;
+}
+
+/*******************************************************************/
+DMA_status_t DMA_de_init(DMA_channel_t channel) {
+    if (channel >= DMA_CHANNEL_LAST) return DMA_ERROR_CHANNEL;
+    neom8x_ctx.dma[channel].initialized = 0;
+    neom8x_ctx.dma[channel].started = 0;
+    return DMA_SUCCESS;
+}
+
+/*******************************************************************/
+DMA_status_t DMA_start(DMA_channel_t channel) {
+    if (channel >= DMA_CHANNEL_LAST) return DMA_ERROR_CHANNEL;
+    if (neom8x_ctx.dma[channel].initialized == 0) return DMA_ERROR_UNINITIALIZED;
+    neom8x_ctx.dma[channel].started = 1;
+    return DMA_SUCCESS;
+}
+
+/*******************************************************************/
+DMA_status_t DMA_stop(DMA_channel_t channel) {
+    if (channel >= DMA_CHANNEL_LAST) return DMA_ERROR_CHANNEL;
+    if (neom8x_ctx.dma[channel].initialized == 0) return DMA_ERROR_UNINITIALIZED;
+    neom8x_ctx.dma[channel].started = 0;
+    return DMA_SUCCESS;
+}
+
+/*******************************************************************/
+DMA_status_t DMA_set_memory_address(DMA_channel_t channel, uint32_t memory_address, uint16_t number_of_data) {
+    if (channel >= DMA_CHANNEL_LAST) return DMA_ERROR_CHANNEL;
+    if (neom8x_ctx.dma[channel].initialized == 0) return DMA_ERROR_UNINITIALIZED;
+    neom8x_ctx.dma[channel].configuration.memory_address = memory_address;
+    neom8x_ctx.dma[channel].configuration.number_of_data = number_of_data;
+    neom8x_ctx.dma[channel].number_of_transfered_data = 0;
+    return DMA_SUCCESS;
+}
+
+/*******************************************************************/
+DMA_status_t DMA_get_number_of_transfered_data(DMA_channel_t channel, uint16_t* number_of_transfered_data) {
+    if (number_of_transfered_data == NULL) return DMA_ERROR_NULL_PARAMETER;
+    if (channel >= DMA_CHANNEL_LAST) return DMA_ERROR_CHANNEL;
+    (*number_of_transfered_data) = neom8x_ctx.dma[channel].number_of_transfered_data;
+    return DMA_SUCCESS;
+}
@@ -0,0 +1,66 @@
+/*
+ * neom8x_driver.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "neom8x.h"
+
+#include "gpio.h"
+#include "gpio_mapping.h"
+#include "neom8x_hw.h"
+#include "types.h"
+
+#ifdef GPSM
+
+/*** NEOM8X DRIVER local macros ***/
+
+#define NEOM8X_DRIVER_UART_BAUD_RATE    9600
+
+/*** NEOM8X DRIVER global variables ***/
+
+const GPIO_pin_t GPIO_GPS_TIMEPULSE = { 0, 15 };
+
+/*** NEOM8X DRIVER local functions ***/
+
+/*******************************************************************/
+static void _NEOM8X_nmea_rx_callback(uint8_t data) {
+    // NMEA sentences are not decoded when the UBX protocol is used.
+    UNUSED(data);
+}
+
+/*** NEOM8X DRIVER functions ***/
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_init(void) {
+    // Local variables.
+    NEOM8X_HW_configuration_t configuration;
+    // Same interface configuration as the submodule driver.
+    configuration.uart_baud_rate = NEOM8X_DRIVER_UART_BAUD_RATE;
+    configuration.rx_irq_callback = &_NEOM8X_nmea_rx_callback;
+    return NEOM8X_HW_init(&configuration);
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_de_init(void) {
+    return NEOM8X_HW_de_init();
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_set_backup_voltage(uint8_t state) {
+    return NEOM8X_HW_set_backup_voltage(state);
+}
+
+/*******************************************************************/
+uint8_t NEOM8X_get_backup_voltage(void) {
+    return NEOM8X_HW_get_backup_voltage();
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_set_timepulse(NEOM8X_timepulse_configuration_t* configuration) {
+    if (configuration == NULL) return NEOM8X_ERROR_NULL_PARAMETER;
+    return NEOM8X_SUCCESS;
+}
+
+#endif /* GPSM */
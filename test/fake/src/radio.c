@@ -0,0 +1,213 @@
+/*
+ * radio.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+
+#include "manuf/mcu_api.h"
+#include "manuf/rf_api.h"
+#include "rf_api_ext.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_rc.h"
+#include "sigfox_types.h"
+#include "types.h"
+
+/*** RADIO local global variables ***/
+
+static SIGFOX_EP_API_message_status_t radio_message_status;
+static sfx_s16 radio_dl_rssi_dbm;
+
+/*** RADIO global variables ***/
+
+const SIGFOX_rc_t SIGFOX_RC1 = { 868130000, 869525000 };
+
+/*** SIGFOX EP API functions ***/
+
+/*******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_open(SIGFOX_EP_API_config_t* config) {
+    UNUSED(config);
+    fake_radio.open_count++;
+    return ((fake_radio.open_error != 0) ? SIGFOX_EP_API_ERROR_STATE : SIGFOX_EP_API_SUCCESS);
+}
+
+/*******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_close(void) {
+    fake_radio.close_count++;
+    return SIGFOX_EP_API_SUCCESS;
+}
+
+/*******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_send_application_message(SIGFOX_EP_API_application_message_t* application_message) {
+    // Local variables.
+    FAKE_radio_message_t* message = NULL;
+    uint32_t duration_seconds = 0;
+    uint8_t idx = 0;
+    // Reset status.
+    radio_message_status.all = 0;
+    radio_dl_rssi_dbm = 0;
+    if (fake_radio.send_error != 0) return SIGFOX_EP_API_ERROR_RF;
+    if (fake_radio.message_count >= FAKE_RADIO_MESSAGES_MAX) return SIGFOX_EP_API_ERROR_STATE;
+    // Record message.
+    message = &(fake_radio.messages[fake_radio.message_count]);
+    message->start_time_seconds = (FAKE_get_milliseconds() / 1000);
+    message->number_of_frames = application_message->common_parameters.number_of_frames;
+    message->bidirectional_flag = (uint8_t) application_message->bidirectional_flag;
+    message->ul_payload_size_bytes = application_message->ul_payload_size_bytes;
+    for (idx = 0; (idx < application_message->ul_payload_size_bytes) && (idx < SIGFOX_UL_PAYLOAD_MAX_SIZE_BYTES); idx++) {
+        message->ul_payload[idx] = application_message->ul_payload[idx];
+    }
+    // Uplink frames.
+    radio_message_status.field.ul_frame_1 = 1;
+    radio_message_status.field.ul_frame_2 = (message->number_of_frames > 1) ? 1 : 0;
+    radio_message_status.field.ul_frame_3 = (message->number_of_frames > 2) ? 1 : 0;
+    duration_seconds = (message->number_of_frames * fake_radio.ul_frame_duration_seconds);
+    // Downlink frame.
+    if (message->bidirectional_flag != 0) {
+        duration_seconds += fake_radio.dl_window_duration_seconds;
+        if (((fake_radio.dl_loss_mask >> (fake_radio.message_count % 32)) & 0x01) == 0) {
+            radio_message_status.field.dl_frame = 1;
+            radio_dl_rssi_dbm = fake_radio.dl_rssi_dbm[fake_radio.message_count];
+        }
+    }
+    // The library is blocking: the whole message duration elapses during the call.
+    FAKE_advance_milliseconds(duration_seconds * 1000);
+    message->end_time_seconds = (FAKE_get_milliseconds() / 1000);
+    fake_radio.message_count++;
+    return SIGFOX_EP_API_SUCCESS;
+}
+
+/*******************************************************************/
+SIGFOX_EP_API_message_status_t SIGFOX_EP_API_get_message_status(void) {
+    return radio_message_status;
+}
+
+/*******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_get_dl_payload(sfx_u8* dl_payload, sfx_u8 dl_payload_size, sfx_s16* dl_rssi_dbm) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    // Fill payload with message index.
+    for (idx = 0; idx < dl_payload_size; idx++) {
+        dl_payload[idx] = (sfx_u8) fake_radio.message_count;
+    }
+    (*dl_rssi_dbm) = radio_dl_rssi_dbm;
+    return SIGFOX_EP_API_SUCCESS;
+}
+
+/*** SIGFOX EP ADDON RFP API functions ***/
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_open(SIGFOX_EP_ADDON_RFP_API_config_t* config) {
+    UNUSED(config);
+    return SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_close(void) {
+    return SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t* test_mode) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    FAKE_radio_test_mode_t* record = NULL;
+    uint32_t duration_seconds = 0;
+    uint32_t idx = fake_radio.test_mode_count;
+    if (fake_radio.send_error != 0) return SIGFOX_EP_ADDON_RFP_API_ERROR_STATE;
+    if (idx >= FAKE_RADIO_MESSAGES_MAX) return SIGFOX_EP_ADDON_RFP_API_ERROR_STATE;
+    // Record test mode.
+    record = &(fake_radio.test_modes[idx]);
+    record->start_time_seconds = (FAKE_get_milliseconds() / 1000);
+    record->test_mode_reference = (uint8_t) test_mode->test_mode_reference;
+    record->ul_bit_rate = (uint8_t) test_mode->ul_bit_rate;
+    // Uplink test frame (C, J and F).
+    if (test_mode->test_mode_reference <= SIGFOX_EP_ADDON_RFP_API_TEST_MODE_F) {
+        duration_seconds += fake_radio.ul_frame_duration_seconds;
+    }
+    // Downlink reception (F, D and E): the test fails if the frame is lost or does not pass the CRC and authentication checks.
+    if (test_mode->test_mode_reference >= SIGFOX_EP_ADDON_RFP_API_TEST_MODE_F) {
+        duration_seconds += fake_radio.dl_window_duration_seconds;
+        radio_dl_rssi_dbm = 0;
+        if (((fake_radio.dl_loss_mask >> (idx % 32)) & 0x01) != 0) {
+            status = SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE;
+        }
+        else {
+            fake_radio.dl_phy_frame_count++;
+            radio_dl_rssi_dbm = fake_radio.dl_rssi_dbm[idx];
+            if (((fake_radio.dl_crc_error_mask >> (idx % 32)) & 0x01) != 0) {
+                status = SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE;
+            }
+        }
+    }
+    // The addon is blocking: the whole test mode duration elapses during the call.
+    FAKE_advance_milliseconds(duration_seconds * 1000);
+    record->end_time_seconds = (FAKE_get_milliseconds() / 1000);
+    fake_radio.test_mode_count++;
+    return status;
+}
+
+/*** MCU API functions ***/
+
+/*******************************************************************/
+MCU_API_status_t MCU_API_get_nvm(sfx_u8* nvm_data, sfx_u8 nvm_data_size_bytes) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    // Message counter is the number of sent messages.
+    for (idx = 0; idx < nvm_data_size_bytes; idx++) {
+        nvm_data[idx] = 0;
+    }
+    nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_MSB] = (sfx_u8) ((fake_radio.message_count >> 8) & 0xFF);
+    nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_LSB] = (sfx_u8) ((fake_radio.message_count >> 0) & 0xFF);
+    return MCU_API_SUCCESS;
+}
+
+/*** RF API functions ***/
+
+/*******************************************************************/
+RF_API_status_t RF_API_wake_up(void) {
+    return RF_API_SUCCESS;
+}
+
+/*******************************************************************/
+RF_API_status_t RF_API_sleep(void) {
+    return RF_API_SUCCESS;
+}
+
+/*******************************************************************/
+RF_API_status_t RF_API_init(RF_API_radio_parameters_t* radio_parameters) {
+    UNUSED(radio_parameters);
+    return RF_API_SUCCESS;
+}
+
+/*******************************************************************/
+RF_API_status_t RF_API_de_init(void) {
+    return RF_API_SUCCESS;
+}
+
+/*******************************************************************/
+RF_API_status_t RF_API_start_continuous_wave(void) {
+    return RF_API_SUCCESS;
+}
+
+/*******************************************************************/
+RF_API_status_t RF_API_get_dl_phy_content_and_rssi(sfx_u8* dl_phy_content, sfx_u8 dl_phy_content_size, sfx_s16* dl_rssi_dbm) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    // Fill content with test mode index.
+    for (idx = 0; idx < dl_phy_content_size; idx++) {
+        dl_phy_content[idx] = (sfx_u8) fake_radio.test_mode_count;
+    }
+    (*dl_rssi_dbm) = radio_dl_rssi_dbm;
+    return RF_API_SUCCESS;
+}
+
+/*** RF API EXT functions ***/
+
+/*******************************************************************/
+sfx_u32 RF_API_get_dl_phy_frame_count(void) {
+    return fake_radio.dl_phy_frame_count;
+}
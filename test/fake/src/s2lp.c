@@ -0,0 +1,381 @@
+/*
+ * s2lp.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+
+#include "gpio.h"
+#include "gpio_mapping.h"
+#include "iwdg.h"
+#include "pwr.h"
+#include "rfe.h"
+#include "s2lp.h"
+#include "sigfox_types.h"
+#include "types.h"
+
+/*** S2LP local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    // Transceiver.
+    uint8_t shutdown;
+    uint8_t tx_fifo[S2LP_FIFO_SIZE_BYTES];
+    uint8_t tx_fifo_level;
+    uint8_t tx_fifo_threshold;
+    uint8_t rx_fifo[SIGFOX_DL_PHY_CONTENT_SIZE_BYTES];
+    uint32_t irq_mask;
+    uint32_t irq_status;
+} S2LP_context_t;
+
+/*** S2LP local global variables ***/
+
+static S2LP_context_t s2lp_ctx;
+
+/*** S2LP global variables ***/
+
+const GPIO_pin_t GPIO_S2LP_GPIO0 = { 0, 0 };
+FAKE_s2lp_t fake_s2lp;
+
+/*** S2LP local functions ***/
+
+/*******************************************************************/
+static void _S2LP_set_irq(S2LP_irq_index_t irq_index) {
+    s2lp_ctx.irq_status |= (0b1 << irq_index);
+    // Assert nIRQ line if the interrupt is enabled on both sides.
+    if ((s2lp_ctx.irq_mask & (0b1 << irq_index)) != 0) {
+        FAKE_exti_trigger(&GPIO_S2LP_GPIO0);
+    }
+}
+
+/*******************************************************************/
+static void _S2LP_shift_out(uint8_t size_bytes) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Record emitted samples.
+    for (idx = 0; idx < size_bytes; idx++) {
+        if (fake_s2lp.stream_size_bytes < FAKE_S2LP_STREAM_SIZE_BYTES) {
+            fake_s2lp.stream[fake_s2lp.stream_size_bytes++] = s2lp_ctx.tx_fifo[idx];
+        }
+    }
+    // Shift FIFO.
+    for (idx = size_bytes; idx < s2lp_ctx.tx_fifo_level; idx++) {
+        s2lp_ctx.tx_fifo[idx - size_bytes] = s2lp_ctx.tx_fifo[idx];
+    }
+    s2lp_ctx.tx_fifo_level = (uint8_t) (s2lp_ctx.tx_fifo_level - size_bytes);
+}
+
+/*** S2LP functions ***/
+
+/*******************************************************************/
+void FAKE_s2lp_reset(void) {
+    // Local variables.
+    uint8_t* ctx_bytes = (uint8_t*) &s2lp_ctx;
+    uint8_t* fake_bytes = (uint8_t*) &fake_s2lp;
+    uint32_t idx = 0;
+    // Reset contexts.
+    for (idx = 0; idx < sizeof(S2LP_context_t); idx++) {
+        ctx_bytes[idx] = 0;
+    }
+    for (idx = 0; idx < sizeof(FAKE_s2lp_t); idx++) {
+        fake_bytes[idx] = 0;
+    }
+    s2lp_ctx.shutdown = 1;
+    fake_s2lp.fifo_level_min = S2LP_FIFO_SIZE_BYTES;
+    fake_s2lp.rssi_dbm = -100;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_shutdown(uint8_t shutdown_enable) {
+    s2lp_ctx.shutdown = shutdown_enable;
+    fake_s2lp.state = S2LP_STATE_READY;
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_send_command(S2LP_command_t command) {
+    // Update transceiver state.
+    switch (command) {
+    case S2LP_COMMAND_TX:
+        fake_s2lp.state = S2LP_STATE_TX;
+        break;
+    case S2LP_COMMAND_RX:
+        fake_s2lp.state = S2LP_STATE_RX;
+        break;
+    case S2LP_COMMAND_LOCKTX:
+    case S2LP_COMMAND_LOCKRX:
+        fake_s2lp.state = S2LP_STATE_LOCK;
+        break;
+    case S2LP_COMMAND_FLUSHTXFIFO:
+        s2lp_ctx.tx_fifo_level = 0;
+        break;
+    case S2LP_COMMAND_FLUSHRXFIFO:
+        break;
+    default:
+        fake_s2lp.state = S2LP_STATE_READY;
+        break;
+    }
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_wait_for_state(S2LP_state_t new_state) {
+    return ((fake_s2lp.state == new_state) ? S2LP_SUCCESS : S2LP_ERROR_STATE_TIMEOUT);
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_oscillator(S2LP_oscillator_t oscillator) {
+    UNUSED(oscillator);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_wait_for_oscillator(void) {
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_common_configuration(void) {
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_smps_frequency(uint32_t frequency_hz) {
+    UNUSED(frequency_hz);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_modulation(S2LP_modulation_t modulation) {
+    UNUSED(modulation);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_rf_frequency(uint32_t frequency_hz) {
+    UNUSED(frequency_hz);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_fsk_deviation(uint32_t deviation_hz) {
+    UNUSED(deviation_hz);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_datarate(uint32_t datarate_bps) {
+    UNUSED(datarate_bps);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_rf_output_power(int8_t output_power_dbm) {
+    UNUSED(output_power_dbm);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_tx_source(S2LP_tx_source_t tx_source) {
+    UNUSED(tx_source);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_rx_source(S2LP_rx_source_t rx_source) {
+    UNUSED(rx_source);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_rx_bandwidth(uint32_t rxbw_hz, S2LP_afc_mode_t afc_mode) {
+    UNUSED(rxbw_hz);
+    UNUSED(afc_mode);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_rssi_threshold(int16_t rssi_threshold_dbm) {
+    UNUSED(rssi_threshold_dbm);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_preamble_detector(uint8_t preamble_size_2bits, S2LP_preamble_pattern_t preamble_pattern) {
+    UNUSED(preamble_size_2bits);
+    UNUSED(preamble_pattern);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_sync_word(uint8_t* sync_word, uint8_t sync_word_size_bits) {
+    UNUSED(sync_word);
+    UNUSED(sync_word_size_bits);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_packet_format(uint8_t packet_size_bytes, S2LP_crc_mode_t crc_mode) {
+    UNUSED(packet_size_bytes);
+    UNUSED(crc_mode);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_configure_gpio(S2LP_gpio_t gpio, S2LP_gpio_mode_t mode, S2LP_gpio_output_function_t function, S2LP_fifo_flag_direction_t fifo_flag_direction) {
+    UNUSED(gpio);
+    UNUSED(mode);
+    UNUSED(function);
+    UNUSED(fifo_flag_direction);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_set_fifo_threshold(S2LP_fifo_threshold_t fifo_threshold, uint8_t threshold_value) {
+    if (fifo_threshold == S2LP_FIFO_THRESHOLD_TX_EMPTY) {
+        s2lp_ctx.tx_fifo_threshold = threshold_value;
+    }
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_configure_irq(S2LP_irq_index_t irq_index, uint8_t irq_enable) {
+    if (irq_enable != 0) {
+        s2lp_ctx.irq_mask |= (0b1 << irq_index);
+    }
+    else {
+        s2lp_ctx.irq_mask &= ~(0b1 << irq_index);
+    }
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_get_irq_flag(S2LP_irq_index_t irq_index, uint8_t* irq_flag) {
+    (*irq_flag) = (uint8_t) ((s2lp_ctx.irq_status >> irq_index) & 0b1);
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_disable_all_irq(void) {
+    s2lp_ctx.irq_mask = 0;
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_clear_all_irq(void) {
+    s2lp_ctx.irq_status = 0;
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_write_fifo(uint8_t* tx_data, uint8_t tx_data_size) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Check overflow.
+    if ((s2lp_ctx.tx_fifo_level + tx_data_size) > S2LP_FIFO_SIZE_BYTES) {
+        fake_s2lp.fifo_overflow = 1;
+        return S2LP_ERROR_TX_FIFO_OVERFLOW;
+    }
+    for (idx = 0; idx < tx_data_size; idx++) {
+        s2lp_ctx.tx_fifo[s2lp_ctx.tx_fifo_level++] = tx_data[idx];
+    }
+    // Update records.
+    fake_s2lp.fifo_write_count++;
+    fake_s2lp.fifo_write_bytes += tx_data_size;
+    if (s2lp_ctx.tx_fifo_level > fake_s2lp.fifo_level_max) {
+        fake_s2lp.fifo_level_max = s2lp_ctx.tx_fifo_level;
+    }
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_read_fifo(uint8_t* rx_data, uint8_t rx_data_size) {
+    // Local variables.
+    uint8_t idx = 0;
+    for (idx = 0; idx < rx_data_size; idx++) {
+        rx_data[idx] = (idx < SIGFOX_DL_PHY_CONTENT_SIZE_BYTES) ? s2lp_ctx.rx_fifo[idx] : 0;
+    }
+    return S2LP_SUCCESS;
+}
+
+/*******************************************************************/
+S2LP_status_t S2LP_get_rssi(S2LP_rssi_t rssi_type, int16_t* rssi_dbm) {
+    UNUSED(rssi_type);
+    (*rssi_dbm) = fake_s2lp.rssi_dbm;
+    return S2LP_SUCCESS;
+}
+
+/*** RFE functions ***/
+
+/*******************************************************************/
+RFE_status_t RFE_init(void) {
+    return RFE_SUCCESS;
+}
+
+/*******************************************************************/
+RFE_status_t RFE_de_init(void) {
+    return RFE_SUCCESS;
+}
+
+/*******************************************************************/
+RFE_status_t RFE_set_path(RFE_path_t radio_path) {
+    UNUSED(radio_path);
+    return RFE_SUCCESS;
+}
+
+/*******************************************************************/
+RFE_status_t RFE_get_rssi(S2LP_rssi_t rssi_type, int16_t* rssi_dbm) {
+    S2LP_get_rssi(rssi_type, rssi_dbm);
+    return RFE_SUCCESS;
+}
+
+/*** PWR functions ***/
+
+/*******************************************************************/
+void PWR_enter_sleep_mode(void) {
+    // Local variables.
+    uint8_t idx = 0;
+    fake_s2lp.wake_up_count++;
+    // Run the transceiver until its next interrupt.
+    switch (fake_s2lp.state) {
+    case S2LP_STATE_TX:
+        if (s2lp_ctx.tx_fifo_level > s2lp_ctx.tx_fifo_threshold) {
+            // Modulator empties the FIFO down to the almost empty threshold.
+            _S2LP_shift_out((uint8_t) (s2lp_ctx.tx_fifo_level - s2lp_ctx.tx_fifo_threshold));
+        }
+        else {
+            // FIFO was not refilled: the modulator runs out of samples.
+            _S2LP_shift_out(s2lp_ctx.tx_fifo_level);
+            fake_s2lp.fifo_underrun = 1;
+        }
+        if (s2lp_ctx.tx_fifo_level < fake_s2lp.fifo_level_min) {
+            fake_s2lp.fifo_level_min = s2lp_ctx.tx_fifo_level;
+        }
+        _S2LP_set_irq(S2LP_IRQ_INDEX_TX_FIFO_ALMOST_EMPTY);
+        break;
+    case S2LP_STATE_RX:
+        if (fake_s2lp.dl_available != 0) {
+            for (idx = 0; idx < SIGFOX_DL_PHY_CONTENT_SIZE_BYTES; idx++) {
+                s2lp_ctx.rx_fifo[idx] = fake_s2lp.dl_phy_content[idx];
+            }
+            fake_s2lp.dl_available = 0;
+            _S2LP_set_irq(S2LP_IRQ_INDEX_RX_DATA_READY);
+        }
+        else {
+            // Nothing received: the MCU is woken up by the reception window timer.
+            FAKE_tim_sleep();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/*** IWDG functions ***/
+
+/*******************************************************************/
+void IWDG_reload(void) {
+    // Nothing to do.
+}
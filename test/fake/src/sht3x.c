@@ -0,0 +1,390 @@
+/*
+ * sht3x.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+
+#include "gpio.h"
+#include "gpio_mapping.h"
+#include "i2c.h"
+#include "i2c_address.h"
+#include "power.h"
+#include "types.h"
+
+/*** SHT3X local macros ***/
+
+#define SHT3X_COMMAND_SINGLE_SHOT           0x2400
+#define SHT3X_COMMAND_FETCH_DATA            0xE000
+#define SHT3X_COMMAND_BREAK                 0x3093
+#define SHT3X_COMMAND_READ_STATUS           0xF32D
+#define SHT3X_COMMAND_CLEAR_STATUS          0x3041
+#define SHT3X_COMMAND_ALERT_HIGH_SET        0x611D
+#define SHT3X_COMMAND_ALERT_HIGH_CLEAR      0x6116
+#define SHT3X_COMMAND_ALERT_LOW_CLEAR       0x610B
+#define SHT3X_COMMAND_ALERT_LOW_SET         0x6100
+#define SHT3X_COMMAND_NONE                  0x0000
+
+#define SHT3X_PERIODIC_RATES                5
+
+#define SHT3X_SINGLE_SHOT_DURATION_MS       15
+#define SHT3X_PERIODIC_DURATION_MS          4
+
+#define SHT3X_STATUS_ALERT_PENDING          0x8000
+#define SHT3X_STATUS_HUMIDITY_ALERT         0x0800
+#define SHT3X_STATUS_TEMPERATURE_ALERT      0x0400
+#define SHT3X_STATUS_RESET_DETECTED         0x0010
+#define SHT3X_STATUS_COMMAND_ERROR          0x0002
+#define SHT3X_STATUS_WRITE_CRC_ERROR        0x0001
+
+// Datasheet default alert limits (60 / 80, 58 / 79, -8 / 22, -10 / 20).
+#define SHT3X_DEFAULT_ALERT_HIGH_SET        0xCD33
+#define SHT3X_DEFAULT_ALERT_HIGH_CLEAR      0xC92D
+#define SHT3X_DEFAULT_ALERT_LOW_CLEAR       0x3869
+#define SHT3X_DEFAULT_ALERT_LOW_SET         0x3466
+
+#define SHT3X_LIMIT_TEMPERATURE_MASK        0x01FF
+#define SHT3X_LIMIT_HUMIDITY_SHIFT          9
+#define SHT3X_LIMIT_TEMPERATURE_SHIFT       7
+
+#define SHT3X_RAW_MAX                       0xFFFF
+#define SHT3X_TEMPERATURE_OFFSET_DEGREES    45
+#define SHT3X_TEMPERATURE_RANGE_DEGREES     175
+#define SHT3X_HUMIDITY_RANGE_PERCENT        100
+
+#define SHT3X_CRC_POLYNOMIAL                0x31
+#define SHT3X_CRC_INIT                      0xFF
+
+/*** SHT3X local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint16_t read_command;
+    uint32_t single_shot_time_ms;
+    uint32_t periodic_start_time_ms;
+    uint32_t periodic_period_ms;
+    uint32_t measurement_index;
+    uint8_t data_ready;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    uint32_t power_off_count;
+} SHT3X_context_t;
+
+/*** SHT3X local global variables ***/
+
+static SHT3X_context_t sht3x_ctx[FAKE_SHT3X_SENSORS_MAX];
+static const uint16_t SHT3X_COMMAND_PERIODIC[SHT3X_PERIODIC_RATES] = { 0x202F, 0x212D, 0x222B, 0x2329, 0x272A };
+static const uint32_t SHT3X_PERIODIC_PERIOD_MS[SHT3X_PERIODIC_RATES] = { 2000, 1000, 500, 250, 100 };
+static const GPIO_pin_t GPIO_SENSORS_SCL = { 1, 8 };
+static const GPIO_pin_t GPIO_SENSORS_SDA = { 1, 9 };
+
+/*** SHT3X global variables ***/
+
+const I2C_gpio_t GPIO_SENSORS_I2C = { &GPIO_SENSORS_SCL, &GPIO_SENSORS_SDA };
+FAKE_sht3x_t fake_sht3x;
+
+/*** SHT3X local functions ***/
+
+/*******************************************************************/
+static uint8_t _SHT3X_compute_crc(uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    uint8_t crc = SHT3X_CRC_INIT;
+    uint8_t idx = 0;
+    uint8_t bit_idx = 0;
+    // Bytes loop.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        crc ^= data[idx];
+        for (bit_idx = 0; bit_idx < 8; bit_idx++) {
+            crc = ((crc & 0x80) != 0) ? ((uint8_t) ((crc << 1) ^ SHT3X_CRC_POLYNOMIAL)) : ((uint8_t) (crc << 1));
+        }
+    }
+    return crc;
+}
+
+/*******************************************************************/
+static void _SHT3X_reset_sensor(uint8_t sensor_index) {
+    // Local variables.
+    FAKE_sht3x_sensor_t* sensor = &(fake_sht3x.sensors[sensor_index]);
+    SHT3X_context_t* context = &(sht3x_ctx[sensor_index]);
+    // Back to single shot mode with default limits.
+    sensor->periodic_running = 0;
+    sensor->periodic_command = SHT3X_COMMAND_NONE;
+    sensor->status_register = (SHT3X_STATUS_ALERT_PENDING | SHT3X_STATUS_RESET_DETECTED);
+    sensor->alert_high_set = SHT3X_DEFAULT_ALERT_HIGH_SET;
+    sensor->alert_high_clear = SHT3X_DEFAULT_ALERT_HIGH_CLEAR;
+    sensor->alert_low_clear = SHT3X_DEFAULT_ALERT_LOW_CLEAR;
+    sensor->alert_low_set = SHT3X_DEFAULT_ALERT_LOW_SET;
+    context->read_command = SHT3X_COMMAND_NONE;
+    context->data_ready = 0;
+}
+
+/*******************************************************************/
+static uint8_t _SHT3X_update_alert(uint8_t alert, uint16_t value, uint16_t high_set, uint16_t high_clear, uint16_t low_clear, uint16_t low_set) {
+    // Set thresholds.
+    if ((value >= high_set) || (value <= low_set)) return 1;
+    // Clear thresholds.
+    if ((value < high_clear) && (value > low_clear)) return 0;
+    // Hysteresis band.
+    return alert;
+}
+
+/*******************************************************************/
+static void _SHT3X_measure(uint8_t sensor_index) {
+    // Local variables.
+    FAKE_sht3x_sensor_t* sensor = &(fake_sht3x.sensors[sensor_index]);
+    SHT3X_context_t* context = &(sht3x_ctx[sensor_index]);
+    int32_t raw = 0;
+    uint16_t temperature = 0;
+    uint16_t humidity = 0;
+    uint8_t temperature_alert = 0;
+    uint8_t humidity_alert = 0;
+    // Raw values are rounded up so that the driver truncation gives back the simulated value.
+    raw = ((((sensor->temperature_degrees) + SHT3X_TEMPERATURE_OFFSET_DEGREES) * SHT3X_RAW_MAX) + (SHT3X_TEMPERATURE_RANGE_DEGREES - 1)) / SHT3X_TEMPERATURE_RANGE_DEGREES;
+    context->temperature_raw = (uint16_t) ((raw < 0) ? 0 : ((raw > SHT3X_RAW_MAX) ? SHT3X_RAW_MAX : raw));
+    raw = (((sensor->humidity_percent) * SHT3X_RAW_MAX) + (SHT3X_HUMIDITY_RANGE_PERCENT - 1)) / SHT3X_HUMIDITY_RANGE_PERCENT;
+    context->humidity_raw = (uint16_t) ((raw < 0) ? 0 : ((raw > SHT3X_RAW_MAX) ? SHT3X_RAW_MAX : raw));
+    // Alerts compare the 9 MSBs of temperature and the 7 MSBs of humidity.
+    temperature = (uint16_t) ((context->temperature_raw) >> SHT3X_LIMIT_TEMPERATURE_SHIFT);
+    humidity = (uint16_t) ((context->humidity_raw) >> SHT3X_LIMIT_HUMIDITY_SHIFT);
+    temperature_alert = _SHT3X_update_alert((((sensor->status_register) & SHT3X_STATUS_TEMPERATURE_ALERT) != 0) ? 1 : 0, temperature,
+        ((sensor->alert_high_set) & SHT3X_LIMIT_TEMPERATURE_MASK), ((sensor->alert_high_clear) & SHT3X_LIMIT_TEMPERATURE_MASK),
+        ((sensor->alert_low_clear) & SHT3X_LIMIT_TEMPERATURE_MASK), ((sensor->alert_low_set) & SHT3X_LIMIT_TEMPERATURE_MASK));
+    humidity_alert = _SHT3X_update_alert((((sensor->status_register) & SHT3X_STATUS_HUMIDITY_ALERT) != 0) ? 1 : 0, humidity,
+        ((sensor->alert_high_set) >> SHT3X_LIMIT_HUMIDITY_SHIFT), ((sensor->alert_high_clear) >> SHT3X_LIMIT_HUMIDITY_SHIFT),
+        ((sensor->alert_low_clear) >> SHT3X_LIMIT_HUMIDITY_SHIFT), ((sensor->alert_low_set) >> SHT3X_LIMIT_HUMIDITY_SHIFT));
+    // Update status register.
+    sensor->status_register &= ~(SHT3X_STATUS_TEMPERATURE_ALERT | SHT3X_STATUS_HUMIDITY_ALERT);
+    sensor->status_register |= ((temperature_alert != 0) ? SHT3X_STATUS_TEMPERATURE_ALERT : 0);
+    sensor->status_register |= ((humidity_alert != 0) ? SHT3X_STATUS_HUMIDITY_ALERT : 0);
+    if ((temperature_alert != 0) || (humidity_alert != 0)) {
+        sensor->status_register |= SHT3X_STATUS_ALERT_PENDING;
+    }
+}
+
+/*******************************************************************/
+static int8_t _SHT3X_get_sensor(uint8_t i2c_address) {
+    // Local variables.
+    uint32_t power_off_count = FAKE_get_power_off_count(POWER_DOMAIN_SENSORS);
+    uint32_t elapsed_ms = 0;
+    uint32_t measurement_index = 0;
+    uint8_t idx = 0;
+    // Search sensor.
+    for (idx = 0; idx < FAKE_SHT3X_SENSORS_MAX; idx++) {
+        if (fake_sht3x.sensors[idx].i2c_address == i2c_address) break;
+    }
+    // Sensor must be present and powered.
+    if ((idx >= FAKE_SHT3X_SENSORS_MAX) || (fake_sht3x.sensors[idx].present == 0) || (POWER_get_state(POWER_DOMAIN_SENSORS) == 0)) return -1;
+    // Power cycle since last access.
+    if (sht3x_ctx[idx].power_off_count != power_off_count) {
+        sht3x_ctx[idx].power_off_count = power_off_count;
+        fake_sht3x.sensors[idx].reset_count++;
+        _SHT3X_reset_sensor(idx);
+    }
+    // Periodic measurements performed since last access.
+    if (fake_sht3x.sensors[idx].periodic_running != 0) {
+        elapsed_ms = (FAKE_get_milliseconds() - sht3x_ctx[idx].periodic_start_time_ms);
+        if (elapsed_ms >= SHT3X_PERIODIC_DURATION_MS) {
+            measurement_index = (1 + ((elapsed_ms - SHT3X_PERIODIC_DURATION_MS) / sht3x_ctx[idx].periodic_period_ms));
+        }
+        if (measurement_index > sht3x_ctx[idx].measurement_index) {
+            sht3x_ctx[idx].measurement_index = measurement_index;
+            sht3x_ctx[idx].data_ready = 1;
+            _SHT3X_measure(idx);
+        }
+    }
+    return ((int8_t) idx);
+}
+
+/*******************************************************************/
+static uint8_t _SHT3X_write_command(uint8_t sensor_index, uint16_t command, uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    FAKE_sht3x_sensor_t* sensor = &(fake_sht3x.sensors[sensor_index]);
+    SHT3X_context_t* context = &(sht3x_ctx[sensor_index]);
+    uint16_t limit = 0;
+    uint8_t idx = 0;
+    // Periodic mode start.
+    for (idx = 0; idx < SHT3X_PERIODIC_RATES; idx++) {
+        if (command != SHT3X_COMMAND_PERIODIC[idx]) continue;
+        // A break is required before changing mode.
+        if (sensor->periodic_running != 0) return 0;
+        sensor->periodic_running = 1;
+        sensor->periodic_command = command;
+        context->periodic_start_time_ms = FAKE_get_milliseconds();
+        context->periodic_period_ms = SHT3X_PERIODIC_PERIOD_MS[idx];
+        context->measurement_index = 0;
+        context->data_ready = 0;
+        return 1;
+    }
+    switch (command) {
+    case SHT3X_COMMAND_SINGLE_SHOT:
+        // Not accepted in periodic mode.
+        if (sensor->periodic_running != 0) return 0;
+        sensor->single_shot_count++;
+        context->single_shot_time_ms = FAKE_get_milliseconds();
+        context->read_command = command;
+        break;
+    case SHT3X_COMMAND_FETCH_DATA:
+        if (sensor->periodic_running == 0) return 0;
+        context->read_command = command;
+        break;
+    case SHT3X_COMMAND_BREAK:
+        sensor->periodic_running = 0;
+        sensor->periodic_command = SHT3X_COMMAND_NONE;
+        context->data_ready = 0;
+        break;
+    case SHT3X_COMMAND_READ_STATUS:
+        context->read_command = command;
+        break;
+    case SHT3X_COMMAND_CLEAR_STATUS:
+        sensor->status_register &= ~(SHT3X_STATUS_ALERT_PENDING | SHT3X_STATUS_HUMIDITY_ALERT | SHT3X_STATUS_TEMPERATURE_ALERT | SHT3X_STATUS_RESET_DETECTED);
+        break;
+    case SHT3X_COMMAND_ALERT_HIGH_SET:
+    case SHT3X_COMMAND_ALERT_HIGH_CLEAR:
+    case SHT3X_COMMAND_ALERT_LOW_CLEAR:
+    case SHT3X_COMMAND_ALERT_LOW_SET:
+        // Limit and checksum.
+        if (data_size_bytes != 5) return 0;
+        if (_SHT3X_compute_crc(&(data[2]), 2) != data[4]) {
+            sensor->status_register |= SHT3X_STATUS_WRITE_CRC_ERROR;
+            break;
+        }
+        sensor->status_register &= ~SHT3X_STATUS_WRITE_CRC_ERROR;
+        limit = (uint16_t) ((data[2] << 8) | data[3]);
+        if (command == SHT3X_COMMAND_ALERT_HIGH_SET) sensor->alert_high_set = limit;
+        if (command == SHT3X_COMMAND_ALERT_HIGH_CLEAR) sensor->alert_high_clear = limit;
+        if (command == SHT3X_COMMAND_ALERT_LOW_CLEAR) sensor->alert_low_clear = limit;
+        if (command == SHT3X_COMMAND_ALERT_LOW_SET) sensor->alert_low_set = limit;
+        break;
+    default:
+        return 0;
+    }
+    return 1;
+}
+
+/*******************************************************************/
+static void _SHT3X_write_word(uint8_t* data, uint16_t word, uint8_t crc_error) {
+    data[0] = (uint8_t) ((word >> 8) & 0xFF);
+    data[1] = (uint8_t) ((word >> 0) & 0xFF);
+    data[2] = (uint8_t) (_SHT3X_compute_crc(data, 2) ^ ((crc_error != 0) ? 0xFF : 0x00));
+}
+
+/*** SHT3X functions ***/
+
+/*******************************************************************/
+void FAKE_sht3x_reset(void) {
+    // Local variables.
+    uint8_t* ctx_bytes = (uint8_t*) sht3x_ctx;
+    uint8_t* fake_bytes = (uint8_t*) &fake_sht3x;
+    uint32_t idx = 0;
+    // Reset contexts.
+    for (idx = 0; idx < sizeof(sht3x_ctx); idx++) {
+        ctx_bytes[idx] = 0;
+    }
+    for (idx = 0; idx < sizeof(FAKE_sht3x_t); idx++) {
+        fake_bytes[idx] = 0;
+    }
+    // Sensors addresses.
+    fake_sht3x.sensors[0].i2c_address = I2C_ADDRESS_SHT30;
+    fake_sht3x.sensors[1].i2c_address = I2C_ADDRESS_SHT30_SECONDARY;
+    for (idx = 0; idx < FAKE_SHT3X_SENSORS_MAX; idx++) {
+        sht3x_ctx[idx].power_off_count = FAKE_get_power_off_count(POWER_DOMAIN_SENSORS);
+        _SHT3X_reset_sensor((uint8_t) idx);
+    }
+}
+
+/*** I2C functions ***/
+
+/*******************************************************************/
+I2C_status_t I2C_init(I2C_instance_t instance, const I2C_gpio_t* pins) {
+    if (pins == NULL) return I2C_ERROR_NULL_PARAMETER;
+    if (instance >= I2C_INSTANCE_LAST) return I2C_ERROR_INSTANCE;
+    return I2C_SUCCESS;
+}
+
+/*******************************************************************/
+I2C_status_t I2C_de_init(I2C_instance_t instance, const I2C_gpio_t* pins) {
+    if (pins == NULL) return I2C_ERROR_NULL_PARAMETER;
+    if (instance >= I2C_INSTANCE_LAST) return I2C_ERROR_INSTANCE;
+    return I2C_SUCCESS;
+}
+
+/*******************************************************************/
+I2C_status_t I2C_write(I2C_instance_t instance, uint8_t slave_address, uint8_t* data, uint8_t data_size_bytes, uint8_t stop_flag) {
+    // Local variables.
+    int8_t sensor_index = 0;
+    UNUSED(stop_flag);
+    // Check parameters.
+    if (data == NULL) return I2C_ERROR_NULL_PARAMETER;
+    if (instance >= I2C_INSTANCE_LAST) return I2C_ERROR_INSTANCE;
+    fake_sht3x.transfer_count++;
+    // Address and command acknowledge.
+    sensor_index = _SHT3X_get_sensor(slave_address);
+    if ((sensor_index < 0) || (data_size_bytes < 2)) goto errors;
+    if (_SHT3X_write_command((uint8_t) sensor_index, (uint16_t) ((data[0] << 8) | data[1]), data, data_size_bytes) == 0) {
+        fake_sht3x.sensors[sensor_index].status_register |= SHT3X_STATUS_COMMAND_ERROR;
+        goto errors;
+    }
+    fake_sht3x.sensors[sensor_index].status_register &= ~SHT3X_STATUS_COMMAND_ERROR;
+    return I2C_SUCCESS;
+errors:
+    fake_sht3x.nack_count++;
+    return I2C_ERROR_NACK;
+}
+
+/*******************************************************************/
+I2C_status_t I2C_read(I2C_instance_t instance, uint8_t slave_address, uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    FAKE_sht3x_sensor_t* sensor = NULL;
+    SHT3X_context_t* context = NULL;
+    uint8_t frame[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    int8_t sensor_index = 0;
+    uint16_t read_command = SHT3X_COMMAND_NONE;
+    uint8_t idx = 0;
+    // Check parameters.
+    if (data == NULL) return I2C_ERROR_NULL_PARAMETER;
+    if (instance >= I2C_INSTANCE_LAST) return I2C_ERROR_INSTANCE;
+    fake_sht3x.transfer_count++;
+    // Address acknowledge.
+    sensor_index = _SHT3X_get_sensor(slave_address);
+    if (sensor_index < 0) goto errors;
+    sensor = &(fake_sht3x.sensors[sensor_index]);
+    context = &(sht3x_ctx[sensor_index]);
+    // A new command is required for each read.
+    read_command = context->read_command;
+    context->read_command = SHT3X_COMMAND_NONE;
+    switch (read_command) {
+    case SHT3X_COMMAND_READ_STATUS:
+        _SHT3X_write_word(&(frame[0]), sensor->status_register, sensor->crc_error);
+        break;
+    case SHT3X_COMMAND_FETCH_DATA:
+        // The header is not acknowledged if no new measurement is available.
+        if (context->data_ready == 0) {
+            sensor->fetch_nack_count++;
+            goto errors;
+        }
+        context->data_ready = 0;
+        sensor->fetch_count++;
+        _SHT3X_write_word(&(frame[0]), context->temperature_raw, sensor->crc_error);
+        _SHT3X_write_word(&(frame[3]), context->humidity_raw, sensor->crc_error);
+        break;
+    case SHT3X_COMMAND_SINGLE_SHOT:
+        // Measurement must be completed.
+        if ((FAKE_get_milliseconds() - context->single_shot_time_ms) < SHT3X_SINGLE_SHOT_DURATION_MS) goto errors;
+        _SHT3X_measure((uint8_t) sensor_index);
+        _SHT3X_write_word(&(frame[0]), context->temperature_raw, sensor->crc_error);
+        _SHT3X_write_word(&(frame[3]), context->humidity_raw, sensor->crc_error);
+        break;
+    default:
+        goto errors;
+    }
+    // Copy frame.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        data[idx] = (idx < sizeof(frame)) ? frame[idx] : 0xFF;
+    }
+    return I2C_SUCCESS;
+errors:
+    fake_sht3x.nack_count++;
+    return I2C_ERROR_NACK;
+}
@@ -0,0 +1,84 @@
+/*
+ * sht3x_driver.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "sht3x.h"
+
+#include "error.h"
+#include "sht3x_hw.h"
+#include "types.h"
+
+#ifdef SM
+
+/*** SHT3X DRIVER local macros ***/
+
+#define SHT3X_DRIVER_COMMAND_SINGLE_SHOT            0x2400
+#define SHT3X_DRIVER_MEASUREMENT_DELAY_MS           20
+
+#define SHT3X_DRIVER_CRC_POLYNOMIAL                 0x31
+#define SHT3X_DRIVER_CRC_INIT                       0xFF
+
+#define SHT3X_DRIVER_RAW_MAX                        0xFFFF
+#define SHT3X_DRIVER_TEMPERATURE_OFFSET_DEGREES     45
+#define SHT3X_DRIVER_TEMPERATURE_RANGE_DEGREES      175
+#define SHT3X_DRIVER_HUMIDITY_RANGE_PERCENT         100
+
+/*** SHT3X DRIVER local functions ***/
+
+/*******************************************************************/
+static uint8_t _SHT3X_compute_crc(uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    uint8_t crc = SHT3X_DRIVER_CRC_INIT;
+    uint8_t idx = 0;
+    uint8_t bit_idx = 0;
+    // Bytes loop.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        crc ^= data[idx];
+        for (bit_idx = 0; bit_idx < 8; bit_idx++) {
+            crc = ((crc & 0x80) != 0) ? ((uint8_t) ((crc << 1) ^ SHT3X_DRIVER_CRC_POLYNOMIAL)) : ((uint8_t) (crc << 1));
+        }
+    }
+    return crc;
+}
+
+/*** SHT3X DRIVER functions ***/
+
+/*******************************************************************/
+SHT3X_status_t SHT3X_get_temperature_humidity(uint8_t i2c_address, int32_t* temperature_degrees, int32_t* humidity_percent) {
+    // Local variables.
+    SHT3X_status_t status = SHT3X_SUCCESS;
+    uint8_t tx_data[2];
+    uint8_t rx_data[6];
+    int32_t raw = 0;
+    // Check parameters.
+    if ((temperature_degrees == NULL) || (humidity_percent == NULL)) {
+        status = SHT3X_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Same single shot sequence as the submodule driver.
+    tx_data[0] = (uint8_t) ((SHT3X_DRIVER_COMMAND_SINGLE_SHOT >> 8) & 0xFF);
+    tx_data[1] = (uint8_t) ((SHT3X_DRIVER_COMMAND_SINGLE_SHOT >> 0) & 0xFF);
+    status = SHT3X_HW_i2c_write(i2c_address, tx_data, 2, 1);
+    if (status != SHT3X_SUCCESS) goto errors;
+    status = SHT3X_HW_delay_milliseconds(SHT3X_DRIVER_MEASUREMENT_DELAY_MS);
+    if (status != SHT3X_SUCCESS) goto errors;
+    status = SHT3X_HW_i2c_read(i2c_address, rx_data, 6);
+    if (status != SHT3X_SUCCESS) goto errors;
+    // Check CRC.
+    if ((_SHT3X_compute_crc(&(rx_data[0]), 2) != rx_data[2]) || (_SHT3X_compute_crc(&(rx_data[3]), 2) != rx_data[5])) {
+        status = SHT3X_ERROR_CRC;
+        goto errors;
+    }
+    // Convert data.
+    raw = (int32_t) ((rx_data[0] << 8) | rx_data[1]);
+    (*temperature_degrees) = (((SHT3X_DRIVER_TEMPERATURE_RANGE_DEGREES * raw) / SHT3X_DRIVER_RAW_MAX) - SHT3X_DRIVER_TEMPERATURE_OFFSET_DEGREES);
+    raw = (int32_t) ((rx_data[3] << 8) | rx_data[4]);
+    (*humidity_percent) = ((SHT3X_DRIVER_HUMIDITY_RANGE_PERCENT * raw) / SHT3X_DRIVER_RAW_MAX);
+errors:
+    return status;
+}
+
+#endif /* SM */
@@ -0,0 +1,50 @@
+/*
+ * swreg.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "swreg.h"
+
+#include "types.h"
+
+/*** SWREG local functions ***/
+
+/*******************************************************************/
+static uint8_t _SWREG_get_shift(uint32_t field_mask) {
+    // Local variables.
+    uint8_t shift = 0;
+    // Compute shift.
+    while ((shift < 32) && (((field_mask >> shift) & 0x01) == 0)) {
+        shift++;
+    }
+    return shift;
+}
+
+/*** SWREG functions ***/
+
+/*******************************************************************/
+void SWREG_modify_register(uint32_t* reg_value, uint32_t new_reg_value, uint32_t reg_mask) {
+    (*reg_value) = ((*reg_value) & (~reg_mask)) | (new_reg_value & reg_mask);
+}
+
+/*******************************************************************/
+void SWREG_write_field(uint32_t* reg_value, uint32_t* reg_mask, uint32_t field_value, uint32_t field_mask) {
+    // Local variables.
+    uint8_t shift = _SWREG_get_shift(field_mask);
+    // Check mask.
+    if (shift >= 32) return;
+    // Write field and update mask.
+    (*reg_value) = ((*reg_value) & (~field_mask)) | ((field_value << shift) & field_mask);
+    (*reg_mask) |= field_mask;
+}
+
+/*******************************************************************/
+uint32_t SWREG_read_field(uint32_t reg_value, uint32_t field_mask) {
+    // Local variables.
+    uint8_t shift = _SWREG_get_shift(field_mask);
+    // Check mask.
+    if (shift >= 32) return 0;
+    return ((reg_value & field_mask) >> shift);
+}
@@ -0,0 +1,113 @@
+/*
+ * tim.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "tim.h"
+
+#include "fake.h"
+#include "types.h"
+
+/*** TIM global variables ***/
+
+FAKE_tim_t fake_tim;
+
+/*** TIM local functions ***/
+
+/*******************************************************************/
+static TIM_status_t _TIM_check_channel(TIM_instance_t instance, TIM_channel_t channel) {
+    if (instance >= TIM_INSTANCE_LAST) return TIM_ERROR_INSTANCE;
+    if (channel >= TIM_CHANNEL_LAST) return TIM_ERROR_CHANNEL;
+    return TIM_SUCCESS;
+}
+
+/*** TIM functions ***/
+
+/*******************************************************************/
+void FAKE_tim_reset(void) {
+    // Local variables.
+    uint8_t* tim_bytes = (uint8_t*) &fake_tim;
+    uint32_t idx = 0;
+    // Reset context.
+    for (idx = 0; idx < sizeof(FAKE_tim_t); idx++) {
+        tim_bytes[idx] = 0;
+    }
+}
+
+/*******************************************************************/
+void FAKE_tim_sleep(void) {
+    // Local variables.
+    uint64_t wake_up_us = 0;
+    uint8_t idx = 0;
+    // Next timer interrupt.
+    for (idx = 0; idx < TIM_CHANNEL_LAST; idx++) {
+        if (fake_tim.channel_running[idx] == 0) continue;
+        if ((wake_up_us == 0) || (fake_tim.channel_deadline_us[idx] < wake_up_us)) {
+            wake_up_us = fake_tim.channel_deadline_us[idx];
+        }
+    }
+    if (wake_up_us > FAKE_get_microseconds()) {
+        FAKE_advance_microseconds((uint32_t) (wake_up_us - FAKE_get_microseconds()));
+    }
+}
+
+/*******************************************************************/
+TIM_status_t TIM_MCH_init(TIM_instance_t instance, uint8_t nvic_priority) {
+    if (instance >= TIM_INSTANCE_LAST) return TIM_ERROR_INSTANCE;
+    FAKE_tim_reset();
+    fake_tim.initialized = 1;
+    return TIM_SUCCESS;
+}
+
+/*******************************************************************/
+TIM_status_t TIM_MCH_de_init(TIM_instance_t instance) {
+    if (instance >= TIM_INSTANCE_LAST) return TIM_ERROR_INSTANCE;
+    fake_tim.initialized = 0;
+    return TIM_SUCCESS;
+}
+
+/*******************************************************************/
+TIM_status_t TIM_MCH_start_channel(TIM_instance_t instance, TIM_channel_t channel, uint32_t duration_ms, TIM_waiting_mode_t waiting_mode) {
+    // Local variables.
+    TIM_status_t status = _TIM_check_channel(instance, channel);
+    if (status != TIM_SUCCESS) return status;
+    fake_tim.channel_running[channel] = 1;
+    fake_tim.channel_deadline_us[channel] = FAKE_get_microseconds() + (((uint64_t) duration_ms) * 1000);
+    fake_tim.channel_waiting_mode[channel] = waiting_mode;
+    fake_tim.start_count++;
+    return TIM_SUCCESS;
+}
+
+/*******************************************************************/
+TIM_status_t TIM_MCH_stop_channel(TIM_instance_t instance, TIM_channel_t channel) {
+    // Local variables.
+    TIM_status_t status = _TIM_check_channel(instance, channel);
+    if (status != TIM_SUCCESS) return status;
+    fake_tim.channel_running[channel] = 0;
+    return TIM_SUCCESS;
+}
+
+/*******************************************************************/
+TIM_status_t TIM_MCH_get_channel_status(TIM_instance_t instance, TIM_channel_t channel, uint8_t* channel_elapsed) {
+    // Local variables.
+    TIM_status_t status = _TIM_check_channel(instance, channel);
+    if (status != TIM_SUCCESS) return status;
+    if (channel_elapsed == NULL) return TIM_ERROR_NULL_PARAMETER;
+    (*channel_elapsed) = (FAKE_get_microseconds() >= fake_tim.channel_deadline_us[channel]) ? 1 : 0;
+    return TIM_SUCCESS;
+}
+
+/*******************************************************************/
+TIM_status_t TIM_MCH_wait_channel_completion(TIM_instance_t instance, TIM_channel_t channel) {
+    // Local variables.
+    TIM_status_t status = _TIM_check_channel(instance, channel);
+    if (status != TIM_SUCCESS) return status;
+    if (FAKE_get_microseconds() < fake_tim.channel_deadline_us[channel]) {
+        FAKE_advance_microseconds((uint32_t) (fake_tim.channel_deadline_us[channel] - FAKE_get_microseconds()));
+    }
+    fake_tim.channel_running[channel] = 0;
+    fake_tim.wait_count++;
+    return TIM_SUCCESS;
+}
@@ -0,0 +1,206 @@
+/*
+ * timebase.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "timebase.h"
+
+#include "fake.h"
+#include "types.h"
+#include "xm_flags.h"
+
+/*** TIMEBASE local macros ***/
+
+#define TIMEBASE_RTC_TICKS_PER_SECOND       256
+#define TIMEBASE_RTC_CALIBRATION_PPB_STEP   954
+#define TIMEBASE_RTC_CALIBRATION_STEP_MAX   512
+#define TIMEBASE_RTC_CALIBRATION_STEP_MIN   (-511)
+#define TIMEBASE_RTC_CALR_CALP              0x00008000
+#define TIMEBASE_RTC_CALR_CALM_MASK         0x000001FF
+// Calendar registers access duration.
+#define TIMEBASE_RTC_READ_DURATION_US       1
+#define TIMEBASE_HSI_CYCLES_PER_US          16
+#define TIMEBASE_HSI_TRIM_DEFAULT           16
+#define TIMEBASE_HSI_TRIM_STEP_PPM          4000
+
+/*** TIMEBASE local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    int32_t lse_error_ppb;
+    int32_t hsi_error_ppm;
+    uint8_t rtc_direct_read_count;
+    int32_t rtc_calibration;
+    int64_t rtc_reference_us;
+    int64_t rtc_reference_microticks;
+    uint8_t hsi_trim;
+    int64_t hsi_reference_us;
+    int64_t hsi_reference_cycles;
+    int64_t cycle_counter_start;
+    uint8_t cycle_counter_running;
+} TIMEBASE_context_t;
+
+/*** TIMEBASE local global variables ***/
+
+static TIMEBASE_context_t timebase_ctx;
+
+/*** TIMEBASE local functions ***/
+
+/*******************************************************************/
+static int64_t _TIMEBASE_scale(int64_t value, int64_t error, int64_t unit) {
+    // Apply a relative frequency error.
+    return (value + ((value * error) / unit));
+}
+
+/*******************************************************************/
+static int64_t _TIMEBASE_get_rtc_microticks(void) {
+    // Local variables.
+    int64_t elapsed_us = ((int64_t) FAKE_get_microseconds() - timebase_ctx.rtc_reference_us);
+    int64_t error_ppb = ((int64_t) timebase_ctx.lse_error_ppb + ((int64_t) timebase_ctx.rtc_calibration * TIMEBASE_RTC_CALIBRATION_PPB_STEP));
+    // LSE drift and smooth calibration since the last change.
+    return (timebase_ctx.rtc_reference_microticks + _TIMEBASE_scale((elapsed_us * TIMEBASE_RTC_TICKS_PER_SECOND), error_ppb, 1000000000));
+}
+
+/*******************************************************************/
+static int64_t _TIMEBASE_get_hsi_cycles(void) {
+    // Local variables.
+    int64_t elapsed_us = ((int64_t) FAKE_get_microseconds() - timebase_ctx.hsi_reference_us);
+    int64_t error_ppm = ((int64_t) timebase_ctx.hsi_error_ppm + (((int64_t) timebase_ctx.hsi_trim - TIMEBASE_HSI_TRIM_DEFAULT) * TIMEBASE_HSI_TRIM_STEP_PPM));
+    // HSI drift and trimming since the last change.
+    return (timebase_ctx.hsi_reference_cycles + _TIMEBASE_scale((elapsed_us * TIMEBASE_HSI_CYCLES_PER_US), error_ppm, 1000000));
+}
+
+/*** TIMEBASE functions ***/
+
+/*******************************************************************/
+void FAKE_timebase_reset(void) {
+    // Local variables.
+    uint8_t* ctx_bytes = (uint8_t*) &timebase_ctx;
+    uint32_t idx = 0;
+    // Ideal clocks.
+    for (idx = 0; idx < sizeof(TIMEBASE_context_t); idx++) {
+        ctx_bytes[idx] = 0;
+    }
+    timebase_ctx.hsi_trim = TIMEBASE_HSI_TRIM_DEFAULT;
+}
+
+/*******************************************************************/
+void FAKE_timebase_set_clock_errors(int32_t lse_error_ppb, int32_t hsi_error_ppm) {
+    // Rebase counters on the current time.
+    timebase_ctx.rtc_reference_microticks = _TIMEBASE_get_rtc_microticks();
+    timebase_ctx.hsi_reference_cycles = _TIMEBASE_get_hsi_cycles();
+    timebase_ctx.rtc_reference_us = (int64_t) FAKE_get_microseconds();
+    timebase_ctx.hsi_reference_us = (int64_t) FAKE_get_microseconds();
+    timebase_ctx.lse_error_ppb = lse_error_ppb;
+    timebase_ctx.hsi_error_ppm = hsi_error_ppm;
+}
+
+/*******************************************************************/
+uint8_t FAKE_timebase_get_rtc_direct_read(void) {
+    return (timebase_ctx.rtc_direct_read_count);
+}
+
+#ifdef XM_TIMEBASE
+
+/*******************************************************************/
+void TIMEBASE_init(void) {
+    timebase_ctx.rtc_direct_read_count = 0;
+}
+
+/*******************************************************************/
+void TIMEBASE_enable_rtc_direct_read(void) {
+    timebase_ctx.rtc_direct_read_count++;
+}
+
+/*******************************************************************/
+void TIMEBASE_disable_rtc_direct_read(void) {
+    if (timebase_ctx.rtc_direct_read_count != 0) {
+        timebase_ctx.rtc_direct_read_count--;
+    }
+}
+
+/*******************************************************************/
+void TIMEBASE_start_cycle_counter(void) {
+    timebase_ctx.cycle_counter_start = _TIMEBASE_get_hsi_cycles();
+    timebase_ctx.cycle_counter_running = 1;
+}
+
+/*******************************************************************/
+void TIMEBASE_stop_cycle_counter(void) {
+    timebase_ctx.cycle_counter_running = 0;
+}
+
+/*******************************************************************/
+uint32_t TIMEBASE_get_cycle_counter(void) {
+    // Local variables.
+    int64_t cycles = 0;
+    if (timebase_ctx.cycle_counter_running == 0) return 0;
+    // Down counter reloaded with its mask.
+    cycles = (_TIMEBASE_get_hsi_cycles() - timebase_ctx.cycle_counter_start);
+    return ((uint32_t) ((0 - cycles) & TIMEBASE_CYCLE_COUNTER_MASK));
+}
+
+/*******************************************************************/
+uint32_t TIMEBASE_get_rtc_ticks_per_second(void) {
+    return TIMEBASE_RTC_TICKS_PER_SECOND;
+}
+
+/*******************************************************************/
+TIMEBASE_status_t TIMEBASE_get_rtc_time(TIMEBASE_rtc_time_t* rtc_time) {
+    // Local variables.
+    int64_t ticks = 0;
+    // Check parameter.
+    if (rtc_time == NULL) return TIMEBASE_ERROR_NULL_PARAMETER;
+    FAKE_advance_microseconds(TIMEBASE_RTC_READ_DURATION_US);
+    // Calendar starts at midnight.
+    ticks = ((_TIMEBASE_get_rtc_microticks() / 1000000) % ((int64_t) TIMEBASE_RTC_SECONDS_PER_DAY * TIMEBASE_RTC_TICKS_PER_SECOND));
+    rtc_time->seconds = (uint32_t) (ticks / TIMEBASE_RTC_TICKS_PER_SECOND);
+    rtc_time->ticks = (uint32_t) ticks;
+    return TIMEBASE_SUCCESS;
+}
+
+/*******************************************************************/
+int32_t TIMEBASE_get_rtc_calibration(void) {
+    return (timebase_ctx.rtc_calibration);
+}
+
+/*******************************************************************/
+TIMEBASE_status_t TIMEBASE_set_rtc_calibration(int32_t calibration_step, uint32_t* rtc_calr) {
+    if (rtc_calr == NULL) return TIMEBASE_ERROR_NULL_PARAMETER;
+    // Clamp to smooth calibration range.
+    if (calibration_step > TIMEBASE_RTC_CALIBRATION_STEP_MAX) {
+        calibration_step = TIMEBASE_RTC_CALIBRATION_STEP_MAX;
+    }
+    if (calibration_step < TIMEBASE_RTC_CALIBRATION_STEP_MIN) {
+        calibration_step = TIMEBASE_RTC_CALIBRATION_STEP_MIN;
+    }
+    // New rate applies from now.
+    timebase_ctx.rtc_reference_microticks = _TIMEBASE_get_rtc_microticks();
+    timebase_ctx.rtc_reference_us = (int64_t) FAKE_get_microseconds();
+    timebase_ctx.rtc_calibration = calibration_step;
+    // Same encoding as the CALR register.
+    if (calibration_step > 0) {
+        (*rtc_calr) = (TIMEBASE_RTC_CALR_CALP | ((uint32_t) (TIMEBASE_RTC_CALIBRATION_STEP_MAX - calibration_step) & TIMEBASE_RTC_CALR_CALM_MASK));
+    }
+    else {
+        (*rtc_calr) = ((uint32_t) (-calibration_step) & TIMEBASE_RTC_CALR_CALM_MASK);
+    }
+    return TIMEBASE_SUCCESS;
+}
+
+/*******************************************************************/
+uint8_t TIMEBASE_get_hsi_trim(void) {
+    return (timebase_ctx.hsi_trim);
+}
+
+/*******************************************************************/
+void TIMEBASE_set_hsi_trim(uint8_t hsi_trim) {
+    // New frequency applies from now.
+    timebase_ctx.hsi_reference_cycles = _TIMEBASE_get_hsi_cycles();
+    timebase_ctx.hsi_reference_us = (int64_t) FAKE_get_microseconds();
+    timebase_ctx.hsi_trim = (hsi_trim & TIMEBASE_HSI_TRIM_MAX);
+}
+
+#endif /* XM_TIMEBASE */
@@ -0,0 +1,72 @@
+/*
+ * una.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una.h"
+
+#include "types.h"
+
+/*** UNA local macros ***/
+
+#define UNA_SECONDS_UNIT_SHIFT      6
+#define UNA_SECONDS_VALUE_MASK      0x3F
+
+/*** UNA local global variables ***/
+
+static const uint32_t UNA_SECONDS_UNIT[4] = { 1, 60, 3600, 86400 };
+
+/*** UNA functions ***/
+
+/*******************************************************************/
+uint32_t UNA_convert_seconds(uint32_t time_seconds) {
+    // Local variables.
+    uint8_t unit = 0;
+    // Select the smallest unit which fits the 6-bit value.
+    while ((unit < 3) && ((time_seconds / UNA_SECONDS_UNIT[unit]) > UNA_SECONDS_VALUE_MASK)) {
+        unit++;
+    }
+    return ((unit << UNA_SECONDS_UNIT_SHIFT) | ((time_seconds / UNA_SECONDS_UNIT[unit]) & UNA_SECONDS_VALUE_MASK));
+}
+
+/*******************************************************************/
+uint32_t UNA_get_seconds(uint32_t field) {
+    return (((field & UNA_SECONDS_VALUE_MASK) * UNA_SECONDS_UNIT[(field >> UNA_SECONDS_UNIT_SHIFT) & 0x03]));
+}
+
+/*******************************************************************/
+uint32_t UNA_convert_mv(int32_t voltage_mv) {
+    return ((voltage_mv < 0) ? UNA_VOLTAGE_ERROR_VALUE : (((uint32_t) voltage_mv) & 0xFFFF));
+}
+
+/*******************************************************************/
+int32_t UNA_get_mv(uint32_t field) {
+    return ((int32_t) (field & 0xFFFF));
+}
+
+/*******************************************************************/
+uint32_t UNA_convert_ua(int32_t current_ua) {
+    return (((uint32_t) current_ua) & 0x00FFFFFF);
+}
+
+/*******************************************************************/
+uint32_t UNA_convert_dbm(int16_t rf_power_dbm) {
+    return (((uint32_t) rf_power_dbm) & 0xFF);
+}
+
+/*******************************************************************/
+int16_t UNA_get_dbm(uint32_t field) {
+    return ((int16_t) ((int8_t) (field & 0xFF)));
+}
+
+/*******************************************************************/
+uint32_t UNA_convert_degrees(int32_t temperature_degrees) {
+    return (((uint32_t) temperature_degrees) & 0xFF);
+}
+
+/*******************************************************************/
+uint32_t UNA_convert_year(uint16_t year) {
+    return ((uint32_t) (year - 2000));
+}
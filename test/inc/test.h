@@ -0,0 +1,53 @@
+/*
+ * test.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TEST_H__
+#define __TEST_H__
+
+#include "types.h"
+
+/*** TEST global variables ***/
+
+extern uint32_t test_failure_count;
+
+/*** TEST functions ***/
+
+/*!******************************************************************
+ * \fn void TEST_failure(const char_t* file, int32_t line, const char_t* expression)
+ * \brief Report a failed assertion.
+ * \param[in]   file: Source file of the assertion.
+ * \param[in]   line: Line of the assertion.
+ * \param[in]   expression: Failed expression.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TEST_failure(const char_t* file, int32_t line, const char_t* expression);
+
+/*!******************************************************************
+ * \fn int32_t TEST_report(const char_t* test_name)
+ * \brief Print the test result.
+ * \param[in]   test_name: Name of the test executable.
+ * \param[out]  none
+ * \retval      Process exit code (0 on success).
+ *******************************************************************/
+int32_t TEST_report(const char_t* test_name);
+
+/*******************************************************************/
+#define TEST_assert(expression) { \
+    if (!(expression)) { \
+        TEST_failure(__FILE__, __LINE__, #expression); \
+    } \
+}
+
+/*******************************************************************/
+#define TEST_assert_equal(actual, expected) { \
+    if ((actual) != (expected)) { \
+        TEST_failure(__FILE__, __LINE__, #actual " == " #expected); \
+    } \
+}
+
+#endif /* __TEST_H__ */
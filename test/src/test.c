@@ -0,0 +1,30 @@
+/*
+ * test.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "test.h"
+
+#include "types.h"
+
+#include <stdio.h>
+
+/*** TEST global variables ***/
+
+uint32_t test_failure_count = 0;
+
+/*** TEST functions ***/
+
+/*******************************************************************/
+void TEST_failure(const char_t* file, int32_t line, const char_t* expression) {
+    printf("%s:%d: assertion failed: %s\n", file, line, expression);
+    test_failure_count++;
+}
+
+/*******************************************************************/
+int32_t TEST_report(const char_t* test_name) {
+    printf("%s: %s (%u failure(s))\n", test_name, ((test_failure_count == 0) ? "PASS" : "FAIL"), test_failure_count);
+    return ((test_failure_count == 0) ? 0 : 1);
+}
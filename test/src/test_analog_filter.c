@@ -0,0 +1,244 @@
+/*
+ * test_analog_filter.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "adc.h"
+#include "analog.h"
+#include "fake.h"
+#include "test.h"
+#include "types.h"
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+/*** TEST ANALOG FILTER local macros ***/
+
+#define TEST_ADC_CHANNEL_AIN0           ADC_CHANNEL_IN5
+#define TEST_ADC_VREFINT_3000MV         1638
+#define TEST_VMCU_MV                    3000
+
+#define TEST_TONE_OFFSET                2048
+#define TEST_TONE_AMPLITUDE             1000
+#define TEST_TONE_PHASE                 0.3
+
+#define TEST_DECIMATION_RATIO           16
+#define TEST_DECIMATION_OUTPUTS         64
+#define TEST_IIR_SHIFT                  3
+#define TEST_IIR_SETTLING_SAMPLES       128
+#define TEST_IIR_OUTPUTS                512
+
+#define TEST_GAIN_TOLERANCE             0.02
+#define TEST_NULL_TOLERANCE_MV          2
+
+#define TEST_BENCHMARK_SAMPLES          100000
+
+#define TEST_PI                         3.14159265358979323846
+
+/*** TEST ANALOG FILTER local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint32_t numerator;
+    uint32_t denominator;
+} TEST_tone_t;
+
+/*** TEST ANALOG FILTER local global variables ***/
+
+// Tone frequencies in cycles per sample.
+static const TEST_tone_t TEST_DECIMATOR_PASSBAND_TONES[] = { { 1, 1024 }, { 1, 64 }, { 5, 64 } };
+static const TEST_tone_t TEST_DECIMATOR_NULL_TONES[] = { { 1, 16 }, { 2, 16 }, { 3, 16 } };
+static const TEST_tone_t TEST_IIR_TONES[] = { { 1, 64 }, { 1, 8 } };
+
+static int32_t test_outputs_mv[TEST_IIR_OUTPUTS];
+
+/*** TEST ANALOG FILTER local functions ***/
+
+/*******************************************************************/
+static void _TEST_init(uint8_t decimation_ratio, uint8_t iir_shift) {
+    // Local variables.
+    int32_t vmcu_mv = 0;
+    FAKE_reset();
+    TEST_assert_equal(ANALOG_init(), ANALOG_SUCCESS);
+    // 3V supply and 1:1 voltage input.
+    FAKE_set_adc_data(ADC_CHANNEL_VREFINT, TEST_ADC_VREFINT_3000MV);
+    TEST_assert_equal(ANALOG_convert_channel(ANALOG_CHANNEL_VMCU_MV, &vmcu_mv), ANALOG_SUCCESS);
+    TEST_assert_equal(vmcu_mv, TEST_VMCU_MV);
+    TEST_assert_equal(ANALOG_set_channel_configuration(ANALOG_CHANNEL_AIN0_MV, ANALOG_INPUT_TYPE_VOLTAGE, ANALOG_GAIN_TYPE_ATTENUATION, 1), ANALOG_SUCCESS);
+    TEST_assert_equal(ANALOG_set_channel_filter(ANALOG_CHANNEL_AIN0_MV, decimation_ratio, iir_shift), ANALOG_SUCCESS);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_run_tone(const TEST_tone_t* tone, uint32_t number_of_samples, uint32_t settling_samples) {
+    // Local variables.
+    double phase = 0.0;
+    uint8_t output_ready = 0;
+    uint32_t number_of_outputs = 0;
+    uint32_t idx = 0;
+    // Feed the sampled tone, one sample per call as in the background process.
+    for (idx = 0; idx < (settling_samples + number_of_samples); idx++) {
+        phase = ((2.0 * TEST_PI * (double) (tone->numerator) * (double) idx) / (double) (tone->denominator)) + TEST_TONE_PHASE;
+        FAKE_set_adc_data(TEST_ADC_CHANNEL_AIN0, (int32_t) lround(TEST_TONE_OFFSET + (TEST_TONE_AMPLITUDE * sin(phase))));
+        TEST_assert_equal(ANALOG_filter_channel(ANALOG_CHANNEL_AIN0_MV, &output_ready), ANALOG_SUCCESS);
+        if ((output_ready == 0) || (idx < settling_samples)) continue;
+        if (number_of_outputs < TEST_IIR_OUTPUTS) {
+            TEST_assert_equal(ANALOG_convert_channel(ANALOG_CHANNEL_AIN0_MV, &(test_outputs_mv[number_of_outputs])), ANALOG_SUCCESS);
+            number_of_outputs++;
+        }
+    }
+    return number_of_outputs;
+}
+
+/*******************************************************************/
+static double _TEST_get_amplitude(uint32_t number_of_outputs, uint32_t bin) {
+    // Local variables.
+    double real = 0.0;
+    double imaginary = 0.0;
+    uint32_t idx = 0;
+    // Single bin DFT of the output sequence.
+    for (idx = 0; idx < number_of_outputs; idx++) {
+        real += ((double) test_outputs_mv[idx]) * cos((2.0 * TEST_PI * (double) bin * (double) idx) / (double) number_of_outputs);
+        imaginary -= ((double) test_outputs_mv[idx]) * sin((2.0 * TEST_PI * (double) bin * (double) idx) / (double) number_of_outputs);
+    }
+    // Convert back to ADC codes.
+    return ((2.0 * sqrt((real * real) + (imaginary * imaginary)) * ADC_FULL_SCALE) / ((double) number_of_outputs * TEST_VMCU_MV));
+}
+
+/*******************************************************************/
+static uint32_t _TEST_get_alias_bin(const TEST_tone_t* tone, uint32_t decimation_ratio, uint32_t number_of_outputs) {
+    // Local variables.
+    uint32_t bin = (((tone->numerator) * decimation_ratio * number_of_outputs) / (tone->denominator)) % number_of_outputs;
+    // Fold around the output Nyquist frequency.
+    return ((bin > (number_of_outputs / 2)) ? (number_of_outputs - bin) : bin);
+}
+
+/*******************************************************************/
+static void _TEST_check_gain(const char_t* stage, const TEST_tone_t* tone, double measured, double expected) {
+    printf("%-10s %4u/%-5u %9.5f %9.5f\n", stage, (unsigned int) tone->numerator, (unsigned int) tone->denominator, measured, expected);
+    TEST_assert(fabs(measured - expected) <= TEST_GAIN_TOLERANCE);
+}
+
+/*******************************************************************/
+static void _TEST_dc(void) {
+    // Local variables.
+    uint8_t output_ready = 0;
+    int32_t analog_data = 0;
+    uint32_t idx = 0;
+    _TEST_init(8, 0);
+    // 1000mV input.
+    FAKE_set_adc_data(TEST_ADC_CHANNEL_AIN0, 1365);
+    for (idx = 0; idx < 8; idx++) {
+        TEST_assert_equal(ANALOG_filter_channel(ANALOG_CHANNEL_AIN0_MV, &output_ready), ANALOG_SUCCESS);
+        TEST_assert_equal(output_ready, ((idx == 7) ? 1 : 0));
+    }
+    // Filtered value is returned without any new conversion.
+    FAKE_set_adc_data(TEST_ADC_CHANNEL_AIN0, 0);
+    TEST_assert_equal(ANALOG_convert_channel(ANALOG_CHANNEL_AIN0_MV, &analog_data), ANALOG_SUCCESS);
+    TEST_assert_equal(analog_data, 1000);
+    // Filter reset falls back to direct conversions.
+    TEST_assert_equal(ANALOG_set_channel_filter(ANALOG_CHANNEL_AIN0_MV, 8, 0), ANALOG_SUCCESS);
+    TEST_assert_equal(ANALOG_convert_channel(ANALOG_CHANNEL_AIN0_MV, &analog_data), ANALOG_SUCCESS);
+    TEST_assert_equal(analog_data, 0);
+    TEST_assert_equal(ANALOG_set_channel_filter(ANALOG_CHANNEL_AIN0_MV, 1, (ANALOG_FILTER_IIR_SHIFT_MAX + 1)), ANALOG_ERROR_FILTER_IIR_SHIFT);
+}
+
+/*******************************************************************/
+static void _TEST_decimator_response(void) {
+    // Local variables.
+    const TEST_tone_t* tone = NULL;
+    uint32_t number_of_outputs = 0;
+    double measured = 0.0;
+    double expected = 0.0;
+    int32_t output_min = 0;
+    int32_t output_max = 0;
+    uint32_t idx = 0;
+    uint32_t output_idx = 0;
+    // Passband and first lobes: sinc response of the integrate-and-dump decimator.
+    for (idx = 0; idx < (sizeof(TEST_DECIMATOR_PASSBAND_TONES) / sizeof(TEST_tone_t)); idx++) {
+        tone = &(TEST_DECIMATOR_PASSBAND_TONES[idx]);
+        _TEST_init(TEST_DECIMATION_RATIO, 0);
+        number_of_outputs = _TEST_run_tone(tone, (TEST_DECIMATION_RATIO * TEST_DECIMATION_OUTPUTS), 0);
+        TEST_assert_equal(number_of_outputs, TEST_DECIMATION_OUTPUTS);
+        measured = _TEST_get_amplitude(number_of_outputs, _TEST_get_alias_bin(tone, TEST_DECIMATION_RATIO, number_of_outputs)) / TEST_TONE_AMPLITUDE;
+        expected = (TEST_PI * (double) (tone->numerator)) / (double) (tone->denominator);
+        expected = fabs(sin(expected * TEST_DECIMATION_RATIO) / (TEST_DECIMATION_RATIO * sin(expected)));
+        _TEST_check_gain("decimator", tone, measured, expected);
+    }
+    // Multiples of the output rate are cancelled.
+    for (idx = 0; idx < (sizeof(TEST_DECIMATOR_NULL_TONES) / sizeof(TEST_tone_t)); idx++) {
+        tone = &(TEST_DECIMATOR_NULL_TONES[idx]);
+        _TEST_init(TEST_DECIMATION_RATIO, 0);
+        number_of_outputs = _TEST_run_tone(tone, (TEST_DECIMATION_RATIO * TEST_DECIMATION_OUTPUTS), 0);
+        output_min = test_outputs_mv[0];
+        output_max = test_outputs_mv[0];
+        for (output_idx = 0; output_idx < number_of_outputs; output_idx++) {
+            output_min = (test_outputs_mv[output_idx] < output_min) ? test_outputs_mv[output_idx] : output_min;
+            output_max = (test_outputs_mv[output_idx] > output_max) ? test_outputs_mv[output_idx] : output_max;
+        }
+        printf("%-10s %4u/%-5u %9d mV peak-to-peak\n", "null", (unsigned int) tone->numerator, (unsigned int) tone->denominator, (int) (output_max - output_min));
+        TEST_assert((output_max - output_min) <= TEST_NULL_TOLERANCE_MV);
+    }
+}
+
+/*******************************************************************/
+static void _TEST_iir_response(void) {
+    // Local variables.
+    const TEST_tone_t* tone = NULL;
+    uint32_t number_of_outputs = 0;
+    double alpha = 1.0 / (double) (1 << TEST_IIR_SHIFT);
+    double omega = 0.0;
+    double measured = 0.0;
+    double expected = 0.0;
+    uint32_t idx = 0;
+    // First order low-pass: alpha / |1 - (1 - alpha).z^-1|.
+    for (idx = 0; idx < (sizeof(TEST_IIR_TONES) / sizeof(TEST_tone_t)); idx++) {
+        tone = &(TEST_IIR_TONES[idx]);
+        _TEST_init(1, TEST_IIR_SHIFT);
+        number_of_outputs = _TEST_run_tone(tone, TEST_IIR_OUTPUTS, TEST_IIR_SETTLING_SAMPLES);
+        TEST_assert_equal(number_of_outputs, TEST_IIR_OUTPUTS);
+        measured = _TEST_get_amplitude(number_of_outputs, _TEST_get_alias_bin(tone, 1, number_of_outputs)) / TEST_TONE_AMPLITUDE;
+        omega = (2.0 * TEST_PI * (double) (tone->numerator)) / (double) (tone->denominator);
+        expected = alpha / sqrt(1.0 - (2.0 * (1.0 - alpha) * cos(omega)) + ((1.0 - alpha) * (1.0 - alpha)));
+        _TEST_check_gain("iir", tone, measured, expected);
+    }
+}
+
+/*******************************************************************/
+static void _TEST_benchmark(void) {
+    // Local variables.
+    uint8_t output_ready = 0;
+    uint32_t number_of_outputs = 0;
+    uint32_t adc_conversion_count = 0;
+    struct timespec start;
+    struct timespec end;
+    long duration_ns = 0;
+    uint32_t idx = 0;
+    _TEST_init(TEST_DECIMATION_RATIO, TEST_IIR_SHIFT);
+    adc_conversion_count = FAKE_get_adc_conversion_count();
+    FAKE_set_adc_data(TEST_ADC_CHANNEL_AIN0, TEST_TONE_OFFSET);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (idx = 0; idx < TEST_BENCHMARK_SAMPLES; idx++) {
+        ANALOG_filter_channel(ANALOG_CHANNEL_AIN0_MV, &output_ready);
+        number_of_outputs += output_ready;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    duration_ns = ((end.tv_sec - start.tv_sec) * 1000000000L) + (end.tv_nsec - start.tv_nsec);
+    // One conversion per sample and one division per decimator output.
+    TEST_assert_equal((FAKE_get_adc_conversion_count() - adc_conversion_count), TEST_BENCHMARK_SAMPLES);
+    TEST_assert_equal(number_of_outputs, (TEST_BENCHMARK_SAMPLES / TEST_DECIMATION_RATIO));
+    printf("benchmark  %u samples %.1f host_ns/sample\n", (unsigned int) TEST_BENCHMARK_SAMPLES, ((double) duration_ns) / TEST_BENCHMARK_SAMPLES);
+}
+
+/*** TEST ANALOG FILTER functions ***/
+
+/*******************************************************************/
+int main(void) {
+    printf("%-10s %10s %9s %9s\n", "stage", "f/fs", "gain", "expected");
+    _TEST_dc();
+    _TEST_decimator_response();
+    _TEST_iir_response();
+    _TEST_benchmark();
+    return TEST_report("test_analog_filter");
+}
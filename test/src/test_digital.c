@@ -0,0 +1,168 @@
+/*
+ * test_digital.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "digital.h"
+#include "fake.h"
+#include "gpio_mapping.h"
+#include "test.h"
+#include "timebase.h"
+#include "types.h"
+
+/*** TEST DIGITAL local macros ***/
+
+#define TEST_PWM_PERIOD_US              1000
+#define TEST_PWM_HIGH_US                250
+#define TEST_PWM_NUMBER_OF_PERIODS      100
+#define TEST_PWM_FREQUENCY_MHZ          1000000
+#define TEST_PWM_DUTY_CYCLE_PERMILLE    250
+
+#define TEST_SWITCH_DEBOUNCE_MS         10
+#define TEST_SWITCH_BOUNCE_US           400
+#define TEST_SWITCH_NUMBER_OF_BOUNCES   5
+#define TEST_SWITCH_PRESS_PERIOD_MS     100
+#define TEST_SWITCH_NUMBER_OF_PRESSES   20
+
+#define TEST_SECONDS_PER_DAY            86400
+
+/*** TEST DIGITAL local functions ***/
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    FAKE_reset();
+    TIMEBASE_init();
+    TEST_assert_equal(DIGITAL_init(), DIGITAL_SUCCESS);
+}
+
+/*******************************************************************/
+static void _TEST_pulse_train(const GPIO_pin_t* gpio, uint32_t period_us, uint32_t high_us, uint32_t number_of_periods) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Replay the input level changes in real time.
+    for (idx = 0; idx < number_of_periods; idx++) {
+        FAKE_exti_set_gpio(gpio, 1);
+        FAKE_advance_microseconds(high_us);
+        FAKE_exti_set_gpio(gpio, 0);
+        FAKE_advance_microseconds(period_us - high_us);
+    }
+}
+
+/*******************************************************************/
+static void _TEST_switch_press(const GPIO_pin_t* gpio) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Mechanical contact bounces before settling to the high level.
+    for (idx = 0; idx < TEST_SWITCH_NUMBER_OF_BOUNCES; idx++) {
+        FAKE_exti_set_gpio(gpio, 1);
+        FAKE_advance_microseconds(TEST_SWITCH_BOUNCE_US);
+        FAKE_exti_set_gpio(gpio, 0);
+        FAKE_advance_microseconds(TEST_SWITCH_BOUNCE_US);
+    }
+    FAKE_exti_set_gpio(gpio, 1);
+    FAKE_advance_milliseconds(TEST_SWITCH_PRESS_PERIOD_MS / 2);
+    FAKE_exti_set_gpio(gpio, 0);
+    FAKE_advance_milliseconds(TEST_SWITCH_PRESS_PERIOD_MS / 2);
+}
+
+/*******************************************************************/
+static void _TEST_measurement(void) {
+    // Local variables.
+    DIGITAL_signal_t signal;
+    _TEST_init();
+    TEST_assert_equal(DIGITAL_start_measurement(DIGITAL_CHANNEL_DIO0), DIGITAL_SUCCESS);
+    // Last period is closed by the next rising edge.
+    _TEST_pulse_train(&GPIO_DIO0, TEST_PWM_PERIOD_US, TEST_PWM_HIGH_US, (TEST_PWM_NUMBER_OF_PERIODS + 1));
+    TEST_assert_equal(DIGITAL_stop_measurement(DIGITAL_CHANNEL_DIO0, &signal), DIGITAL_SUCCESS);
+    TEST_assert_equal(signal.frequency_mhz, TEST_PWM_FREQUENCY_MHZ);
+    TEST_assert_equal(signal.duty_cycle_permille, TEST_PWM_DUTY_CYCLE_PERMILLE);
+    // Static level.
+    TEST_assert_equal(DIGITAL_start_measurement(DIGITAL_CHANNEL_DIO0), DIGITAL_SUCCESS);
+    FAKE_exti_set_gpio(&GPIO_DIO0, 1);
+    FAKE_advance_milliseconds(TEST_PWM_PERIOD_US);
+    TEST_assert_equal(DIGITAL_stop_measurement(DIGITAL_CHANNEL_DIO0, &signal), DIGITAL_SUCCESS);
+    TEST_assert_equal(signal.frequency_mhz, 0);
+    TEST_assert_equal(signal.duty_cycle_permille, 1000);
+    FAKE_exti_set_gpio(&GPIO_DIO0, 0);
+    // Input is released: edges are ignored.
+    _TEST_pulse_train(&GPIO_DIO0, TEST_PWM_PERIOD_US, TEST_PWM_HIGH_US, TEST_PWM_NUMBER_OF_PERIODS);
+    TEST_assert_equal(DIGITAL_stop_measurement(DIGITAL_CHANNEL_DIO0, &signal), DIGITAL_ERROR_MEASUREMENT_STATE);
+}
+
+/*******************************************************************/
+static void _TEST_debounce(void) {
+    // Local variables.
+    uint32_t count = 0;
+    uint32_t idx = 0;
+    _TEST_init();
+    // Without debouncing, each bounce is counted.
+    TEST_assert_equal(DIGITAL_start_counter(DIGITAL_CHANNEL_DIO1, DIGITAL_COUNTER_EDGE_RISING, 0), DIGITAL_SUCCESS);
+    _TEST_switch_press(&GPIO_DIO1);
+    TEST_assert_equal(DIGITAL_read_counter(DIGITAL_CHANNEL_DIO1, 1, &count), DIGITAL_SUCCESS);
+    TEST_assert_equal(count, (TEST_SWITCH_NUMBER_OF_BOUNCES + 1));
+    // With debouncing, only one edge per press is counted.
+    TEST_assert_equal(DIGITAL_start_counter(DIGITAL_CHANNEL_DIO1, DIGITAL_COUNTER_EDGE_RISING, TEST_SWITCH_DEBOUNCE_MS), DIGITAL_SUCCESS);
+    for (idx = 0; idx < TEST_SWITCH_NUMBER_OF_PRESSES; idx++) {
+        _TEST_switch_press(&GPIO_DIO1);
+    }
+    TEST_assert_equal(DIGITAL_read_counter(DIGITAL_CHANNEL_DIO1, 1, &count), DIGITAL_SUCCESS);
+    TEST_assert_equal(count, TEST_SWITCH_NUMBER_OF_PRESSES);
+    TEST_assert_equal(DIGITAL_stop_counter(DIGITAL_CHANNEL_DIO1), DIGITAL_SUCCESS);
+    _TEST_switch_press(&GPIO_DIO1);
+    TEST_assert_equal(DIGITAL_read_counter(DIGITAL_CHANNEL_DIO1, 1, &count), DIGITAL_SUCCESS);
+    TEST_assert_equal(count, 0);
+}
+
+/*******************************************************************/
+static void _TEST_debounce_midnight(void) {
+    // Local variables.
+    uint32_t count = 0;
+    uint32_t idx = 0;
+    _TEST_init();
+    // Presses around the calendar day rollover.
+    FAKE_set_uptime_seconds(TEST_SECONDS_PER_DAY - 1);
+    TEST_assert_equal(DIGITAL_start_counter(DIGITAL_CHANNEL_DIO2, DIGITAL_COUNTER_EDGE_RISING, TEST_SWITCH_DEBOUNCE_MS), DIGITAL_SUCCESS);
+    for (idx = 0; idx < TEST_SWITCH_NUMBER_OF_PRESSES; idx++) {
+        _TEST_switch_press(&GPIO_DIO2);
+    }
+    TEST_assert_equal(FAKE_get_milliseconds() > (TEST_SECONDS_PER_DAY * 1000), 1);
+    TEST_assert_equal(DIGITAL_read_counter(DIGITAL_CHANNEL_DIO2, 0, &count), DIGITAL_SUCCESS);
+    TEST_assert_equal(count, TEST_SWITCH_NUMBER_OF_PRESSES);
+    TEST_assert_equal(DIGITAL_stop_counter(DIGITAL_CHANNEL_DIO2), DIGITAL_SUCCESS);
+}
+
+/*******************************************************************/
+static void _TEST_counter_and_measurement(void) {
+    // Local variables.
+    DIGITAL_signal_t signal;
+    uint32_t count = 0;
+    _TEST_init();
+    TEST_assert_equal(DIGITAL_start_counter(DIGITAL_CHANNEL_DIO3, DIGITAL_COUNTER_EDGE_FALLING, 0), DIGITAL_SUCCESS);
+    TEST_assert_equal(DIGITAL_set_counter(DIGITAL_CHANNEL_DIO3, 0), DIGITAL_SUCCESS);
+    // Both edges trigger the interrupt during the measurement but only falling edges are counted.
+    TEST_assert_equal(DIGITAL_start_measurement(DIGITAL_CHANNEL_DIO3), DIGITAL_SUCCESS);
+    _TEST_pulse_train(&GPIO_DIO3, TEST_PWM_PERIOD_US, TEST_PWM_HIGH_US, (TEST_PWM_NUMBER_OF_PERIODS + 1));
+    TEST_assert_equal(DIGITAL_stop_measurement(DIGITAL_CHANNEL_DIO3, &signal), DIGITAL_SUCCESS);
+    TEST_assert_equal(signal.frequency_mhz, TEST_PWM_FREQUENCY_MHZ);
+    TEST_assert_equal(signal.duty_cycle_permille, TEST_PWM_DUTY_CYCLE_PERMILLE);
+    TEST_assert_equal(DIGITAL_read_counter(DIGITAL_CHANNEL_DIO3, 1, &count), DIGITAL_SUCCESS);
+    TEST_assert_equal(count, (TEST_PWM_NUMBER_OF_PERIODS + 1));
+    // Counter keeps running on its own trigger.
+    _TEST_pulse_train(&GPIO_DIO3, TEST_PWM_PERIOD_US, TEST_PWM_HIGH_US, TEST_PWM_NUMBER_OF_PERIODS);
+    TEST_assert_equal(DIGITAL_read_counter(DIGITAL_CHANNEL_DIO3, 1, &count), DIGITAL_SUCCESS);
+    TEST_assert_equal(count, TEST_PWM_NUMBER_OF_PERIODS);
+    TEST_assert_equal(DIGITAL_stop_counter(DIGITAL_CHANNEL_DIO3), DIGITAL_SUCCESS);
+}
+
+/*** TEST DIGITAL functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_measurement();
+    _TEST_debounce();
+    _TEST_debounce_midnight();
+    _TEST_counter_and_measurement();
+    return TEST_report("test_digital");
+}
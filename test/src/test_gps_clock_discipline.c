@@ -0,0 +1,184 @@
+/*
+ * test_gps_clock_discipline.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "gpio_mapping.h"
+#include "gps.h"
+#include "test.h"
+#include "timebase.h"
+#include "types.h"
+
+/*** TEST GPS CLOCK DISCIPLINE local macros ***/
+
+#define TEST_START_TIME_SECONDS         1000
+#define TEST_NUMBER_OF_PULSES           64
+#define TEST_NUMBER_OF_RUNS             3
+
+// Timepulse interrupt latency jitter.
+#define TEST_PULSE_JITTER_US            2
+// Process wake-up latency after the timepulse edge.
+#define TEST_PROCESS_LATENCY_MIN_US     100
+#define TEST_PROCESS_LATENCY_MAX_US     20000
+// Edges measured more than half a second late are skipped.
+#define TEST_LATE_EDGE_LATENCY_US       600000
+#define TEST_ACCEPTED_EDGE_LATENCY_US   450000
+#define TEST_LATE_EDGE_INDEX            20
+#define TEST_SLOW_EDGE_INDEX            40
+
+#define TEST_LSE_ERROR_PPB              23400
+#define TEST_HSI_ERROR_PPM              9000
+#define TEST_RTC_CALIBRATION_PPB_STEP   954
+#define TEST_HSI_TRIM_DEFAULT           16
+#define TEST_HSI_TRIM_STEP_PPM          4000
+// Measurement accuracy over the window with the simulated jitter.
+#define TEST_LSE_TOLERANCE_PPB          200
+#define TEST_HSI_TOLERANCE_PPM          5
+
+/*** TEST GPS CLOCK DISCIPLINE local global variables ***/
+
+static uint32_t test_random = 0x1234;
+
+/*** TEST GPS CLOCK DISCIPLINE local functions ***/
+
+/*******************************************************************/
+static uint32_t _TEST_random(uint32_t modulo) {
+    // Deterministic linear congruential generator.
+    test_random = ((test_random * 1103515245) + 12345);
+    return (((test_random >> 8) & 0x00FFFFFF) % modulo);
+}
+
+/*******************************************************************/
+static int32_t _TEST_abs(int32_t value) {
+    return ((value < 0) ? (-value) : value);
+}
+
+/*******************************************************************/
+static void _TEST_wait_until(uint64_t time_us) {
+    // Time never goes backward.
+    if (time_us > FAKE_get_microseconds()) {
+        FAKE_advance_microseconds((uint32_t) (time_us - FAKE_get_microseconds()));
+    }
+}
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    FAKE_reset();
+    TIMEBASE_init();
+    FAKE_set_uptime_seconds(TEST_START_TIME_SECONDS);
+    FAKE_timebase_set_clock_errors(TEST_LSE_ERROR_PPB, TEST_HSI_ERROR_PPM);
+    test_random = 0x1234;
+}
+
+/*******************************************************************/
+static GPS_status_t _TEST_run(uint32_t number_of_pulses, uint32_t late_edge_index, GPS_clock_discipline_t* clock_discipline) {
+    // Local variables.
+    GPS_status_t status = GPS_SUCCESS;
+    uint64_t first_edge_us = 0;
+    uint64_t edge_us = 0;
+    uint32_t latency_us = 0;
+    uint32_t pulse_count = 0;
+    uint32_t idx = 0;
+    // Start captures.
+    TEST_assert_equal(GPS_start_clock_discipline(), GPS_SUCCESS);
+    TEST_assert_equal(FAKE_timebase_get_rtc_direct_read(), 1);
+    TEST_assert_equal(GPS_start_clock_discipline(), GPS_ERROR_CLOCK_DISCIPLINE_STATE);
+    first_edge_us = ((FAKE_get_microseconds() / 1000000) + 1) * 1000000;
+    for (idx = 0; idx < number_of_pulses; idx++) {
+        // GPS second with interrupt latency jitter.
+        edge_us = first_edge_us + (((uint64_t) idx) * 1000000) + _TEST_random(2 * TEST_PULSE_JITTER_US + 1);
+        _TEST_wait_until(edge_us);
+        FAKE_exti_trigger(&GPIO_GPS_TIMEPULSE);
+        // Process context is woken up later.
+        latency_us = TEST_PROCESS_LATENCY_MIN_US + _TEST_random(TEST_PROCESS_LATENCY_MAX_US - TEST_PROCESS_LATENCY_MIN_US);
+        if (idx == late_edge_index) {
+            latency_us = TEST_LATE_EDGE_LATENCY_US;
+        }
+        if (idx == TEST_SLOW_EDGE_INDEX) {
+            latency_us = TEST_ACCEPTED_EDGE_LATENCY_US;
+        }
+        _TEST_wait_until(edge_us + latency_us);
+        TEST_assert_equal(GPS_process_clock_discipline(), GPS_SUCCESS);
+        // Same edge is measured only once.
+        TEST_assert_equal(GPS_process_clock_discipline(), GPS_SUCCESS);
+        // Late edge is not used: edges are counted from the first measured one.
+        if (idx == late_edge_index) {
+            TEST_assert_equal(GPS_get_clock_discipline_pulse_count(), pulse_count);
+        }
+        else {
+            pulse_count = (pulse_count == 0) ? 1 : (idx + 1 - ((late_edge_index == 0) ? 1 : 0));
+            TEST_assert_equal(GPS_get_clock_discipline_pulse_count(), pulse_count);
+        }
+    }
+    status = GPS_apply_clock_discipline(clock_discipline);
+    TEST_assert_equal(GPS_stop_clock_discipline(), GPS_SUCCESS);
+    // RTC read mode is restored.
+    TEST_assert_equal(FAKE_timebase_get_rtc_direct_read(), 0);
+    TEST_assert_equal(GPS_stop_clock_discipline(), GPS_SUCCESS);
+    TEST_assert_equal(FAKE_timebase_get_rtc_direct_read(), 0);
+    return status;
+}
+
+/*******************************************************************/
+static void _TEST_convergence(void) {
+    // Local variables.
+    GPS_clock_discipline_t clock_discipline;
+    int32_t calibration_step = 0;
+    int32_t residual_lse_error_ppb = TEST_LSE_ERROR_PPB;
+    int32_t residual_hsi_error_ppm = TEST_HSI_ERROR_PPM;
+    uint8_t hsi_trim = TEST_HSI_TRIM_DEFAULT;
+    uint32_t run = 0;
+    _TEST_init();
+    for (run = 0; run < TEST_NUMBER_OF_RUNS; run++) {
+        // Errors are measured against the GPS second.
+        TEST_assert_equal(_TEST_run(TEST_NUMBER_OF_PULSES, ((run == 0) ? TEST_LATE_EDGE_INDEX : TEST_NUMBER_OF_PULSES), &clock_discipline), GPS_SUCCESS);
+        TEST_assert(_TEST_abs(clock_discipline.lse_error_ppb - residual_lse_error_ppb) <= TEST_LSE_TOLERANCE_PPB);
+        TEST_assert(_TEST_abs(clock_discipline.hsi_error_ppm - residual_hsi_error_ppm) <= TEST_HSI_TOLERANCE_PPM);
+        // Corrections.
+        calibration_step = TIMEBASE_get_rtc_calibration();
+        hsi_trim = TIMEBASE_get_hsi_trim();
+        TEST_assert_equal(clock_discipline.hsi_trim, hsi_trim);
+        residual_lse_error_ppb = TEST_LSE_ERROR_PPB + (calibration_step * TEST_RTC_CALIBRATION_PPB_STEP);
+        residual_hsi_error_ppm = TEST_HSI_ERROR_PPM + (((int32_t) hsi_trim - TEST_HSI_TRIM_DEFAULT) * TEST_HSI_TRIM_STEP_PPM);
+        // Clocks are within half a correction step after the first run and do not oscillate with the jitter.
+        TEST_assert(_TEST_abs(residual_lse_error_ppb) <= (TEST_RTC_CALIBRATION_PPB_STEP / 2));
+        TEST_assert(_TEST_abs(residual_hsi_error_ppm) <= (TEST_HSI_TRIM_STEP_PPM / 2));
+        TEST_assert_equal(calibration_step, -25);
+        TEST_assert_equal(hsi_trim, 14);
+    }
+}
+
+/*******************************************************************/
+static void _TEST_late_first_edge(void) {
+    // Local variables.
+    GPS_clock_discipline_t clock_discipline;
+    _TEST_init();
+    // First edge is skipped, the window starts on the second one.
+    TEST_assert_equal(_TEST_run(TEST_NUMBER_OF_PULSES, 0, &clock_discipline), GPS_SUCCESS);
+    TEST_assert(_TEST_abs(clock_discipline.lse_error_ppb - TEST_LSE_ERROR_PPB) <= TEST_LSE_TOLERANCE_PPB);
+    TEST_assert_equal(TIMEBASE_get_rtc_calibration(), -25);
+}
+
+/*******************************************************************/
+static void _TEST_not_enough_pulses(void) {
+    // Local variables.
+    GPS_clock_discipline_t clock_discipline;
+    _TEST_init();
+    // A single measured edge gives no period.
+    TEST_assert_equal(_TEST_run(2, 0, &clock_discipline), GPS_ERROR_CLOCK_DISCIPLINE_PULSES);
+    TEST_assert_equal(TIMEBASE_get_rtc_calibration(), 0);
+    TEST_assert_equal(TIMEBASE_get_hsi_trim(), TEST_HSI_TRIM_DEFAULT);
+}
+
+/*** TEST GPS CLOCK DISCIPLINE functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_convergence();
+    _TEST_late_first_edge();
+    _TEST_not_enough_pulses();
+    return TEST_report("test_gps_clock_discipline");
+}
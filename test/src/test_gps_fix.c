@@ -0,0 +1,355 @@
+/*
+ * test_gps_fix.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "gps.h"
+#include "neom8x_hw.h"
+#include "test.h"
+#include "types.h"
+#include <math.h>
+#include <stdio.h>
+
+/*** TEST GPS FIX local macros ***/
+
+#define TEST_UBX_FRAME_OVERHEAD_BYTES   8
+#define TEST_UBX_CLASS_NAV              0x01
+#define TEST_UBX_ID_NAV_PVT             0x07
+#define TEST_NAV_PVT_PAYLOAD_SIZE       92
+
+#define TEST_COORDINATE_SCALE           10000000
+#define TEST_COORDINATE_FULL_TURN       (360 * ((int64_t) TEST_COORDINATE_SCALE))
+#define TEST_COORDINATE_HALF_TURN       (180 * ((int64_t) TEST_COORDINATE_SCALE))
+// Positions are truncated to thousandths of arc-seconds (2.8e-7 degree) at each conversion.
+#define TEST_COORDINATE_TOLERANCE       8
+// Averaging weights are truncated to integers.
+#define TEST_ACCURACY_TOLERANCE_PERCENT 1
+
+#define TEST_NO_FIX                     { 0, 3, 9999, 999000, 0, 0, 0 }
+
+/*** TEST GPS FIX local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t fix_type;
+    uint8_t number_of_satellites;
+    uint16_t pdop;
+    uint32_t horizontal_accuracy_mm;
+    // Offsets from the true position in 1e-7 degree unit.
+    int32_t latitude_offset;
+    int32_t longitude_offset;
+    int32_t altitude_m;
+} TEST_epoch_t;
+
+/*******************************************************************/
+typedef struct {
+    const char_t* name;
+    GPS_coordinates_t position;
+    const TEST_epoch_t* epochs;
+    uint32_t number_of_epochs;
+} TEST_trace_t;
+
+/*******************************************************************/
+typedef struct {
+    const char_t* name;
+    GPS_fix_quality_gate_t gate;
+} TEST_gate_t;
+
+/*******************************************************************/
+typedef struct {
+    const TEST_trace_t* trace;
+    const TEST_gate_t* gate;
+    uint32_t timeout_seconds;
+    GPS_acquisition_status_t expected_status;
+    uint32_t expected_duration_seconds;
+    uint8_t expected_number_of_fixes;
+    uint8_t expected_gate_reached;
+} TEST_case_t;
+
+/*** TEST GPS FIX local global variables ***/
+
+// Cold start in open sky, one NAV-PVT frame per second.
+static const TEST_epoch_t TEST_EPOCHS_OPEN_SKY[] = {
+    TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX,
+    TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX,
+    TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX,
+    { 3, 6, 320, 48000, 3100, -2500, 212 },
+    { 3, 7, 280, 31000, 2000, 1800, 205 },
+    { 3, 8, 240, 19000, -1200, 900, 209 },
+    { 3, 9, 190, 12500, 700, -1000, 207 },
+    { 3, 10, 160, 8400, -500, 400, 206 },
+    { 3, 10, 150, 6100, 300, -350, 206 },
+    { 3, 11, 140, 4700, -250, 200, 205 },
+    { 3, 11, 130, 3900, 150, 180, 205 },
+    { 3, 12, 125, 3300, -120, -90, 205 },
+    { 3, 12, 120, 2900, 80, 60, 205 },
+    { 3, 12, 115, 2700, -60, 70, 205 },
+    { 3, 12, 115, 2600, 40, -50, 205 },
+};
+
+// Urban canyon: multipath, satellites masked by buildings.
+static const TEST_epoch_t TEST_EPOCHS_URBAN[] = {
+    TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX,
+    TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX,
+    { 2, 4, 650, 85000, 7000, 4000, 0 },
+    { 2, 4, 600, 60000, -5000, 3500, 0 },
+    { 3, 5, 540, 42000, 3500, -3000, 230 },
+    { 3, 5, 510, 35000, -2800, 2600, 226 },
+    { 3, 6, 470, 28000, 2200, 1900, 224 },
+    { 3, 4, 620, 9500, -800, 600, 224 },
+    { 3, 6, 560, 9200, 750, -700, 223 },
+    { 3, 7, 450, 14000, -1100, -900, 223 },
+    { 3, 7, 420, 11000, 900, 800, 224 },
+    { 3, 8, 380, 9800, -700, 650, 224 },
+    { 3, 8, 360, 9100, 600, -600, 224 },
+    { 3, 7, 400, 12500, -1000, 900, 225 },
+    { 3, 9, 330, 8700, 550, 500, 224 },
+    { 3, 9, 310, 7900, -500, -450, 224 },
+    { 3, 9, 300, 7400, 450, 400, 224 },
+    { 3, 10, 290, 7100, -400, 380, 224 },
+    { 3, 10, 290, 6900, 380, -360, 224 },
+    { 3, 10, 285, 6800, -350, 330, 224 },
+    { 3, 9, 300, 7200, 400, 350, 224 },
+    { 3, 10, 280, 6600, -330, -300, 224 },
+    { 3, 10, 280, 6500, 300, 280, 224 },
+    { 3, 10, 285, 6700, -320, 300, 224 },
+    { 3, 10, 280, 6400, 290, -270, 224 },
+    { 3, 10, 280, 6300, -280, 260, 224 },
+    { 3, 10, 280, 6200, 270, 250, 224 },
+    { 3, 10, 280, 6300, -260, -240, 224 },
+    { 3, 10, 280, 6100, 250, 230, 224 },
+    { 3, 10, 280, 6000, -240, 220, 224 },
+    { 3, 10, 280, 6100, 230, -210, 224 },
+    { 3, 10, 280, 6000, -220, 200, 224 },
+};
+
+// Indoor: no 3D fix.
+static const TEST_epoch_t TEST_EPOCHS_INDOOR[] = {
+    TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX,
+    TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX,
+    { 2, 3, 990, 150000, 12000, -9000, 0 },
+    { 2, 4, 870, 120000, -9000, 8000, 0 },
+    { 2, 4, 820, 110000, 8500, 7000, 0 },
+    { 2, 3, 950, 140000, -10000, -8000, 0 },
+    { 2, 4, 800, 105000, 7000, -6500, 0 },
+    { 2, 4, 790, 100000, -6500, 6000, 0 },
+    { 2, 4, 780, 98000, 6000, 5500, 0 },
+    { 2, 4, 780, 97000, -5500, -5000, 0 },
+    { 2, 4, 770, 95000, 5000, 4500, 0 },
+    { 2, 4, 770, 94000, -4500, 4000, 0 },
+};
+
+// Open sea, fixes spread across the anti-meridian.
+static const TEST_epoch_t TEST_EPOCHS_PACIFIC[] = {
+    TEST_NO_FIX, TEST_NO_FIX, TEST_NO_FIX,
+    { 3, 9, 180, 4000, 40, 35, 0 },
+    { 3, 9, 170, 3500, -30, -40, 0 },
+    { 3, 10, 160, 3000, 25, 30, 0 },
+    { 3, 10, 150, 2500, -20, -25, 0 },
+    { 3, 10, 150, 2400, 15, 20, 0 },
+};
+
+static const TEST_trace_t TEST_TRACE_OPEN_SKY = { "open_sky", { 451885000, 57245000 }, TEST_EPOCHS_OPEN_SKY, (sizeof(TEST_EPOCHS_OPEN_SKY) / sizeof(TEST_epoch_t)) };
+static const TEST_trace_t TEST_TRACE_URBAN = { "urban", { 488566000, 23522000 }, TEST_EPOCHS_URBAN, (sizeof(TEST_EPOCHS_URBAN) / sizeof(TEST_epoch_t)) };
+static const TEST_trace_t TEST_TRACE_INDOOR = { "indoor", { 451885000, 57245000 }, TEST_EPOCHS_INDOOR, (sizeof(TEST_EPOCHS_INDOOR) / sizeof(TEST_epoch_t)) };
+static const TEST_trace_t TEST_TRACE_PACIFIC = { "pacific", { -170000000, 1799999990 }, TEST_EPOCHS_PACIFIC, (sizeof(TEST_EPOCHS_PACIFIC) / sizeof(TEST_epoch_t)) };
+
+static const TEST_gate_t TEST_GATE_ALTITUDE = { "altitude", { 0, 0, 0, 0 } };
+static const TEST_gate_t TEST_GATE_10M = { "10m", { 10000, 500, 5, 1 } };
+static const TEST_gate_t TEST_GATE_10M_AVERAGE_4 = { "10m_avg4", { 10000, 500, 5, 4 } };
+static const TEST_gate_t TEST_GATE_5M = { "5m", { 5000, 300, 8, 1 } };
+
+static const TEST_case_t TEST_CASES[] = {
+    // The altitude filter stops on the first stable altitude whatever the accuracy.
+    { &TEST_TRACE_OPEN_SKY, &TEST_GATE_ALTITUDE, 120, GPS_ACQUISITION_SUCCESS, 28, 1, 1 },
+    { &TEST_TRACE_OPEN_SKY, &TEST_GATE_10M, 120, GPS_ACQUISITION_SUCCESS, 30, 1, 1 },
+    { &TEST_TRACE_OPEN_SKY, &TEST_GATE_10M_AVERAGE_4, 120, GPS_ACQUISITION_SUCCESS, 33, 4, 1 },
+    { &TEST_TRACE_OPEN_SKY, &TEST_GATE_5M, 120, GPS_ACQUISITION_SUCCESS, 32, 1, 1 },
+    { &TEST_TRACE_URBAN, &TEST_GATE_ALTITUDE, 60, GPS_ACQUISITION_SUCCESS, 19, 1, 1 },
+    // Fixes failing on satellites or PDOP only are rejected.
+    { &TEST_TRACE_URBAN, &TEST_GATE_10M, 60, GPS_ACQUISITION_SUCCESS, 25, 1, 1 },
+    { &TEST_TRACE_URBAN, &TEST_GATE_10M_AVERAGE_4, 60, GPS_ACQUISITION_SUCCESS, 29, 4, 1 },
+    // Gate never reached: last raw fix is returned at timeout.
+    { &TEST_TRACE_URBAN, &TEST_GATE_5M, 60, GPS_ACQUISITION_SUCCESS, 60, 0, 0 },
+    { &TEST_TRACE_INDOOR, &TEST_GATE_ALTITUDE, 30, GPS_ACQUISITION_ERROR_TIMEOUT, 30, 0, 0 },
+    { &TEST_TRACE_INDOOR, &TEST_GATE_10M, 30, GPS_ACQUISITION_ERROR_TIMEOUT, 30, 0, 0 },
+    { &TEST_TRACE_PACIFIC, &TEST_GATE_10M_AVERAGE_4, 60, GPS_ACQUISITION_SUCCESS, 7, 4, 1 },
+};
+
+/*** TEST GPS FIX local functions ***/
+
+/*******************************************************************/
+static void _TEST_write_u16(uint8_t* payload, uint8_t offset, uint16_t value) {
+    payload[offset + 0] = (uint8_t) ((value >> 0) & 0xFF);
+    payload[offset + 1] = (uint8_t) ((value >> 8) & 0xFF);
+}
+
+/*******************************************************************/
+static void _TEST_write_u32(uint8_t* payload, uint8_t offset, uint32_t value) {
+    payload[offset + 0] = (uint8_t) ((value >> 0) & 0xFF);
+    payload[offset + 1] = (uint8_t) ((value >> 8) & 0xFF);
+    payload[offset + 2] = (uint8_t) ((value >> 16) & 0xFF);
+    payload[offset + 3] = (uint8_t) ((value >> 24) & 0xFF);
+}
+
+/*******************************************************************/
+static int32_t _TEST_normalize_longitude(int64_t longitude) {
+    if (longitude >= TEST_COORDINATE_HALF_TURN) {
+        longitude -= TEST_COORDINATE_FULL_TURN;
+    }
+    if (longitude < (-TEST_COORDINATE_HALF_TURN)) {
+        longitude += TEST_COORDINATE_FULL_TURN;
+    }
+    return (int32_t) longitude;
+}
+
+/*******************************************************************/
+static void _TEST_get_coordinates(const TEST_trace_t* trace, const TEST_epoch_t* epoch, GPS_coordinates_t* coordinates) {
+    coordinates->latitude = (trace->position.latitude + epoch->latitude_offset);
+    coordinates->longitude = _TEST_normalize_longitude(((int64_t) trace->position.longitude) + epoch->longitude_offset);
+}
+
+/*******************************************************************/
+static void _TEST_send_epoch(const TEST_trace_t* trace, const TEST_epoch_t* epoch) {
+    // Local variables.
+    uint8_t payload[TEST_NAV_PVT_PAYLOAD_SIZE] = { 0x00 };
+    uint8_t frame[TEST_NAV_PVT_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t frame_size = 0;
+    GPS_coordinates_t coordinates;
+    _TEST_get_coordinates(trace, epoch, &coordinates);
+    // NAV-PVT fields used by the driver.
+    payload[20] = epoch->fix_type;
+    payload[21] = (epoch->fix_type >= 2) ? 0x01 : 0x00;
+    payload[23] = epoch->number_of_satellites;
+    _TEST_write_u32(payload, 24, (uint32_t) coordinates.longitude);
+    _TEST_write_u32(payload, 28, (uint32_t) coordinates.latitude);
+    _TEST_write_u32(payload, 36, (uint32_t) (epoch->altitude_m * 1000));
+    _TEST_write_u32(payload, 40, epoch->horizontal_accuracy_mm);
+    _TEST_write_u16(payload, 76, epoch->pdop);
+    frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_PVT, payload, TEST_NAV_PVT_PAYLOAD_SIZE, frame);
+    // Frame tail is handed over by the IDLE interrupt.
+    FAKE_gps_receive(frame, frame_size);
+}
+
+/*******************************************************************/
+static uint8_t _TEST_is_accepted(const TEST_gate_t* gate, const TEST_epoch_t* epoch) {
+    // Reference criteria of the configured gates.
+    if ((epoch->fix_type < 3) || (epoch->horizontal_accuracy_mm > gate->gate.horizontal_accuracy_max_mm)) return 0;
+    if ((epoch->pdop > gate->gate.pdop_max) || (epoch->number_of_satellites < gate->gate.satellites_min)) return 0;
+    return 1;
+}
+
+/*******************************************************************/
+static void _TEST_check_average(const TEST_case_t* test_case, uint32_t last_epoch, GPS_fix_report_t* fix_report, GPS_coordinates_t* coordinates) {
+    // Local variables.
+    const TEST_trace_t* trace = test_case->trace;
+    GPS_coordinates_t epoch_coordinates;
+    double weight = 0.0;
+    double weight_sum = 0.0;
+    double latitude_sum = 0.0;
+    double longitude_sum = 0.0;
+    uint8_t number_of_fixes = 0;
+    int32_t idx = 0;
+    // Inverse variance weighted mean of the accepted fixes, variance in dm^2.
+    for (idx = (int32_t) last_epoch; (idx >= 0) && (number_of_fixes < (test_case->expected_number_of_fixes)); idx--) {
+        if (_TEST_is_accepted(test_case->gate, &(trace->epochs[idx])) == 0) continue;
+        _TEST_get_coordinates(trace, &(trace->epochs[idx]), &epoch_coordinates);
+        weight = 1.0 / pow((double) (trace->epochs[idx].horizontal_accuracy_mm / 100), 2);
+        weight_sum += weight;
+        latitude_sum += weight * (epoch_coordinates.latitude - trace->position.latitude);
+        longitude_sum += weight * _TEST_normalize_longitude(((int64_t) epoch_coordinates.longitude) - trace->position.longitude);
+        number_of_fixes++;
+    }
+    TEST_assert_equal(number_of_fixes, test_case->expected_number_of_fixes);
+    TEST_assert(fabs((100.0 / sqrt(weight_sum)) - fix_report->horizontal_accuracy_mm) <= ((fix_report->horizontal_accuracy_mm * TEST_ACCURACY_TOLERANCE_PERCENT) / 100.0));
+    TEST_assert(fix_report->horizontal_accuracy_mm < trace->epochs[last_epoch].horizontal_accuracy_mm);
+    TEST_assert(fabs((trace->position.latitude + (latitude_sum / weight_sum)) - coordinates->latitude) <= TEST_COORDINATE_TOLERANCE);
+    TEST_assert(fabs((double) (_TEST_normalize_longitude((int64_t) lround(trace->position.longitude + (longitude_sum / weight_sum)) - coordinates->longitude))) <= TEST_COORDINATE_TOLERANCE);
+}
+
+/*******************************************************************/
+static void _TEST_run(const TEST_case_t* test_case) {
+    // Local variables.
+    const TEST_trace_t* trace = test_case->trace;
+    GPS_fix_quality_gate_t gate = test_case->gate->gate;
+    GPS_position_t gps_position = { 0 };
+    GPS_coordinates_t coordinates;
+    GPS_coordinates_t expected_coordinates;
+    GPS_acquisition_status_t acquisition_status = GPS_ACQUISITION_ERROR_LAST;
+    GPS_fix_report_t fix_report;
+    uint32_t duration_seconds = 0;
+    uint32_t last_epoch = 0;
+    uint32_t idx = 0;
+    // Init.
+    FAKE_reset();
+    TEST_assert_equal(GPS_init(), GPS_SUCCESS);
+    TEST_assert_equal(GPS_set_fix_quality_gate(&gate), GPS_SUCCESS);
+    TEST_assert_equal(GPS_start_acquisition(GPS_ACQUISITION_TYPE_POSITION, test_case->timeout_seconds), GPS_SUCCESS);
+    // One frame per second until the acquisition completes.
+    for (idx = 0; idx < (test_case->timeout_seconds); idx++) {
+        FAKE_set_uptime_seconds(idx + 1);
+        if (idx < (trace->number_of_epochs)) {
+            _TEST_send_epoch(trace, &(trace->epochs[idx]));
+            last_epoch = idx;
+        }
+        TEST_assert_equal(GPS_process(), GPS_SUCCESS);
+        if (GPS_get_acquisition_state() == GPS_ACQUISITION_STATE_DONE) break;
+    }
+    // Check result.
+    TEST_assert_equal(GPS_get_acquisition_state(), GPS_ACQUISITION_STATE_DONE);
+    TEST_assert_equal(GPS_get_position(&gps_position, &duration_seconds, &acquisition_status), GPS_SUCCESS);
+    TEST_assert_equal(GPS_get_fix_report(&fix_report), GPS_SUCCESS);
+    TEST_assert_equal(acquisition_status, test_case->expected_status);
+    TEST_assert_equal(duration_seconds, test_case->expected_duration_seconds);
+    TEST_assert_equal(fix_report.number_of_fixes, test_case->expected_number_of_fixes);
+    TEST_assert_equal(fix_report.gate_reached, test_case->expected_gate_reached);
+    printf("%-10s %-10s %8u %12u %6u\n", trace->name, test_case->gate->name, (unsigned int) duration_seconds, (unsigned int) fix_report.horizontal_accuracy_mm, (unsigned int) fix_report.number_of_fixes);
+    // Check position.
+    TEST_assert_equal(GPS_convert_position(&gps_position, &coordinates), GPS_SUCCESS);
+    if (fix_report.number_of_fixes > 1) {
+        _TEST_check_average(test_case, last_epoch, &fix_report, &coordinates);
+    }
+    else if (acquisition_status == GPS_ACQUISITION_SUCCESS) {
+        // Last decoded fix is returned.
+        _TEST_get_coordinates(trace, &(trace->epochs[last_epoch]), &expected_coordinates);
+        TEST_assert_equal(fix_report.horizontal_accuracy_mm, trace->epochs[last_epoch].horizontal_accuracy_mm);
+        TEST_assert(fabs((double) (coordinates.latitude - expected_coordinates.latitude)) <= TEST_COORDINATE_TOLERANCE);
+        TEST_assert(fabs((double) (coordinates.longitude - expected_coordinates.longitude)) <= TEST_COORDINATE_TOLERANCE);
+        TEST_assert_equal(gps_position.altitude, (uint32_t) trace->epochs[last_epoch].altitude_m);
+    }
+    TEST_assert_equal(GPS_de_init(), GPS_SUCCESS);
+}
+
+/*******************************************************************/
+static void _TEST_errors(void) {
+    // Local variables.
+    GPS_fix_quality_gate_t gate = { 10000, 500, 5, 9 };
+    GPS_fix_report_t fix_report;
+    FAKE_reset();
+    TEST_assert_equal(GPS_init(), GPS_SUCCESS);
+    TEST_assert_equal(GPS_set_fix_quality_gate(NULL), GPS_ERROR_NULL_PARAMETER);
+    TEST_assert_equal(GPS_set_fix_quality_gate(&gate), GPS_ERROR_FIX_AVERAGING_DEPTH);
+    TEST_assert_equal(GPS_get_fix_report(NULL), GPS_ERROR_NULL_PARAMETER);
+    // Report is only available after a position acquisition.
+    TEST_assert_equal(GPS_start_acquisition(GPS_ACQUISITION_TYPE_POSITION, 10), GPS_SUCCESS);
+    TEST_assert_equal(GPS_get_fix_report(&fix_report), GPS_ERROR_ACQUISITION_STATE);
+    TEST_assert_equal(GPS_stop_acquisition(), GPS_SUCCESS);
+    TEST_assert_equal(GPS_de_init(), GPS_SUCCESS);
+}
+
+/*** TEST GPS FIX functions ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    printf("%-10s %-10s %8s %12s %6s\n", "trace", "gate", "time_on", "accuracy_mm", "fixes");
+    for (idx = 0; idx < (sizeof(TEST_CASES) / sizeof(TEST_case_t)); idx++) {
+        _TEST_run(&(TEST_CASES[idx]));
+    }
+    _TEST_errors();
+    return TEST_report("test_gps_fix");
+}
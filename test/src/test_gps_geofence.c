@@ -0,0 +1,252 @@
+/*
+ * test_gps_geofence.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "gps.h"
+#include "test.h"
+#include "types.h"
+#include <math.h>
+
+/*** TEST GPS GEOFENCE local macros ***/
+
+#define TEST_COORDINATE_SCALE           10000000.0
+// Equatorial radius matching the 1e-7 degree arc length used by the driver.
+#define TEST_EARTH_RADIUS_M             6378137.0
+#define TEST_METERS_PER_DEGREE          ((TEST_EARTH_RADIUS_M * M_PI) / 180.0)
+
+#define TEST_DISTANCE_TOLERANCE_M       2.0
+#define TEST_DISTANCE_TOLERANCE_RATIO   0.003
+
+#define TEST_POLYGON_VERTICES_MAX       8
+
+/*** TEST GPS GEOFENCE local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    double latitude_degrees;
+    double longitude_degrees;
+} TEST_point_t;
+
+/*******************************************************************/
+typedef struct {
+    // Start point and constant step in meters.
+    TEST_point_t start;
+    double east_step_m;
+    double north_step_m;
+    uint32_t number_of_points;
+} TEST_track_t;
+
+/*******************************************************************/
+typedef struct {
+    TEST_point_t center;
+    uint32_t radius_m;
+    TEST_track_t track;
+    uint32_t expected_transitions;
+} TEST_circle_t;
+
+/*******************************************************************/
+typedef struct {
+    // Vertices in meters around the origin.
+    TEST_point_t origin;
+    double vertices_m[TEST_POLYGON_VERTICES_MAX][2];
+    uint8_t number_of_vertices;
+    // Track in meters around the origin.
+    double track_east_start_m;
+    double track_north_m;
+    double track_east_step_m;
+    uint32_t track_number_of_points;
+    uint32_t expected_inside_points;
+    uint32_t expected_transitions;
+} TEST_polygon_t;
+
+/*** TEST GPS GEOFENCE local global variables ***/
+
+static const TEST_circle_t TEST_CIRCLES[] = {
+    // Mid latitude, track passing 111m north of the center.
+    { { 48.8566, 2.3522 }, 500, { { 48.8576, 2.3250 }, 50.0, 0.0, 81 }, 2 },
+    // High latitude, diagonal track through the center.
+    { { 69.6496, 18.9560 }, 1000, { { 69.6227, 18.8776 }, 75.0, 75.0, 81 }, 2 },
+    // Track crossing the anti-meridian 532m east of the center.
+    { { -17.0000, 179.9950 }, 2000, { { -17.0000, 179.9480 }, 100.0, 0.0, 101 }, 2 },
+    // Track crossing the equator and the prime meridian.
+    { { 0.0005, -0.0005 }, 300, { { -0.0090, 0.0000 }, 0.0, 25.0, 81 }, 2 },
+    // Track never entering the fence.
+    { { 45.1885, 5.7245 }, 200, { { 45.1985, 5.7000 }, 50.0, 0.0, 41 }, 0 },
+};
+
+static const TEST_polygon_t TEST_POLYGONS[] = {
+    // Concave U shaped fence crossed through both arms.
+    { { 45.0, 6.0 }, { { 0, 0 }, { 900, 0 }, { 900, 900 }, { 600, 900 }, { 600, 300 }, { 300, 300 }, { 300, 900 }, { 0, 900 } }, 8, -275.0, 600.0, 50.0, 31, 12, 4 },
+    // Same fence crossed along its base.
+    { { 45.0, 6.0 }, { { 0, 0 }, { 900, 0 }, { 900, 900 }, { 600, 900 }, { 600, 300 }, { 300, 300 }, { 300, 900 }, { 0, 900 } }, 8, -275.0, 150.0, 50.0, 31, 18, 2 },
+    // Square fence spanning the anti-meridian.
+    { { 10.0, 180.0 }, { { -500, -500 }, { 500, -500 }, { 500, 500 }, { -500, 500 } }, 4, -975.0, 0.0, 50.0, 40, 20, 2 },
+    // Triangle fence in the southern and western hemispheres.
+    { { -33.45, -70.66 }, { { 0, 0 }, { 1000, 0 }, { 0, 1000 } }, 3, -225.0, 250.0, 50.0, 30, 15, 2 },
+};
+
+/*** TEST GPS GEOFENCE local functions ***/
+
+/*******************************************************************/
+static double _TEST_normalize_longitude(double longitude_degrees) {
+    while (longitude_degrees >= 180.0) {
+        longitude_degrees -= 360.0;
+    }
+    while (longitude_degrees < -180.0) {
+        longitude_degrees += 360.0;
+    }
+    return longitude_degrees;
+}
+
+/*******************************************************************/
+static void _TEST_convert_point(const TEST_point_t* point, GPS_coordinates_t* coordinates) {
+    coordinates->latitude = (int32_t) lround(point->latitude_degrees * TEST_COORDINATE_SCALE);
+    coordinates->longitude = (int32_t) lround(_TEST_normalize_longitude(point->longitude_degrees) * TEST_COORDINATE_SCALE);
+}
+
+/*******************************************************************/
+static void _TEST_offset_point(const TEST_point_t* origin, double east_m, double north_m, double cos_latitude, TEST_point_t* point) {
+    point->latitude_degrees = origin->latitude_degrees + (north_m / TEST_METERS_PER_DEGREE);
+    point->longitude_degrees = _TEST_normalize_longitude(origin->longitude_degrees + (east_m / (TEST_METERS_PER_DEGREE * cos_latitude)));
+}
+
+/*******************************************************************/
+static double _TEST_get_reference_distance(GPS_coordinates_t* point_1, GPS_coordinates_t* point_2) {
+    // Local variables.
+    double latitude_1 = ((point_1->latitude) / TEST_COORDINATE_SCALE) * (M_PI / 180.0);
+    double latitude_2 = ((point_2->latitude) / TEST_COORDINATE_SCALE) * (M_PI / 180.0);
+    double delta_latitude = latitude_2 - latitude_1;
+    double delta_longitude = (((point_2->longitude) - (double) (point_1->longitude)) / TEST_COORDINATE_SCALE) * (M_PI / 180.0);
+    double a = 0.0;
+    // Haversine formula.
+    a = pow(sin(delta_latitude / 2.0), 2) + (cos(latitude_1) * cos(latitude_2) * pow(sin(delta_longitude / 2.0), 2));
+    return (2.0 * TEST_EARTH_RADIUS_M * asin(sqrt(a)));
+}
+
+/*******************************************************************/
+static void _TEST_circle(const TEST_circle_t* circle) {
+    // Local variables.
+    GPS_coordinates_t center;
+    GPS_coordinates_t coordinates;
+    TEST_point_t point;
+    double tolerance_m = 0.0;
+    double reference_m = 0.0;
+    uint32_t distance_m = 0;
+    uint8_t inside = 0;
+    uint8_t previous_inside = 0;
+    uint32_t transitions = 0;
+    uint32_t idx = 0;
+    _TEST_convert_point(&(circle->center), &center);
+    for (idx = 0; idx < (circle->track.number_of_points); idx++) {
+        _TEST_offset_point(&(circle->track.start), (idx * circle->track.east_step_m), (idx * circle->track.north_step_m), cos(circle->track.start.latitude_degrees * (M_PI / 180.0)), &point);
+        _TEST_convert_point(&point, &coordinates);
+        // Compare fixed point distance with the haversine reference.
+        TEST_assert_equal(GPS_get_distance(&center, &coordinates, &distance_m), GPS_SUCCESS);
+        reference_m = _TEST_get_reference_distance(&center, &coordinates);
+        tolerance_m = TEST_DISTANCE_TOLERANCE_M + (reference_m * TEST_DISTANCE_TOLERANCE_RATIO);
+        TEST_assert(fabs(distance_m - reference_m) <= tolerance_m);
+        // Inside state must match the reference out of the tolerance band.
+        inside = (distance_m <= circle->radius_m) ? 1 : 0;
+        if (fabs(reference_m - circle->radius_m) > tolerance_m) {
+            TEST_assert_equal(inside, ((reference_m <= circle->radius_m) ? 1 : 0));
+        }
+        if ((idx > 0) && (inside != previous_inside)) {
+            transitions++;
+        }
+        previous_inside = inside;
+    }
+    TEST_assert_equal(transitions, circle->expected_transitions);
+}
+
+/*******************************************************************/
+static void _TEST_polygon(const TEST_polygon_t* polygon) {
+    // Local variables.
+    GPS_coordinates_t vertices[TEST_POLYGON_VERTICES_MAX];
+    GPS_coordinates_t coordinates;
+    TEST_point_t point;
+    double cos_latitude = cos(polygon->origin.latitude_degrees * (M_PI / 180.0));
+    uint8_t inside = 0;
+    uint8_t previous_inside = 0;
+    uint32_t inside_points = 0;
+    uint32_t transitions = 0;
+    uint32_t idx = 0;
+    // Same local projection for vertices and track.
+    for (idx = 0; idx < (polygon->number_of_vertices); idx++) {
+        _TEST_offset_point(&(polygon->origin), polygon->vertices_m[idx][0], polygon->vertices_m[idx][1], cos_latitude, &point);
+        _TEST_convert_point(&point, &(vertices[idx]));
+    }
+    for (idx = 0; idx < (polygon->track_number_of_points); idx++) {
+        _TEST_offset_point(&(polygon->origin), (polygon->track_east_start_m + (idx * polygon->track_east_step_m)), polygon->track_north_m, cos_latitude, &point);
+        _TEST_convert_point(&point, &coordinates);
+        TEST_assert_equal(GPS_is_inside_polygon(&coordinates, vertices, polygon->number_of_vertices, &inside), GPS_SUCCESS);
+        inside_points += inside;
+        if ((idx > 0) && (inside != previous_inside)) {
+            transitions++;
+        }
+        previous_inside = inside;
+    }
+    TEST_assert_equal(inside_points, polygon->expected_inside_points);
+    TEST_assert_equal(transitions, polygon->expected_transitions);
+}
+
+/*******************************************************************/
+static void _TEST_polygon_vertex_ray(void) {
+    // Local variables.
+    const TEST_polygon_t* polygon = &(TEST_POLYGONS[0]);
+    GPS_coordinates_t vertices[TEST_POLYGON_VERTICES_MAX];
+    GPS_coordinates_t coordinates;
+    TEST_point_t point;
+    double cos_latitude = cos(polygon->origin.latitude_degrees * (M_PI / 180.0));
+    uint8_t inside = 0;
+    uint32_t idx = 0;
+    for (idx = 0; idx < (polygon->number_of_vertices); idx++) {
+        _TEST_offset_point(&(polygon->origin), polygon->vertices_m[idx][0], polygon->vertices_m[idx][1], cos_latitude, &point);
+        _TEST_convert_point(&point, &(vertices[idx]));
+    }
+    // Point of the left arm whose ray runs along the bottom edge of the notch.
+    coordinates.latitude = vertices[5].latitude;
+    coordinates.longitude = (vertices[0].longitude + vertices[5].longitude) / 2;
+    TEST_assert_equal(GPS_is_inside_polygon(&coordinates, vertices, polygon->number_of_vertices, &inside), GPS_SUCCESS);
+    TEST_assert_equal(inside, 1);
+    // Same latitude in the notch.
+    coordinates.latitude = vertices[5].latitude + 1000;
+    coordinates.longitude = (vertices[4].longitude + vertices[5].longitude) / 2;
+    TEST_assert_equal(GPS_is_inside_polygon(&coordinates, vertices, polygon->number_of_vertices, &inside), GPS_SUCCESS);
+    TEST_assert_equal(inside, 0);
+}
+
+/*******************************************************************/
+static void _TEST_errors(void) {
+    // Local variables.
+    GPS_coordinates_t vertices[3] = { { 0, 0 }, { 10000, 0 }, { 0, 10000 } };
+    GPS_coordinates_t coordinates = { 1000, 1000 };
+    uint32_t distance_m = 0;
+    uint8_t inside = 0;
+    TEST_assert_equal(GPS_get_distance(NULL, &coordinates, &distance_m), GPS_ERROR_NULL_PARAMETER);
+    TEST_assert_equal(GPS_get_distance(&coordinates, &coordinates, NULL), GPS_ERROR_NULL_PARAMETER);
+    TEST_assert_equal(GPS_is_inside_polygon(&coordinates, NULL, 3, &inside), GPS_ERROR_NULL_PARAMETER);
+    TEST_assert_equal(GPS_is_inside_polygon(&coordinates, vertices, 2, &inside), GPS_ERROR_GEOFENCE_VERTEX_COUNT);
+    // Same point.
+    TEST_assert_equal(GPS_get_distance(&coordinates, &coordinates, &distance_m), GPS_SUCCESS);
+    TEST_assert_equal(distance_m, 0);
+}
+
+/*** TEST GPS GEOFENCE functions ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    for (idx = 0; idx < (sizeof(TEST_CIRCLES) / sizeof(TEST_circle_t)); idx++) {
+        _TEST_circle(&(TEST_CIRCLES[idx]));
+    }
+    for (idx = 0; idx < (sizeof(TEST_POLYGONS) / sizeof(TEST_polygon_t)); idx++) {
+        _TEST_polygon(&(TEST_POLYGONS[idx]));
+    }
+    _TEST_polygon_vertex_ray();
+    _TEST_errors();
+    return TEST_report("test_gps_geofence");
+}
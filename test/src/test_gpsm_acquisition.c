@@ -0,0 +1,349 @@
+/*
+ * test_gpsm_acquisition.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "gps.h"
+#include "gpsm.h"
+#include "node.h"
+#include "power.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST GPSM ACQUISITION local macros ***/
+
+#define TEST_UBX_FRAME_OVERHEAD_BYTES   8
+#define TEST_UBX_CLASS_NAV              0x01
+#define TEST_UBX_ID_NAV_DOP             0x04
+#define TEST_UBX_ID_NAV_PVT             0x07
+#define TEST_UBX_ID_NAV_TIMEUTC         0x21
+#define TEST_UBX_ID_NAV_SAT             0x35
+#define TEST_UBX_ID_NAV_AOPSTATUS       0x60
+
+#define TEST_NAV_PVT_PAYLOAD_SIZE       92
+#define TEST_NAV_TIMEUTC_PAYLOAD_SIZE   20
+#define TEST_NAV_DOP_PAYLOAD_SIZE       18
+#define TEST_NAV_SAT_HEADER_SIZE        8
+#define TEST_NAV_SAT_BLOCK_SIZE         12
+#define TEST_NAV_SAT_NUMBER_OF_BLOCKS   3
+#define TEST_NAV_AOPSTATUS_PAYLOAD_SIZE 16
+#define TEST_NAV_TIMEUTC_VALID_UTC      0x04
+
+#define TEST_TIME_TIMEOUT_SECONDS       20
+#define TEST_GEOLOC_TIMEOUT_SECONDS     40
+#define TEST_START_TIME_SECONDS         1000
+
+// Aiding configuration, then receiver acquisition start.
+#define TEST_START_SEQUENCE_LENGTH      2
+
+/*** TEST GPSM ACQUISITION local global variables ***/
+
+// NMEA sentence output by the receiver before the UBX configuration is applied.
+static const char_t TEST_NMEA_SENTENCE[] = "$GNGGA,101512.00,4511.31020,N,00543.47082,E,1,10,0.92,212.4,M,48.3,M,,*4E\r\n";
+
+static uint32_t test_time_seconds = 0;
+
+/*** TEST GPSM ACQUISITION local functions ***/
+
+/*******************************************************************/
+static void _TEST_write_u16(uint8_t* payload, uint8_t offset, uint16_t value) {
+    payload[offset + 0] = (uint8_t) ((value >> 0) & 0xFF);
+    payload[offset + 1] = (uint8_t) ((value >> 8) & 0xFF);
+}
+
+/*******************************************************************/
+static void _TEST_write_u32(uint8_t* payload, uint8_t offset, uint32_t value) {
+    payload[offset + 0] = (uint8_t) ((value >> 0) & 0xFF);
+    payload[offset + 1] = (uint8_t) ((value >> 8) & 0xFF);
+    payload[offset + 2] = (uint8_t) ((value >> 16) & 0xFF);
+    payload[offset + 3] = (uint8_t) ((value >> 24) & 0xFF);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return SWREG_read_field(reg_value, field_mask);
+}
+
+/*******************************************************************/
+static void _TEST_add_poll_replies(void) {
+    // Local variables.
+    uint8_t payload[TEST_NAV_SAT_HEADER_SIZE + (TEST_NAV_SAT_NUMBER_OF_BLOCKS * TEST_NAV_SAT_BLOCK_SIZE)] = { 0x00 };
+    uint8_t frame[TEST_NAV_SAT_HEADER_SIZE + (TEST_NAV_SAT_NUMBER_OF_BLOCKS * TEST_NAV_SAT_BLOCK_SIZE) + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t frame_size = 0;
+    // NAV-DOP: PDOP 1.61, HDOP 0.92.
+    _TEST_write_u16(payload, 6, 161);
+    _TEST_write_u16(payload, 12, 92);
+    frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_DOP, payload, TEST_NAV_DOP_PAYLOAD_SIZE, frame);
+    FAKE_gps_add_reply(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_DOP, frame, frame_size);
+    // NAV-SAT: two GPS satellites used, one GLONASS satellite tracked.
+    payload[4] = 0x01;
+    payload[5] = TEST_NAV_SAT_NUMBER_OF_BLOCKS;
+    payload[TEST_NAV_SAT_HEADER_SIZE + 0] = 0;
+    payload[TEST_NAV_SAT_HEADER_SIZE + 2] = 42;
+    payload[TEST_NAV_SAT_HEADER_SIZE + 8] = 0x0F;
+    payload[TEST_NAV_SAT_HEADER_SIZE + TEST_NAV_SAT_BLOCK_SIZE + 0] = 0;
+    payload[TEST_NAV_SAT_HEADER_SIZE + TEST_NAV_SAT_BLOCK_SIZE + 2] = 38;
+    payload[TEST_NAV_SAT_HEADER_SIZE + TEST_NAV_SAT_BLOCK_SIZE + 8] = 0x0F;
+    payload[TEST_NAV_SAT_HEADER_SIZE + (2 * TEST_NAV_SAT_BLOCK_SIZE) + 0] = 6;
+    payload[TEST_NAV_SAT_HEADER_SIZE + (2 * TEST_NAV_SAT_BLOCK_SIZE) + 2] = 29;
+    payload[TEST_NAV_SAT_HEADER_SIZE + (2 * TEST_NAV_SAT_BLOCK_SIZE) + 8] = 0x04;
+    frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_SAT, payload, (uint16_t) sizeof(payload), frame);
+    FAKE_gps_add_reply(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_SAT, frame, frame_size);
+    // NAV-AOPSTATUS: orbits computation running.
+    payload[5] = 0x01;
+    frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_AOPSTATUS, payload, TEST_NAV_AOPSTATUS_PAYLOAD_SIZE, frame);
+    FAKE_gps_add_reply(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_AOPSTATUS, frame, frame_size);
+}
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    FAKE_reset();
+    NODE_init();
+    // Receiver interface is initialized by the power driver on the board.
+    TEST_assert_equal(GPS_init(), GPS_SUCCESS);
+    test_time_seconds = TEST_START_TIME_SECONDS;
+    FAKE_set_uptime_seconds(test_time_seconds);
+    // Acquisition timeouts and autonomous aiding.
+    SWREG_write_field(&reg_value, &reg_mask, TEST_TIME_TIMEOUT_SECONDS, GPSM_REGISTER_CONFIGURATION_1_MASK_TIME_TIMEOUT);
+    SWREG_write_field(&reg_value, &reg_mask, TEST_GEOLOC_TIMEOUT_SECONDS, GPSM_REGISTER_CONFIGURATION_1_MASK_GEOLOC_TIMEOUT);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_CONFIGURATION_1, reg_value, reg_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_MGA_CONFIGURATION, GPSM_REGISTER_MGA_CONFIGURATION_MASK_AOPEN, GPSM_REGISTER_MGA_CONFIGURATION_MASK_AOPEN);
+    _TEST_add_poll_replies();
+}
+
+/*******************************************************************/
+static void _TEST_start(uint32_t trigger_mask, uint32_t in_progress_mask) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Trigger only arms the sequence.
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, trigger_mask, trigger_mask), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, in_progress_mask), 1);
+    TEST_assert_equal(fake_gps.tx_message_count, 0);
+    // One receiver exchange per process call.
+    for (idx = 0; idx < TEST_START_SEQUENCE_LENGTH; idx++) {
+        TEST_assert_equal(NODE_get_state(), NODE_STATE_BUSY);
+        TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    }
+    // CFG-NAVX5, then CFG-PRT and CFG-MSG.
+    TEST_assert_equal(fake_gps.tx_message_count, 3);
+    TEST_assert_equal(NODE_get_state(), NODE_STATE_RUNNING);
+}
+
+/*******************************************************************/
+static void _TEST_send_epoch(uint8_t* frame, uint32_t frame_size) {
+    // Next navigation epoch.
+    test_time_seconds++;
+    FAKE_set_uptime_seconds(test_time_seconds);
+    FAKE_gps_receive((uint8_t*) TEST_NMEA_SENTENCE, (sizeof(TEST_NMEA_SENTENCE) - 1));
+    FAKE_gps_receive(frame, frame_size);
+    TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_build_time(uint8_t valid, uint8_t* frame) {
+    // Local variables.
+    uint8_t payload[TEST_NAV_TIMEUTC_PAYLOAD_SIZE] = { 0x00 };
+    // 19 oct. 2026 10:15:12 UTC at the first epoch.
+    _TEST_write_u16(payload, 12, 2026);
+    payload[14] = 10;
+    payload[15] = 19;
+    payload[16] = 10;
+    payload[17] = 15;
+    payload[18] = (uint8_t) (12 + (test_time_seconds - TEST_START_TIME_SECONDS));
+    payload[19] = (valid == 0) ? 0x00 : TEST_NAV_TIMEUTC_VALID_UTC;
+    return FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_TIMEUTC, payload, TEST_NAV_TIMEUTC_PAYLOAD_SIZE, frame);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_build_position(uint8_t fix_type, uint8_t* frame) {
+    // Local variables.
+    uint8_t payload[TEST_NAV_PVT_PAYLOAD_SIZE] = { 0x00 };
+    // 45.1885N 5.7245E, 212m.
+    payload[20] = fix_type;
+    payload[21] = (fix_type >= 2) ? 0x01 : 0x00;
+    payload[23] = 10;
+    _TEST_write_u32(payload, 24, 57245000);
+    _TEST_write_u32(payload, 28, 451885000);
+    _TEST_write_u32(payload, 36, 212000);
+    _TEST_write_u32(payload, 40, 2600);
+    _TEST_write_u16(payload, 76, 161);
+    return FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_PVT, payload, TEST_NAV_PVT_PAYLOAD_SIZE, frame);
+}
+
+/*******************************************************************/
+static void _TEST_check_report(void) {
+    // Local variables.
+    uint32_t tx_message_count = 0;
+    // Receiver is polled once per process call before turning GPS off.
+    TEST_assert_equal(NODE_get_state(), NODE_STATE_BUSY);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_QUALITY_DATA_0, GPSM_REGISTER_QUALITY_DATA_0_MASK_QDV), 0);
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_GPS), 1);
+    // Quality step: NAV-DOP and NAV-SAT.
+    tx_message_count = fake_gps.tx_message_count;
+    TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    TEST_assert_equal((fake_gps.tx_message_count - tx_message_count), 2);
+    TEST_assert_equal(NODE_get_state(), NODE_STATE_BUSY);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_QUALITY_DATA_0, GPSM_REGISTER_QUALITY_DATA_0_MASK_QDV), 1);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_QUALITY_DATA_0, GPSM_REGISTER_QUALITY_DATA_0_MASK_SV_USED), 2);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_QUALITY_DATA_0, GPSM_REGISTER_QUALITY_DATA_0_MASK_SV_TRACKED), 3);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_QUALITY_DATA_1, GPSM_REGISTER_QUALITY_DATA_1_MASK_PDOP), 161);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_QUALITY_DATA_1, GPSM_REGISTER_QUALITY_DATA_1_MASK_HDOP), 92);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_QUALITY_DATA_2, GPSM_REGISTER_QUALITY_DATA_2_MASK_GPS_CN0_MAX), 42);
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_GPS), 1);
+    // Autonomous aiding step: NAV-AOPSTATUS, then GPS off.
+    tx_message_count = fake_gps.tx_message_count;
+    TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    TEST_assert_equal((fake_gps.tx_message_count - tx_message_count), 1);
+    // Orbits computation stops with the receiver.
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_MGA_STATUS, GPSM_REGISTER_MGA_STATUS_MASK_AOPST), 0);
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_GPS), 0);
+    TEST_assert_equal(NODE_get_state(), NODE_STATE_IDLE);
+}
+
+/*******************************************************************/
+static void _TEST_time_fix(void) {
+    // Local variables.
+    uint8_t frame[TEST_NAV_TIMEUTC_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t frame_size = 0;
+    uint32_t idx = 0;
+    _TEST_init();
+    _TEST_start(GPSM_REGISTER_CONTROL_1_MASK_TTRG, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TIP);
+    // Another acquisition can not be started meanwhile.
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, GPSM_REGISTER_CONTROL_1_MASK_GTRG, GPSM_REGISTER_CONTROL_1_MASK_GTRG), NODE_ERROR_GPS_STATE);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP), 0);
+    // UTC time is not valid before the leap seconds are known.
+    for (idx = 0; idx < 5; idx++) {
+        frame_size = _TEST_build_time(0, frame);
+        _TEST_send_epoch(frame, frame_size);
+        TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TIP), 1);
+        TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_ELAPSED_TIME), (idx + 1));
+        TEST_assert_equal(NODE_get_state(), NODE_STATE_RUNNING);
+    }
+    frame_size = _TEST_build_time(1, frame);
+    _TEST_send_epoch(frame, frame_size);
+    // TIP -> TFX.
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TIP), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TFX), 1);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TTO), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_ELAPSED_TIME), 6);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_STATUS_1, GPSM_REGISTER_STATUS_1_MASK_TFS), 1);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_TIME_DATA_0, GPSM_REGISTER_TIME_DATA_0_MASK_YEAR), 26);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_TIME_DATA_0, GPSM_REGISTER_TIME_DATA_0_MASK_MONTH), 10);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_TIME_DATA_0, GPSM_REGISTER_TIME_DATA_0_MASK_DATE), 19);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_TIME_DATA_1, GPSM_REGISTER_TIME_DATA_1_MASK_HOUR), 10);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_TIME_DATA_1, GPSM_REGISTER_TIME_DATA_1_MASK_MINUTE), 15);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_TIME_DATA_1, GPSM_REGISTER_TIME_DATA_1_MASK_SECOND), 17);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_TIME_DATA_2, GPSM_REGISTER_TIME_DATA_2_MASK_FIX_DURATION), 6);
+    _TEST_check_report();
+}
+
+/*******************************************************************/
+static void _TEST_time_timeout(void) {
+    // Local variables.
+    uint8_t frame[TEST_NAV_TIMEUTC_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t frame_size = 0;
+    uint32_t idx = 0;
+    _TEST_init();
+    _TEST_start(GPSM_REGISTER_CONTROL_1_MASK_TTRG, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TIP);
+    // Receiver never gets a valid time.
+    for (idx = 0; idx < (TEST_TIME_TIMEOUT_SECONDS - 1); idx++) {
+        frame_size = _TEST_build_time(0, frame);
+        _TEST_send_epoch(frame, frame_size);
+        TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TIP), 1);
+    }
+    frame_size = _TEST_build_time(0, frame);
+    _TEST_send_epoch(frame, frame_size);
+    // TIP -> TTO.
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TIP), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TFX), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_TTO), 1);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_ELAPSED_TIME), TEST_TIME_TIMEOUT_SECONDS);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_STATUS_1, GPSM_REGISTER_STATUS_1_MASK_TFS), 0);
+    // Receiver state is reported whatever the result.
+    _TEST_check_report();
+}
+
+/*******************************************************************/
+static void _TEST_geoloc_fix(void) {
+    // Local variables.
+    uint8_t frame[TEST_NAV_PVT_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t frame_size = 0;
+    uint32_t idx = 0;
+    _TEST_init();
+    _TEST_start(GPSM_REGISTER_CONTROL_1_MASK_GTRG, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP);
+    // No fix, then 2D fix.
+    for (idx = 0; idx < 8; idx++) {
+        frame_size = _TEST_build_position(((idx < 6) ? 0 : 2), frame);
+        _TEST_send_epoch(frame, frame_size);
+        TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP), 1);
+    }
+    // First 3D fix only initializes the altitude stability filter.
+    frame_size = _TEST_build_position(3, frame);
+    _TEST_send_epoch(frame, frame_size);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP), 1);
+    _TEST_send_epoch(frame, frame_size);
+    // GIP -> GFX.
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GFX), 1);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GTO), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_ELAPSED_TIME), 10);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_STATUS_1, GPSM_REGISTER_STATUS_1_MASK_GFS), 1);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_0, GPSM_REGISTER_GEOLOC_DATA_0_MASK_DEGREE), 45);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_0, GPSM_REGISTER_GEOLOC_DATA_0_MASK_MINUTE), 11);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_0, GPSM_REGISTER_GEOLOC_DATA_0_MASK_SECOND), 18600);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_0, GPSM_REGISTER_GEOLOC_DATA_0_MASK_NF), 1);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_1, GPSM_REGISTER_GEOLOC_DATA_1_MASK_DEGREE), 5);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_1, GPSM_REGISTER_GEOLOC_DATA_1_MASK_MINUTE), 43);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_1, GPSM_REGISTER_GEOLOC_DATA_1_MASK_SECOND), 28200);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_1, GPSM_REGISTER_GEOLOC_DATA_1_MASK_EF), 1);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_2, GPSM_REGISTER_GEOLOC_DATA_2_MASK_ALTITUDE), 212);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_3, GPSM_REGISTER_GEOLOC_DATA_3_MASK_FIX_DURATION), 10);
+    _TEST_check_report();
+}
+
+/*******************************************************************/
+static void _TEST_geoloc_timeout(void) {
+    // Local variables.
+    uint8_t frame[TEST_NAV_PVT_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t frame_size = 0;
+    uint32_t idx = 0;
+    _TEST_init();
+    _TEST_start(GPSM_REGISTER_CONTROL_1_MASK_GTRG, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP);
+    // Indoor: 2D fix at best.
+    for (idx = 0; idx < TEST_GEOLOC_TIMEOUT_SECONDS; idx++) {
+        TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP), 1);
+        frame_size = _TEST_build_position(((idx < 10) ? 0 : 2), frame);
+        _TEST_send_epoch(frame, frame_size);
+    }
+    // GIP -> GTO.
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GFX), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GTO), 1);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_ELAPSED_TIME), TEST_GEOLOC_TIMEOUT_SECONDS);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_STATUS_1, GPSM_REGISTER_STATUS_1_MASK_GFS), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_2, GPSM_REGISTER_GEOLOC_DATA_2_MASK_ALTITUDE), 0);
+    _TEST_check_report();
+}
+
+/*** TEST GPSM ACQUISITION functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_time_fix();
+    _TEST_time_timeout();
+    _TEST_geoloc_fix();
+    _TEST_geoloc_timeout();
+    return TEST_report("test_gpsm_acquisition");
+}
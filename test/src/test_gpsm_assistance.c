@@ -0,0 +1,219 @@
+/*
+ * test_gpsm_assistance.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "gpsm.h"
+#include "node.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST GPSM ASSISTANCE local macros ***/
+
+#define TEST_UBX_FRAME_OVERHEAD_BYTES   8
+#define TEST_UBX_CLASS_MGA              0x13
+#define TEST_UBX_ID_MGA_GPS             0x00
+#define TEST_UBX_ID_MGA_INI             0x40
+
+#define TEST_MGA_INI_TIME_UTC_SIZE      24
+#define TEST_MGA_INI_POS_LLH_SIZE       20
+#define TEST_MGA_GPS_EPH_SIZE           68
+#define TEST_MGA_NUMBER_OF_MESSAGES     3
+#define TEST_MGA_STREAM_SIZE_BYTES      ((TEST_MGA_INI_TIME_UTC_SIZE + TEST_MGA_INI_POS_LLH_SIZE + TEST_MGA_GPS_EPH_SIZE) + (TEST_MGA_NUMBER_OF_MESSAGES * TEST_UBX_FRAME_OVERHEAD_BYTES))
+
+#define TEST_MGA_WINDOW_SIZE_BYTES      (GPSM_MGA_WINDOW_NUMBER_OF_REGISTERS * 4)
+
+#define TEST_LOOP_COUNT_MAX             100
+
+/*** TEST GPSM ASSISTANCE local global variables ***/
+
+// AssistNow Online reply: MGA-INI-TIME_UTC (19 oct. 2026 12:00:00, leap seconds 18).
+static const uint8_t TEST_MGA_INI_TIME_UTC[TEST_MGA_INI_TIME_UTC_SIZE] = {
+    0x10, 0x00, 0x00, 0x12, 0xEA, 0x07, 0x0A, 0x13, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+// MGA-INI-POS_LLH (48.8566N 2.3522E, 35m, 3km accuracy).
+static const uint8_t TEST_MGA_INI_POS_LLH[TEST_MGA_INI_POS_LLH_SIZE] = {
+    0x01, 0x00, 0x00, 0x00, 0xF0, 0x9A, 0x1F, 0x1D, 0xD0, 0xEA, 0x66, 0x01,
+    0xAC, 0x0D, 0x00, 0x00, 0xE0, 0x93, 0x04, 0x00
+};
+// MGA-GPS-EPH of satellite 5.
+static const uint8_t TEST_MGA_GPS_EPH[TEST_MGA_GPS_EPH_SIZE] = {
+    0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x37, 0x38,
+    0x7C, 0x00, 0x8A, 0x11, 0x4D, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0xB2, 0x16,
+    0x0A, 0xFF, 0x5C, 0x34, 0x6A, 0x0D, 0x3F, 0xCA, 0x91, 0x06, 0x2C, 0x03,
+    0x9D, 0x22, 0x17, 0x0E, 0x72, 0x0A, 0x10, 0x0C, 0xA1, 0xA1, 0x0D, 0x28,
+    0x3E, 0x00, 0xD4, 0xFF, 0x6B, 0x15, 0xE8, 0x1F, 0x88, 0x1A, 0x2A, 0x32,
+    0xFC, 0xFF, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00
+};
+
+/*** TEST GPSM ASSISTANCE local functions ***/
+
+/*******************************************************************/
+static uint32_t _TEST_build_stream(uint8_t* stream) {
+    // Local variables.
+    uint32_t stream_size = 0;
+    // Messages are injected in the order of the service reply.
+    stream_size += FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_MGA, TEST_UBX_ID_MGA_INI, (uint8_t*) TEST_MGA_INI_TIME_UTC, TEST_MGA_INI_TIME_UTC_SIZE, &(stream[stream_size]));
+    stream_size += FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_MGA, TEST_UBX_ID_MGA_INI, (uint8_t*) TEST_MGA_INI_POS_LLH, TEST_MGA_INI_POS_LLH_SIZE, &(stream[stream_size]));
+    stream_size += FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_MGA, TEST_UBX_ID_MGA_GPS, (uint8_t*) TEST_MGA_GPS_EPH, TEST_MGA_GPS_EPH_SIZE, &(stream[stream_size]));
+    return stream_size;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return SWREG_read_field(reg_value, field_mask);
+}
+
+/*******************************************************************/
+static void _TEST_append(uint8_t* data, uint32_t size_bytes) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint32_t idx = 0;
+    // Fill data window, least significant byte first.
+    for (idx = 0; idx < size_bytes; idx += 4) {
+        reg_value = (uint32_t) (data[idx] | (data[idx + 1] << 8) | (data[idx + 2] << 16) | ((uint32_t) data[idx + 3] << 24));
+        NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, (GPSM_REGISTER_ADDRESS_MGA_DATA_0 + (idx / 4)), reg_value, UNA_REGISTER_MASK_ALL);
+    }
+    // Append window content.
+    reg_value = 0;
+    SWREG_write_field(&reg_value, &reg_mask, 0b1, GPSM_REGISTER_MGA_CONTROL_MASK_MGAPP);
+    SWREG_write_field(&reg_value, &reg_mask, size_bytes, GPSM_REGISTER_MGA_CONTROL_MASK_LENGTH);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_MGA_CONTROL, reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static void _TEST_upload(uint8_t* stream, uint32_t stream_size) {
+    // Local variables.
+    uint32_t offset = 0;
+    uint32_t size_bytes = 0;
+    // Upload stream window by window as the bus master does.
+    for (offset = 0; offset < stream_size; offset += TEST_MGA_WINDOW_SIZE_BYTES) {
+        size_bytes = ((stream_size - offset) > TEST_MGA_WINDOW_SIZE_BYTES) ? TEST_MGA_WINDOW_SIZE_BYTES : (stream_size - offset);
+        _TEST_append(&(stream[offset]), size_bytes);
+    }
+}
+
+/*******************************************************************/
+static uint32_t _TEST_run_main_loop(void) {
+    // Local variables.
+    uint32_t loop_count = 0;
+    uint32_t exchange_count = 0;
+    // Run main loop while the node is busy.
+    for (loop_count = 0; loop_count < TEST_LOOP_COUNT_MAX; loop_count++) {
+        if (NODE_get_state() != NODE_STATE_BUSY) break;
+        exchange_count = fake_gps.exchange_count;
+        NODE_process();
+        // Each process call must perform at most one receiver exchange.
+        TEST_assert(fake_gps.exchange_count <= (exchange_count + 1));
+    }
+    return loop_count;
+}
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    FAKE_reset();
+    NODE_init();
+}
+
+/*******************************************************************/
+static void _TEST_injection_before_acquisition(void) {
+    // Local variables.
+    uint8_t stream[TEST_MGA_STREAM_SIZE_BYTES];
+    uint32_t stream_size = 0;
+    uint32_t loop_count = 0;
+    _TEST_init();
+    // Third message is rejected by the receiver.
+    fake_gps.mga_nack_mask = 0b100;
+    stream_size = _TEST_build_stream(stream);
+    TEST_assert_equal(stream_size, TEST_MGA_STREAM_SIZE_BYTES);
+    // Data is kept while the GPS is off.
+    _TEST_upload(stream, stream_size);
+    TEST_assert_equal(fake_gps.exchange_count, 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_MGA_STATUS, GPSM_REGISTER_MGA_STATUS_MASK_LEVEL), stream_size);
+    TEST_assert_equal(GPSM_is_assistance_pending(), 0);
+    TEST_assert(NODE_get_state() != NODE_STATE_BUSY);
+    // Acquisition request only arms the sequence.
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, GPSM_REGISTER_CONTROL_1_MASK_GTRG, GPSM_REGISTER_CONTROL_1_MASK_GTRG);
+    TEST_assert_equal(fake_gps.exchange_count, 0);
+    TEST_assert_equal(GPSM_is_assistance_pending(), 1);
+    TEST_assert_equal(NODE_get_state(), NODE_STATE_BUSY);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP), 1);
+    // Aiding configuration, 3 messages and acquisition start.
+    loop_count = _TEST_run_main_loop();
+    TEST_assert_equal(loop_count, (TEST_MGA_NUMBER_OF_MESSAGES + 2));
+    TEST_assert_equal(fake_gps.aiding_configuration_count, 1);
+    TEST_assert_equal(fake_gps.mga_message_count, TEST_MGA_NUMBER_OF_MESSAGES);
+    TEST_assert_equal(fake_gps.mga_message_ids[0], TEST_UBX_ID_MGA_INI);
+    TEST_assert_equal(fake_gps.mga_message_ids[2], TEST_UBX_ID_MGA_GPS);
+    TEST_assert_equal(fake_gps.acquisition_start_count, 1);
+    TEST_assert_equal(fake_gps.acquisition_start_mga_message_count, TEST_MGA_NUMBER_OF_MESSAGES);
+    TEST_assert_equal(NODE_get_state(), NODE_STATE_RUNNING);
+    // Check status.
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_MGA_STATUS, GPSM_REGISTER_MGA_STATUS_MASK_LEVEL), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_MGA_STATUS, GPSM_REGISTER_MGA_STATUS_MASK_MGE), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_MGA_COUNTERS, GPSM_REGISTER_MGA_COUNTERS_MASK_ACK_COUNT), 2);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_MGA_COUNTERS, GPSM_REGISTER_MGA_COUNTERS_MASK_NACK_COUNT), 1);
+}
+
+/*******************************************************************/
+static void _TEST_injection_while_powered(void) {
+    // Local variables.
+    uint8_t stream[TEST_MGA_STREAM_SIZE_BYTES];
+    uint32_t stream_size = 0;
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    _TEST_init();
+    stream_size = _TEST_build_stream(stream);
+    // Keep the receiver on through the PWEN bit.
+    SWREG_write_field(&reg_value, &reg_mask, 0b1, GPSM_REGISTER_CONTROL_1_MASK_PWMD);
+    SWREG_write_field(&reg_value, &reg_mask, 0b1, GPSM_REGISTER_CONTROL_1_MASK_PWEN);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, reg_value, UNA_REGISTER_MASK_ALL);
+    TEST_assert_equal(NODE_get_state(), NODE_STATE_BUSY);
+    _TEST_run_main_loop();
+    TEST_assert_equal(fake_gps.aiding_configuration_count, 1);
+    // First window only contains a complete MGA-INI message.
+    _TEST_append(stream, TEST_MGA_WINDOW_SIZE_BYTES);
+    TEST_assert_equal(fake_gps.mga_message_count, 0);
+    TEST_assert_equal(NODE_get_state(), NODE_STATE_BUSY);
+    _TEST_run_main_loop();
+    TEST_assert_equal(fake_gps.mga_message_count, 1);
+    // Partial message waits for the next window without any exchange.
+    _TEST_append(&(stream[TEST_MGA_WINDOW_SIZE_BYTES]), TEST_MGA_WINDOW_SIZE_BYTES);
+    _TEST_run_main_loop();
+    TEST_assert_equal(fake_gps.mga_message_count, 2);
+    TEST_assert(GPSM_is_assistance_pending() == 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_MGA_STATUS, GPSM_REGISTER_MGA_STATUS_MASK_LEVEL), (2 * TEST_MGA_WINDOW_SIZE_BYTES) - (TEST_MGA_INI_TIME_UTC_SIZE + TEST_MGA_INI_POS_LLH_SIZE + (2 * TEST_UBX_FRAME_OVERHEAD_BYTES)));
+    // Aiding configuration update is also deferred.
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_MGA_CONFIGURATION, 0, GPSM_REGISTER_MGA_CONFIGURATION_MASK_AOPEN);
+    TEST_assert_equal(fake_gps.aiding_configuration_count, 1);
+    _TEST_run_main_loop();
+    TEST_assert_equal(fake_gps.aiding_configuration_count, 2);
+    TEST_assert_equal(fake_gps.autonomous_aiding_enable, 0);
+    // End of stream.
+    _TEST_upload(&(stream[2 * TEST_MGA_WINDOW_SIZE_BYTES]), (stream_size - (2 * TEST_MGA_WINDOW_SIZE_BYTES)));
+    _TEST_run_main_loop();
+    TEST_assert_equal(fake_gps.mga_message_count, TEST_MGA_NUMBER_OF_MESSAGES);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_MGA_STATUS, GPSM_REGISTER_MGA_STATUS_MASK_LEVEL), 0);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_MGA_COUNTERS, GPSM_REGISTER_MGA_COUNTERS_MASK_ACK_COUNT), TEST_MGA_NUMBER_OF_MESSAGES);
+    TEST_assert(NODE_get_state() != NODE_STATE_BUSY);
+}
+
+/*** TEST GPSM ASSISTANCE functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_injection_before_acquisition();
+    _TEST_injection_while_powered();
+    return TEST_report("test_gpsm_assistance");
+}
@@ -0,0 +1,292 @@
+/*
+ * test_gpsm_hot_start.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "gps.h"
+#include "gpsm.h"
+#include "node.h"
+#include "power.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST GPSM HOT START local macros ***/
+
+#define TEST_UBX_FRAME_OVERHEAD_BYTES   8
+#define TEST_UBX_CLASS_NAV              0x01
+#define TEST_UBX_ID_NAV_PVT             0x07
+#define TEST_NAV_PVT_PAYLOAD_SIZE       92
+#define TEST_NAV_PVT_FIX_TYPE_3D        3
+
+#define TEST_GEOLOC_TIMEOUT_SECONDS     60
+#define TEST_START_TIME_SECONDS         1000
+#define TEST_IDLE_PROCESS_PERIOD_SECONDS 10
+
+// Aiding data lifetimes of the receiver, mirrored by the GPSM windows.
+#define TEST_HOT_WINDOW_SECONDS         120
+#define TEST_WARM_WINDOW_SECONDS        1800
+
+// Receiver time to first fix for each start type.
+#define TEST_RECEIVER_TTFF_HOT_SECONDS  1
+#define TEST_RECEIVER_TTFF_WARM_SECONDS 20
+#define TEST_RECEIVER_TTFF_COLD_SECONDS 29
+// GPSM waits for a second fix with a stable altitude.
+#define TEST_ALTITUDE_FILTER_SECONDS    1
+
+#define TEST_ACQUISITION_POWER_MW       105
+
+/*** TEST GPSM HOT START local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    TEST_START_TYPE_COLD = 0,
+    TEST_START_TYPE_WARM,
+    TEST_START_TYPE_HOT,
+    TEST_START_TYPE_LAST
+} TEST_start_type_t;
+
+/*******************************************************************/
+typedef struct {
+    uint8_t power;
+    uint8_t aiding_valid;
+    uint32_t last_fix_time_seconds;
+    TEST_start_type_t start_type;
+    uint32_t epoch_count;
+    uint32_t ttff_seconds;
+} TEST_receiver_t;
+
+/*** TEST GPSM HOT START local global variables ***/
+
+static uint32_t test_time_seconds = 0;
+static TEST_receiver_t test_receiver;
+
+/*** TEST GPSM HOT START local functions ***/
+
+/*******************************************************************/
+static void _TEST_write_u32(uint8_t* payload, uint8_t offset, uint32_t value) {
+    payload[offset + 0] = (uint8_t) ((value >> 0) & 0xFF);
+    payload[offset + 1] = (uint8_t) ((value >> 8) & 0xFF);
+    payload[offset + 2] = (uint8_t) ((value >> 16) & 0xFF);
+    payload[offset + 3] = (uint8_t) ((value >> 24) & 0xFF);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return SWREG_read_field(reg_value, field_mask);
+}
+
+/*******************************************************************/
+static void _TEST_receiver_update(void) {
+    // Local variables.
+    uint8_t power = POWER_get_state(POWER_DOMAIN_GPS);
+    uint32_t aiding_age_seconds = 0;
+    // Battery backed RAM is lost when both supplies are off.
+    if ((power == 0) && (GPS_get_backup_voltage() == 0)) {
+        test_receiver.aiding_valid = 0;
+    }
+    // Start type only depends on the receiver memory at power on.
+    if ((power != 0) && (test_receiver.power == 0)) {
+        aiding_age_seconds = (test_time_seconds - test_receiver.last_fix_time_seconds);
+        test_receiver.epoch_count = 0;
+        test_receiver.start_type = TEST_START_TYPE_COLD;
+        test_receiver.ttff_seconds = TEST_RECEIVER_TTFF_COLD_SECONDS;
+        if ((test_receiver.aiding_valid != 0) && (aiding_age_seconds < TEST_HOT_WINDOW_SECONDS)) {
+            test_receiver.start_type = TEST_START_TYPE_HOT;
+            test_receiver.ttff_seconds = TEST_RECEIVER_TTFF_HOT_SECONDS;
+        }
+        else if ((test_receiver.aiding_valid != 0) && (aiding_age_seconds < TEST_WARM_WINDOW_SECONDS)) {
+            test_receiver.start_type = TEST_START_TYPE_WARM;
+            test_receiver.ttff_seconds = TEST_RECEIVER_TTFF_WARM_SECONDS;
+        }
+    }
+    test_receiver.power = power;
+}
+
+/*******************************************************************/
+static void _TEST_process(void) {
+    // Run node and check receiver supplies.
+    TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    _TEST_receiver_update();
+}
+
+/*******************************************************************/
+static void _TEST_init(uint8_t hot_start_enable) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    FAKE_reset();
+    NODE_init();
+    // Receiver interface is initialized by the power driver on the board.
+    TEST_assert_equal(GPS_init(), GPS_SUCCESS);
+    test_time_seconds = TEST_START_TIME_SECONDS;
+    FAKE_set_uptime_seconds(test_time_seconds);
+    test_receiver.power = 0;
+    test_receiver.aiding_valid = 0;
+    test_receiver.last_fix_time_seconds = 0;
+    test_receiver.start_type = TEST_START_TYPE_COLD;
+    test_receiver.epoch_count = 0;
+    test_receiver.ttff_seconds = 0;
+    // Acquisition timeout.
+    SWREG_write_field(&reg_value, &reg_mask, TEST_GEOLOC_TIMEOUT_SECONDS, GPSM_REGISTER_CONFIGURATION_1_MASK_GEOLOC_TIMEOUT);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_CONFIGURATION_1, reg_value, reg_mask);
+    // Hot start manager.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, hot_start_enable, GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_HSEN);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_seconds(TEST_HOT_WINDOW_SECONDS), GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_HOT_WINDOW);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_seconds(TEST_WARM_WINDOW_SECONDS), GPSM_REGISTER_HOT_START_CONFIGURATION_MASK_WARM_WINDOW);
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_HOT_START_CONFIGURATION, reg_value, reg_mask), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_HOT_START_STATUS, GPSM_REGISTER_HOT_START_STATUS_MASK_LFV), 0);
+}
+
+/*******************************************************************/
+static void _TEST_wait(uint32_t duration_seconds) {
+    // Local variables.
+    uint32_t end_time_seconds = (test_time_seconds + duration_seconds);
+    // Node is periodically woken up by the RTC.
+    while (test_time_seconds < end_time_seconds) {
+        test_time_seconds += TEST_IDLE_PROCESS_PERIOD_SECONDS;
+        if (test_time_seconds > end_time_seconds) {
+            test_time_seconds = end_time_seconds;
+        }
+        FAKE_set_uptime_seconds(test_time_seconds);
+        _TEST_process();
+        TEST_assert_equal(POWER_get_state(POWER_DOMAIN_GPS), 0);
+    }
+}
+
+/*******************************************************************/
+static void _TEST_send_epoch(void) {
+    // Local variables.
+    uint8_t payload[TEST_NAV_PVT_PAYLOAD_SIZE] = { 0x00 };
+    uint8_t frame[TEST_NAV_PVT_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t frame_size = 0;
+    // Next navigation epoch.
+    test_time_seconds++;
+    FAKE_set_uptime_seconds(test_time_seconds);
+    test_receiver.epoch_count++;
+    // Position is output once the receiver has acquired enough satellites.
+    if (test_receiver.epoch_count >= test_receiver.ttff_seconds) {
+        payload[20] = TEST_NAV_PVT_FIX_TYPE_3D;
+        payload[21] = 0x01;
+        payload[23] = 9;
+        _TEST_write_u32(payload, 24, 57245000);
+        _TEST_write_u32(payload, 28, 451885000);
+        _TEST_write_u32(payload, 36, 212000);
+        _TEST_write_u32(payload, 40, 3100);
+        test_receiver.aiding_valid = 1;
+        test_receiver.last_fix_time_seconds = test_time_seconds;
+    }
+    frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_PVT, payload, TEST_NAV_PVT_PAYLOAD_SIZE, frame);
+    FAKE_gps_receive(frame, frame_size);
+    _TEST_process();
+}
+
+/*******************************************************************/
+static void _TEST_acquisition(TEST_start_type_t expected_start_type) {
+    // Local variables.
+    uint32_t ttff_seconds = 0;
+    uint32_t idx = 0;
+    // Start position acquisition.
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, GPSM_REGISTER_CONTROL_1_MASK_GTRG, GPSM_REGISTER_CONTROL_1_MASK_GTRG), NODE_SUCCESS);
+    _TEST_receiver_update();
+    TEST_assert_equal(test_receiver.start_type, expected_start_type);
+    // Policy estimation must match the receiver behavior.
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_HOT_START_STATUS, GPSM_REGISTER_HOT_START_STATUS_MASK_START_TYPE), expected_start_type);
+    while (NODE_get_state() == NODE_STATE_BUSY) {
+        _TEST_process();
+    }
+    // Acquisition.
+    for (idx = 0; idx < TEST_GEOLOC_TIMEOUT_SECONDS; idx++) {
+        if (_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP) == 0) break;
+        _TEST_send_epoch();
+    }
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GFX), 1);
+    // Report steps, then GPS off.
+    while (NODE_get_state() == NODE_STATE_BUSY) {
+        _TEST_process();
+    }
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_GPS), 0);
+    // Published metrics.
+    ttff_seconds = (test_receiver.ttff_seconds + TEST_ALTITUDE_FILTER_SECONDS);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_HOT_START_STATUS, GPSM_REGISTER_HOT_START_STATUS_MASK_START_TYPE), expected_start_type);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_HOT_START_STATUS, GPSM_REGISTER_HOT_START_STATUS_MASK_TTFF), ttff_seconds);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_ENERGY, GPSM_REGISTER_ACQUISITION_ENERGY_MASK_ENERGY), (ttff_seconds * TEST_ACQUISITION_POWER_MW));
+}
+
+/*******************************************************************/
+static void _TEST_check_backup(uint8_t expected_state) {
+    // Backup supply and last fix validity must be consistent.
+    TEST_assert_equal(GPS_get_backup_voltage(), expected_state);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_STATUS_1, GPSM_REGISTER_STATUS_1_MASK_BKENST), ((expected_state == 0) ? UNA_BIT_0 : UNA_BIT_1));
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_HOT_START_STATUS, GPSM_REGISTER_HOT_START_STATUS_MASK_LFV), expected_state);
+    TEST_assert_equal(test_receiver.aiding_valid, expected_state);
+}
+
+/*******************************************************************/
+static void _TEST_windows(void) {
+    _TEST_init(1);
+    // First start without any aiding data.
+    _TEST_acquisition(TEST_START_TYPE_COLD);
+    _TEST_check_backup(1);
+    // Within the hot window.
+    _TEST_wait(TEST_HOT_WINDOW_SECONDS / 2);
+    _TEST_check_backup(1);
+    _TEST_acquisition(TEST_START_TYPE_HOT);
+    _TEST_check_backup(1);
+    // Between hot and warm windows.
+    _TEST_wait(TEST_HOT_WINDOW_SECONDS * 5);
+    _TEST_check_backup(1);
+    _TEST_acquisition(TEST_START_TYPE_WARM);
+    // Backup is kept until the warm window expires.
+    _TEST_wait(TEST_WARM_WINDOW_SECONDS - TEST_IDLE_PROCESS_PERIOD_SECONDS);
+    _TEST_check_backup(1);
+    _TEST_wait(TEST_IDLE_PROCESS_PERIOD_SECONDS);
+    _TEST_check_backup(0);
+    _TEST_acquisition(TEST_START_TYPE_COLD);
+    _TEST_check_backup(1);
+}
+
+/*******************************************************************/
+static void _TEST_backup_power_loss(void) {
+    _TEST_init(1);
+    _TEST_acquisition(TEST_START_TYPE_COLD);
+    _TEST_wait(TEST_HOT_WINDOW_SECONDS / 4);
+    _TEST_check_backup(1);
+    // Backup supply cut while the GPS is off.
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, 0b0, GPSM_REGISTER_CONTROL_1_MASK_BKEN), NODE_SUCCESS);
+    _TEST_receiver_update();
+    _TEST_check_backup(0);
+    // Start type must not be estimated from the outdated last fix.
+    _TEST_acquisition(TEST_START_TYPE_COLD);
+}
+
+/*******************************************************************/
+static void _TEST_disabled(void) {
+    _TEST_init(0);
+    // Receiver memory is lost at each GPS power off.
+    _TEST_acquisition(TEST_START_TYPE_COLD);
+    _TEST_check_backup(0);
+    _TEST_wait(TEST_HOT_WINDOW_SECONDS / 4);
+    _TEST_acquisition(TEST_START_TYPE_COLD);
+    _TEST_check_backup(0);
+}
+
+/*** TEST GPSM HOT START functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_windows();
+    _TEST_backup_power_loss();
+    _TEST_disabled();
+    return TEST_report("test_gpsm_hot_start");
+}
@@ -0,0 +1,268 @@
+/*
+ * test_gpsm_tracking.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "gps.h"
+#include "gpsm.h"
+#include "node.h"
+#include "power.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST GPSM TRACKING local macros ***/
+
+#define TEST_UBX_FRAME_OVERHEAD_BYTES   8
+#define TEST_UBX_CLASS_NAV              0x01
+#define TEST_UBX_ID_NAV_PVT             0x07
+#define TEST_NAV_PVT_PAYLOAD_SIZE       92
+#define TEST_NAV_PVT_FIX_TYPE_3D        3
+
+#define TEST_GEOLOC_TIMEOUT_SECONDS     30
+#define TEST_START_TIME_SECONDS         1000
+#define TEST_TRACKING_PERIOD_SECONDS    300
+#define TEST_RECEIVER_TTFF_SECONDS      4
+
+#define TEST_TRACKING_DEPTH             8
+#define TEST_REGISTERS_PER_ENTRY        4
+#define TEST_NUMBER_OF_PERIODS          13
+// Receiver has no sky view during this period.
+#define TEST_TIMEOUT_PERIOD_INDEX       5
+
+/*** TEST GPSM TRACKING local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint32_t timestamp;
+    uint32_t geoloc_data[TEST_REGISTERS_PER_ENTRY - 1];
+} TEST_entry_t;
+
+/*** TEST GPSM TRACKING local global variables ***/
+
+static uint32_t test_time_seconds = 0;
+static TEST_entry_t test_history[TEST_NUMBER_OF_PERIODS];
+static uint32_t test_history_count = 0;
+
+/*** TEST GPSM TRACKING local functions ***/
+
+/*******************************************************************/
+static void _TEST_write_u32(uint8_t* payload, uint8_t offset, uint32_t value) {
+    payload[offset + 0] = (uint8_t) ((value >> 0) & 0xFF);
+    payload[offset + 1] = (uint8_t) ((value >> 8) & 0xFF);
+    payload[offset + 2] = (uint8_t) ((value >> 16) & 0xFF);
+    payload[offset + 3] = (uint8_t) ((value >> 24) & 0xFF);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_register(uint8_t reg_addr) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return reg_value;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    return SWREG_read_field(_TEST_read_register(reg_addr), field_mask);
+}
+
+/*******************************************************************/
+static void _TEST_set_time(uint32_t time_seconds) {
+    test_time_seconds = time_seconds;
+    FAKE_set_uptime_seconds(test_time_seconds);
+}
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    FAKE_reset();
+    NODE_init();
+    // Receiver interface is initialized by the power driver on the board.
+    TEST_assert_equal(GPS_init(), GPS_SUCCESS);
+    _TEST_set_time(TEST_START_TIME_SECONDS);
+    test_history_count = 0;
+    // Acquisition timeout.
+    SWREG_write_field(&reg_value, &reg_mask, TEST_GEOLOC_TIMEOUT_SECONDS, GPSM_REGISTER_CONFIGURATION_1_MASK_GEOLOC_TIMEOUT);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_CONFIGURATION_1, reg_value, reg_mask);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_TRACKING_STATUS, GPSM_REGISTER_TRACKING_STATUS_MASK_COUNT), 0);
+}
+
+/*******************************************************************/
+static void _TEST_set_tracking(uint8_t enable) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Tracking mode.
+    SWREG_write_field(&reg_value, &reg_mask, enable, GPSM_REGISTER_TRACKING_CONFIGURATION_MASK_TKEN);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_seconds(TEST_TRACKING_PERIOD_SECONDS), GPSM_REGISTER_TRACKING_CONFIGURATION_MASK_PERIOD);
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_TRACKING_CONFIGURATION, reg_value, reg_mask), NODE_SUCCESS);
+}
+
+/*******************************************************************/
+static uint8_t _TEST_wait_acquisition(uint32_t end_time_seconds) {
+    // Local variables.
+    uint8_t started = 0;
+    // Node is woken up every second by the RTC.
+    while (test_time_seconds <= end_time_seconds) {
+        TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+        if (_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP) != 0) {
+            started = 1;
+            break;
+        }
+        _TEST_set_time(test_time_seconds + 1);
+    }
+    return started;
+}
+
+/*******************************************************************/
+static void _TEST_acquisition(uint32_t period_index, uint8_t sky_view) {
+    // Local variables.
+    uint8_t payload[TEST_NAV_PVT_PAYLOAD_SIZE] = { 0x00 };
+    uint8_t frame[TEST_NAV_PVT_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t frame_size = 0;
+    uint32_t epoch = 0;
+    // Aiding configuration and receiver start.
+    while (NODE_get_state() == NODE_STATE_BUSY) {
+        TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    }
+    // Walking north.
+    _TEST_write_u32(payload, 24, 57245000);
+    _TEST_write_u32(payload, 28, (451885000 + (period_index * 1000)));
+    _TEST_write_u32(payload, 36, 212000);
+    _TEST_write_u32(payload, 40, 2400);
+    payload[23] = 8;
+    for (epoch = 1; epoch <= TEST_GEOLOC_TIMEOUT_SECONDS; epoch++) {
+        if (_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GIP) == 0) break;
+        if ((sky_view != 0) && (epoch >= TEST_RECEIVER_TTFF_SECONDS)) {
+            payload[20] = TEST_NAV_PVT_FIX_TYPE_3D;
+            payload[21] = 0x01;
+        }
+        _TEST_set_time(test_time_seconds + 1);
+        frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_PVT, payload, TEST_NAV_PVT_PAYLOAD_SIZE, frame);
+        FAKE_gps_receive(frame, frame_size);
+        TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    }
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GFX), ((sky_view == 0) ? 0 : 1));
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_ACQUISITION_STATUS, GPSM_REGISTER_ACQUISITION_STATUS_MASK_GTO), ((sky_view == 0) ? 1 : 0));
+    // Record expected entry.
+    if (sky_view != 0) {
+        test_history[test_history_count].timestamp = test_time_seconds;
+        test_history[test_history_count].geoloc_data[0] = _TEST_read_register(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_0);
+        test_history[test_history_count].geoloc_data[1] = _TEST_read_register(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_1);
+        test_history[test_history_count].geoloc_data[2] = _TEST_read_register(GPSM_REGISTER_ADDRESS_GEOLOC_DATA_2);
+        test_history_count++;
+    }
+    // Report steps, then GPS off.
+    while (NODE_get_state() == NODE_STATE_BUSY) {
+        TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    }
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_GPS), 0);
+}
+
+/*******************************************************************/
+static void _TEST_check_buffer(void) {
+    // Local variables.
+    uint32_t expected_count = (test_history_count < TEST_TRACKING_DEPTH) ? test_history_count : TEST_TRACKING_DEPTH;
+    uint32_t expected_index = (test_history_count % TEST_TRACKING_DEPTH);
+    uint8_t reg_addr = 0;
+    uint32_t history_idx = 0;
+    uint32_t slot = 0;
+    uint32_t idx = 0;
+    // Ring buffer indexes.
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_TRACKING_STATUS, GPSM_REGISTER_TRACKING_STATUS_MASK_INDEX), expected_index);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_TRACKING_STATUS, GPSM_REGISTER_TRACKING_STATUS_MASK_COUNT), expected_count);
+    // Latest entries, the oldest ones being overwritten.
+    for (slot = 0; slot < TEST_TRACKING_DEPTH; slot++) {
+        reg_addr = (uint8_t) (GPSM_REGISTER_ADDRESS_TRACKING_DATA_0 + (slot * TEST_REGISTERS_PER_ENTRY));
+        if (slot >= expected_count) {
+            for (idx = 0; idx < TEST_REGISTERS_PER_ENTRY; idx++) {
+                TEST_assert_equal(_TEST_read_register(reg_addr + idx), 0);
+            }
+            continue;
+        }
+        // Most recent entry written in this slot.
+        history_idx = slot + (((test_history_count - 1 - slot) / TEST_TRACKING_DEPTH) * TEST_TRACKING_DEPTH);
+        TEST_assert_equal(_TEST_read_register(reg_addr + 0), test_history[history_idx].timestamp);
+        for (idx = 0; idx < (TEST_REGISTERS_PER_ENTRY - 1); idx++) {
+            TEST_assert_equal(_TEST_read_register(reg_addr + 1 + idx), test_history[history_idx].geoloc_data[idx]);
+        }
+    }
+}
+
+/*******************************************************************/
+static void _TEST_schedule(void) {
+    // Local variables.
+    uint32_t expected_start_time_seconds = 0;
+    uint32_t period_index = 0;
+    _TEST_init();
+    // No acquisition while tracking is disabled.
+    TEST_assert_equal(_TEST_wait_acquisition(test_time_seconds + (2 * TEST_TRACKING_PERIOD_SECONDS)), 0);
+    // First fix as soon as tracking is enabled.
+    _TEST_set_tracking(1);
+    expected_start_time_seconds = test_time_seconds;
+    for (period_index = 0; period_index < TEST_NUMBER_OF_PERIODS; period_index++) {
+        TEST_assert_equal(_TEST_wait_acquisition(expected_start_time_seconds), 1);
+        TEST_assert_equal(test_time_seconds, expected_start_time_seconds);
+        _TEST_acquisition(period_index, ((period_index == TEST_TIMEOUT_PERIOD_INDEX) ? 0 : 1));
+        _TEST_check_buffer();
+        // Period is counted from the acquisition start.
+        expected_start_time_seconds += TEST_TRACKING_PERIOD_SECONDS;
+        TEST_assert_equal(_TEST_wait_acquisition(expected_start_time_seconds - 1), 0);
+    }
+    // Buffer has wrapped.
+    TEST_assert_equal(test_history_count, (TEST_NUMBER_OF_PERIODS - 1));
+    TEST_assert(test_history_count > TEST_TRACKING_DEPTH);
+    // Clear buffer.
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_TRACKING_CONTROL, GPSM_REGISTER_TRACKING_CONTROL_MASK_TCLR, GPSM_REGISTER_TRACKING_CONTROL_MASK_TCLR), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(GPSM_REGISTER_ADDRESS_TRACKING_CONTROL, GPSM_REGISTER_TRACKING_CONTROL_MASK_TCLR), 0);
+    test_history_count = 0;
+    _TEST_check_buffer();
+    // Next entry is written from the buffer start.
+    TEST_assert_equal(_TEST_wait_acquisition(expected_start_time_seconds), 1);
+    _TEST_acquisition(0, 1);
+    _TEST_check_buffer();
+    TEST_assert_equal(test_history_count, 1);
+    // Schedule stops with tracking.
+    _TEST_set_tracking(0);
+    TEST_assert_equal(_TEST_wait_acquisition(test_time_seconds + (2 * TEST_TRACKING_PERIOD_SECONDS)), 0);
+    _TEST_check_buffer();
+}
+
+/*******************************************************************/
+static void _TEST_manual_trigger(void) {
+    // Local variables.
+    uint32_t expected_start_time_seconds = 0;
+    _TEST_init();
+    _TEST_set_tracking(1);
+    expected_start_time_seconds = test_time_seconds;
+    TEST_assert_equal(_TEST_wait_acquisition(expected_start_time_seconds), 1);
+    _TEST_acquisition(0, 1);
+    // Manual fix between two tracking fixes is recorded too.
+    _TEST_set_time(test_time_seconds + (TEST_TRACKING_PERIOD_SECONDS / 2));
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, GPSM_REGISTER_ADDRESS_CONTROL_1, GPSM_REGISTER_CONTROL_1_MASK_GTRG, GPSM_REGISTER_CONTROL_1_MASK_GTRG), NODE_SUCCESS);
+    _TEST_acquisition(1, 1);
+    _TEST_check_buffer();
+    // Tracking period is not shifted by the manual acquisition.
+    expected_start_time_seconds += TEST_TRACKING_PERIOD_SECONDS;
+    TEST_assert_equal(_TEST_wait_acquisition(expected_start_time_seconds), 1);
+    TEST_assert_equal(test_time_seconds, expected_start_time_seconds);
+    _TEST_acquisition(2, 1);
+    _TEST_check_buffer();
+}
+
+/*** TEST GPSM TRACKING functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_schedule();
+    _TEST_manual_trigger();
+    return TEST_report("test_gpsm_tracking");
+}
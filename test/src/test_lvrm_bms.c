@@ -0,0 +1,192 @@
+/*
+ * test_lvrm_bms.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "adc.h"
+#include "analog.h"
+#include "fake.h"
+#include "lvrm.h"
+#include "node.h"
+#include "power.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+#include "xm_flags.h"
+
+/*** TEST LVRM BMS local macros ***/
+
+// VIN divider on ADC_CHANNEL_IN6 with the default 3V MCU supply (HW1.0).
+#define TEST_ADC_CHANNEL_VIN            ADC_CHANNEL_IN6
+#define TEST_ADC_CHANNEL_IOUT           ADC_CHANNEL_IN0
+#define TEST_VMCU_MV                    3000
+#define TEST_DIVIDER_RATIO_VIN          10
+
+#define TEST_VBATT_LOW_THRESHOLD_MV     10500
+#define TEST_VBATT_HIGH_THRESHOLD_MV    13000
+
+/*** TEST LVRM BMS local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint32_t time_seconds;
+    int32_t vin_mv;
+} TEST_curve_point_t;
+
+/*** TEST LVRM BMS local global variables ***/
+
+// 12V lead-acid battery: charged at rest, surface charge decay, discharge plateau and knee under load, relaxation once disconnected, then charge.
+static const TEST_curve_point_t TEST_DISCHARGE_CURVE[] = {
+    { 0, 13200 },
+    { 600, 12600 },
+    { 900, 12400 },
+    { 20000, 11200 },
+    { 22000, 10900 },
+    { 23000, 10300 },
+    { 23300, 11800 },
+    { 30000, 11900 },
+    { 31000, 13100 },
+    { 31600, 13100 }
+};
+
+/*** TEST LVRM BMS local functions ***/
+
+/*******************************************************************/
+static int32_t _TEST_get_curve_voltage(uint32_t time_seconds) {
+    // Local variables.
+    const TEST_curve_point_t* start = NULL;
+    const TEST_curve_point_t* end = NULL;
+    uint32_t idx = 0;
+    // Search segment.
+    for (idx = 0; idx < ((sizeof(TEST_DISCHARGE_CURVE) / sizeof(TEST_curve_point_t)) - 1); idx++) {
+        start = &(TEST_DISCHARGE_CURVE[idx]);
+        end = &(TEST_DISCHARGE_CURVE[idx + 1]);
+        if (time_seconds < (end->time_seconds)) break;
+    }
+    // Linear interpolation.
+    return ((start->vin_mv) + (((end->vin_mv) - (start->vin_mv)) * (int32_t) (time_seconds - (start->time_seconds))) / (int32_t) ((end->time_seconds) - (start->time_seconds)));
+}
+
+/*******************************************************************/
+static int32_t _TEST_set_vin(int32_t vin_mv) {
+    // Local variables.
+    int32_t adc_data_12bits = ((vin_mv * ADC_FULL_SCALE) / (TEST_VMCU_MV * TEST_DIVIDER_RATIO_VIN));
+    // Feed the ADC and return the voltage seen by the firmware.
+    FAKE_set_adc_data(TEST_ADC_CHANNEL_VIN, adc_data_12bits);
+    return ((adc_data_12bits * TEST_VMCU_MV * TEST_DIVIDER_RATIO_VIN) / ADC_FULL_SCALE);
+}
+
+/*******************************************************************/
+static uint8_t _TEST_is_close_to_threshold(int32_t vin_mv) {
+    return (((vin_mv < (TEST_VBATT_LOW_THRESHOLD_MV + LVRM_BMS_MONITORING_MARGIN_MV)) || (vin_mv > (TEST_VBATT_HIGH_THRESHOLD_MV - LVRM_BMS_MONITORING_MARGIN_MV))) ? 1 : 0);
+}
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Reset fakes, ADC front-end and node.
+    FAKE_reset();
+    FAKE_set_uptime_seconds(0);
+    TEST_assert_equal(ANALOG_init(), ANALOG_SUCCESS);
+    _TEST_set_vin(TEST_DISCHARGE_CURVE[0].vin_mv);
+    NODE_init();
+    // Battery voltage window, no battery capacity: relay is controlled by the voltage only.
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_mv(TEST_VBATT_LOW_THRESHOLD_MV), LVRM_REGISTER_CONFIGURATION_1_MASK_VBATT_LOW_THRESHOLD);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_mv(TEST_VBATT_HIGH_THRESHOLD_MV), LVRM_REGISTER_CONFIGURATION_1_MASK_VBATT_HIGH_THRESHOLD);
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, LVRM_REGISTER_ADDRESS_CONFIGURATION_1, reg_value, reg_mask), NODE_SUCCESS);
+}
+
+/*******************************************************************/
+static void _TEST_discharge_curve(void) {
+    // Local variables.
+    uint32_t end_time_seconds = TEST_DISCHARGE_CURVE[(sizeof(TEST_DISCHARGE_CURVE) / sizeof(TEST_curve_point_t)) - 1].time_seconds;
+    uint32_t time_seconds = 0;
+    uint32_t adc_conversion_count = 0;
+    uint32_t power_request_count = 0;
+    uint32_t set_count = 0;
+    uint32_t last_check_seconds = 0;
+    uint32_t period_min_count = 0;
+    uint32_t period_max_count = 0;
+    uint32_t open_time_seconds = 0;
+    uint32_t close_time_seconds = 0;
+    uint32_t low_crossing_seconds = 0;
+    uint32_t high_crossing_seconds = 0;
+    int32_t vin_mv = 0;
+    int32_t last_check_vin_mv = 0;
+    uint8_t check_done = 0;
+    _TEST_init();
+    // Replay the curve second by second through the ADC.
+    for (time_seconds = 0; time_seconds <= end_time_seconds; time_seconds++) {
+        vin_mv = _TEST_set_vin(_TEST_get_curve_voltage(time_seconds));
+        // First seconds where the measured voltage leaves the window (discharge knee, then charge).
+        if ((vin_mv < TEST_VBATT_LOW_THRESHOLD_MV) && (low_crossing_seconds == 0)) {
+            low_crossing_seconds = time_seconds;
+        }
+        if ((vin_mv > TEST_VBATT_HIGH_THRESHOLD_MV) && (low_crossing_seconds != 0) && (high_crossing_seconds == 0)) {
+            high_crossing_seconds = time_seconds;
+        }
+        adc_conversion_count = FAKE_get_adc_conversion_count();
+        power_request_count = FAKE_get_power_request_count(POWER_REQUESTER_ID_LVRM);
+        set_count = fake_load.set_count;
+        FAKE_set_uptime_seconds(time_seconds);
+        TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+        // Battery checks power the analog front-end on, the IOUT indicator uses the ADC on its own schedule.
+        if (FAKE_get_power_request_count(POWER_REQUESTER_ID_LVRM) == power_request_count) {
+            TEST_assert_equal(fake_load.set_count, set_count);
+            continue;
+        }
+        TEST_assert(FAKE_get_adc_conversion_count() > adc_conversion_count);
+        // Next check is scheduled from the voltage measured at the previous one.
+        if (check_done != 0) {
+            if (_TEST_is_close_to_threshold(last_check_vin_mv) != 0) {
+                TEST_assert_equal((time_seconds - last_check_seconds), LVRM_BMS_MONITORING_PERIOD_MIN_SECONDS);
+                period_min_count++;
+            }
+            else {
+                TEST_assert_equal((time_seconds - last_check_seconds), LVRM_BMS_MONITORING_PERIOD_MAX_SECONDS);
+                period_max_count++;
+            }
+        }
+        // Relay is driven only when the voltage leaves the window.
+        if (fake_load.set_count != set_count) {
+            TEST_assert_equal(fake_load.set_count, (set_count + 1));
+            TEST_assert((vin_mv < TEST_VBATT_LOW_THRESHOLD_MV) || (vin_mv > TEST_VBATT_HIGH_THRESHOLD_MV));
+            if (vin_mv < TEST_VBATT_LOW_THRESHOLD_MV) {
+                TEST_assert_equal(fake_load.output_state, 0);
+                open_time_seconds = time_seconds;
+            }
+            else {
+                TEST_assert_equal(fake_load.output_state, 1);
+                close_time_seconds = time_seconds;
+            }
+        }
+        last_check_seconds = time_seconds;
+        last_check_vin_mv = vin_mv;
+        check_done = 1;
+    }
+    // Relay closed on the charged battery, opened at the knee and closed again during charge.
+    TEST_assert_equal(fake_load.set_count, 3);
+    TEST_assert_equal(fake_load.switch_count, 3);
+    TEST_assert_equal(fake_load.output_state, 1);
+    // Threshold crossings are detected within the fast period.
+    TEST_assert((low_crossing_seconds > 22000) && (low_crossing_seconds < 23000));
+    TEST_assert((open_time_seconds >= low_crossing_seconds) && (open_time_seconds < (low_crossing_seconds + LVRM_BMS_MONITORING_PERIOD_MIN_SECONDS)));
+    TEST_assert((high_crossing_seconds > 30000) && (high_crossing_seconds < 31000));
+    TEST_assert((close_time_seconds >= high_crossing_seconds) && (close_time_seconds < (high_crossing_seconds + LVRM_BMS_MONITORING_PERIOD_MIN_SECONDS)));
+    // Both periods are used: slow on the plateau and during relaxation, fast near the thresholds.
+    TEST_assert(period_max_count > 60);
+    TEST_assert(period_min_count > 200);
+}
+
+/*** TEST LVRM BMS functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_discharge_curve();
+    return TEST_report("test_lvrm_bms");
+}
@@ -0,0 +1,98 @@
+/*
+ * test_lvrm_relay.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "lvrm.h"
+#include "node.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST LVRM RELAY local macros ***/
+
+#define TEST_SEQUENCE_PROCESS_COUNT     3
+
+/*** TEST LVRM RELAY local functions ***/
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Reset fakes and node.
+    FAKE_reset();
+    fake_load.sequence_process_count = TEST_SEQUENCE_PROCESS_COUNT;
+    NODE_init();
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return SWREG_read_field(reg_value, field_mask);
+}
+
+/*******************************************************************/
+static void _TEST_set_relay(uint8_t state) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Write control bit as the bus master or the CLI does.
+    SWREG_write_field(&reg_value, &reg_mask, state, LVRM_REGISTER_CONTROL_1_MASK_RLST);
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, LVRM_REGISTER_ADDRESS_CONTROL_1, reg_value, reg_mask), NODE_SUCCESS);
+}
+
+/*******************************************************************/
+static void _TEST_command_after_process(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    _TEST_init();
+    TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    TEST_assert_equal(NODE_get_state(), NODE_STATE_IDLE);
+    // Command received between two node process calls.
+    _TEST_set_relay(1);
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_RELAY_STATUS, LVRM_REGISTER_RELAY_STATUS_MASK_SWIP), 1);
+    // Node must not enter stop mode before the sequence completes.
+    for (idx = 0; idx < TEST_SEQUENCE_PROCESS_COUNT; idx++) {
+        TEST_assert_equal(NODE_get_state(), NODE_STATE_RUNNING);
+        TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    }
+    TEST_assert_equal(NODE_get_state(), NODE_STATE_IDLE);
+    TEST_assert_equal(fake_load.output_state, 1);
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_STATUS_1, LVRM_REGISTER_STATUS_1_MASK_RLSTST), UNA_BIT_1);
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_RELAY_STATUS, LVRM_REGISTER_RELAY_STATUS_MASK_SWIP), 0);
+}
+
+/*******************************************************************/
+static void _TEST_queued_command(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    _TEST_init();
+    // Second command during the first sequence.
+    _TEST_set_relay(1);
+    TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    _TEST_set_relay(0);
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_RELAY_STATUS, LVRM_REGISTER_RELAY_STATUS_MASK_PEND), 1);
+    // Both sequences are executed while the node stays running.
+    for (idx = 0; idx < ((2 * TEST_SEQUENCE_PROCESS_COUNT) - 1); idx++) {
+        TEST_assert_equal(NODE_get_state(), NODE_STATE_RUNNING);
+        TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    }
+    TEST_assert_equal(NODE_get_state(), NODE_STATE_IDLE);
+    TEST_assert_equal(fake_load.output_state, 0);
+    TEST_assert_equal(fake_load.switch_count, 2);
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_RELAY_STATUS, LVRM_REGISTER_RELAY_STATUS_MASK_PEND), 0);
+}
+
+/*** TEST LVRM RELAY functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_command_after_process();
+    _TEST_queued_command();
+    return TEST_report("test_lvrm_relay");
+}
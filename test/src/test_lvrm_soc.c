@@ -0,0 +1,200 @@
+/*
+ * test_lvrm_soc.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "analog.h"
+#include "fake.h"
+#include "lvrm.h"
+#include "node.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST LVRM SOC local macros ***/
+
+#define TEST_LOOP_PERIOD_SECONDS        10
+
+#define TEST_VBATT_LOW_THRESHOLD_MV     10000
+#define TEST_VBATT_HIGH_THRESHOLD_MV    12000
+
+#define TEST_BATTERY_CHEMISTRY          1
+#define TEST_BATTERY_CAPACITY_UNITS     100
+
+#define TEST_SOC_LOW_THRESHOLD_PERCENT  30
+#define TEST_SOC_HIGH_THRESHOLD_PERCENT 60
+
+#define TEST_DISCHARGE_CURRENT_UA       2000000
+
+/*** TEST LVRM SOC local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint32_t duration_seconds;
+    int32_t vbatt_mv;
+    int32_t ibatt_ua;
+} TEST_log_entry_t;
+
+/*** TEST LVRM SOC local global variables ***/
+
+// 10Ah lead-acid battery: rest at 80%, 2A discharge down to the low threshold, voltage recovery, then charge.
+static const TEST_log_entry_t TEST_SOC_LOG_REST[] = {
+    { 30, 12500, 0 }
+};
+static const TEST_log_entry_t TEST_SOC_LOG_DISCHARGE[] = {
+    { 7200, 12100, TEST_DISCHARGE_CURRENT_UA }
+};
+static const TEST_log_entry_t TEST_SOC_LOG_DEEP_DISCHARGE[] = {
+    { 1200, 11900, TEST_DISCHARGE_CURRENT_UA },
+    { 1200, 11800, TEST_DISCHARGE_CURRENT_UA }
+};
+static const TEST_log_entry_t TEST_SOC_LOG_RECOVERY[] = {
+    { 3600, 12000, TEST_DISCHARGE_CURRENT_UA }
+};
+static const TEST_log_entry_t TEST_SOC_LOG_CHARGE[] = {
+    { 600, 12800, TEST_DISCHARGE_CURRENT_UA }
+};
+// Noisy battery voltage around both thresholds.
+static const TEST_log_entry_t TEST_VOLTAGE_LOG_NOISE_HIGH[] = {
+    { 20, 11900, 0 },
+    { 20, 12100, 0 },
+    { 20, 11900, 0 },
+    { 20, 12100, 0 },
+    { 20, 11900, 0 },
+    { 20, 12100, 0 }
+};
+static const TEST_log_entry_t TEST_VOLTAGE_LOG_NOISE_LOW[] = {
+    { 20, 10100, 0 },
+    { 20, 9900, 0 },
+    { 20, 10100, 0 },
+    { 20, 9900, 0 },
+    { 20, 11900, 0 },
+    { 20, 10100, 0 }
+};
+
+static uint32_t test_uptime_seconds = 0;
+
+/*** TEST LVRM SOC local functions ***/
+
+/*******************************************************************/
+static void _TEST_init(uint8_t soc_mode) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Reset fakes and node.
+    FAKE_reset();
+    test_uptime_seconds = 0;
+    FAKE_set_uptime_seconds(test_uptime_seconds);
+    NODE_init();
+    // Battery voltage thresholds.
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_mv(TEST_VBATT_LOW_THRESHOLD_MV), LVRM_REGISTER_CONFIGURATION_1_MASK_VBATT_LOW_THRESHOLD);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_mv(TEST_VBATT_HIGH_THRESHOLD_MV), LVRM_REGISTER_CONFIGURATION_1_MASK_VBATT_HIGH_THRESHOLD);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, LVRM_REGISTER_ADDRESS_CONFIGURATION_1, reg_value, reg_mask);
+    // Lead-acid preset and capacity.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, TEST_BATTERY_CHEMISTRY, LVRM_REGISTER_BATTERY_CONFIGURATION_MASK_CHEM);
+    SWREG_write_field(&reg_value, &reg_mask, TEST_BATTERY_CAPACITY_UNITS, LVRM_REGISTER_BATTERY_CONFIGURATION_MASK_CAPACITY);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, LVRM_REGISTER_ADDRESS_BATTERY_CONFIGURATION, reg_value, reg_mask);
+    // Relay control mode.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, soc_mode, LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOCM);
+    SWREG_write_field(&reg_value, &reg_mask, TEST_SOC_LOW_THRESHOLD_PERCENT, LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOC_LOW_THRESHOLD);
+    SWREG_write_field(&reg_value, &reg_mask, TEST_SOC_HIGH_THRESHOLD_PERCENT, LVRM_REGISTER_BMS_CONFIGURATION_MASK_SOC_HIGH_THRESHOLD);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, LVRM_REGISTER_ADDRESS_BMS_CONFIGURATION, reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return SWREG_read_field(reg_value, field_mask);
+}
+
+/*******************************************************************/
+static void _TEST_replay(const TEST_log_entry_t* log, uint32_t number_of_entries) {
+    // Local variables.
+    uint32_t entry_idx = 0;
+    uint32_t elapsed_seconds = 0;
+    // Entries loop.
+    for (entry_idx = 0; entry_idx < number_of_entries; entry_idx++) {
+        FAKE_set_analog_data(ANALOG_CHANNEL_VIN_MV, log[entry_idx].vbatt_mv);
+        FAKE_set_analog_data(ANALOG_CHANNEL_VOUT_MV, log[entry_idx].vbatt_mv);
+        FAKE_set_analog_data(ANALOG_CHANNEL_IOUT_UA, log[entry_idx].ibatt_ua);
+        // Run main loop over the entry duration.
+        for (elapsed_seconds = 0; elapsed_seconds < log[entry_idx].duration_seconds; elapsed_seconds += TEST_LOOP_PERIOD_SECONDS) {
+            FAKE_set_uptime_seconds(test_uptime_seconds);
+            NODE_process();
+            test_uptime_seconds += TEST_LOOP_PERIOD_SECONDS;
+        }
+    }
+}
+
+/*******************************************************************/
+static void _TEST_soc_mode(void) {
+    // Local variables.
+    uint32_t soc_percent = 0;
+    _TEST_init(1);
+    // First estimation from the rest voltage closes the relay.
+    _TEST_replay(TEST_SOC_LOG_REST, (sizeof(TEST_SOC_LOG_REST) / sizeof(TEST_log_entry_t)));
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1, LVRM_REGISTER_BATTERY_STATUS_1_MASK_SOCV), 1);
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1, LVRM_REGISTER_BATTERY_STATUS_1_MASK_SOC), 80);
+    TEST_assert_equal(fake_load.output_state, 1);
+    TEST_assert_equal(fake_load.switch_count, 1);
+    // 2 hours at 2A remove 4Ah: coulomb counting must ignore the loaded voltage.
+    _TEST_replay(TEST_SOC_LOG_DISCHARGE, (sizeof(TEST_SOC_LOG_DISCHARGE) / sizeof(TEST_log_entry_t)));
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1, LVRM_REGISTER_BATTERY_STATUS_1_MASK_SOC), 40);
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1, LVRM_REGISTER_BATTERY_STATUS_1_MASK_REST), 0);
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1, LVRM_REGISTER_BATTERY_STATUS_1_MASK_TTE), 120);
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_2, LVRM_REGISTER_BATTERY_STATUS_2_MASK_CHARGE), 40);
+    TEST_assert_equal(fake_load.switch_count, 1);
+    // Relay opens once below the low threshold.
+    _TEST_replay(TEST_SOC_LOG_DEEP_DISCHARGE, (sizeof(TEST_SOC_LOG_DEEP_DISCHARGE) / sizeof(TEST_log_entry_t)));
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1, LVRM_REGISTER_BATTERY_STATUS_1_MASK_SOC), (TEST_SOC_LOW_THRESHOLD_PERCENT - 1));
+    TEST_assert_equal(fake_load.output_state, 0);
+    TEST_assert_equal(fake_load.switch_count, 2);
+    // Relaxed voltage (about 43%) corrects the estimation after the rest duration, relay stays open in the hysteresis band.
+    _TEST_replay(TEST_SOC_LOG_RECOVERY, (sizeof(TEST_SOC_LOG_RECOVERY) / sizeof(TEST_log_entry_t)));
+    soc_percent = _TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1, LVRM_REGISTER_BATTERY_STATUS_1_MASK_SOC);
+    TEST_assert((soc_percent >= 41) && (soc_percent <= 43));
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1, LVRM_REGISTER_BATTERY_STATUS_1_MASK_REST), 1);
+    TEST_assert_equal(fake_load.output_state, 0);
+    TEST_assert_equal(fake_load.switch_count, 2);
+    // Charge brings the estimation above the high threshold: relay closes once.
+    _TEST_replay(TEST_SOC_LOG_CHARGE, (sizeof(TEST_SOC_LOG_CHARGE) / sizeof(TEST_log_entry_t)));
+    soc_percent = _TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1, LVRM_REGISTER_BATTERY_STATUS_1_MASK_SOC);
+    TEST_assert(soc_percent > TEST_SOC_HIGH_THRESHOLD_PERCENT);
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1, LVRM_REGISTER_BATTERY_STATUS_1_MASK_REST), 0);
+    TEST_assert_equal(fake_load.output_state, 1);
+    TEST_assert_equal(fake_load.switch_count, 3);
+}
+
+/*******************************************************************/
+static void _TEST_voltage_mode(void) {
+    _TEST_init(0);
+    // Noise around the high threshold closes the relay only once.
+    _TEST_replay(TEST_VOLTAGE_LOG_NOISE_HIGH, (sizeof(TEST_VOLTAGE_LOG_NOISE_HIGH) / sizeof(TEST_log_entry_t)));
+    TEST_assert_equal(fake_load.output_state, 1);
+    TEST_assert_equal(fake_load.switch_count, 1);
+    // Noise around the low threshold opens the relay only once.
+    _TEST_replay(TEST_VOLTAGE_LOG_NOISE_LOW, (sizeof(TEST_VOLTAGE_LOG_NOISE_LOW) / sizeof(TEST_log_entry_t)));
+    TEST_assert_equal(fake_load.output_state, 0);
+    TEST_assert_equal(fake_load.switch_count, 2);
+    // Estimation keeps running in voltage mode.
+    TEST_assert_equal(_TEST_read_field(LVRM_REGISTER_ADDRESS_BATTERY_STATUS_1, LVRM_REGISTER_BATTERY_STATUS_1_MASK_SOCV), 1);
+}
+
+/*** TEST LVRM SOC functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_soc_mode();
+    _TEST_voltage_mode();
+    return TEST_report("test_lvrm_soc");
+}
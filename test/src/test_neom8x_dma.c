@@ -0,0 +1,196 @@
+/*
+ * test_neom8x_dma.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "neom8x.h"
+#include "neom8x_hw.h"
+#include "test.h"
+#include "types.h"
+#include "ubx.h"
+
+/*** TEST NEOM8X DMA local macros ***/
+
+#define TEST_UBX_FRAME_OVERHEAD_BYTES   8
+#define TEST_UBX_CLASS_NAV              0x01
+#define TEST_UBX_CLASS_MGA              0x13
+#define TEST_UBX_ID_NAV_DOP             0x04
+#define TEST_UBX_ID_NAV_PVT             0x07
+#define TEST_UBX_ID_NAV_SAT             0x35
+#define TEST_UBX_ID_NAV_AOPSTATUS       0x60
+#define TEST_UBX_ID_MGA_GPS             0x00
+#define TEST_UBX_ID_MGA_ACK             0x60
+
+#define TEST_MGA_GPS_PAYLOAD_SIZE       68
+#define TEST_NAV_PVT_PAYLOAD_SIZE       92
+#define TEST_NAV_PVT_NUMBER_OF_FRAMES   3
+#define TEST_NAV_SAT_PAYLOAD_SIZE       32
+
+#define TEST_DMA_HALF_BUFFER_BYTES      32
+
+/*** TEST NEOM8X DMA local global variables ***/
+
+static uint32_t test_position_count = 0;
+
+/*** TEST NEOM8X DMA local functions ***/
+
+/*******************************************************************/
+static void _TEST_nmea_rx_callback(uint8_t data) {
+    UNUSED(data);
+}
+
+/*******************************************************************/
+static void _TEST_position_callback(void) {
+    // Local variables.
+    UBX_position_t ubx_position;
+    // Read frame as the GPS driver does.
+    UBX_get_position(&ubx_position);
+    if (ubx_position.fix_ok != 0) {
+        test_position_count++;
+    }
+}
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Local variables.
+    NEOM8X_HW_configuration_t configuration;
+    // Reset fakes and init interface.
+    FAKE_reset();
+    test_position_count = 0;
+    configuration.uart_baud_rate = 9600;
+    configuration.rx_irq_callback = &_TEST_nmea_rx_callback;
+    TEST_assert_equal(NEOM8X_HW_init(&configuration), NEOM8X_SUCCESS);
+}
+
+/*******************************************************************/
+static void _TEST_short_replies(void) {
+    // Local variables.
+    uint8_t payload[TEST_MGA_GPS_PAYLOAD_SIZE] = { 0x00 };
+    uint8_t mga_frame[TEST_MGA_GPS_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint8_t reply[TEST_NAV_SAT_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t mga_frame_size = 0;
+    uint32_t reply_size = 0;
+    uint32_t frame_size = 0;
+    uint8_t acknowledged = 0;
+    uint8_t aop_running = 0;
+    UBX_quality_t ubx_quality;
+    _TEST_init();
+    // 16 bytes MGA-ACK of an MGA-GPS message.
+    mga_frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_MGA, TEST_UBX_ID_MGA_GPS, payload, TEST_MGA_GPS_PAYLOAD_SIZE, mga_frame);
+    payload[0] = 0x01;
+    payload[3] = TEST_UBX_ID_MGA_GPS;
+    reply_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_MGA, TEST_UBX_ID_MGA_ACK, payload, 8, reply);
+    TEST_assert_equal(reply_size, 16);
+    FAKE_gps_add_reply(TEST_UBX_CLASS_MGA, TEST_UBX_ID_MGA_GPS, reply, reply_size);
+    // 24 bytes NAV-AOPSTATUS.
+    payload[5] = 0x01;
+    reply_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_AOPSTATUS, payload, 16, reply);
+    TEST_assert_equal(reply_size, 24);
+    FAKE_gps_add_reply(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_AOPSTATUS, reply, reply_size);
+    // 26 bytes NAV-DOP: PDOP 1.50 and HDOP 0.90.
+    payload[6] = 150;
+    payload[12] = 90;
+    reply_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_DOP, payload, 18, reply);
+    TEST_assert_equal(reply_size, 26);
+    FAKE_gps_add_reply(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_DOP, reply, reply_size);
+    // 40 bytes NAV-SAT: one used GPS satellite and one tracked GLONASS satellite.
+    payload[8] = 0;
+    payload[10] = 40;
+    payload[16] = 0x08;
+    payload[20] = 6;
+    payload[22] = 30;
+    payload[28] = 0x00;
+    reply_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_SAT, payload, TEST_NAV_SAT_PAYLOAD_SIZE, reply);
+    FAKE_gps_add_reply(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_SAT, reply, reply_size);
+    // Replies shorter than the half buffer are handed over by the IDLE interrupt, without polling delay.
+    TEST_assert_equal(UBX_inject_assistance(mga_frame, mga_frame_size, &frame_size, &acknowledged), UBX_SUCCESS);
+    TEST_assert_equal(frame_size, mga_frame_size);
+    TEST_assert_equal(acknowledged, 1);
+    TEST_assert_equal(FAKE_get_delay_count(), 0);
+    TEST_assert_equal(UBX_get_autonomous_aiding_status(&aop_running), UBX_SUCCESS);
+    TEST_assert_equal(aop_running, 1);
+    TEST_assert_equal(FAKE_get_delay_count(), 0);
+    TEST_assert_equal(UBX_get_quality(&ubx_quality), UBX_SUCCESS);
+    TEST_assert_equal(ubx_quality.pdop, 150);
+    TEST_assert_equal(ubx_quality.hdop, 90);
+    TEST_assert_equal(ubx_quality.satellites_used, 1);
+    TEST_assert_equal(ubx_quality.satellites_tracked, 2);
+    TEST_assert_equal(ubx_quality.cno_max[UBX_CONSTELLATION_GPS], 40);
+    TEST_assert_equal(ubx_quality.cno_max[UBX_CONSTELLATION_GLONASS], 30);
+    // All bytes went through the DMA with one IDLE interrupt per reply.
+    TEST_assert_equal(fake_gps.rxne_irq_count, 0);
+    TEST_assert_equal(fake_gps.dma_irq_count, 1);
+    TEST_assert_equal(fake_gps.idle_irq_count, 4);
+    TEST_assert_equal(fake_gps.rx_lost_bytes, 0);
+}
+
+/*******************************************************************/
+static void _TEST_stream(void) {
+    // Local variables.
+    uint8_t payload[TEST_NAV_PVT_PAYLOAD_SIZE] = { 0x00 };
+    uint8_t stream[TEST_NAV_PVT_NUMBER_OF_FRAMES * (TEST_NAV_PVT_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES)];
+    uint32_t stream_size = 0;
+    uint32_t idx = 0;
+    _TEST_init();
+    // Valid 3D fix with 7 satellites.
+    payload[20] = 3;
+    payload[21] = 0x01;
+    payload[23] = 7;
+    for (idx = 0; idx < TEST_NAV_PVT_NUMBER_OF_FRAMES; idx++) {
+        stream_size += FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_PVT, payload, TEST_NAV_PVT_PAYLOAD_SIZE, &(stream[stream_size]));
+    }
+    TEST_assert_equal(UBX_start(UBX_MESSAGE_NAV_PVT, &_TEST_position_callback), UBX_SUCCESS);
+    FAKE_gps_receive(stream, stream_size);
+    // One interrupt per half buffer instead of one per byte.
+    TEST_assert_equal(fake_gps.rxne_irq_count, 0);
+    TEST_assert_equal(fake_gps.dma_irq_count, (stream_size / TEST_DMA_HALF_BUFFER_BYTES));
+    // Last frame tail is below the half buffer and is handed over by the IDLE interrupt.
+    TEST_assert_equal(fake_gps.idle_irq_count, 1);
+    TEST_assert_equal(test_position_count, TEST_NAV_PVT_NUMBER_OF_FRAMES);
+    TEST_assert_equal(UBX_stop(), UBX_SUCCESS);
+    TEST_assert_equal(fake_gps.rx_lost_bytes, 0);
+}
+
+/*******************************************************************/
+static void _TEST_navigation_period(void) {
+    // Local variables.
+    uint8_t payload[TEST_NAV_PVT_PAYLOAD_SIZE] = { 0x00 };
+    uint8_t frame[TEST_NAV_PVT_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t frame_size = 0;
+    uint32_t delay_count = 0;
+    uint32_t idx = 0;
+    _TEST_init();
+    // Valid 3D fix with 7 satellites.
+    payload[20] = 3;
+    payload[21] = 0x01;
+    payload[23] = 7;
+    frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_PVT, payload, TEST_NAV_PVT_PAYLOAD_SIZE, frame);
+    // 100 bytes frame: 4 bytes tail after the third half buffer interrupt.
+    TEST_assert((frame_size % TEST_DMA_HALF_BUFFER_BYTES) != 0);
+    TEST_assert_equal(UBX_start(UBX_MESSAGE_NAV_PVT, &_TEST_position_callback), UBX_SUCCESS);
+    delay_count = FAKE_get_delay_count();
+    // One frame per navigation period, without any delay in between.
+    for (idx = 0; idx < TEST_NAV_PVT_NUMBER_OF_FRAMES; idx++) {
+        FAKE_advance_milliseconds(1000);
+        FAKE_gps_receive(frame, frame_size);
+        // Each frame is decoded before the next one is sent.
+        TEST_assert_equal(test_position_count, (idx + 1));
+    }
+    TEST_assert_equal(FAKE_get_delay_count(), delay_count);
+    TEST_assert_equal(fake_gps.idle_irq_count, TEST_NAV_PVT_NUMBER_OF_FRAMES);
+    TEST_assert_equal(UBX_stop(), UBX_SUCCESS);
+    TEST_assert_equal(fake_gps.rx_lost_bytes, 0);
+}
+
+/*** TEST NEOM8X DMA functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_short_replies();
+    _TEST_stream();
+    _TEST_navigation_period();
+    return TEST_report("test_neom8x_dma");
+}
@@ -0,0 +1,565 @@
+/*
+ * test_rf_api.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "adc.h"
+#include "analog.h"
+#include "fake.h"
+#include "manuf/mcu_api.h"
+#include "manuf/rf_api.h"
+#include "nvm.h"
+#include "nvm_address.h"
+#include "power.h"
+#include "s2lp.h"
+#include "sigfox_types.h"
+#include "test.h"
+#include "tim.h"
+#include "types.h"
+#ifdef XM_TEST_SIGFOX_EP_LIB
+#include "sigfox_ep_api.h"
+#include "sigfox_rc.h"
+#endif
+
+#include <stdio.h>
+
+/*** TEST RF API local macros ***/
+
+#define TEST_RF_API_UL_FREQUENCY_HZ         868130000
+#define TEST_RF_API_UL_BIT_RATE_BPS         100
+#define TEST_RF_API_TX_POWER_DBM            14
+#define TEST_RF_API_DL_WINDOW_MS            25000
+
+#define TEST_RF_API_SYMBOL_SIZE_BYTES       80
+#define TEST_RF_API_PROFILE_SIZE            40
+#define TEST_RF_API_FDEV_IDX                20
+#define TEST_RF_API_FDEV_NEGATIVE           0x7F
+#define TEST_RF_API_FDEV_POSITIVE           0x81
+#define TEST_RF_API_FIFO_THRESHOLD_BYTES    40
+
+#define TEST_RF_API_NUMBER_OF_VECTORS       (sizeof(TEST_RF_API_VECTORS) / sizeof(TEST_RF_API_vector_t))
+
+#ifdef XM_TEST_SIGFOX_EP_LIB
+#define TEST_RF_API_NUMBER_OF_FRAMES        3
+#define TEST_RF_API_MESSAGE_COUNTER_START   4090
+#define TEST_RF_API_MESSAGE_COUNTER_MASK    0x0FFF
+#define TEST_RF_API_NUMBER_OF_MESSAGES      (sizeof(TEST_RF_API_MESSAGES) / sizeof(TEST_RF_API_message_t))
+#endif
+
+/*** TEST RF API local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    const char* name;
+    uint8_t frame_type;
+    uint8_t payload_size_bytes;
+    uint16_t message_counter;
+} TEST_RF_API_vector_t;
+
+#ifdef XM_TEST_SIGFOX_EP_LIB
+/*******************************************************************/
+typedef struct {
+    const char* name;
+    SIGFOX_application_message_type_t type;
+    uint8_t payload_size_bytes;
+} TEST_RF_API_message_t;
+#endif
+
+/*** TEST RF API local global variables ***/
+
+// Waveform definition (amplitude profiles of the polar modulator).
+static const uint8_t TEST_RF_API_RAMP_PROFILE[TEST_RF_API_PROFILE_SIZE] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 5, 7, 10, 14, 19, 25, 31, 39, 60, 220 };
+static const uint8_t TEST_RF_API_BIT0_PROFILE[TEST_RF_API_PROFILE_SIZE] = { 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 5, 7, 10, 14, 19, 25, 31, 39, 60, 220, 220, 60, 39, 31, 25, 19, 14, 10, 7, 5, 3, 3, 2, 2, 2, 1, 1, 1, 1, 1 };
+
+// Uplink frames sent directly through the RF API.
+// Vectors are played in this order since the DBPSK phase is kept from one frame to the next.
+static const TEST_RF_API_vector_t TEST_RF_API_VECTORS[] = {
+    { "empty_mc0",      0x06,  0, 0x000 },
+    { "bit0_mc1",       0x6B,  0, 0x001 },
+    { "bit1_mc2",       0x6B,  0, 0x002 },
+    { "byte1_mc3",      0x6E,  1, 0x003 },
+    { "byte4_mc255",    0x8D,  4, 0x0FF },
+    { "byte8_mc2047",   0x35,  8, 0x7FF },
+    { "byte12_mc4094",  0x94, 12, 0xFFE },
+    { "byte12_mc4095",  0x94, 12, 0xFFF },
+};
+
+// Start of the first frame, written by hand from the waveform definition:
+// ramp-up (reversed ramp profile), then the first preamble bit '1' (constant carrier).
+static const uint8_t TEST_RF_API_FIRST_SAMPLES[] = { 0x00, 0xDC, 0x00, 0x3C, 0x00, 0x27, 0x00, 0x1F };
+static const uint8_t TEST_RF_API_FIRST_BIT1_SAMPLES[] = { 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01 };
+
+#ifdef XM_TEST_SIGFOX_EP_LIB
+// Every application message type and payload size.
+static const TEST_RF_API_message_t TEST_RF_API_MESSAGES[] = {
+    { "empty",  SIGFOX_APPLICATION_MESSAGE_TYPE_EMPTY,       0 },
+    { "bit0",   SIGFOX_APPLICATION_MESSAGE_TYPE_BIT0,        0 },
+    { "bit1",   SIGFOX_APPLICATION_MESSAGE_TYPE_BIT1,        0 },
+    { "byte1",  SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY,  1 },
+    { "byte2",  SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY,  2 },
+    { "byte3",  SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY,  3 },
+    { "byte4",  SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY,  4 },
+    { "byte5",  SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY,  5 },
+    { "byte6",  SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY,  6 },
+    { "byte7",  SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY,  7 },
+    { "byte8",  SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY,  8 },
+    { "byte9",  SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY,  9 },
+    { "byte10", SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY, 10 },
+    { "byte11", SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY, 11 },
+    { "byte12", SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY, 12 },
+};
+
+static const uint8_t TEST_RF_API_EP_ID[SIGFOX_EP_ID_SIZE_BYTES] = { 0x00, 0x4D, 0x33, 0x1A };
+#endif
+
+// FIPS-197 appendix C.1 AES-128 vector.
+static const uint8_t TEST_RF_API_AES_KEY[SIGFOX_EP_KEY_SIZE_BYTES] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F };
+static const uint8_t TEST_RF_API_AES_PLAINTEXT[SIGFOX_EP_KEY_SIZE_BYTES] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+static const uint8_t TEST_RF_API_AES_CIPHERTEXT[SIGFOX_EP_KEY_SIZE_BYTES] = { 0x69, 0xC4, 0xE0, 0xD8, 0x6A, 0x7B, 0x04, 0x30, 0xD8, 0xCD, 0xB7, 0x80, 0x70, 0xB4, 0xC5, 0x5A };
+
+static uint8_t test_rf_api_expected_stream[FAKE_S2LP_STREAM_SIZE_BYTES];
+static uint8_t test_rf_api_reference_fdev = 0;
+static uint8_t test_rf_api_demodulator_fdev = 0;
+
+/*** TEST RF API local functions ***/
+
+/*******************************************************************/
+static uint8_t _TEST_build_bitstream(const TEST_RF_API_vector_t* vector, uint8_t* bitstream) {
+    // Local variables.
+    uint8_t size = (uint8_t) (14 + vector->payload_size_bytes);
+    uint32_t lfsr = (0xACE10000 | ((uint32_t) vector->frame_type << 12) | vector->message_counter);
+    uint8_t idx = 0;
+    // Preamble and frame type.
+    bitstream[0] = 0xAA;
+    bitstream[1] = 0xAA;
+    bitstream[2] = (uint8_t) (0xA0 | (vector->payload_size_bytes & 0x0F));
+    bitstream[3] = vector->frame_type;
+    // Message counter.
+    bitstream[4] = (uint8_t) ((vector->message_counter >> 8) & 0x0F);
+    bitstream[5] = (uint8_t) ((vector->message_counter >> 0) & 0xFF);
+    // Remaining fields (ID, payload, authentication and CRC) are synthetic.
+    for (idx = 6; idx < size; idx++) {
+        lfsr = (lfsr >> 1) ^ ((lfsr & 0b1) ? 0xEDB88320 : 0);
+        bitstream[idx] = (uint8_t) (lfsr & 0xFF);
+    }
+    return size;
+}
+
+/*******************************************************************/
+static void _TEST_append_symbol(uint32_t* size, uint8_t deviation, const uint8_t* amplitude, uint8_t constant_amplitude) {
+    // Local variables.
+    uint8_t idx = 0;
+    for (idx = 0; idx < TEST_RF_API_PROFILE_SIZE; idx++) {
+        test_rf_api_expected_stream[(*size)++] = (idx == TEST_RF_API_FDEV_IDX) ? deviation : 0;
+        test_rf_api_expected_stream[(*size)++] = (amplitude == NULL) ? constant_amplitude : amplitude[idx];
+    }
+}
+
+/*******************************************************************/
+static uint32_t _TEST_reference_modulator(const uint8_t* bitstream, uint8_t bitstream_size_bytes) {
+    // Local variables.
+    uint8_t ramp_up[TEST_RF_API_PROFILE_SIZE];
+    uint32_t size = 0;
+    uint16_t bit_idx = 0;
+    uint8_t idx = 0;
+    // Ramp-up.
+    for (idx = 0; idx < TEST_RF_API_PROFILE_SIZE; idx++) {
+        ramp_up[idx] = TEST_RF_API_RAMP_PROFILE[TEST_RF_API_PROFILE_SIZE - idx - 1];
+    }
+    _TEST_append_symbol(&size, 0, ramp_up, 0);
+    // DBPSK symbols: phase shift on bit 0, constant carrier on bit 1.
+    for (bit_idx = 0; bit_idx < (bitstream_size_bytes * 8); bit_idx++) {
+        if ((bitstream[bit_idx >> 3] & (1 << (7 - (bit_idx & 0x07)))) == 0) {
+            test_rf_api_reference_fdev = (test_rf_api_reference_fdev == TEST_RF_API_FDEV_NEGATIVE) ? TEST_RF_API_FDEV_POSITIVE : TEST_RF_API_FDEV_NEGATIVE;
+            _TEST_append_symbol(&size, test_rf_api_reference_fdev, TEST_RF_API_BIT0_PROFILE, 0);
+        }
+        else {
+            _TEST_append_symbol(&size, 0, NULL, TEST_RF_API_BIT0_PROFILE[0]);
+        }
+    }
+    // Ramp-down.
+    _TEST_append_symbol(&size, 0, TEST_RF_API_RAMP_PROFILE, 0);
+    // First half of the padding bit (the radio is stopped on the next almost empty interrupt).
+    for (idx = 0; idx < (TEST_RF_API_SYMBOL_SIZE_BYTES - TEST_RF_API_FIFO_THRESHOLD_BYTES); idx++) {
+        test_rf_api_expected_stream[size++] = 0;
+    }
+    return size;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_demodulate_frame(uint32_t offset, uint8_t* bitstream, uint8_t* bitstream_size_bytes) {
+    // Local variables.
+    const uint8_t* symbol = NULL;
+    uint16_t bit_idx = 0;
+    uint8_t fdev = 0;
+    // Ramp-up starts at full amplitude.
+    if ((offset + TEST_RF_API_SYMBOL_SIZE_BYTES) > fake_s2lp.stream_size_bytes) goto errors;
+    if (fake_s2lp.stream[offset + 1] != TEST_RF_API_RAMP_PROFILE[TEST_RF_API_PROFILE_SIZE - 1]) goto errors;
+    offset += TEST_RF_API_SYMBOL_SIZE_BYTES;
+    // Symbols until the ramp-down, which ends at full amplitude.
+    while (1) {
+        if ((offset + TEST_RF_API_SYMBOL_SIZE_BYTES) > fake_s2lp.stream_size_bytes) goto errors;
+        symbol = &(fake_s2lp.stream[offset]);
+        offset += TEST_RF_API_SYMBOL_SIZE_BYTES;
+        fdev = symbol[TEST_RF_API_FDEV_IDX << 1];
+        if ((fdev == 0) && (symbol[TEST_RF_API_SYMBOL_SIZE_BYTES - 1] == TEST_RF_API_RAMP_PROFILE[TEST_RF_API_PROFILE_SIZE - 1])) break;
+        if (bit_idx >= (SIGFOX_UL_BITSTREAM_SIZE_BYTES * 8)) goto errors;
+        if ((bit_idx & 0x07) == 0) {
+            bitstream[bit_idx >> 3] = 0;
+        }
+        if (fdev == 0) {
+            bitstream[bit_idx >> 3] |= (uint8_t) (1 << (7 - (bit_idx & 0x07)));
+        }
+        else {
+            // Each bit 0 must reverse the phase.
+            if (fdev == test_rf_api_demodulator_fdev) goto errors;
+            test_rf_api_demodulator_fdev = fdev;
+        }
+        bit_idx++;
+    }
+    if ((bit_idx & 0x07) != 0) goto errors;
+    (*bitstream_size_bytes) = (uint8_t) (bit_idx >> 3);
+    // Skip first half of the padding bit.
+    return (offset + (TEST_RF_API_SYMBOL_SIZE_BYTES - TEST_RF_API_FIFO_THRESHOLD_BYTES));
+errors:
+    return 0;
+}
+
+/*******************************************************************/
+static void _TEST_check_stream(uint32_t offset, uint32_t expected_size, const char* name) {
+    // Local variables.
+    uint32_t byte_idx = 0;
+    for (byte_idx = 0; byte_idx < expected_size; byte_idx++) {
+        if (((offset + byte_idx) >= fake_s2lp.stream_size_bytes) || (fake_s2lp.stream[offset + byte_idx] != test_rf_api_expected_stream[byte_idx])) {
+            TEST_failure(__FILE__, __LINE__, "FIFO stream differs from reference modulator");
+            printf("%s: first difference at byte %u\n", name, (unsigned int) (offset + byte_idx));
+            break;
+        }
+    }
+}
+
+/*******************************************************************/
+static RF_API_status_t _TEST_send_frame(uint8_t* bitstream, uint8_t bitstream_size_bytes) {
+    // Local variables.
+    RF_API_status_t status = RF_API_SUCCESS;
+    RF_API_radio_parameters_t radio_parameters;
+    RF_API_tx_data_t tx_data;
+    // Same sequence as the Sigfox library for one uplink frame.
+    radio_parameters.rf_mode = RF_API_MODE_TX;
+    radio_parameters.frequency_hz = TEST_RF_API_UL_FREQUENCY_HZ;
+    radio_parameters.modulation = RF_API_MODULATION_DBPSK;
+    radio_parameters.bit_rate_bps = TEST_RF_API_UL_BIT_RATE_BPS;
+    radio_parameters.tx_power_dbm_eirp = TEST_RF_API_TX_POWER_DBM;
+    radio_parameters.deviation_hz = 0;
+    tx_data.bitstream = bitstream;
+    tx_data.bitstream_size_bytes = bitstream_size_bytes;
+    status = RF_API_wake_up();
+    if (status != RF_API_SUCCESS) goto errors;
+    status = RF_API_init(&radio_parameters);
+    if (status != RF_API_SUCCESS) goto errors;
+    status = RF_API_send(&tx_data);
+    if (status != RF_API_SUCCESS) goto errors;
+errors:
+    RF_API_de_init();
+    RF_API_sleep();
+    return status;
+}
+
+/*******************************************************************/
+static void _TEST_print_header(void) {
+    // CPU cycles are not reported: host cycles do not model the target core and the Cortex-M0+ has no DWT cycle counter,
+    // so the cost on target can only be measured with SysTick around RF_API_send(). The metrics below are deterministic
+    // work units of the bitstream path: one FIFO refill is one almost empty interrupt and one SPI burst.
+    printf("%-16s %6s %8s %7s %10s %8s %9s %9s\n", "frame", "bits", "stream", "writes", "spi_bytes", "wakeups", "fifo_min", "fifo_max");
+}
+
+/*******************************************************************/
+static void _TEST_print_metrics(const char* name, uint32_t number_of_bits) {
+    printf("%-16s %6u %8u %7u %10u %8u %9u %9u\n", name, (unsigned int) number_of_bits, (unsigned int) fake_s2lp.stream_size_bytes, (unsigned int) fake_s2lp.fifo_write_count,
+        (unsigned int) fake_s2lp.fifo_write_bytes, (unsigned int) fake_s2lp.wake_up_count, (unsigned int) fake_s2lp.fifo_level_min, (unsigned int) fake_s2lp.fifo_level_max);
+}
+
+/*******************************************************************/
+static void _TEST_uplink_vectors(void) {
+    // Local variables.
+    const TEST_RF_API_vector_t* vector = NULL;
+    uint8_t bitstream[SIGFOX_UL_BITSTREAM_SIZE_BYTES];
+    uint8_t demodulated[SIGFOX_UL_BITSTREAM_SIZE_BYTES];
+    uint8_t bitstream_size_bytes = 0;
+    uint8_t demodulated_size_bytes = 0;
+    uint32_t expected_size = 0;
+    uint32_t vector_idx = 0;
+    uint32_t idx = 0;
+    FAKE_reset();
+    _TEST_print_header();
+    for (vector_idx = 0; vector_idx < TEST_RF_API_NUMBER_OF_VECTORS; vector_idx++) {
+        vector = &(TEST_RF_API_VECTORS[vector_idx]);
+        FAKE_s2lp_reset();
+        bitstream_size_bytes = _TEST_build_bitstream(vector, bitstream);
+        // Send frame through the real RF API and the transceiver model.
+        TEST_assert_equal(_TEST_send_frame(bitstream, bitstream_size_bytes), RF_API_SUCCESS);
+        // Hand written samples of the first frame.
+        if (vector_idx == 0) {
+            for (idx = 0; idx < sizeof(TEST_RF_API_FIRST_SAMPLES); idx++) {
+                TEST_assert_equal(fake_s2lp.stream[idx], TEST_RF_API_FIRST_SAMPLES[idx]);
+                TEST_assert_equal(fake_s2lp.stream[TEST_RF_API_SYMBOL_SIZE_BYTES + idx], TEST_RF_API_FIRST_BIT1_SAMPLES[idx]);
+            }
+            // Second preamble bit '0': first phase reversal at the peak of the amplitude profile.
+            TEST_assert_equal(fake_s2lp.stream[(2 * TEST_RF_API_SYMBOL_SIZE_BYTES) + (TEST_RF_API_FDEV_IDX << 1)], TEST_RF_API_FDEV_NEGATIVE);
+            TEST_assert_equal(fake_s2lp.stream[(2 * TEST_RF_API_SYMBOL_SIZE_BYTES) + (TEST_RF_API_FDEV_IDX << 1) + 1], 220);
+        }
+        // Compare with reference modulator.
+        expected_size = _TEST_reference_modulator(bitstream, bitstream_size_bytes);
+        TEST_assert_equal(fake_s2lp.stream_size_bytes, expected_size);
+        _TEST_check_stream(0, expected_size, vector->name);
+        // Demodulated stream must give the input bitstream back.
+        TEST_assert_equal(_TEST_demodulate_frame(0, demodulated, &demodulated_size_bytes), expected_size);
+        TEST_assert_equal(demodulated_size_bytes, bitstream_size_bytes);
+        for (idx = 0; idx < bitstream_size_bytes; idx++) {
+            TEST_assert_equal(demodulated[idx], bitstream[idx]);
+        }
+        // FIFO must never overflow nor run out of samples.
+        TEST_assert_equal(fake_s2lp.fifo_overflow, 0);
+        TEST_assert_equal(fake_s2lp.fifo_underrun, 0);
+        TEST_assert_equal(fake_s2lp.fifo_write_count, (uint32_t) ((bitstream_size_bytes * 8) + 3));
+        _TEST_print_metrics(vector->name, (uint32_t) (bitstream_size_bytes * 8));
+    }
+}
+
+/*******************************************************************/
+static void _TEST_mcu_api(void) {
+    // Local variables.
+    MCU_API_config_t mcu_api_config;
+    MCU_API_timer_t timer;
+    MCU_API_encryption_data_t aes_data;
+    sfx_u8 data[SIGFOX_EP_KEY_SIZE_BYTES];
+    sfx_u8 nvm_data[SIGFOX_NVM_DATA_SIZE_BYTES] = { 0x12, 0x34, 0x0F, 0xFE };
+    sfx_u16 voltage_idle_mv = 0;
+    sfx_u16 voltage_tx_mv = 0;
+    sfx_s16 temperature_tenth_degrees = 0;
+    sfx_u32 latency_ms = 0;
+    sfx_bool timer_has_elapsed = SIGFOX_TRUE;
+    uint32_t start_ms = 0;
+    uint8_t idx = 0;
+    FAKE_reset();
+    mcu_api_config.rc = NULL;
+    // Device ID, key and library data are read from the NVM.
+    for (idx = 0; idx < SIGFOX_EP_ID_SIZE_BYTES; idx++) {
+        NVM_write_byte((NVM_ADDRESS_SIGFOX_EP_ID + idx), (uint8_t) (0xC0 + idx));
+    }
+    for (idx = 0; idx < SIGFOX_EP_KEY_SIZE_BYTES; idx++) {
+        NVM_write_byte((NVM_ADDRESS_SIGFOX_EP_KEY + idx), TEST_RF_API_AES_KEY[idx]);
+    }
+    TEST_assert_equal(MCU_API_get_ep_id(data, SIGFOX_EP_ID_SIZE_BYTES), MCU_API_SUCCESS);
+    for (idx = 0; idx < SIGFOX_EP_ID_SIZE_BYTES; idx++) {
+        TEST_assert_equal(data[idx], (0xC0 + idx));
+    }
+    TEST_assert_equal(MCU_API_set_nvm(nvm_data, SIGFOX_NVM_DATA_SIZE_BYTES), MCU_API_SUCCESS);
+    for (idx = 0; idx < SIGFOX_NVM_DATA_SIZE_BYTES; idx++) {
+        data[idx] = 0;
+    }
+    TEST_assert_equal(MCU_API_get_nvm(data, SIGFOX_NVM_DATA_SIZE_BYTES), MCU_API_SUCCESS);
+    for (idx = 0; idx < SIGFOX_NVM_DATA_SIZE_BYTES; idx++) {
+        TEST_assert_equal(data[idx], nvm_data[idx]);
+    }
+    // Encryption with the NVM key.
+    for (idx = 0; idx < SIGFOX_EP_KEY_SIZE_BYTES; idx++) {
+        data[idx] = TEST_RF_API_AES_PLAINTEXT[idx];
+    }
+    aes_data.data = data;
+    aes_data.data_size_bytes = SIGFOX_EP_KEY_SIZE_BYTES;
+    TEST_assert_equal(MCU_API_aes_128_cbc_encrypt(&aes_data), MCU_API_SUCCESS);
+    for (idx = 0; idx < SIGFOX_EP_KEY_SIZE_BYTES; idx++) {
+        TEST_assert_equal(data[idx], TEST_RF_API_AES_CIPHERTEXT[idx]);
+    }
+    // Analog measurements, with the analog domain released afterwards.
+    FAKE_set_analog_data(ANALOG_CHANNEL_VMCU_MV, 3270);
+    FAKE_set_analog_data(ANALOG_CHANNEL_TMCU_DEGREES, 23);
+    TEST_assert_equal(MCU_API_get_voltage_temperature(&voltage_idle_mv, &voltage_tx_mv, &temperature_tenth_degrees), MCU_API_SUCCESS);
+    TEST_assert_equal(voltage_idle_mv, 3270);
+    TEST_assert_equal(voltage_tx_mv, 3270);
+    TEST_assert_equal(temperature_tenth_degrees, 230);
+    TEST_assert_equal(FAKE_get_power_request_count(POWER_REQUESTER_ID_MCU_API), 1);
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_ANALOG), 0);
+    TEST_assert_equal(MCU_API_get_latency(MCU_API_LATENCY_GET_VOLTAGE_TEMPERATURE, &latency_ms), MCU_API_SUCCESS);
+    TEST_assert_equal(latency_ms, ADC_INIT_DELAY_MS);
+    TEST_assert(MCU_API_get_latency(MCU_API_LATENCY_LAST, &latency_ms) != MCU_API_SUCCESS);
+    // Inter-frame timer waits in low power mode.
+    TEST_assert_equal(MCU_API_open(&mcu_api_config), MCU_API_SUCCESS);
+    TEST_assert_equal(fake_tim.initialized, 1);
+    timer.instance = MCU_API_TIMER_INSTANCE_T_IFX;
+    timer.reason = MCU_API_TIMER_REASON_T_IFX;
+    timer.duration_ms = 1000;
+    start_ms = FAKE_get_milliseconds();
+    TEST_assert_equal(MCU_API_timer_start(&timer), MCU_API_SUCCESS);
+    TEST_assert_equal(fake_tim.channel_waiting_mode[MCU_API_TIMER_INSTANCE_T_IFX], TIM_WAITING_MODE_LOW_POWER_SLEEP);
+    TEST_assert_equal(MCU_API_timer_status(MCU_API_TIMER_INSTANCE_T_IFX, &timer_has_elapsed), MCU_API_SUCCESS);
+    TEST_assert_equal(timer_has_elapsed, SIGFOX_FALSE);
+    TEST_assert_equal(MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_T_IFX), MCU_API_SUCCESS);
+    TEST_assert_equal((FAKE_get_milliseconds() - start_ms), 1000);
+    TEST_assert_equal(MCU_API_timer_status(MCU_API_TIMER_INSTANCE_T_IFX, &timer_has_elapsed), MCU_API_SUCCESS);
+    TEST_assert_equal(timer_has_elapsed, SIGFOX_TRUE);
+    TEST_assert_equal(MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_T_IFX), MCU_API_SUCCESS);
+    TEST_assert(MCU_API_timer_start(NULL) != MCU_API_SUCCESS);
+    TEST_assert_equal(MCU_API_close(), MCU_API_SUCCESS);
+    TEST_assert_equal(fake_tim.initialized, 0);
+}
+
+/*******************************************************************/
+static void _TEST_downlink(void) {
+    // Local variables.
+    MCU_API_config_t mcu_api_config;
+    MCU_API_timer_t timer;
+    RF_API_radio_parameters_t radio_parameters;
+    RF_API_rx_data_t rx_data;
+    uint8_t dl_phy_content[SIGFOX_DL_PHY_CONTENT_SIZE_BYTES];
+    int16_t dl_rssi_dbm = 0;
+    uint32_t start_ms = 0;
+    uint8_t idx = 0;
+    FAKE_reset();
+    mcu_api_config.rc = NULL;
+    radio_parameters.rf_mode = RF_API_MODE_RX;
+    radio_parameters.frequency_hz = 869525000;
+    radio_parameters.modulation = RF_API_MODULATION_GFSK;
+    radio_parameters.bit_rate_bps = 600;
+    radio_parameters.tx_power_dbm_eirp = 0;
+    radio_parameters.deviation_hz = 800;
+    // Reception window timer, started as the Sigfox library does before RF_API_receive().
+    timer.instance = MCU_API_TIMER_INSTANCE_T_RX;
+    timer.reason = MCU_API_TIMER_REASON_T_RX;
+    timer.duration_ms = TEST_RF_API_DL_WINDOW_MS;
+    TEST_assert_equal(MCU_API_open(&mcu_api_config), MCU_API_SUCCESS);
+    // Frame received.
+    fake_s2lp.dl_available = 1;
+    fake_s2lp.rssi_dbm = -121;
+    for (idx = 0; idx < SIGFOX_DL_PHY_CONTENT_SIZE_BYTES; idx++) {
+        fake_s2lp.dl_phy_content[idx] = (uint8_t) (0xA0 + idx);
+    }
+    TEST_assert_equal(RF_API_wake_up(), RF_API_SUCCESS);
+    TEST_assert_equal(RF_API_init(&radio_parameters), RF_API_SUCCESS);
+    TEST_assert_equal(MCU_API_timer_start(&timer), MCU_API_SUCCESS);
+    // T_RX completion is polled by RF_API_receive(), not waited in low power mode.
+    TEST_assert_equal(fake_tim.channel_waiting_mode[MCU_API_TIMER_INSTANCE_T_RX], TIM_WAITING_MODE_ACTIVE);
+    TEST_assert_equal(RF_API_receive(&rx_data), RF_API_SUCCESS);
+    TEST_assert_equal(MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_T_RX), MCU_API_SUCCESS);
+    TEST_assert_equal(rx_data.data_received, SIGFOX_TRUE);
+    TEST_assert_equal(RF_API_get_dl_phy_content_and_rssi(dl_phy_content, SIGFOX_DL_PHY_CONTENT_SIZE_BYTES, &dl_rssi_dbm), RF_API_SUCCESS);
+    for (idx = 0; idx < SIGFOX_DL_PHY_CONTENT_SIZE_BYTES; idx++) {
+        TEST_assert_equal(dl_phy_content[idx], (0xA0 + idx));
+    }
+    TEST_assert_equal(dl_rssi_dbm, -121);
+    // Reception window timeout: the MCU sleeps until the T_RX timer interrupt.
+    start_ms = FAKE_get_milliseconds();
+    TEST_assert_equal(MCU_API_timer_start(&timer), MCU_API_SUCCESS);
+    TEST_assert_equal(RF_API_receive(&rx_data), RF_API_SUCCESS);
+    TEST_assert_equal(MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_T_RX), MCU_API_SUCCESS);
+    TEST_assert_equal(rx_data.data_received, SIGFOX_FALSE);
+    TEST_assert_equal((FAKE_get_milliseconds() - start_ms), TEST_RF_API_DL_WINDOW_MS);
+    TEST_assert_equal(fake_s2lp.state, S2LP_STATE_READY);
+    RF_API_de_init();
+    RF_API_sleep();
+    TEST_assert_equal(MCU_API_close(), MCU_API_SUCCESS);
+}
+
+#ifdef XM_TEST_SIGFOX_EP_LIB
+/*******************************************************************/
+static void _TEST_ep_api_messages(void) {
+    // Local variables.
+    const TEST_RF_API_message_t* message = NULL;
+    SIGFOX_EP_API_config_t lib_config;
+    SIGFOX_EP_API_application_message_t application_message;
+    sfx_u8 ul_payload[SIGFOX_UL_PAYLOAD_MAX_SIZE_BYTES];
+    uint8_t frames[TEST_RF_API_NUMBER_OF_FRAMES][SIGFOX_UL_BITSTREAM_SIZE_BYTES];
+    uint8_t frame_size_bytes[TEST_RF_API_NUMBER_OF_FRAMES];
+    uint32_t frame_offset[TEST_RF_API_NUMBER_OF_FRAMES + 1];
+    uint32_t expected_size = 0;
+    uint16_t message_counter = 0;
+    uint16_t previous_message_counter = 0;
+    uint8_t rollover_done = 0;
+    uint32_t message_idx = 0;
+    uint8_t frame_idx = 0;
+    uint8_t idx = 0;
+    FAKE_reset();
+    // Device ID and message counter close to the rollover.
+    for (idx = 0; idx < SIGFOX_EP_ID_SIZE_BYTES; idx++) {
+        NVM_write_byte((NVM_ADDRESS_SIGFOX_EP_ID + idx), TEST_RF_API_EP_ID[idx]);
+    }
+    NVM_write_byte((NVM_ADDRESS_SIGFOX_EP_LIB_DATA + SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_MSB), (uint8_t) (TEST_RF_API_MESSAGE_COUNTER_START >> 8));
+    NVM_write_byte((NVM_ADDRESS_SIGFOX_EP_LIB_DATA + SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_LSB), (uint8_t) (TEST_RF_API_MESSAGE_COUNTER_START & 0xFF));
+    lib_config.rc = &SIGFOX_RC1;
+    for (message_idx = 0; message_idx < TEST_RF_API_NUMBER_OF_MESSAGES; message_idx++) {
+        message = &(TEST_RF_API_MESSAGES[message_idx]);
+        FAKE_s2lp_reset();
+        for (idx = 0; idx < SIGFOX_UL_PAYLOAD_MAX_SIZE_BYTES; idx++) {
+            ul_payload[idx] = (sfx_u8) (0x5A ^ (message_idx << 4) ^ idx);
+        }
+        // Same message structure as the UHFM node.
+        application_message.common_parameters.number_of_frames = TEST_RF_API_NUMBER_OF_FRAMES;
+        application_message.common_parameters.ul_bit_rate = SIGFOX_UL_BIT_RATE_100BPS;
+#ifdef SIGFOX_EP_PUBLIC_KEY_CAPABLE
+        application_message.common_parameters.ep_key_type = SIGFOX_EP_KEY_PRIVATE;
+#endif
+        application_message.type = message->type;
+        application_message.bidirectional_flag = SIGFOX_FALSE;
+        application_message.ul_payload = ul_payload;
+        application_message.ul_payload_size_bytes = message->payload_size_bytes;
+        TEST_assert_equal(SIGFOX_EP_API_open(&lib_config), SIGFOX_EP_API_SUCCESS);
+        TEST_assert_equal(SIGFOX_EP_API_send_application_message(&application_message), SIGFOX_EP_API_SUCCESS);
+        SIGFOX_EP_API_close();
+        // Demodulate the frames and check the waveform against the reference modulator.
+        frame_offset[0] = 0;
+        for (frame_idx = 0; frame_idx < TEST_RF_API_NUMBER_OF_FRAMES; frame_idx++) {
+            frame_offset[frame_idx + 1] = _TEST_demodulate_frame(frame_offset[frame_idx], frames[frame_idx], &(frame_size_bytes[frame_idx]));
+            TEST_assert(frame_offset[frame_idx + 1] != 0);
+            if (frame_offset[frame_idx + 1] == 0) break;
+            expected_size = _TEST_reference_modulator(frames[frame_idx], frame_size_bytes[frame_idx]);
+            TEST_assert_equal((frame_offset[frame_idx + 1] - frame_offset[frame_idx]), expected_size);
+            _TEST_check_stream(frame_offset[frame_idx], expected_size, message->name);
+            // Preamble.
+            TEST_assert_equal(frames[frame_idx][0], 0xAA);
+            TEST_assert_equal(frames[frame_idx][1], 0xAA);
+            TEST_assert_equal((frames[frame_idx][2] & 0xF0), 0xA0);
+            TEST_assert_equal(frame_size_bytes[frame_idx], frame_size_bytes[0]);
+        }
+        if (frame_idx != TEST_RF_API_NUMBER_OF_FRAMES) continue;
+        TEST_assert_equal(frame_offset[TEST_RF_API_NUMBER_OF_FRAMES], fake_s2lp.stream_size_bytes);
+        // First frame: EP ID (LSB first) and payload in clear.
+        TEST_assert(frame_size_bytes[0] >= (10 + message->payload_size_bytes + 4));
+        for (idx = 0; idx < SIGFOX_EP_ID_SIZE_BYTES; idx++) {
+            TEST_assert_equal(frames[0][6 + idx], TEST_RF_API_EP_ID[SIGFOX_EP_ID_SIZE_BYTES - 1 - idx]);
+        }
+        for (idx = 0; idx < message->payload_size_bytes; idx++) {
+            TEST_assert_equal(frames[0][10 + idx], ul_payload[idx]);
+        }
+        // Message counter is incremented modulo 4096.
+        message_counter = (uint16_t) ((((uint16_t) frames[0][4] << 8) | frames[0][5]) & TEST_RF_API_MESSAGE_COUNTER_MASK);
+        if (message_idx != 0) {
+            TEST_assert_equal(message_counter, ((previous_message_counter + 1) & TEST_RF_API_MESSAGE_COUNTER_MASK));
+            if (message_counter < previous_message_counter) {
+                rollover_done = 1;
+            }
+        }
+        previous_message_counter = message_counter;
+        // FIFO must never overflow nor run out of samples.
+        TEST_assert_equal(fake_s2lp.fifo_overflow, 0);
+        TEST_assert_equal(fake_s2lp.fifo_underrun, 0);
+        _TEST_print_metrics(message->name, (uint32_t) (frame_size_bytes[0] * 8 * TEST_RF_API_NUMBER_OF_FRAMES));
+    }
+    TEST_assert_equal(rollover_done, 1);
+}
+#endif
+
+/*** TEST RF API functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_uplink_vectors();
+#ifdef XM_TEST_SIGFOX_EP_LIB
+    _TEST_ep_api_messages();
+#endif
+    _TEST_mcu_api();
+    _TEST_downlink();
+    return TEST_report("test_rf_api");
+}
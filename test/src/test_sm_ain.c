@@ -0,0 +1,164 @@
+/*
+ * test_sm_ain.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "adc.h"
+#include "analog.h"
+#include "fake.h"
+#include "node.h"
+#include "sm.h"
+#include "sm_ext_registers.h"
+#include "sm_registers.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST SM AIN local macros ***/
+
+#define TEST_ADC_CHANNEL_AIN0           ADC_CHANNEL_IN5
+#define TEST_ADC_CHANNEL_AIN1           ADC_CHANNEL_IN6
+#define TEST_ADC_VREFINT_3000MV         1638
+#define TEST_ADC_VREFINT_2400MV         2048
+#define TEST_VMCU_MV                    3000
+
+// One third of the ADC full scale.
+#define TEST_ADC_THIRD                  1365
+#define TEST_THIRD_MV                   1000
+#define TEST_THIRD_PERMILLE             333
+
+#define TEST_ATTENUATION                10
+#define TEST_AMPLIFICATION              2
+
+// 4-20mA loop on a 150 ohms shunt resistor.
+#define TEST_SHUNT_OHMS                 150
+#define TEST_ADC_4MA                    819
+#define TEST_ADC_20MA                   ADC_FULL_SCALE
+#define TEST_4MA_UA                     4000
+#define TEST_20MA_UA                    20000
+
+/*** TEST SM AIN local functions ***/
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Local variables.
+    int32_t vmcu_mv = 0;
+    // Reset fakes with a 3V supply.
+    FAKE_reset();
+    TEST_assert_equal(ANALOG_init(), ANALOG_SUCCESS);
+    FAKE_set_adc_data(ADC_CHANNEL_VREFINT, TEST_ADC_VREFINT_3000MV);
+    TEST_assert_equal(ANALOG_convert_channel(ANALOG_CHANNEL_VMCU_MV, &vmcu_mv), ANALOG_SUCCESS);
+    TEST_assert_equal(vmcu_mv, TEST_VMCU_MV);
+    NODE_init();
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return SWREG_read_field(reg_value, field_mask);
+}
+
+/*******************************************************************/
+static NODE_status_t _TEST_set_ain_configuration(uint8_t ain_index, uint32_t input_type, uint32_t gain_type, uint32_t gain) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Write front-end as the bus master does.
+    SWREG_write_field(&reg_value, &reg_mask, input_type, SM_REGISTER_AIN_CONFIGURATION_MASK_TYPE);
+    SWREG_write_field(&reg_value, &reg_mask, gain_type, SM_REGISTER_AIN_CONFIGURATION_MASK_GT);
+    SWREG_write_field(&reg_value, &reg_mask, gain, SM_REGISTER_AIN_CONFIGURATION_MASK_GAIN);
+    return NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, (SM_REGISTER_ADDRESS_AIN_CONFIGURATION_0 + ain_index), reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static int32_t _TEST_convert(ANALOG_channel_t channel) {
+    // Local variables.
+    int32_t analog_data = 0;
+    TEST_assert_equal(ANALOG_convert_channel(channel, &analog_data), ANALOG_SUCCESS);
+    return analog_data;
+}
+
+/*******************************************************************/
+static void _TEST_scale(void) {
+    // Local variables.
+    int32_t vmcu_mv = 0;
+    _TEST_init();
+    FAKE_set_adc_data(TEST_ADC_CHANNEL_AIN0, TEST_ADC_THIRD);
+    // Voltage input.
+    TEST_assert_equal(ANALOG_set_channel_configuration(ANALOG_CHANNEL_AIN0_MV, ANALOG_INPUT_TYPE_VOLTAGE, ANALOG_GAIN_TYPE_ATTENUATION, 1), ANALOG_SUCCESS);
+    TEST_assert_equal(_TEST_convert(ANALOG_CHANNEL_AIN0_MV), TEST_THIRD_MV);
+    TEST_assert_equal(ANALOG_set_channel_configuration(ANALOG_CHANNEL_AIN0_MV, ANALOG_INPUT_TYPE_VOLTAGE, ANALOG_GAIN_TYPE_ATTENUATION, TEST_ATTENUATION), ANALOG_SUCCESS);
+    TEST_assert_equal(_TEST_convert(ANALOG_CHANNEL_AIN0_MV), (TEST_THIRD_MV * TEST_ATTENUATION));
+    TEST_assert_equal(ANALOG_set_channel_configuration(ANALOG_CHANNEL_AIN0_MV, ANALOG_INPUT_TYPE_VOLTAGE, ANALOG_GAIN_TYPE_AMPLIFICATION, TEST_AMPLIFICATION), ANALOG_SUCCESS);
+    TEST_assert_equal(_TEST_convert(ANALOG_CHANNEL_AIN0_MV), (TEST_THIRD_MV / TEST_AMPLIFICATION));
+    // Current loop.
+    TEST_assert_equal(ANALOG_set_channel_configuration(ANALOG_CHANNEL_AIN0_MV, ANALOG_INPUT_TYPE_CURRENT_4_20MA, ANALOG_GAIN_TYPE_ATTENUATION, TEST_SHUNT_OHMS), ANALOG_SUCCESS);
+    FAKE_set_adc_data(TEST_ADC_CHANNEL_AIN0, TEST_ADC_4MA);
+    TEST_assert_equal(_TEST_convert(ANALOG_CHANNEL_AIN0_MV), TEST_4MA_UA);
+    FAKE_set_adc_data(TEST_ADC_CHANNEL_AIN0, TEST_ADC_20MA);
+    TEST_assert_equal(_TEST_convert(ANALOG_CHANNEL_AIN0_MV), TEST_20MA_UA);
+    // Ratiometric input does not depend on the supply voltage.
+    TEST_assert_equal(ANALOG_set_channel_configuration(ANALOG_CHANNEL_AIN0_MV, ANALOG_INPUT_TYPE_RATIOMETRIC, ANALOG_GAIN_TYPE_ATTENUATION, 1), ANALOG_SUCCESS);
+    FAKE_set_adc_data(TEST_ADC_CHANNEL_AIN0, TEST_ADC_THIRD);
+    TEST_assert_equal(_TEST_convert(ANALOG_CHANNEL_AIN0_MV), TEST_THIRD_PERMILLE);
+    FAKE_set_adc_data(ADC_CHANNEL_VREFINT, TEST_ADC_VREFINT_2400MV);
+    vmcu_mv = _TEST_convert(ANALOG_CHANNEL_VMCU_MV);
+    TEST_assert(vmcu_mv != TEST_VMCU_MV);
+    TEST_assert_equal(_TEST_convert(ANALOG_CHANNEL_AIN0_MV), TEST_THIRD_PERMILLE);
+    // Voltage input follows the supply voltage.
+    TEST_assert_equal(ANALOG_set_channel_configuration(ANALOG_CHANNEL_AIN0_MV, ANALOG_INPUT_TYPE_VOLTAGE, ANALOG_GAIN_TYPE_ATTENUATION, 1), ANALOG_SUCCESS);
+    TEST_assert_equal(_TEST_convert(ANALOG_CHANNEL_AIN0_MV), ((TEST_ADC_THIRD * vmcu_mv) / ADC_FULL_SCALE));
+}
+
+/*******************************************************************/
+static void _TEST_invalid_configuration(void) {
+    _TEST_init();
+    TEST_assert_equal(ANALOG_set_channel_configuration(ANALOG_CHANNEL_AIN0_MV, ANALOG_INPUT_TYPE_LAST, ANALOG_GAIN_TYPE_ATTENUATION, 1), ANALOG_ERROR_INPUT_TYPE);
+    TEST_assert_equal(ANALOG_set_channel_configuration(ANALOG_CHANNEL_AIN0_MV, ANALOG_INPUT_TYPE_VOLTAGE, ANALOG_GAIN_TYPE_LAST, 1), ANALOG_ERROR_GAIN_TYPE);
+    TEST_assert_equal(ANALOG_set_channel_configuration(ANALOG_CHANNEL_AIN0_MV, ANALOG_INPUT_TYPE_VOLTAGE, ANALOG_GAIN_TYPE_ATTENUATION, 0), ANALOG_ERROR_GAIN);
+    TEST_assert_equal(ANALOG_set_channel_configuration(ANALOG_CHANNEL_VMCU_MV, ANALOG_INPUT_TYPE_VOLTAGE, ANALOG_GAIN_TYPE_ATTENUATION, 1), ANALOG_ERROR_CHANNEL);
+}
+
+/*******************************************************************/
+static void _TEST_registers(void) {
+    _TEST_init();
+    // Empty NVM falls back to the default front-end.
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_AIN_CONFIGURATION_1, SM_REGISTER_AIN_CONFIGURATION_MASK_TYPE), SM_AIN1_INPUT_TYPE);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_AIN_CONFIGURATION_1, SM_REGISTER_AIN_CONFIGURATION_MASK_GAIN), SM_AIN1_GAIN);
+    // Current loop on AIN1.
+    TEST_assert_equal(_TEST_set_ain_configuration(1, ANALOG_INPUT_TYPE_CURRENT_4_20MA, ANALOG_GAIN_TYPE_ATTENUATION, TEST_SHUNT_OHMS), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_CONFIGURATION_1, SM_REGISTER_CONFIGURATION_1_MASK_AI1T), ANALOG_GAIN_TYPE_ATTENUATION);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_CONFIGURATION_1, SM_REGISTER_CONFIGURATION_1_MASK_AI1G), TEST_SHUNT_OHMS);
+    FAKE_set_adc_data(TEST_ADC_CHANNEL_AIN0, TEST_ADC_THIRD);
+    FAKE_set_adc_data(TEST_ADC_CHANNEL_AIN1, TEST_ADC_4MA);
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_ANALOG_DATA_1, SM_REGISTER_ANALOG_DATA_1_MASK_VAIN0), UNA_convert_mv(TEST_THIRD_MV));
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_ANALOG_DATA_1, SM_REGISTER_ANALOG_DATA_1_MASK_VAIN1), UNA_convert_mv(TEST_4MA_UA));
+    // Invalid settings are rejected and the current scale is kept.
+    TEST_assert_equal(_TEST_set_ain_configuration(1, ANALOG_INPUT_TYPE_VOLTAGE, ANALOG_GAIN_TYPE_ATTENUATION, 0), (NODE_ERROR_BASE_ANALOG + ANALOG_ERROR_GAIN));
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_ANALOG_DATA_1, SM_REGISTER_ANALOG_DATA_1_MASK_VAIN1), UNA_convert_mv(TEST_4MA_UA));
+    // Valid settings are restored from NVM after reset.
+    NODE_init();
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_AIN_CONFIGURATION_1, SM_REGISTER_AIN_CONFIGURATION_MASK_TYPE), ANALOG_INPUT_TYPE_CURRENT_4_20MA);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_AIN_CONFIGURATION_1, SM_REGISTER_AIN_CONFIGURATION_MASK_GAIN), TEST_SHUNT_OHMS);
+    FAKE_set_adc_data(TEST_ADC_CHANNEL_AIN1, TEST_ADC_20MA);
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_ANALOG_DATA_1, SM_REGISTER_ANALOG_DATA_1_MASK_VAIN1), UNA_convert_mv(TEST_20MA_UA));
+}
+
+/*** TEST SM AIN functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_scale();
+    _TEST_invalid_configuration();
+    _TEST_registers();
+    return TEST_report("test_sm_ain");
+}
@@ -0,0 +1,235 @@
+/*
+ * test_sm_logger.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "adc.h"
+#include "analog.h"
+#include "fake.h"
+#include "node.h"
+#include "sm_ext_registers.h"
+#include "sm_logger.h"
+#include "sm_registers.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST SM LOGGER local macros ***/
+
+#define TEST_ADC_VREFINT_3000MV         1638
+
+#define TEST_CAPACITY                   25
+#define TEST_RECORDS_PARTIAL            10
+#define TEST_RECORDS_WRAP               (TEST_CAPACITY + 7)
+#define TEST_RECORDS_SEQUENCE_ROLLOVER  (0xFFFF + 5)
+
+// Erase (2), payload (17), checksum (1) and sequence (2) bytes.
+#define TEST_APPEND_NVM_WRITES          22
+// Sequence high byte of the first records is already erased.
+#define TEST_APPEND_COMMIT_NVM_WRITES   (TEST_APPEND_NVM_WRITES - 1)
+
+#define TEST_LOGGER_PERIOD_SECONDS      10
+#define TEST_LOGGER_RECORDS             3
+
+/*** TEST SM LOGGER local functions ***/
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Reset fakes and node with empty NVM.
+    FAKE_reset();
+    FAKE_sht3x_reset();
+    TEST_assert_equal(ANALOG_init(), ANALOG_SUCCESS);
+    FAKE_set_adc_data(ADC_CHANNEL_VREFINT, TEST_ADC_VREFINT_3000MV);
+    NODE_init();
+}
+
+/*******************************************************************/
+static void _TEST_append(uint32_t marker) {
+    // Local variables.
+    uint32_t record[SM_LOGGER_RECORD_SIZE_WORDS] = { 0 };
+    // Payload identifying the record.
+    record[1] = marker;
+    record[2] = ~marker;
+    record[3] = (marker << 8);
+    record[4] = (marker * 3);
+    TEST_assert_equal(SM_LOGGER_append(record), NODE_SUCCESS);
+}
+
+/*******************************************************************/
+static void _TEST_check_records(uint32_t first_marker, uint16_t count) {
+    // Local variables.
+    uint32_t record[SM_LOGGER_RECORD_SIZE_WORDS];
+    uint32_t marker = 0;
+    uint16_t idx = 0;
+    // Records are read from the oldest one.
+    TEST_assert_equal(SM_LOGGER_get_count(), count);
+    for (idx = 0; idx < count; idx++) {
+        marker = (first_marker + idx);
+        TEST_assert_equal(SM_LOGGER_read(idx, record), NODE_SUCCESS);
+        TEST_assert(SWREG_read_field(record[0], SM_REGISTER_LOGGER_RECORD_0_MASK_SEQ) != 0);
+        TEST_assert_equal(record[1], marker);
+        TEST_assert_equal(record[2], ~marker);
+        TEST_assert_equal(record[3], (marker << 8));
+        TEST_assert_equal(record[4], (marker * 3));
+    }
+    // Out of range index returns an empty record.
+    TEST_assert_equal(SM_LOGGER_read(count, record), NODE_SUCCESS);
+    TEST_assert_equal(record[0], 0);
+    TEST_assert_equal(record[1], 0);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return SWREG_read_field(reg_value, field_mask);
+}
+
+/*******************************************************************/
+static void _TEST_append_and_recover(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    _TEST_init();
+    TEST_assert_equal(SM_LOGGER_get_capacity(), TEST_CAPACITY);
+    TEST_assert_equal(SM_LOGGER_get_count(), 0);
+    for (idx = 0; idx < TEST_RECORDS_PARTIAL; idx++) {
+        _TEST_append(idx);
+    }
+    _TEST_check_records(0, TEST_RECORDS_PARTIAL);
+    // Reset.
+    TEST_assert_equal(SM_LOGGER_init(), NODE_SUCCESS);
+    _TEST_check_records(0, TEST_RECORDS_PARTIAL);
+    // New records follow the recovered ones.
+    _TEST_append(TEST_RECORDS_PARTIAL);
+    _TEST_check_records(0, (TEST_RECORDS_PARTIAL + 1));
+    // Clear.
+    TEST_assert_equal(SM_LOGGER_clear(), NODE_SUCCESS);
+    TEST_assert_equal(SM_LOGGER_get_count(), 0);
+    TEST_assert_equal(SM_LOGGER_init(), NODE_SUCCESS);
+    TEST_assert_equal(SM_LOGGER_get_count(), 0);
+}
+
+/*******************************************************************/
+static void _TEST_wrap_around(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    _TEST_init();
+    // Oldest records are overwritten.
+    for (idx = 0; idx < TEST_RECORDS_WRAP; idx++) {
+        _TEST_append(idx);
+    }
+    _TEST_check_records((TEST_RECORDS_WRAP - TEST_CAPACITY), TEST_CAPACITY);
+    TEST_assert_equal(SM_LOGGER_init(), NODE_SUCCESS);
+    _TEST_check_records((TEST_RECORDS_WRAP - TEST_CAPACITY), TEST_CAPACITY);
+    _TEST_append(TEST_RECORDS_WRAP);
+    _TEST_check_records((TEST_RECORDS_WRAP - TEST_CAPACITY + 1), TEST_CAPACITY);
+    // Sequence number roll-over skips the empty value.
+    for (idx = (TEST_RECORDS_WRAP + 1); idx < TEST_RECORDS_SEQUENCE_ROLLOVER; idx++) {
+        _TEST_append(idx);
+    }
+    _TEST_check_records((TEST_RECORDS_SEQUENCE_ROLLOVER - TEST_CAPACITY), TEST_CAPACITY);
+    TEST_assert_equal(SM_LOGGER_init(), NODE_SUCCESS);
+    _TEST_check_records((TEST_RECORDS_SEQUENCE_ROLLOVER - TEST_CAPACITY), TEST_CAPACITY);
+}
+
+/*******************************************************************/
+static void _TEST_power_loss(uint32_t number_of_records) {
+    // Local variables.
+    uint32_t record[SM_LOGGER_RECORD_SIZE_WORDS];
+    uint32_t first_marker = 0;
+    uint16_t count = 0;
+    uint32_t nvm_writes = 0;
+    uint32_t idx = 0;
+    // Power loss after each byte write of the next record.
+    for (nvm_writes = 0; nvm_writes <= TEST_APPEND_NVM_WRITES; nvm_writes++) {
+        _TEST_init();
+        for (idx = 0; idx < number_of_records; idx++) {
+            _TEST_append(idx);
+        }
+        FAKE_set_nvm_write_limit(FAKE_get_nvm_write_count() + nvm_writes);
+        _TEST_append(number_of_records);
+        FAKE_set_nvm_write_limit(FAKE_NVM_WRITE_LIMIT_NONE);
+        TEST_assert_equal(SM_LOGGER_init(), NODE_SUCCESS);
+        // The interrupted record is discarded, the previous ones are kept.
+        first_marker = (number_of_records > TEST_CAPACITY) ? (number_of_records - TEST_CAPACITY) : 0;
+        count = (uint16_t) (number_of_records - first_marker);
+        if (nvm_writes >= TEST_APPEND_COMMIT_NVM_WRITES) {
+            // Committed record.
+            count = (count < TEST_CAPACITY) ? (count + 1) : count;
+            first_marker = (number_of_records + 1 - count);
+        }
+        else if ((nvm_writes > 0) && (count == TEST_CAPACITY)) {
+            // Slot of the oldest record was erased.
+            count--;
+            first_marker++;
+        }
+        _TEST_check_records(first_marker, count);
+        // Logging goes on after the last valid record.
+        _TEST_append(number_of_records + 1);
+        TEST_assert_equal(SM_LOGGER_init(), NODE_SUCCESS);
+        TEST_assert_equal(SM_LOGGER_read((SM_LOGGER_get_count() - 1), record), NODE_SUCCESS);
+        TEST_assert_equal(record[1], (number_of_records + 1));
+    }
+}
+
+/*******************************************************************/
+static void _TEST_registers(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint32_t idx = 0;
+    _TEST_init();
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_STATUS, SM_REGISTER_LOGGER_STATUS_MASK_CAPACITY), TEST_CAPACITY);
+    // Enable logger.
+    SWREG_write_field(&reg_value, &reg_mask, 1, SM_REGISTER_LOGGER_CONFIGURATION_MASK_LEN);
+    SWREG_write_field(&reg_value, &reg_mask, TEST_LOGGER_PERIOD_SECONDS, SM_REGISTER_LOGGER_CONFIGURATION_MASK_PERIOD);
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_LOGGER_CONFIGURATION, reg_value, reg_mask), NODE_SUCCESS);
+    for (idx = 0; idx < TEST_LOGGER_RECORDS; idx++) {
+        TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+        FAKE_advance_milliseconds(TEST_LOGGER_PERIOD_SECONDS * 1000);
+    }
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_STATUS, SM_REGISTER_LOGGER_STATUS_MASK_COUNT), TEST_LOGGER_RECORDS);
+    // Download through the window, pointer is incremented after the last word.
+    for (idx = 0; idx < TEST_LOGGER_RECORDS; idx++) {
+        TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_READ_POINTER, SM_REGISTER_LOGGER_READ_POINTER_MASK_INDEX), idx);
+        TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_RECORD_1, SM_REGISTER_LOGGER_RECORD_1_MASK_TIME), (idx * TEST_LOGGER_PERIOD_SECONDS));
+        TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_RECORD_1, SM_REGISTER_LOGGER_RECORD_1_MASK_RST), ((idx == 0) ? 1 : 0));
+        _TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_RECORD_4, UNA_REGISTER_MASK_ALL);
+    }
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_RECORD_0, SM_REGISTER_LOGGER_RECORD_0_MASK_SEQ), 0);
+    // Node reset: logger time goes on after the last record.
+    FAKE_set_uptime_seconds(0);
+    NODE_init();
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_STATUS, SM_REGISTER_LOGGER_STATUS_MASK_COUNT), TEST_LOGGER_RECORDS);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_TIME, SM_REGISTER_LOGGER_TIME_MASK_TIME), (((TEST_LOGGER_RECORDS - 1) * TEST_LOGGER_PERIOD_SECONDS) + 1));
+    TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_STATUS, SM_REGISTER_LOGGER_STATUS_MASK_COUNT), (TEST_LOGGER_RECORDS + 1));
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_LOGGER_READ_POINTER, TEST_LOGGER_RECORDS, SM_REGISTER_LOGGER_READ_POINTER_MASK_INDEX), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_RECORD_1, SM_REGISTER_LOGGER_RECORD_1_MASK_TIME), (((TEST_LOGGER_RECORDS - 1) * TEST_LOGGER_PERIOD_SECONDS) + 1));
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_RECORD_1, SM_REGISTER_LOGGER_RECORD_1_MASK_RST), 1);
+    // Clear records.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, 1, SM_REGISTER_LOGGER_CONTROL_MASK_CLR);
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_LOGGER_CONTROL, reg_value, reg_mask), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_STATUS, SM_REGISTER_LOGGER_STATUS_MASK_COUNT), 0);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_READ_POINTER, SM_REGISTER_LOGGER_READ_POINTER_MASK_INDEX), 0);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_LOGGER_CONTROL, SM_REGISTER_LOGGER_CONTROL_MASK_CLR), 0);
+}
+
+/*** TEST SM LOGGER functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_append_and_recover();
+    _TEST_wrap_around();
+    _TEST_power_loss(TEST_RECORDS_PARTIAL);
+    _TEST_power_loss(TEST_RECORDS_WRAP);
+    _TEST_registers();
+    return TEST_report("test_sm_logger");
+}
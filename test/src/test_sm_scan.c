@@ -0,0 +1,159 @@
+/*
+ * test_sm_scan.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "error.h"
+#include "fake.h"
+#include "node.h"
+#include "power.h"
+#include "sm.h"
+#include "sm_ext_registers.h"
+#include "sm_registers.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST SM SCAN local macros ***/
+
+#define TEST_PRIMARY_SENSOR             0
+#define TEST_SECONDARY_SENSOR           1
+#define TEST_SENSOR_INDEX_NONE          0xFF
+
+#define TEST_PRIMARY_TEMPERATURE        21
+#define TEST_PRIMARY_HUMIDITY           40
+#define TEST_SECONDARY_TEMPERATURE      (-5)
+#define TEST_SECONDARY_HUMIDITY         70
+
+#define TEST_RATE_1_MPS                 1
+#define TEST_FETCH_PERIOD_MS            2000
+
+/*** TEST SM SCAN local functions ***/
+
+/*******************************************************************/
+static void _TEST_init(uint8_t primary_present, uint8_t secondary_present) {
+    // Reset fakes with the requested shield sensors.
+    FAKE_reset();
+    FAKE_sht3x_reset();
+    fake_sht3x.sensors[TEST_PRIMARY_SENSOR].present = primary_present;
+    fake_sht3x.sensors[TEST_PRIMARY_SENSOR].temperature_degrees = TEST_PRIMARY_TEMPERATURE;
+    fake_sht3x.sensors[TEST_PRIMARY_SENSOR].humidity_percent = TEST_PRIMARY_HUMIDITY;
+    fake_sht3x.sensors[TEST_SECONDARY_SENSOR].present = secondary_present;
+    fake_sht3x.sensors[TEST_SECONDARY_SENSOR].temperature_degrees = TEST_SECONDARY_TEMPERATURE;
+    fake_sht3x.sensors[TEST_SECONDARY_SENSOR].humidity_percent = TEST_SECONDARY_HUMIDITY;
+    NODE_init();
+    // Sensors are only powered during the scan.
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_SENSORS), 0);
+    // Missing sensors are not reported as errors.
+    TEST_assert_equal(ERROR_stack_is_empty(), 1);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return SWREG_read_field(reg_value, field_mask);
+}
+
+/*******************************************************************/
+static void _TEST_check_data(uint8_t reg_addr, uint32_t tamb_mask, uint32_t hamb_mask, int32_t tamb_degrees, int32_t hamb_percent) {
+    TEST_assert_equal(_TEST_read_field(reg_addr, tamb_mask), UNA_convert_degrees(tamb_degrees));
+    TEST_assert_equal(_TEST_read_field(reg_addr, hamb_mask), (uint32_t) hamb_percent);
+}
+
+/*******************************************************************/
+static void _TEST_check_error(uint8_t reg_addr, uint32_t tamb_mask, uint32_t hamb_mask) {
+    TEST_assert_equal(_TEST_read_field(reg_addr, tamb_mask), UNA_TEMPERATURE_ERROR_VALUE);
+    TEST_assert_equal(_TEST_read_field(reg_addr, hamb_mask), UNA_HUMIDITY_ERROR_VALUE);
+}
+
+/*******************************************************************/
+static void _TEST_no_sensor(void) {
+    // Local variables.
+    uint32_t transfer_count = 0;
+    _TEST_init(0, 0);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DETECTION, SM_REGISTER_SENSORS_DETECTION_MASK_DETECTED), 0);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DETECTION, SM_REGISTER_SENSORS_DETECTION_MASK_MAIN), TEST_SENSOR_INDEX_NONE);
+    // Both addresses are probed once.
+    TEST_assert_equal(fake_sht3x.nack_count, 2);
+    // Measurement does not access the bus.
+    transfer_count = fake_sht3x.transfer_count;
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(fake_sht3x.transfer_count, transfer_count);
+    TEST_assert_equal(FAKE_get_power_off_count(POWER_DOMAIN_SENSORS), 1);
+    _TEST_check_error(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_TAMB, SM_REGISTER_SENSORS_DATA_MASK_HAMB);
+    _TEST_check_error(SM_REGISTER_ADDRESS_SENSORS_DATA_1, SM_REGISTER_SENSORS_DATA_MASK_TAMB, SM_REGISTER_SENSORS_DATA_MASK_HAMB);
+    _TEST_check_error(SM_REGISTER_ADDRESS_ANALOG_DATA_3, SM_REGISTER_ANALOG_DATA_3_MASK_TAMB, SM_REGISTER_ANALOG_DATA_3_MASK_HAMB);
+}
+
+/*******************************************************************/
+static void _TEST_secondary_only(void) {
+    _TEST_init(0, 1);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DETECTION, SM_REGISTER_SENSORS_DETECTION_MASK_DETECTED), 0b10);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DETECTION, SM_REGISTER_SENSORS_DETECTION_MASK_MAIN), TEST_SECONDARY_SENSOR);
+    // Secondary sensor feeds the common fields.
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_SECONDARY_SENSOR].single_shot_count, 1);
+    _TEST_check_error(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_TAMB, SM_REGISTER_SENSORS_DATA_MASK_HAMB);
+    _TEST_check_data(SM_REGISTER_ADDRESS_SENSORS_DATA_1, SM_REGISTER_SENSORS_DATA_MASK_TAMB, SM_REGISTER_SENSORS_DATA_MASK_HAMB, TEST_SECONDARY_TEMPERATURE, TEST_SECONDARY_HUMIDITY);
+    _TEST_check_data(SM_REGISTER_ADDRESS_ANALOG_DATA_3, SM_REGISTER_ANALOG_DATA_3_MASK_TAMB, SM_REGISTER_ANALOG_DATA_3_MASK_HAMB, TEST_SECONDARY_TEMPERATURE, TEST_SECONDARY_HUMIDITY);
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_SENSORS), 0);
+}
+
+/*******************************************************************/
+static void _TEST_both_sensors(void) {
+    _TEST_init(1, 1);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DETECTION, SM_REGISTER_SENSORS_DETECTION_MASK_DETECTED), 0b11);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DETECTION, SM_REGISTER_SENSORS_DETECTION_MASK_MAIN), TEST_PRIMARY_SENSOR);
+    TEST_assert_equal(fake_sht3x.nack_count, 0);
+    // Each sensor has its own data register.
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_PRIMARY_SENSOR].single_shot_count, 1);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_SECONDARY_SENSOR].single_shot_count, 1);
+    _TEST_check_data(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_TAMB, SM_REGISTER_SENSORS_DATA_MASK_HAMB, TEST_PRIMARY_TEMPERATURE, TEST_PRIMARY_HUMIDITY);
+    _TEST_check_data(SM_REGISTER_ADDRESS_SENSORS_DATA_1, SM_REGISTER_SENSORS_DATA_MASK_TAMB, SM_REGISTER_SENSORS_DATA_MASK_HAMB, TEST_SECONDARY_TEMPERATURE, TEST_SECONDARY_HUMIDITY);
+    _TEST_check_data(SM_REGISTER_ADDRESS_ANALOG_DATA_3, SM_REGISTER_ANALOG_DATA_3_MASK_TAMB, SM_REGISTER_ANALOG_DATA_3_MASK_HAMB, TEST_PRIMARY_TEMPERATURE, TEST_PRIMARY_HUMIDITY);
+}
+
+/*******************************************************************/
+static void _TEST_both_sensors_periodic(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint32_t reset_count = 0;
+    _TEST_init(1, 1);
+    // Periodic mode runs on the main sensor only.
+    SWREG_write_field(&reg_value, &reg_mask, 1, SM_REGISTER_SENSORS_CONFIGURATION_MASK_PMEN);
+    SWREG_write_field(&reg_value, &reg_mask, TEST_RATE_1_MPS, SM_REGISTER_SENSORS_CONFIGURATION_MASK_RATE);
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_SENSORS_CONFIGURATION, reg_value, reg_mask), NODE_SUCCESS);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_PRIMARY_SENSOR].periodic_running, 1);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_SECONDARY_SENSOR].periodic_running, 0);
+    reset_count = fake_sht3x.sensors[TEST_PRIMARY_SENSOR].reset_count;
+    FAKE_advance_milliseconds(TEST_FETCH_PERIOD_MS);
+    TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    // Secondary sensor is still measured in single shot mode while the domain stays powered.
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_PRIMARY_SENSOR].single_shot_count, 0);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_SECONDARY_SENSOR].single_shot_count, 1);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_PRIMARY_SENSOR].reset_count, reset_count);
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_SENSORS), 1);
+    _TEST_check_data(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_TAMB, SM_REGISTER_SENSORS_DATA_MASK_HAMB, TEST_PRIMARY_TEMPERATURE, TEST_PRIMARY_HUMIDITY);
+    _TEST_check_data(SM_REGISTER_ADDRESS_SENSORS_DATA_1, SM_REGISTER_SENSORS_DATA_MASK_TAMB, SM_REGISTER_SENSORS_DATA_MASK_HAMB, TEST_SECONDARY_TEMPERATURE, TEST_SECONDARY_HUMIDITY);
+    TEST_assert_equal(ERROR_stack_is_empty(), 1);
+}
+
+/*** TEST SM SCAN functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_no_sensor();
+    _TEST_secondary_only();
+    _TEST_both_sensors();
+    _TEST_both_sensors_periodic();
+    return TEST_report("test_sm_scan");
+}
@@ -0,0 +1,248 @@
+/*
+ * test_sm_sensors.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "node.h"
+#include "power.h"
+#include "sm.h"
+#include "sm_ext_registers.h"
+#include "sm_registers.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "una.h"
+
+/*** TEST SM SENSORS local macros ***/
+
+#define TEST_MAIN_SENSOR                0
+#define TEST_TEMPERATURE_DEGREES        25
+#define TEST_HUMIDITY_PERCENT           50
+
+#define TEST_RATE_1_MPS                 1
+#define TEST_RATE_1_MPS_COMMAND         0x212D
+#define TEST_RATE_INVALID               5
+#define TEST_FETCH_PERIOD_MS            2000
+
+// Alert configuration: 30 / -10 degrees and 80 / 20 percent.
+#define TEST_ALERT_THIGH_DEGREES        30
+#define TEST_ALERT_TLOW_DEGREES         (-10)
+#define TEST_ALERT_HHIGH_PERCENT        80
+#define TEST_ALERT_HLOW_PERCENT         20
+
+// Limits words with 2 degrees and 5 percent hysteresis.
+#define TEST_ALERT_HIGH_SET             0xCCDB
+#define TEST_ALERT_HIGH_CLEAR           0xBED5
+#define TEST_ALERT_LOW_CLEAR            0x3E6C
+#define TEST_ALERT_LOW_SET              0x3266
+
+#define TEST_TEMPERATURE_ALERT_DEGREES  35
+#define TEST_TEMPERATURE_BAND_DEGREES   29
+#define TEST_HUMIDITY_ALERT_PERCENT     85
+
+#define TEST_STATUS_RESET_DETECTED      0x0010
+
+/*** TEST SM SENSORS local functions ***/
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Reset fakes with the main sensor fitted.
+    FAKE_reset();
+    FAKE_sht3x_reset();
+    fake_sht3x.sensors[TEST_MAIN_SENSOR].present = 1;
+    fake_sht3x.sensors[TEST_MAIN_SENSOR].temperature_degrees = TEST_TEMPERATURE_DEGREES;
+    fake_sht3x.sensors[TEST_MAIN_SENSOR].humidity_percent = TEST_HUMIDITY_PERCENT;
+    NODE_init();
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return SWREG_read_field(reg_value, field_mask);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_alerts(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Flags are cleared on read so that all bits are read at once.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_SENSORS_STATUS, &reg_value);
+    return (reg_value & (SM_REGISTER_SENSORS_STATUS_MASK_TA | SM_REGISTER_SENSORS_STATUS_MASK_HA | SM_REGISTER_SENSORS_STATUS_MASK_TAF | SM_REGISTER_SENSORS_STATUS_MASK_HAF));
+}
+
+/*******************************************************************/
+static NODE_status_t _TEST_set_alert_configuration(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Write thresholds as the bus master does.
+    SWREG_write_field(&reg_value, &reg_mask, (uint8_t) TEST_ALERT_THIGH_DEGREES, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_THIGH);
+    SWREG_write_field(&reg_value, &reg_mask, (uint8_t) TEST_ALERT_TLOW_DEGREES, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_TLOW);
+    SWREG_write_field(&reg_value, &reg_mask, TEST_ALERT_HHIGH_PERCENT, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_HHIGH);
+    SWREG_write_field(&reg_value, &reg_mask, TEST_ALERT_HLOW_PERCENT, SM_REGISTER_SENSORS_ALERT_CONFIGURATION_MASK_HLOW);
+    return NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_SENSORS_ALERT_CONFIGURATION, reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static NODE_status_t _TEST_set_periodic_mode(uint8_t enable, uint8_t rate) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Write configuration as the bus master does.
+    SWREG_write_field(&reg_value, &reg_mask, enable, SM_REGISTER_SENSORS_CONFIGURATION_MASK_PMEN);
+    SWREG_write_field(&reg_value, &reg_mask, rate, SM_REGISTER_SENSORS_CONFIGURATION_MASK_RATE);
+    return NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, SM_REGISTER_ADDRESS_SENSORS_CONFIGURATION, reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static void _TEST_fetch(void) {
+    // Local variables.
+    uint32_t fetch_count = fake_sht3x.sensors[TEST_MAIN_SENSOR].fetch_count;
+    // Wait for the next fetch period.
+    FAKE_advance_milliseconds(TEST_FETCH_PERIOD_MS);
+    TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].fetch_count, (fetch_count + 1));
+}
+
+/*******************************************************************/
+static void _TEST_single_shot(void) {
+    _TEST_init();
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_STATUS, SM_REGISTER_SENSORS_STATUS_MASK_PMST), 0);
+    // Measurement is triggered by the MTRG command.
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].single_shot_count, 1);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_TAMB), TEST_TEMPERATURE_DEGREES);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_HAMB), TEST_HUMIDITY_PERCENT);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_ANALOG_DATA_3, SM_REGISTER_ANALOG_DATA_3_MASK_TAMB), TEST_TEMPERATURE_DEGREES);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_ANALOG_DATA_3, SM_REGISTER_ANALOG_DATA_3_MASK_HAMB), TEST_HUMIDITY_PERCENT);
+    // Sensors are turned off between measurements.
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_SENSORS), 0);
+}
+
+/*******************************************************************/
+static void _TEST_periodic_mode(void) {
+    // Local variables.
+    uint32_t transfer_count = 0;
+    uint32_t reset_count = 0;
+    _TEST_init();
+    TEST_assert_equal(_TEST_set_alert_configuration(), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_set_periodic_mode(1, TEST_RATE_1_MPS), NODE_SUCCESS);
+    // Sensor configuration.
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].periodic_running, 1);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].periodic_command, TEST_RATE_1_MPS_COMMAND);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].alert_high_set, TEST_ALERT_HIGH_SET);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].alert_high_clear, TEST_ALERT_HIGH_CLEAR);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].alert_low_clear, TEST_ALERT_LOW_CLEAR);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].alert_low_set, TEST_ALERT_LOW_SET);
+    TEST_assert_equal((fake_sht3x.sensors[TEST_MAIN_SENSOR].status_register & TEST_STATUS_RESET_DETECTED), 0);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_STATUS, SM_REGISTER_SENSORS_STATUS_MASK_PMST), 1);
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_SENSORS), 1);
+    // No result before the first fetch.
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].single_shot_count, 0);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_TAMB), UNA_TEMPERATURE_ERROR_VALUE);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_HAMB), UNA_HUMIDITY_ERROR_VALUE);
+    // Cached result is used without any bus transfer nor power cycle.
+    _TEST_fetch();
+    transfer_count = fake_sht3x.transfer_count;
+    reset_count = fake_sht3x.sensors[TEST_MAIN_SENSOR].reset_count;
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(fake_sht3x.transfer_count, transfer_count);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].single_shot_count, 0);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].reset_count, reset_count);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].periodic_running, 1);
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_SENSORS), 1);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_TAMB), TEST_TEMPERATURE_DEGREES);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_HAMB), TEST_HUMIDITY_PERCENT);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_ANALOG_DATA_3, SM_REGISTER_ANALOG_DATA_3_MASK_TAMB), TEST_TEMPERATURE_DEGREES);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_ANALOG_DATA_3, SM_REGISTER_ANALOG_DATA_3_MASK_HAMB), TEST_HUMIDITY_PERCENT);
+    // Disable periodic mode.
+    TEST_assert_equal(_TEST_set_periodic_mode(0, TEST_RATE_1_MPS), NODE_SUCCESS);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].periodic_running, 0);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_STATUS, SM_REGISTER_SENSORS_STATUS_MASK_PMST), 0);
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_SENSORS), 0);
+    // Back to single shot measurements.
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].single_shot_count, 1);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_TAMB), TEST_TEMPERATURE_DEGREES);
+}
+
+/*******************************************************************/
+static void _TEST_alerts(void) {
+    _TEST_init();
+    TEST_assert_equal(_TEST_set_alert_configuration(), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_set_periodic_mode(1, TEST_RATE_1_MPS), NODE_SUCCESS);
+    _TEST_fetch();
+    TEST_assert_equal(_TEST_read_alerts(), 0);
+    // High temperature threshold crossing.
+    fake_sht3x.sensors[TEST_MAIN_SENSOR].temperature_degrees = TEST_TEMPERATURE_ALERT_DEGREES;
+    _TEST_fetch();
+    TEST_assert_equal(_TEST_read_alerts(), (SM_REGISTER_SENSORS_STATUS_MASK_TA | SM_REGISTER_SENSORS_STATUS_MASK_TAF));
+    // Flag is cleared on read while the alert remains.
+    TEST_assert_equal(_TEST_read_alerts(), SM_REGISTER_SENSORS_STATUS_MASK_TA);
+    // Alert is kept within the hysteresis band.
+    fake_sht3x.sensors[TEST_MAIN_SENSOR].temperature_degrees = TEST_TEMPERATURE_BAND_DEGREES;
+    _TEST_fetch();
+    TEST_assert_equal(_TEST_read_alerts(), SM_REGISTER_SENSORS_STATUS_MASK_TA);
+    // Alert is cleared below the clear threshold.
+    fake_sht3x.sensors[TEST_MAIN_SENSOR].temperature_degrees = TEST_TEMPERATURE_DEGREES;
+    _TEST_fetch();
+    TEST_assert_equal(_TEST_read_alerts(), SM_REGISTER_SENSORS_STATUS_MASK_TAF);
+    // High humidity threshold crossing.
+    fake_sht3x.sensors[TEST_MAIN_SENSOR].humidity_percent = TEST_HUMIDITY_ALERT_PERCENT;
+    _TEST_fetch();
+    TEST_assert_equal(_TEST_read_alerts(), (SM_REGISTER_SENSORS_STATUS_MASK_HA | SM_REGISTER_SENSORS_STATUS_MASK_HAF));
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_HAMB), TEST_HUMIDITY_ALERT_PERCENT);
+}
+
+/*******************************************************************/
+static void _TEST_configuration_errors(void) {
+    _TEST_init();
+    // Invalid rate.
+    TEST_assert_equal(_TEST_set_periodic_mode(1, TEST_RATE_INVALID), NODE_ERROR_REGISTER_FIELD_RANGE);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].periodic_running, 0);
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_SENSORS), 0);
+    // Periodic mode is ignored without any sensor.
+    FAKE_reset();
+    FAKE_sht3x_reset();
+    NODE_init();
+    TEST_assert_equal(_TEST_set_periodic_mode(1, TEST_RATE_1_MPS), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_STATUS, SM_REGISTER_SENSORS_STATUS_MASK_PMST), 0);
+    TEST_assert_equal(POWER_get_state(POWER_DOMAIN_SENSORS), 0);
+}
+
+/*******************************************************************/
+static void _TEST_nvm_restore(void) {
+    _TEST_init();
+    TEST_assert_equal(_TEST_set_alert_configuration(), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_set_periodic_mode(1, TEST_RATE_1_MPS), NODE_SUCCESS);
+    // Node reset with power loss of the sensors.
+    POWER_disable(POWER_REQUESTER_ID_SM_SENSORS, POWER_DOMAIN_SENSORS);
+    NODE_init();
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_STATUS, SM_REGISTER_SENSORS_STATUS_MASK_PMST), 1);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].periodic_running, 1);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].periodic_command, TEST_RATE_1_MPS_COMMAND);
+    TEST_assert_equal(fake_sht3x.sensors[TEST_MAIN_SENSOR].alert_high_set, TEST_ALERT_HIGH_SET);
+    _TEST_fetch();
+    TEST_assert_equal(SM_mtrg_callback(), NODE_SUCCESS);
+    TEST_assert_equal(_TEST_read_field(SM_REGISTER_ADDRESS_SENSORS_DATA_0, SM_REGISTER_SENSORS_DATA_MASK_TAMB), TEST_TEMPERATURE_DEGREES);
+}
+
+/*** TEST SM SENSORS functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_single_shot();
+    _TEST_periodic_mode();
+    _TEST_alerts();
+    _TEST_configuration_errors();
+    _TEST_nvm_restore();
+    return TEST_report("test_sm_sensors");
+}
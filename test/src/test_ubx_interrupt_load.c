@@ -0,0 +1,214 @@
+/*
+ * test_ubx_interrupt_load.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "neom8x.h"
+#include "neom8x_hw.h"
+#include "test.h"
+#include "types.h"
+#include "ubx.h"
+#include "usart.h"
+#include <stdio.h>
+
+/*** TEST UBX INTERRUPT LOAD local macros ***/
+
+#define TEST_UBX_FRAME_OVERHEAD_BYTES   8
+#define TEST_UBX_CLASS_NAV              0x01
+#define TEST_UBX_ID_NAV_PVT             0x07
+#define TEST_NAV_PVT_PAYLOAD_SIZE       92
+
+#define TEST_NMEA_EPOCH_SIZE_BYTES      593
+#define TEST_UBX_EPOCH_SIZE_BYTES       (TEST_NAV_PVT_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES)
+
+#define TEST_NUMBER_OF_EPOCHS           10
+#define TEST_NAVIGATION_PERIOD_MS       1000
+
+#define TEST_UART_BAUD_RATE             9600
+#define TEST_UART_BITS_PER_BYTE         10
+#define TEST_DMA_HALF_BUFFER_BYTES      32
+
+/*** TEST UBX INTERRUPT LOAD local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    TEST_MODE_NMEA_RXNE = 0,
+    TEST_MODE_NMEA_DMA,
+    TEST_MODE_UBX_DMA,
+    TEST_MODE_LAST
+} TEST_mode_t;
+
+/*******************************************************************/
+typedef struct {
+    uint32_t rx_bytes;
+    uint32_t rxne_irq_count;
+    uint32_t dma_irq_count;
+    uint32_t idle_irq_count;
+    uint32_t decoded_count;
+} TEST_result_t;
+
+/*** TEST UBX INTERRUPT LOAD local global variables ***/
+
+// Default NMEA output of the receiver for one navigation epoch (10 satellites, GPS and GLONASS).
+static const char_t TEST_NMEA_EPOCH[] =
+    "$GNRMC,101512.00,A,4511.31020,N,00543.47082,E,0.042,,191026,,,A*69\r\n"
+    "$GNVTG,,T,,M,0.042,N,0.078,K,A*34\r\n"
+    "$GNGGA,101512.00,4511.31020,N,00543.47082,E,1,10,0.92,212.4,M,48.3,M,,*4E\r\n"
+    "$GNGSA,A,3,05,13,15,18,20,23,24,,,,,,1.61,0.92,1.32*1E\r\n"
+    "$GNGSA,A,3,68,69,78,,,,,,,,,,1.61,0.92,1.32*1F\r\n"
+    "$GPGSV,3,1,11,05,45,152,42,13,70,265,44,15,31,301,38,18,12,045,30*7C\r\n"
+    "$GPGSV,3,2,11,20,22,102,36,23,18,318,33,24,58,090,45,26,05,210,*7F\r\n"
+    "$GPGSV,3,3,11,28,03,175,,29,10,032,21,30,02,340,*4D\r\n"
+    "$GLGSV,1,1,04,68,32,058,37,69,65,142,41,78,41,260,35,79,08,325,*63\r\n"
+    "$GNGLL,4511.31020,N,00543.47082,E,101512.00,A,A*7B\r\n";
+
+// NAV-PVT payload of the same epoch (19 oct. 2026 10:15:12, 3D fix, 10 satellites).
+static const uint8_t TEST_NAV_PVT_PAYLOAD[TEST_NAV_PVT_PAYLOAD_SIZE] = {
+    0xD0, 0xDD, 0x59, 0x07, 0xEA, 0x07, 0x0A, 0x13, 0x0A, 0x0F, 0x0C, 0x37,
+    0xC4, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0xEA, 0x0A,
+    0xD1, 0x7D, 0x69, 0x03, 0xE9, 0x37, 0xEF, 0x1A, 0x5C, 0xFA, 0x03, 0x00,
+    0xB0, 0x3D, 0x03, 0x00, 0x28, 0x0A, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const char_t* TEST_MODE_NAME[TEST_MODE_LAST] = { "nmea_rxne", "nmea_dma", "ubx_dma" };
+
+static uint32_t test_nmea_sentence_count = 0;
+static uint32_t test_position_count = 0;
+
+/*** TEST UBX INTERRUPT LOAD local functions ***/
+
+/*******************************************************************/
+static void _TEST_nmea_rx_callback(uint8_t data) {
+    // Count complete sentences as the NMEA parser would.
+    if (data == '\n') {
+        test_nmea_sentence_count++;
+    }
+}
+
+/*******************************************************************/
+static void _TEST_position_callback(void) {
+    // Local variables.
+    UBX_position_t ubx_position;
+    // Read frame as the GPS driver does.
+    UBX_get_position(&ubx_position);
+    if ((ubx_position.fix_ok != 0) && (ubx_position.fix_type == 3)) {
+        test_position_count++;
+    }
+}
+
+/*******************************************************************/
+static void _TEST_run(TEST_mode_t mode, TEST_result_t* result) {
+    // Local variables.
+    NEOM8X_HW_configuration_t configuration;
+    uint8_t ubx_epoch[TEST_UBX_EPOCH_SIZE_BYTES];
+    uint8_t* epoch = (uint8_t*) TEST_NMEA_EPOCH;
+    uint32_t epoch_size = TEST_NMEA_EPOCH_SIZE_BYTES;
+    uint32_t idx = 0;
+    // Init interface.
+    FAKE_reset();
+    test_nmea_sentence_count = 0;
+    test_position_count = 0;
+    configuration.uart_baud_rate = TEST_UART_BAUD_RATE;
+    configuration.rx_irq_callback = &_TEST_nmea_rx_callback;
+    TEST_assert_equal(NEOM8X_HW_init(&configuration), NEOM8X_SUCCESS);
+    // Start reception.
+    switch (mode) {
+    case TEST_MODE_NMEA_RXNE:
+        // NMEA driver: one RXNE interrupt per byte.
+        TEST_assert_equal(USART_enable_rx(USART_INSTANCE_USART2), USART_SUCCESS);
+        break;
+    case TEST_MODE_NMEA_DMA:
+        TEST_assert_equal(NEOM8X_HW_start_rx(), NEOM8X_SUCCESS);
+        break;
+    default:
+        // Binary output of the position message only.
+        epoch_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_PVT, (uint8_t*) TEST_NAV_PVT_PAYLOAD, TEST_NAV_PVT_PAYLOAD_SIZE, ubx_epoch);
+        epoch = ubx_epoch;
+        TEST_assert_equal(UBX_start(UBX_MESSAGE_NAV_PVT, &_TEST_position_callback), UBX_SUCCESS);
+        break;
+    }
+    // Replay the same epoch at each navigation period.
+    for (idx = 0; idx < TEST_NUMBER_OF_EPOCHS; idx++) {
+        FAKE_advance_milliseconds(TEST_NAVIGATION_PERIOD_MS);
+        FAKE_gps_receive(epoch, epoch_size);
+    }
+    // Save records before stopping, which flushes the buffer.
+    result->rx_bytes = fake_gps.rx_size_bytes;
+    result->rxne_irq_count = fake_gps.rxne_irq_count;
+    result->dma_irq_count = fake_gps.dma_irq_count;
+    result->idle_irq_count = fake_gps.idle_irq_count;
+    result->decoded_count = (mode == TEST_MODE_UBX_DMA) ? test_position_count : test_nmea_sentence_count;
+    TEST_assert_equal(fake_gps.rx_lost_bytes, 0);
+    // Release interface.
+    if (mode == TEST_MODE_UBX_DMA) {
+        TEST_assert_equal(UBX_stop(), UBX_SUCCESS);
+    }
+    else {
+        TEST_assert_equal(NEOM8X_HW_stop_rx(), NEOM8X_SUCCESS);
+    }
+    TEST_assert_equal(NEOM8X_HW_de_init(), NEOM8X_SUCCESS);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_get_irq_count(TEST_result_t* result) {
+    return (result->rxne_irq_count + result->dma_irq_count + result->idle_irq_count);
+}
+
+/*******************************************************************/
+static void _TEST_print(TEST_mode_t mode, TEST_result_t* result) {
+    // Local variables.
+    uint32_t bytes_per_epoch = (result->rx_bytes / TEST_NUMBER_OF_EPOCHS);
+    uint32_t line_time_ms = ((bytes_per_epoch * TEST_UART_BITS_PER_BYTE * 1000) / TEST_UART_BAUD_RATE);
+    printf("%-10s %8u %10u %8u %8u %8u %10u %12u\n",
+        TEST_MODE_NAME[mode],
+        (unsigned int) bytes_per_epoch,
+        (unsigned int) (_TEST_get_irq_count(result) / TEST_NUMBER_OF_EPOCHS),
+        (unsigned int) result->rxne_irq_count,
+        (unsigned int) result->dma_irq_count,
+        (unsigned int) result->idle_irq_count,
+        (unsigned int) line_time_ms,
+        (unsigned int) result->decoded_count);
+}
+
+/*** TEST UBX INTERRUPT LOAD functions ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    TEST_result_t result[TEST_MODE_LAST];
+    TEST_mode_t mode = 0;
+    // Reference streams.
+    TEST_assert_equal((sizeof(TEST_NMEA_EPOCH) - 1), TEST_NMEA_EPOCH_SIZE_BYTES);
+    printf("%-10s %8s %10s %8s %8s %8s %10s %12s\n", "mode", "bytes/s", "irq/s", "rxne", "dma", "idle", "line_ms/s", "decoded");
+    for (mode = 0; mode < TEST_MODE_LAST; mode++) {
+        _TEST_run(mode, &(result[mode]));
+        _TEST_print(mode, &(result[mode]));
+    }
+    // All sentences and frames are delivered.
+    TEST_assert_equal(result[TEST_MODE_NMEA_RXNE].decoded_count, (10 * TEST_NUMBER_OF_EPOCHS));
+    TEST_assert_equal(result[TEST_MODE_NMEA_DMA].decoded_count, (10 * TEST_NUMBER_OF_EPOCHS));
+    TEST_assert_equal(result[TEST_MODE_UBX_DMA].decoded_count, TEST_NUMBER_OF_EPOCHS);
+    // Bytes: the binary position message replaces the whole NMEA epoch.
+    TEST_assert_equal(result[TEST_MODE_NMEA_RXNE].rx_bytes, (TEST_NMEA_EPOCH_SIZE_BYTES * TEST_NUMBER_OF_EPOCHS));
+    TEST_assert_equal(result[TEST_MODE_NMEA_DMA].rx_bytes, (TEST_NMEA_EPOCH_SIZE_BYTES * TEST_NUMBER_OF_EPOCHS));
+    TEST_assert_equal(result[TEST_MODE_UBX_DMA].rx_bytes, (TEST_UBX_EPOCH_SIZE_BYTES * TEST_NUMBER_OF_EPOCHS));
+    // Interrupts: one per byte without DMA, one per half buffer and one IDLE per epoch with DMA.
+    TEST_assert_equal(result[TEST_MODE_NMEA_RXNE].rxne_irq_count, result[TEST_MODE_NMEA_RXNE].rx_bytes);
+    TEST_assert_equal(result[TEST_MODE_NMEA_RXNE].dma_irq_count, 0);
+    TEST_assert_equal(result[TEST_MODE_NMEA_DMA].rxne_irq_count, 0);
+    TEST_assert_equal(result[TEST_MODE_NMEA_DMA].dma_irq_count, (result[TEST_MODE_NMEA_DMA].rx_bytes / TEST_DMA_HALF_BUFFER_BYTES));
+    TEST_assert_equal(result[TEST_MODE_NMEA_DMA].idle_irq_count, TEST_NUMBER_OF_EPOCHS);
+    TEST_assert_equal(result[TEST_MODE_UBX_DMA].rxne_irq_count, 0);
+    TEST_assert_equal(result[TEST_MODE_UBX_DMA].dma_irq_count, (result[TEST_MODE_UBX_DMA].rx_bytes / TEST_DMA_HALF_BUFFER_BYTES));
+    TEST_assert_equal(result[TEST_MODE_UBX_DMA].idle_irq_count, TEST_NUMBER_OF_EPOCHS);
+    TEST_assert((_TEST_get_irq_count(&(result[TEST_MODE_UBX_DMA])) * 4) < _TEST_get_irq_count(&(result[TEST_MODE_NMEA_DMA])));
+    TEST_assert((_TEST_get_irq_count(&(result[TEST_MODE_UBX_DMA])) * 100) < _TEST_get_irq_count(&(result[TEST_MODE_NMEA_RXNE])));
+    return TEST_report("test_ubx_interrupt_load");
+}
@@ -0,0 +1,141 @@
+/*
+ * test_ubx_power_mode.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "neom8x.h"
+#include "neom8x_hw.h"
+#include "test.h"
+#include "types.h"
+#include "ubx.h"
+
+/*** TEST UBX POWER MODE local macros ***/
+
+#define TEST_UBX_FRAME_OVERHEAD_BYTES   8
+#define TEST_UBX_CLASS_CFG              0x06
+#define TEST_UBX_ID_CFG_RXM             0x11
+#define TEST_UBX_ID_CFG_PM2             0x3B
+
+#define TEST_CFG_PM2_PAYLOAD_SIZE       44
+#define TEST_CFG_RXM_PAYLOAD_SIZE       2
+
+#define TEST_CFG_PM2_FLAGS_CYCLIC       0x00021800
+#define TEST_CFG_PM2_FLAGS_ON_OFF       0x00001800
+
+#define TEST_UPDATE_PERIOD_MS           10000
+#define TEST_SEARCH_PERIOD_MS           60000
+
+/*** TEST UBX POWER MODE local functions ***/
+
+/*******************************************************************/
+static void _TEST_nmea_rx_callback(uint8_t data) {
+    UNUSED(data);
+}
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Local variables.
+    NEOM8X_HW_configuration_t configuration;
+    // Reset fakes and init interface.
+    FAKE_reset();
+    configuration.uart_baud_rate = 9600;
+    configuration.rx_irq_callback = &_TEST_nmea_rx_callback;
+    TEST_assert_equal(NEOM8X_HW_init(&configuration), NEOM8X_SUCCESS);
+}
+
+/*******************************************************************/
+static void _TEST_write_u32(uint8_t* payload, uint8_t offset, uint32_t value) {
+    payload[offset + 0] = (uint8_t) ((value >> 0) & 0xFF);
+    payload[offset + 1] = (uint8_t) ((value >> 8) & 0xFF);
+    payload[offset + 2] = (uint8_t) ((value >> 16) & 0xFF);
+    payload[offset + 3] = (uint8_t) ((value >> 24) & 0xFF);
+}
+
+/*******************************************************************/
+static void _TEST_check_frame(uint32_t offset, uint8_t* expected_frame, uint32_t expected_frame_size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check bounds.
+    TEST_assert((offset + expected_frame_size) <= fake_gps.tx_size_bytes);
+    if ((offset + expected_frame_size) > fake_gps.tx_size_bytes) return;
+    // Byte per byte comparison.
+    for (idx = 0; idx < expected_frame_size; idx++) {
+        TEST_assert_equal(fake_gps.tx_data[offset + idx], expected_frame[idx]);
+    }
+}
+
+/*******************************************************************/
+static void _TEST_power_save(UBX_power_mode_t mode, uint32_t expected_flags) {
+    // Local variables.
+    UBX_power_mode_configuration_t configuration;
+    uint8_t pm2_payload[TEST_CFG_PM2_PAYLOAD_SIZE] = { 0x00 };
+    uint8_t rxm_payload[TEST_CFG_RXM_PAYLOAD_SIZE] = { 0x08, 0x01 };
+    uint8_t pm2_frame[TEST_CFG_PM2_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint8_t rxm_frame[TEST_CFG_RXM_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t pm2_frame_size = 0;
+    uint32_t rxm_frame_size = 0;
+    _TEST_init();
+    // Version 1, RTC and ephemeris updates, periods in ms.
+    pm2_payload[0] = 0x01;
+    _TEST_write_u32(pm2_payload, 4, expected_flags);
+    _TEST_write_u32(pm2_payload, 8, TEST_UPDATE_PERIOD_MS);
+    _TEST_write_u32(pm2_payload, 12, TEST_SEARCH_PERIOD_MS);
+    pm2_frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_CFG, TEST_UBX_ID_CFG_PM2, pm2_payload, TEST_CFG_PM2_PAYLOAD_SIZE, pm2_frame);
+    rxm_frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_CFG, TEST_UBX_ID_CFG_RXM, rxm_payload, TEST_CFG_RXM_PAYLOAD_SIZE, rxm_frame);
+    // CFG-PM2 is sent before switching to power save mode with CFG-RXM.
+    configuration.mode = mode;
+    configuration.update_period_ms = TEST_UPDATE_PERIOD_MS;
+    configuration.search_period_ms = TEST_SEARCH_PERIOD_MS;
+    TEST_assert_equal(UBX_set_power_mode(&configuration), UBX_SUCCESS);
+    TEST_assert_equal(fake_gps.tx_message_count, 2);
+    TEST_assert_equal(fake_gps.tx_size_bytes, (pm2_frame_size + rxm_frame_size));
+    _TEST_check_frame(0, pm2_frame, pm2_frame_size);
+    _TEST_check_frame(pm2_frame_size, rxm_frame, rxm_frame_size);
+}
+
+/*******************************************************************/
+static void _TEST_continuous(void) {
+    // Local variables.
+    UBX_power_mode_configuration_t configuration;
+    uint8_t rxm_payload[TEST_CFG_RXM_PAYLOAD_SIZE] = { 0x08, 0x00 };
+    uint8_t rxm_frame[TEST_CFG_RXM_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t rxm_frame_size = 0;
+    _TEST_init();
+    rxm_frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_CFG, TEST_UBX_ID_CFG_RXM, rxm_payload, TEST_CFG_RXM_PAYLOAD_SIZE, rxm_frame);
+    // Only CFG-RXM is sent in continuous mode.
+    configuration.mode = UBX_POWER_MODE_CONTINUOUS;
+    configuration.update_period_ms = TEST_UPDATE_PERIOD_MS;
+    configuration.search_period_ms = TEST_SEARCH_PERIOD_MS;
+    TEST_assert_equal(UBX_set_power_mode(&configuration), UBX_SUCCESS);
+    TEST_assert_equal(fake_gps.tx_message_count, 1);
+    TEST_assert_equal(fake_gps.tx_size_bytes, rxm_frame_size);
+    _TEST_check_frame(0, rxm_frame, rxm_frame_size);
+}
+
+/*******************************************************************/
+static void _TEST_errors(void) {
+    // Local variables.
+    UBX_power_mode_configuration_t configuration;
+    _TEST_init();
+    // Nothing is sent on parameter errors.
+    TEST_assert_equal(UBX_set_power_mode(NULL), UBX_ERROR_NULL_PARAMETER);
+    configuration.mode = UBX_POWER_MODE_LAST;
+    configuration.update_period_ms = TEST_UPDATE_PERIOD_MS;
+    configuration.search_period_ms = TEST_SEARCH_PERIOD_MS;
+    TEST_assert_equal(UBX_set_power_mode(&configuration), UBX_ERROR_MESSAGE);
+    TEST_assert_equal(fake_gps.tx_message_count, 0);
+}
+
+/*** TEST UBX POWER MODE functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_power_save(UBX_POWER_MODE_CYCLIC_TRACKING, TEST_CFG_PM2_FLAGS_CYCLIC);
+    _TEST_power_save(UBX_POWER_MODE_ON_OFF, TEST_CFG_PM2_FLAGS_ON_OFF);
+    _TEST_continuous();
+    _TEST_errors();
+    return TEST_report("test_ubx_power_mode");
+}
@@ -0,0 +1,286 @@
+/*
+ * test_ubx_quality.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "neom8x.h"
+#include "neom8x_hw.h"
+#include "test.h"
+#include "types.h"
+#include "ubx.h"
+
+/*** TEST UBX QUALITY local macros ***/
+
+#define TEST_UBX_FRAME_OVERHEAD_BYTES   8
+#define TEST_UBX_CLASS_NAV              0x01
+#define TEST_UBX_ID_NAV_DOP             0x04
+#define TEST_UBX_ID_NAV_SAT             0x35
+
+#define TEST_NAV_DOP_PAYLOAD_SIZE       18
+#define TEST_NAV_SAT_HEADER_SIZE        8
+#define TEST_NAV_SAT_BLOCK_SIZE         12
+#define TEST_NAV_SAT_FLAGS_SV_USED      0x08
+
+#define TEST_SATELLITES_MAX             32
+#define TEST_STREAM_SIZE_BYTES          FAKE_GPS_REPLY_SIZE_BYTES
+
+#define TEST_GNSS_ID_GPS                0
+#define TEST_GNSS_ID_SBAS               1
+#define TEST_GNSS_ID_GALILEO            2
+#define TEST_GNSS_ID_BEIDOU             3
+#define TEST_GNSS_ID_QZSS               5
+#define TEST_GNSS_ID_GLONASS            6
+
+/*** TEST UBX QUALITY local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t gnss_id;
+    uint8_t sv_id;
+    uint8_t cno;
+    uint8_t flags;
+} TEST_satellite_t;
+
+/*** TEST UBX QUALITY local global variables ***/
+
+// Open sky recording: GPS, SBAS, Galileo, QZSS and GLONASS, some satellites without signal.
+static const TEST_satellite_t TEST_SKY_OPEN[] = {
+    { TEST_GNSS_ID_GPS, 2, 42, 0x0F },
+    { TEST_GNSS_ID_GPS, 5, 38, 0x0F },
+    { TEST_GNSS_ID_GPS, 12, 45, 0x0F },
+    { TEST_GNSS_ID_GPS, 13, 31, 0x0F },
+    { TEST_GNSS_ID_GPS, 15, 0, 0x01 },
+    { TEST_GNSS_ID_GPS, 18, 27, 0x04 },
+    { TEST_GNSS_ID_GPS, 20, 40, 0x0F },
+    { TEST_GNSS_ID_GPS, 25, 36, 0x0F },
+    { TEST_GNSS_ID_GPS, 29, 22, 0x04 },
+    { TEST_GNSS_ID_SBAS, 123, 35, 0x07 },
+    { TEST_GNSS_ID_GALILEO, 1, 39, 0x0F },
+    { TEST_GNSS_ID_GALILEO, 7, 0, 0x01 },
+    { TEST_GNSS_ID_GALILEO, 19, 33, 0x0F },
+    { TEST_GNSS_ID_GALILEO, 26, 28, 0x04 },
+    { TEST_GNSS_ID_QZSS, 193, 30, 0x04 },
+    { TEST_GNSS_ID_GLONASS, 65, 34, 0x0F },
+    { TEST_GNSS_ID_GLONASS, 66, 29, 0x04 },
+    { TEST_GNSS_ID_GLONASS, 72, 41, 0x0F },
+    { TEST_GNSS_ID_GLONASS, 80, 0, 0x01 }
+};
+// Urban canyon recording: few weak satellites.
+static const TEST_satellite_t TEST_SKY_URBAN[] = {
+    { TEST_GNSS_ID_GPS, 10, 24, 0x0C },
+    { TEST_GNSS_ID_GPS, 23, 19, 0x04 },
+    { TEST_GNSS_ID_BEIDOU, 11, 21, 0x0C },
+    { TEST_GNSS_ID_BEIDOU, 14, 0, 0x00 },
+    { TEST_GNSS_ID_GLONASS, 70, 26, 0x0C }
+};
+// NMEA sentence output before the polled frame.
+static const char_t TEST_NMEA_SENTENCE[] = "$GNGSA,A,3,02,05,12,13,20,25,,,,,,,1.52,0.91,1.22,1*0E\r\n";
+
+/*** TEST UBX QUALITY local functions ***/
+
+/*******************************************************************/
+static void _TEST_nmea_rx_callback(uint8_t data) {
+    UNUSED(data);
+}
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Local variables.
+    NEOM8X_HW_configuration_t configuration;
+    // Reset fakes and init interface.
+    FAKE_reset();
+    configuration.uart_baud_rate = 9600;
+    configuration.rx_irq_callback = &_TEST_nmea_rx_callback;
+    TEST_assert_equal(NEOM8X_HW_init(&configuration), NEOM8X_SUCCESS);
+}
+
+/*******************************************************************/
+static void _TEST_add_dop_reply(uint16_t pdop, uint16_t hdop) {
+    // Local variables.
+    uint8_t payload[TEST_NAV_DOP_PAYLOAD_SIZE] = { 0x00 };
+    uint8_t frame[TEST_NAV_DOP_PAYLOAD_SIZE + TEST_UBX_FRAME_OVERHEAD_BYTES];
+    uint32_t frame_size = 0;
+    // Build NAV-DOP.
+    payload[6] = (uint8_t) (pdop & 0xFF);
+    payload[7] = (uint8_t) (pdop >> 8);
+    payload[12] = (uint8_t) (hdop & 0xFF);
+    payload[13] = (uint8_t) (hdop >> 8);
+    frame_size = FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_DOP, payload, TEST_NAV_DOP_PAYLOAD_SIZE, frame);
+    FAKE_gps_add_reply(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_DOP, frame, frame_size);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_build_nav_sat(const TEST_satellite_t* satellites, uint8_t number_of_satellites, uint8_t* frame) {
+    // Local variables.
+    uint8_t payload[TEST_NAV_SAT_HEADER_SIZE + (TEST_SATELLITES_MAX * TEST_NAV_SAT_BLOCK_SIZE)] = { 0x00 };
+    uint8_t* block = NULL;
+    uint8_t idx = 0;
+    // Header: version 1 and number of satellites.
+    payload[4] = 0x01;
+    payload[5] = number_of_satellites;
+    // Satellite blocks.
+    for (idx = 0; idx < number_of_satellites; idx++) {
+        block = &(payload[TEST_NAV_SAT_HEADER_SIZE + (idx * TEST_NAV_SAT_BLOCK_SIZE)]);
+        block[0] = satellites[idx].gnss_id;
+        block[1] = satellites[idx].sv_id;
+        block[2] = satellites[idx].cno;
+        block[3] = 45;
+        block[8] = satellites[idx].flags;
+    }
+    return FAKE_gps_build_ubx_frame(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_SAT, payload, (uint16_t) (TEST_NAV_SAT_HEADER_SIZE + (number_of_satellites * TEST_NAV_SAT_BLOCK_SIZE)), frame);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_append_nmea(uint8_t* stream) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Copy sentence without null character.
+    for (idx = 0; idx < (sizeof(TEST_NMEA_SENTENCE) - 1); idx++) {
+        stream[idx] = (uint8_t) TEST_NMEA_SENTENCE[idx];
+    }
+    return idx;
+}
+
+/*******************************************************************/
+static void _TEST_compute_expected(const TEST_satellite_t* satellites, uint8_t number_of_satellites, UBX_quality_t* expected) {
+    // Local variables.
+    uint32_t cno_sum[UBX_CONSTELLATION_LAST] = { 0 };
+    uint32_t cno_count[UBX_CONSTELLATION_LAST] = { 0 };
+    UBX_constellation_t constellation = UBX_CONSTELLATION_LAST;
+    uint8_t idx = 0;
+    // Reset.
+    expected->satellites_used = 0;
+    expected->satellites_tracked = 0;
+    for (idx = 0; idx < UBX_CONSTELLATION_LAST; idx++) {
+        expected->cno_max[idx] = 0;
+        expected->cno_mean[idx] = 0;
+    }
+    // Reference statistics.
+    for (idx = 0; idx < number_of_satellites; idx++) {
+        if ((satellites[idx].flags & TEST_NAV_SAT_FLAGS_SV_USED) != 0) {
+            expected->satellites_used++;
+        }
+        if (satellites[idx].cno == 0) continue;
+        expected->satellites_tracked++;
+        switch (satellites[idx].gnss_id) {
+        case TEST_GNSS_ID_GPS:
+            constellation = UBX_CONSTELLATION_GPS;
+            break;
+        case TEST_GNSS_ID_GLONASS:
+            constellation = UBX_CONSTELLATION_GLONASS;
+            break;
+        case TEST_GNSS_ID_GALILEO:
+            constellation = UBX_CONSTELLATION_GALILEO;
+            break;
+        case TEST_GNSS_ID_BEIDOU:
+            constellation = UBX_CONSTELLATION_BEIDOU;
+            break;
+        default:
+            constellation = UBX_CONSTELLATION_LAST;
+            break;
+        }
+        if (constellation >= UBX_CONSTELLATION_LAST) continue;
+        if (satellites[idx].cno > expected->cno_max[constellation]) {
+            expected->cno_max[constellation] = satellites[idx].cno;
+        }
+        cno_sum[constellation] += satellites[idx].cno;
+        cno_count[constellation]++;
+    }
+    for (idx = 0; idx < UBX_CONSTELLATION_LAST; idx++) {
+        expected->cno_mean[idx] = (cno_count[idx] == 0) ? 0 : (uint8_t) (cno_sum[idx] / cno_count[idx]);
+    }
+}
+
+/*******************************************************************/
+static void _TEST_check_quality(UBX_quality_t* actual, UBX_quality_t* expected) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Compare all fields.
+    TEST_assert_equal(actual->satellites_used, expected->satellites_used);
+    TEST_assert_equal(actual->satellites_tracked, expected->satellites_tracked);
+    TEST_assert_equal(actual->pdop, expected->pdop);
+    TEST_assert_equal(actual->hdop, expected->hdop);
+    for (idx = 0; idx < UBX_CONSTELLATION_LAST; idx++) {
+        TEST_assert_equal(actual->cno_max[idx], expected->cno_max[idx]);
+        TEST_assert_equal(actual->cno_mean[idx], expected->cno_mean[idx]);
+    }
+}
+
+/*******************************************************************/
+static void _TEST_open_sky(void) {
+    // Local variables.
+    uint8_t stream[TEST_STREAM_SIZE_BYTES];
+    uint32_t stream_size = 0;
+    uint8_t number_of_satellites = (uint8_t) (sizeof(TEST_SKY_OPEN) / sizeof(TEST_satellite_t));
+    UBX_quality_t expected;
+    UBX_quality_t ubx_quality;
+    _TEST_init();
+    // NMEA output followed by a NAV-SAT longer than the receive buffer.
+    stream_size = _TEST_append_nmea(stream);
+    stream_size += _TEST_build_nav_sat(TEST_SKY_OPEN, number_of_satellites, &(stream[stream_size]));
+    FAKE_gps_add_reply(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_SAT, stream, stream_size);
+    _TEST_add_dop_reply(152, 91);
+    // Decode.
+    _TEST_compute_expected(TEST_SKY_OPEN, number_of_satellites, &expected);
+    expected.pdop = 152;
+    expected.hdop = 91;
+    TEST_assert_equal(UBX_get_quality(&ubx_quality), UBX_SUCCESS);
+    _TEST_check_quality(&ubx_quality, &expected);
+    // Spot check of the recording.
+    TEST_assert_equal(ubx_quality.satellites_used, 10);
+    TEST_assert_equal(ubx_quality.satellites_tracked, 16);
+    TEST_assert_equal(ubx_quality.cno_max[UBX_CONSTELLATION_GPS], 45);
+    TEST_assert_equal(ubx_quality.cno_mean[UBX_CONSTELLATION_GALILEO], 33);
+    TEST_assert_equal(ubx_quality.cno_max[UBX_CONSTELLATION_BEIDOU], 0);
+    TEST_assert_equal(fake_gps.rx_lost_bytes, 0);
+}
+
+/*******************************************************************/
+static void _TEST_corrupted_frame(void) {
+    // Local variables.
+    uint8_t stream[TEST_STREAM_SIZE_BYTES];
+    uint32_t stream_size = 0;
+    uint32_t frame_size = 0;
+    uint8_t number_of_satellites = (uint8_t) (sizeof(TEST_SKY_URBAN) / sizeof(TEST_satellite_t));
+    UBX_quality_t expected;
+    UBX_quality_t ubx_quality;
+    _TEST_init();
+    // Open sky frame with a transmission error, then the urban canyon frame.
+    frame_size = _TEST_build_nav_sat(TEST_SKY_OPEN, (uint8_t) (sizeof(TEST_SKY_OPEN) / sizeof(TEST_satellite_t)), stream);
+    stream[frame_size - 1] ^= 0xFF;
+    stream_size = frame_size;
+    stream_size += _TEST_build_nav_sat(TEST_SKY_URBAN, number_of_satellites, &(stream[stream_size]));
+    FAKE_gps_add_reply(TEST_UBX_CLASS_NAV, TEST_UBX_ID_NAV_SAT, stream, stream_size);
+    _TEST_add_dop_reply(480, 320);
+    // Statistics of the corrupted frame must not be committed.
+    _TEST_compute_expected(TEST_SKY_URBAN, number_of_satellites, &expected);
+    expected.pdop = 480;
+    expected.hdop = 320;
+    TEST_assert_equal(UBX_get_quality(&ubx_quality), UBX_SUCCESS);
+    _TEST_check_quality(&ubx_quality, &expected);
+    TEST_assert_equal(ubx_quality.satellites_used, 3);
+    TEST_assert_equal(ubx_quality.cno_mean[UBX_CONSTELLATION_BEIDOU], 21);
+}
+
+/*******************************************************************/
+static void _TEST_no_reply(void) {
+    // Local variables.
+    UBX_quality_t ubx_quality;
+    _TEST_init();
+    // Only NAV-DOP is answered.
+    _TEST_add_dop_reply(99, 99);
+    TEST_assert_equal(UBX_get_quality(&ubx_quality), UBX_ERROR_TIMEOUT);
+}
+
+/*** TEST UBX QUALITY functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_open_sky();
+    _TEST_corrupted_frame();
+    _TEST_no_reply();
+    return TEST_report("test_ubx_quality");
+}
@@ -0,0 +1,196 @@
+/*
+ * test_uhfm_per.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "node.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "uhfm.h"
+#include "una.h"
+
+/*** TEST UHFM PER local macros ***/
+
+#define TEST_PER_PERIOD_SECONDS_MIN     10
+#define TEST_LOOP_PERIOD_MS             1000
+#define TEST_LOOP_COUNT_MAX             1000
+
+/*** TEST UHFM PER local functions ***/
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Reset fakes and node.
+    FAKE_reset();
+    NODE_init();
+    // Uplink bit rate of the test frames.
+    SWREG_write_field(&reg_value, &reg_mask, 0b01, UHFM_REGISTER_CONFIGURATION_0_MASK_BR);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_CONFIGURATION_0, reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static void _TEST_start_campaign(uint16_t number_of_iterations, SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t test_mode_reference, uint8_t bidirectional, uint32_t period_seconds) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Select RFP test mode.
+    SWREG_write_field(&reg_value, &reg_mask, (uint32_t) test_mode_reference, UHFM_REGISTER_CONTROL_1_MASK_RFP_TEST_MODE);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_CONTROL_1, reg_value, reg_mask);
+    // Configure and trigger campaign as the bus master does.
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, number_of_iterations, UHFM_REGISTER_PER_CONFIGURATION_MASK_NUMBER_OF_ITERATIONS);
+    SWREG_write_field(&reg_value, &reg_mask, bidirectional, UHFM_REGISTER_PER_CONFIGURATION_MASK_MODE);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_seconds(period_seconds), UHFM_REGISTER_PER_CONFIGURATION_MASK_PERIOD);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_PER_CONFIGURATION, reg_value, reg_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_PER_CONTROL, UHFM_REGISTER_PER_CONTROL_MASK_PTRG, UHFM_REGISTER_PER_CONTROL_MASK_PTRG);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return SWREG_read_field(reg_value, field_mask);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_run_main_loop(void) {
+    // Local variables.
+    uint32_t loop_count = 0;
+    uint32_t test_mode_count = 0;
+    // Run main loop until the end of the campaign.
+    for (loop_count = 0; loop_count < TEST_LOOP_COUNT_MAX; loop_count++) {
+        test_mode_count = fake_radio.test_mode_count;
+        NODE_process();
+        // Each process call must perform at most one test mode, and no network message is sent.
+        TEST_assert(fake_radio.test_mode_count <= (test_mode_count + 1));
+        TEST_assert_equal(fake_radio.message_count, 0);
+        if (_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_STATUS, UHFM_REGISTER_PER_STATUS_MASK_PRST) == 0) break;
+        FAKE_advance_milliseconds(TEST_LOOP_PERIOD_MS);
+    }
+    return loop_count;
+}
+
+/*******************************************************************/
+static void _TEST_default_configuration(void) {
+    // Local variables.
+    uint32_t period_field = 0;
+    _TEST_init();
+    // Default configuration must run a finite campaign with a non-zero period.
+    TEST_assert(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_CONFIGURATION, UHFM_REGISTER_PER_CONFIGURATION_MASK_NUMBER_OF_ITERATIONS) != 0);
+    period_field = _TEST_read_field(UHFM_REGISTER_ADDRESS_PER_CONFIGURATION, UHFM_REGISTER_PER_CONFIGURATION_MASK_PERIOD);
+    TEST_assert(UNA_get_seconds(period_field) >= TEST_PER_PERIOD_SECONDS_MIN);
+}
+
+/*******************************************************************/
+static void _TEST_minimum_period(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    uint32_t period_field = 0;
+    _TEST_init();
+    // Request back to back iterations.
+    _TEST_start_campaign(3, SIGFOX_EP_ADDON_RFP_API_TEST_MODE_C, 0, 0);
+    // Effective period is reported in the configuration register.
+    period_field = _TEST_read_field(UHFM_REGISTER_ADDRESS_PER_CONFIGURATION, UHFM_REGISTER_PER_CONFIGURATION_MASK_PERIOD);
+    TEST_assert_equal(UNA_get_seconds(period_field), TEST_PER_PERIOD_SECONDS_MIN);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_STATUS, UHFM_REGISTER_PER_STATUS_MASK_PRST), 1);
+    // Start is only armed from the register write: no test frame is sent from the bus access.
+    TEST_assert_equal(fake_radio.test_mode_count, 0);
+    _TEST_run_main_loop();
+    // Check campaign result.
+    TEST_assert_equal(fake_radio.test_mode_count, 3);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_STATUS, UHFM_REGISTER_PER_STATUS_MASK_PDNE), 1);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_STATUS, UHFM_REGISTER_PER_STATUS_MASK_PERR), 0);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_STATUS, UHFM_REGISTER_PER_STATUS_MASK_ITERATION), 3);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_DATA_0, UHFM_REGISTER_PER_DATA_0_MASK_UL_FRAME_COUNT), 3);
+    // Iterations run the selected test mode.
+    for (idx = 0; idx < fake_radio.test_mode_count; idx++) {
+        TEST_assert_equal(fake_radio.test_modes[idx].test_mode_reference, SIGFOX_EP_ADDON_RFP_API_TEST_MODE_C);
+        TEST_assert_equal(fake_radio.test_modes[idx].ul_bit_rate, 0b01);
+    }
+    // Node must be released for at least the minimum period between two test modes.
+    for (idx = 1; idx < fake_radio.test_mode_count; idx++) {
+        TEST_assert((fake_radio.test_modes[idx].start_time_seconds - fake_radio.test_modes[idx - 1].end_time_seconds) >= TEST_PER_PERIOD_SECONDS_MIN);
+    }
+}
+
+/*******************************************************************/
+static void _TEST_bidirectional(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    _TEST_init();
+    // Second downlink is lost, third one is received with a CRC error.
+    fake_radio.dl_loss_mask = 0b0010;
+    fake_radio.dl_crc_error_mask = 0b0100;
+    fake_radio.dl_rssi_dbm[0] = -100;
+    fake_radio.dl_rssi_dbm[2] = -80;
+    fake_radio.dl_rssi_dbm[3] = -90;
+    _TEST_start_campaign(4, SIGFOX_EP_ADDON_RFP_API_TEST_MODE_F, 1, 30);
+    _TEST_run_main_loop();
+    // Check downlink statistics: missed and rejected frames are counted separately.
+    TEST_assert_equal(fake_radio.test_mode_count, 4);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_STATUS, UHFM_REGISTER_PER_STATUS_MASK_PDNE), 1);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_DATA_0, UHFM_REGISTER_PER_DATA_0_MASK_UL_FRAME_COUNT), 4);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_DATA_0, UHFM_REGISTER_PER_DATA_0_MASK_DL_FRAME_COUNT), 2);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_DATA_1, UHFM_REGISTER_PER_DATA_1_MASK_DL_ERROR_COUNT), 1);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_DATA_2, UHFM_REGISTER_PER_DATA_2_MASK_DL_CRC_ERROR_COUNT), 1);
+    // Rejected frame is not part of the RSSI statistics.
+    TEST_assert_equal(UNA_get_dbm(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_DATA_1, UHFM_REGISTER_PER_DATA_1_MASK_DL_RSSI_MIN)), -100);
+    TEST_assert_equal(UNA_get_dbm(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_DATA_1, UHFM_REGISTER_PER_DATA_1_MASK_DL_RSSI_MAX)), -90);
+    TEST_assert_equal(UNA_get_dbm(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_DATA_2, UHFM_REGISTER_PER_DATA_2_MASK_DL_RSSI_MEAN)), -95);
+    TEST_assert_equal(UNA_get_dbm(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_DATA_2, UHFM_REGISTER_PER_DATA_2_MASK_DL_RSSI_LAST)), -90);
+    // Bus is blocked at most for one test frame and downlink window, configured period above the minimum is kept.
+    for (idx = 0; idx < fake_radio.test_mode_count; idx++) {
+        TEST_assert((fake_radio.test_modes[idx].end_time_seconds - fake_radio.test_modes[idx].start_time_seconds) <= (fake_radio.ul_frame_duration_seconds + fake_radio.dl_window_duration_seconds));
+    }
+    for (idx = 1; idx < fake_radio.test_mode_count; idx++) {
+        TEST_assert((fake_radio.test_modes[idx].start_time_seconds - fake_radio.test_modes[idx - 1].end_time_seconds) >= 30);
+    }
+}
+
+/*******************************************************************/
+static void _TEST_radio_error(void) {
+    _TEST_init();
+    fake_radio.send_error = 1;
+    _TEST_start_campaign(5, SIGFOX_EP_ADDON_RFP_API_TEST_MODE_C, 0, 10);
+    _TEST_run_main_loop();
+    // Campaign is aborted on the first failure.
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_STATUS, UHFM_REGISTER_PER_STATUS_MASK_PERR), 1);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_STATUS, UHFM_REGISTER_PER_STATUS_MASK_PDNE), 0);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_DATA_0, UHFM_REGISTER_PER_DATA_0_MASK_UL_FRAME_COUNT), 0);
+}
+
+/*******************************************************************/
+static void _TEST_stop(void) {
+    _TEST_init();
+    _TEST_start_campaign(5, SIGFOX_EP_ADDON_RFP_API_TEST_MODE_C, 0, 10);
+    NODE_process();
+    TEST_assert_equal(fake_radio.test_mode_count, 1);
+    // Abort campaign from the bus.
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_PER_CONTROL, UHFM_REGISTER_PER_CONTROL_MASK_PSTP, UHFM_REGISTER_PER_CONTROL_MASK_PSTP);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_PER_STATUS, UHFM_REGISTER_PER_STATUS_MASK_PRST), 0);
+    FAKE_advance_milliseconds(60000);
+    NODE_process();
+    TEST_assert_equal(fake_radio.test_mode_count, 1);
+}
+
+/*** TEST UHFM PER functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_default_configuration();
+    _TEST_minimum_period();
+    _TEST_bidirectional();
+    _TEST_radio_error();
+    _TEST_stop();
+    return TEST_report("test_uhfm_per");
+}
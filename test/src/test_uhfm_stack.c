@@ -0,0 +1,217 @@
+/*
+ * test_uhfm_stack.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "node.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "uhfm.h"
+#include "una.h"
+
+#include <stdio.h>
+#include <ucontext.h>
+
+/*** TEST UHFM STACK local macros ***/
+
+#define TEST_STACK_SIZE_BYTES           65536
+#define TEST_STACK_PATTERN              0xA5
+// Host (x86-64, -O0) peak of a register access through the node layer, measured with this test.
+#define TEST_STACK_BASELINE_MAX_BYTES   512
+// Stack used by a radio mode on top of a register access: Sigfox and RF structures must live in the work arena.
+#define TEST_STACK_RADIO_MODE_MAX_BYTES 256
+
+#define TEST_RF_FREQUENCY_HZ            868130000
+#define TEST_TX_POWER_DBM               14
+#define TEST_PER_PERIOD_SECONDS         10
+
+/*** TEST UHFM STACK local structures ***/
+
+/*******************************************************************/
+typedef void (*TEST_scenario_cb_t)(void);
+
+/*******************************************************************/
+typedef struct {
+    const char_t* name;
+    TEST_scenario_cb_t scenario;
+} TEST_scenario_t;
+
+/*** TEST UHFM STACK local global variables ***/
+
+static uint8_t test_stack[TEST_STACK_SIZE_BYTES] __attribute__((aligned(16)));
+static ucontext_t test_main_context;
+static ucontext_t test_scenario_context;
+static TEST_scenario_cb_t test_scenario = NULL;
+
+/*** TEST UHFM STACK local functions ***/
+
+/*******************************************************************/
+static void _TEST_write_control_1(uint32_t reg_value, uint32_t reg_mask) {
+    TEST_assert_equal(NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_CONTROL_1, reg_value, reg_mask), NODE_SUCCESS);
+}
+
+/*******************************************************************/
+static void _TEST_scenario_register_read(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_STATUS_1, &reg_value);
+}
+
+/*******************************************************************/
+static void _TEST_scenario_strg(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Bidirectional application message with a full payload.
+    SWREG_write_field(&reg_value, &reg_mask, 1, UHFM_REGISTER_CONTROL_1_MASK_BF);
+    SWREG_write_field(&reg_value, &reg_mask, 12, UHFM_REGISTER_CONTROL_1_MASK_UL_PAYLOAD_SIZE);
+    SWREG_write_field(&reg_value, &reg_mask, 1, UHFM_REGISTER_CONTROL_1_MASK_STRG);
+    _TEST_write_control_1(reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static void _TEST_scenario_control_message(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Keep alive control message.
+    SWREG_write_field(&reg_value, &reg_mask, 1, UHFM_REGISTER_CONTROL_1_MASK_CMSG);
+    SWREG_write_field(&reg_value, &reg_mask, 1, UHFM_REGISTER_CONTROL_1_MASK_STRG);
+    _TEST_write_control_1(reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static void _TEST_scenario_ttrg(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, 1, UHFM_REGISTER_CONTROL_1_MASK_TTRG);
+    _TEST_write_control_1(reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static void _TEST_scenario_cwen(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Continuous wave on then off.
+    SWREG_write_field(&reg_value, &reg_mask, 1, UHFM_REGISTER_CONTROL_1_MASK_CWEN);
+    _TEST_write_control_1(reg_value, reg_mask);
+    reg_value = 0;
+    _TEST_write_control_1(reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static void _TEST_scenario_rsen(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // RSSI measurement on then off.
+    SWREG_write_field(&reg_value, &reg_mask, 1, UHFM_REGISTER_CONTROL_1_MASK_RSEN);
+    _TEST_write_control_1(reg_value, reg_mask);
+    reg_value = 0;
+    _TEST_write_control_1(reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static void _TEST_scenario_per(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Single bidirectional RFP test mode run from the main loop.
+    SWREG_write_field(&reg_value, &reg_mask, SIGFOX_EP_ADDON_RFP_API_TEST_MODE_F, UHFM_REGISTER_CONTROL_1_MASK_RFP_TEST_MODE);
+    _TEST_write_control_1(reg_value, reg_mask);
+    reg_value = 0;
+    reg_mask = 0;
+    SWREG_write_field(&reg_value, &reg_mask, 1, UHFM_REGISTER_PER_CONFIGURATION_MASK_NUMBER_OF_ITERATIONS);
+    SWREG_write_field(&reg_value, &reg_mask, 1, UHFM_REGISTER_PER_CONFIGURATION_MASK_MODE);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_seconds(TEST_PER_PERIOD_SECONDS), UHFM_REGISTER_PER_CONFIGURATION_MASK_PERIOD);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_PER_CONFIGURATION, reg_value, reg_mask);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_PER_CONTROL, UHFM_REGISTER_PER_CONTROL_MASK_PTRG, UHFM_REGISTER_PER_CONTROL_MASK_PTRG);
+    TEST_assert_equal(NODE_process(), NODE_SUCCESS);
+}
+
+/*******************************************************************/
+static void _TEST_scenario_entry(void) {
+    test_scenario();
+}
+
+/*******************************************************************/
+static uint32_t _TEST_get_stack_peak(TEST_scenario_cb_t scenario) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Paint the scenario stack.
+    for (idx = 0; idx < TEST_STACK_SIZE_BYTES; idx++) {
+        test_stack[idx] = TEST_STACK_PATTERN;
+    }
+    // Run scenario on its own stack.
+    test_scenario = scenario;
+    TEST_assert_equal(getcontext(&test_scenario_context), 0);
+    test_scenario_context.uc_stack.ss_sp = test_stack;
+    test_scenario_context.uc_stack.ss_size = TEST_STACK_SIZE_BYTES;
+    test_scenario_context.uc_link = &test_main_context;
+    makecontext(&test_scenario_context, _TEST_scenario_entry, 0);
+    TEST_assert_equal(swapcontext(&test_main_context, &test_scenario_context), 0);
+    // Stack grows downward: the peak is the deepest overwritten byte.
+    for (idx = 0; idx < TEST_STACK_SIZE_BYTES; idx++) {
+        if (test_stack[idx] != TEST_STACK_PATTERN) break;
+    }
+    return (TEST_STACK_SIZE_BYTES - idx);
+}
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Reset fakes and node on the main stack.
+    FAKE_reset();
+    NODE_init();
+    // Radio test parameters.
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_RADIO_TEST_0, TEST_RF_FREQUENCY_HZ, UHFM_REGISTER_RADIO_TEST_0_MASK_RF_FREQUENCY);
+    SWREG_write_field(&reg_value, &reg_mask, UNA_convert_dbm(TEST_TX_POWER_DBM), UHFM_REGISTER_RADIO_TEST_1_MASK_TX_POWER);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_RADIO_TEST_1, reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static void _TEST_stack_peaks(void) {
+    // Local variables.
+    const TEST_scenario_t scenarios[] = {
+        { "strg", &_TEST_scenario_strg },
+        { "cmsg", &_TEST_scenario_control_message },
+        { "ttrg", &_TEST_scenario_ttrg },
+        { "cwen", &_TEST_scenario_cwen },
+        { "rsen", &_TEST_scenario_rsen },
+        { "per", &_TEST_scenario_per }
+    };
+    uint32_t baseline_bytes = 0;
+    uint32_t peak_bytes = 0;
+    uint32_t idx = 0;
+    // Reference path.
+    _TEST_init();
+    baseline_bytes = _TEST_get_stack_peak(&_TEST_scenario_register_read);
+    printf("%-10s %6u bytes\n", "register", baseline_bytes);
+    TEST_assert((baseline_bytes > 0) && (baseline_bytes <= TEST_STACK_BASELINE_MAX_BYTES));
+    // Radio modes.
+    for (idx = 0; idx < (sizeof(scenarios) / sizeof(TEST_scenario_t)); idx++) {
+        _TEST_init();
+        peak_bytes = _TEST_get_stack_peak(scenarios[idx].scenario);
+        printf("%-10s %6u bytes\n", scenarios[idx].name, peak_bytes);
+        TEST_assert(peak_bytes <= (baseline_bytes + TEST_STACK_RADIO_MODE_MAX_BYTES));
+    }
+    // Last mode (PER campaign iteration) must have run on the measured stack.
+    TEST_assert(fake_radio.test_mode_count != 0);
+}
+
+/*** TEST UHFM STACK functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_stack_peaks();
+    return TEST_report("test_uhfm_stack");
+}
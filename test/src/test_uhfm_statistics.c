@@ -0,0 +1,110 @@
+/*
+ * test_uhfm_statistics.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "fake.h"
+#include "node.h"
+#include "swreg.h"
+#include "test.h"
+#include "types.h"
+#include "uhfm.h"
+#include "una.h"
+
+/*** TEST UHFM STATISTICS local macros ***/
+
+#define TEST_STATISTICS_SAVE_PERIOD_SECONDS 3600
+#define TEST_NUMBER_OF_MESSAGES             5
+
+/*** TEST UHFM STATISTICS local functions ***/
+
+/*******************************************************************/
+static uint32_t _TEST_read_field(uint8_t reg_addr, uint32_t field_mask) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    // Read register.
+    NODE_read_register(NODE_REQUEST_SOURCE_EXTERNAL, reg_addr, &reg_value);
+    return SWREG_read_field(reg_value, field_mask);
+}
+
+/*******************************************************************/
+static void _TEST_send_message(void) {
+    // Local variables.
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    // Trigger a 1-byte uplink message as the bus master does.
+    SWREG_write_field(&reg_value, &reg_mask, 1, UHFM_REGISTER_CONTROL_1_MASK_UL_PAYLOAD_SIZE);
+    SWREG_write_field(&reg_value, &reg_mask, 1, UHFM_REGISTER_CONTROL_1_MASK_STRG);
+    NODE_write_register(NODE_REQUEST_SOURCE_EXTERNAL, UHFM_REGISTER_ADDRESS_CONTROL_1, reg_value, reg_mask);
+}
+
+/*******************************************************************/
+static void _TEST_init(void) {
+    // Reset fakes and node.
+    FAKE_reset();
+    NODE_init();
+    // Skip the first save of the boot.
+    FAKE_set_uptime_seconds(1);
+}
+
+/*******************************************************************/
+static void _TEST_periodic_save(void) {
+    // Local variables.
+    uint32_t nvm_write_count = 0;
+    uint32_t idx = 0;
+    _TEST_init();
+    nvm_write_count = FAKE_get_nvm_write_count();
+    // Messages must not write the EEPROM.
+    for (idx = 0; idx < TEST_NUMBER_OF_MESSAGES; idx++) {
+        _TEST_send_message();
+        NODE_process();
+        FAKE_advance_milliseconds(60000);
+    }
+    TEST_assert_equal(fake_radio.message_count, TEST_NUMBER_OF_MESSAGES);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_STATISTICS_0, UHFM_REGISTER_STATISTICS_0_MASK_UL_MESSAGE_COUNT), TEST_NUMBER_OF_MESSAGES);
+    TEST_assert_equal(FAKE_get_nvm_write_count(), nvm_write_count);
+    // Counters are saved once the period is over.
+    FAKE_set_uptime_seconds(TEST_STATISTICS_SAVE_PERIOD_SECONDS);
+    NODE_process();
+    TEST_assert(FAKE_get_nvm_write_count() > nvm_write_count);
+    // Nothing is written again when the counters did not change.
+    nvm_write_count = FAKE_get_nvm_write_count();
+    FAKE_set_uptime_seconds(2 * TEST_STATISTICS_SAVE_PERIOD_SECONDS);
+    NODE_process();
+    TEST_assert_equal(FAKE_get_nvm_write_count(), nvm_write_count);
+    // Saved counters are restored at boot.
+    NODE_init();
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_STATISTICS_0, UHFM_REGISTER_STATISTICS_0_MASK_UL_MESSAGE_COUNT), TEST_NUMBER_OF_MESSAGES);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_STATISTICS_0, UHFM_REGISTER_STATISTICS_0_MASK_UL_SUCCESS_COUNT), TEST_NUMBER_OF_MESSAGES);
+}
+
+/*******************************************************************/
+static void _TEST_open_error(void) {
+    _TEST_init();
+    // Library cannot be opened: no message is sent.
+    fake_radio.open_error = 1;
+    _TEST_send_message();
+    NODE_process();
+    TEST_assert_equal(fake_radio.message_count, 0);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_HISTORY_STATUS, UHFM_REGISTER_HISTORY_STATUS_MASK_COUNT), 0);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_STATISTICS_0, UHFM_REGISTER_STATISTICS_0_MASK_UL_MESSAGE_COUNT), 0);
+    // Failed transmission is still recorded.
+    fake_radio.open_error = 0;
+    fake_radio.send_error = 1;
+    _TEST_send_message();
+    NODE_process();
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_HISTORY_STATUS, UHFM_REGISTER_HISTORY_STATUS_MASK_COUNT), 1);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_STATISTICS_0, UHFM_REGISTER_STATISTICS_0_MASK_UL_MESSAGE_COUNT), 1);
+    TEST_assert_equal(_TEST_read_field(UHFM_REGISTER_ADDRESS_STATISTICS_0, UHFM_REGISTER_STATISTICS_0_MASK_UL_SUCCESS_COUNT), 0);
+}
+
+/*** TEST UHFM STATISTICS functions ***/
+
+/*******************************************************************/
+int main(void) {
+    _TEST_periodic_save();
+    _TEST_open_error();
+    return TEST_report("test_uhfm_statistics");
+}